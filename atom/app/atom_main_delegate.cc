@@ -12,6 +12,7 @@
 #include "atom/browser/relauncher.h"
 #include "atom/common/google_api_key.h"
 #include "atom/common/options_switches.h"
+#include "atom/common/startup_timings.h"
 #include "atom/renderer/atom_renderer_client.h"
 #include "atom/renderer/atom_sandboxed_renderer_client.h"
 #include "atom/utility/atom_content_utility_client.h"
@@ -53,6 +54,9 @@ AtomMainDelegate::~AtomMainDelegate() {
 bool AtomMainDelegate::BasicStartupComplete(int* exit_code) {
   auto command_line = base::CommandLine::ForCurrentProcess();
 
+  if (IsBrowserProcess(command_line))
+    startup_timings::Record(startup_timings::kMainDelegateCreated);
+
   logging::LoggingSettings settings;
 #if defined(OS_WIN)
   // On Windows the terminal returns immediately, so we add a new line to
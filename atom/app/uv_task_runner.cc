@@ -4,28 +4,32 @@
 
 #include "atom/app/uv_task_runner.h"
 
-#include "base/stl_util.h"
+#include <utility>
 
 namespace atom {
 
-UvTaskRunner::UvTaskRunner(uv_loop_t* loop) : loop_(loop) {
+UvTaskRunner::UvTaskRunner(uv_loop_t* loop)
+    : loop_(loop),
+      timer_(new uv_timer_t) {
+  timer_->data = this;
+  uv_timer_init(loop_, timer_);
 }
 
 UvTaskRunner::~UvTaskRunner() {
-  for (auto& iter : tasks_) {
-    uv_unref(reinterpret_cast<uv_handle_t*>(iter.first));
-    delete iter.first;
-  }
+  uv_unref(reinterpret_cast<uv_handle_t*>(timer_));
+  delete timer_;
 }
 
 bool UvTaskRunner::PostDelayedTask(const tracked_objects::Location& from_here,
                                    const base::Closure& task,
                                    base::TimeDelta delay) {
-  auto* timer = new uv_timer_t;
-  timer->data = this;
-  uv_timer_init(loop_, timer);
-  uv_timer_start(timer, UvTaskRunner::OnTimeout, delay.InMilliseconds(), 0);
-  tasks_[timer] = task;
+  base::TimeTicks run_time = base::TimeTicks::Now() + delay;
+  bool is_earliest = tasks_.empty() || run_time < tasks_.begin()->first;
+  tasks_.insert(std::make_pair(run_time, task));
+  // Only a task that becomes the new front of the queue needs the shared
+  // timer re-armed; everything else just waits its turn.
+  if (is_earliest)
+    ScheduleWakeup();
   return true;
 }
 
@@ -40,21 +44,32 @@ bool UvTaskRunner::PostNonNestableDelayedTask(
   return PostDelayedTask(from_here, task, delay);
 }
 
-// static
-void UvTaskRunner::OnTimeout(uv_timer_t* timer) {
-  UvTaskRunner* self = static_cast<UvTaskRunner*>(timer->data);
-  if (!ContainsKey(self->tasks_, timer))
+void UvTaskRunner::ScheduleWakeup() {
+  if (tasks_.empty()) {
+    uv_timer_stop(timer_);
     return;
+  }
 
-  self->tasks_[timer].Run();
-  self->tasks_.erase(timer);
-  uv_timer_stop(timer);
-  uv_close(reinterpret_cast<uv_handle_t*>(timer), UvTaskRunner::OnClose);
+  base::TimeDelta delay = tasks_.begin()->first - base::TimeTicks::Now();
+  if (delay < base::TimeDelta())
+    delay = base::TimeDelta();
+  uv_timer_start(timer_, &UvTaskRunner::OnTimeout, delay.InMilliseconds(), 0);
 }
 
 // static
-void UvTaskRunner::OnClose(uv_handle_t* handle) {
-  delete reinterpret_cast<uv_timer_t*>(handle);
+void UvTaskRunner::OnTimeout(uv_timer_t* timer) {
+  UvTaskRunner* self = static_cast<UvTaskRunner*>(timer->data);
+
+  // Run every task that is due; tasks posted while running land in
+  // |tasks_| and are picked up by the re-arm below.
+  base::TimeTicks now = base::TimeTicks::Now();
+  while (!self->tasks_.empty() && self->tasks_.begin()->first <= now) {
+    base::Closure task = self->tasks_.begin()->second;
+    self->tasks_.erase(self->tasks_.begin());
+    task.Run();
+  }
+
+  self->ScheduleWakeup();
 }
 
 }  // namespace atom
@@ -9,6 +9,7 @@
 
 #include "base/callback.h"
 #include "base/single_thread_task_runner.h"
+#include "base/time/time.h"
 #include "vendor/node/deps/uv/include/uv.h"
 
 namespace atom {
@@ -31,11 +32,18 @@ class UvTaskRunner : public base::SingleThreadTaskRunner {
 
  private:
   static void OnTimeout(uv_timer_t* timer);
-  static void OnClose(uv_handle_t* handle);
+
+  // Re-arms |timer_| for the earliest pending task, or stops it when the
+  // queue is empty.
+  void ScheduleWakeup();
 
   uv_loop_t* loop_;
 
-  std::map<uv_timer_t*, base::Closure> tasks_;
+  // One shared uv timer armed for the earliest deadline. Tasks are kept
+  // here ordered by run time instead of paying a uv handle allocation,
+  // init and close per posted task.
+  uv_timer_t* timer_;
+  std::multimap<base::TimeTicks, base::Closure> tasks_;
 
   DISALLOW_COPY_AND_ASSIGN(UvTaskRunner);
 };
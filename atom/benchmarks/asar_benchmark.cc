@@ -0,0 +1,112 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "atom/benchmarks/benchmark.h"
+#include "atom/common/asar/archive.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/json/json_writer.h"
+#include "base/memory/ptr_util.h"
+#include "base/pickle.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/values.h"
+
+namespace {
+
+const int kDirectoryCount = 100;
+const int kFilesPerDirectory = 100;
+
+// Builds a header the size of a large real-world app: node_modules-like
+// nesting with kDirectoryCount * kFilesPerDirectory entries.
+std::string BuildLargeHeaderJson() {
+  base::DictionaryValue root;
+  auto root_files = base::MakeUnique<base::DictionaryValue>();
+  uint64_t offset = 0;
+  for (int dir = 0; dir < kDirectoryCount; ++dir) {
+    auto dir_files = base::MakeUnique<base::DictionaryValue>();
+    for (int file = 0; file < kFilesPerDirectory; ++file) {
+      auto node = base::MakeUnique<base::DictionaryValue>();
+      node->SetInteger("size", 1024);
+      node->SetString("offset", base::Uint64ToString(offset));
+      offset += 1024;
+      dir_files->SetWithoutPathExpansion(
+          "file-" + base::IntToString(file) + ".js", std::move(node));
+    }
+    auto dir_node = base::MakeUnique<base::DictionaryValue>();
+    dir_node->Set("files", std::move(dir_files));
+    root_files->SetWithoutPathExpansion("dir-" + base::IntToString(dir),
+                                        std::move(dir_node));
+  }
+  root.Set("files", std::move(root_files));
+
+  std::string json;
+  base::JSONWriter::Write(root, &json);
+  return json;
+}
+
+// Writes an archive with the given header to |path|, mirroring the format
+// Archive::Init reads: an 8 byte pickle holding the header pickle's size,
+// followed by the header pickle itself.
+bool WriteArchive(const base::FilePath& path, const std::string& header_json) {
+  base::Pickle header_pickle;
+  header_pickle.WriteString(header_json);
+
+  base::Pickle size_pickle;
+  size_pickle.WriteUInt32(header_pickle.size());
+
+  std::string contents;
+  contents.append(static_cast<const char*>(size_pickle.data()),
+                  size_pickle.size());
+  contents.append(static_cast<const char*>(header_pickle.data()),
+                  header_pickle.size());
+  return base::WriteFile(path, contents.data(), contents.size()) ==
+         static_cast<int>(contents.size());
+}
+
+}  // namespace
+
+ELECTRON_BENCHMARK(ArchiveInitLargeHeader) {
+  base::ScopedTempDir temp_dir;
+  if (!temp_dir.CreateUniqueTempDir())
+    return;
+  base::FilePath path = temp_dir.GetPath().AppendASCII("large.asar");
+  if (!WriteArchive(path, BuildLargeHeaderJson()))
+    return;
+
+  while (state->KeepRunning()) {
+    asar::Archive archive(path);
+    archive.Init();
+  }
+}
+
+ELECTRON_BENCHMARK(ArchiveGetFileInfoLargeHeader) {
+  base::ScopedTempDir temp_dir;
+  if (!temp_dir.CreateUniqueTempDir())
+    return;
+  base::FilePath path = temp_dir.GetPath().AppendASCII("large.asar");
+  if (!WriteArchive(path, BuildLargeHeaderJson()))
+    return;
+
+  asar::Archive archive(path);
+  if (!archive.Init())
+    return;
+
+  // Cycles through paths across the whole header so the lookup cost is
+  // not dominated by one lucky entry.
+  int counter = 0;
+  asar::Archive::FileInfo info;
+  while (state->KeepRunning()) {
+    int dir = counter % kDirectoryCount;
+    int file = (counter / kDirectoryCount) % kFilesPerDirectory;
+    counter++;
+    archive.GetFileInfo(
+        base::FilePath()
+            .AppendASCII("dir-" + base::IntToString(dir))
+            .AppendASCII("file-" + base::IntToString(file) + ".js"),
+        &info);
+  }
+}
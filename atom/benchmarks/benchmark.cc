@@ -0,0 +1,90 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/benchmarks/benchmark.h"
+
+#include <iostream>
+
+#include "base/memory/ptr_util.h"
+
+namespace atom {
+
+namespace benchmarks {
+
+namespace {
+
+base::LazyInstance<BenchmarkRegistry>::Leaky g_registry =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+BenchmarkState::BenchmarkState(base::TimeDelta min_running_time)
+    : min_running_time_(min_running_time),
+      iterations_(0) {
+}
+
+BenchmarkState::~BenchmarkState() {
+}
+
+bool BenchmarkState::KeepRunning() {
+  if (start_.is_null()) {
+    start_ = base::TimeTicks::Now();
+    iterations_++;
+    return true;
+  }
+
+  elapsed_ = base::TimeTicks::Now() - start_;
+  if (elapsed_ >= min_running_time_)
+    return false;
+
+  iterations_++;
+  return true;
+}
+
+// static
+BenchmarkRegistry* BenchmarkRegistry::GetInstance() {
+  return g_registry.Pointer();
+}
+
+BenchmarkRegistry::BenchmarkRegistry() {
+}
+
+BenchmarkRegistry::~BenchmarkRegistry() {
+}
+
+void BenchmarkRegistry::Register(const std::string& name,
+                                 BenchmarkFunction function) {
+  benchmarks_.push_back(std::make_pair(name, function));
+}
+
+std::unique_ptr<base::ListValue> BenchmarkRegistry::RunAll() {
+  auto results = base::MakeUnique<base::ListValue>();
+  for (const auto& benchmark : benchmarks_) {
+    std::cerr << "Running " << benchmark.first << std::endl;
+
+    BenchmarkState state(base::TimeDelta::FromMilliseconds(500));
+    benchmark.second(&state);
+
+    auto result = base::MakeUnique<base::DictionaryValue>();
+    result->SetString("name", benchmark.first);
+    result->SetDouble("iterations", static_cast<double>(state.iterations()));
+    result->SetDouble("wallTimeMs", state.elapsed().InMillisecondsF());
+    if (state.iterations() > 0) {
+      result->SetDouble("nsPerIteration",
+                        state.elapsed().InMicroseconds() * 1000.0 /
+                            state.iterations());
+    }
+    results->Append(std::move(result));
+  }
+  return results;
+}
+
+BenchmarkRegistrar::BenchmarkRegistrar(const char* name,
+                                       BenchmarkFunction function) {
+  BenchmarkRegistry::GetInstance()->Register(name, function);
+}
+
+}  // namespace benchmarks
+
+}  // namespace atom
@@ -0,0 +1,92 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BENCHMARKS_BENCHMARK_H_
+#define ATOM_BENCHMARKS_BENCHMARK_H_
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/lazy_instance.h"
+#include "base/macros.h"
+#include "base/time/time.h"
+#include "base/values.h"
+
+namespace atom {
+
+namespace benchmarks {
+
+// Iteration state handed to each benchmark. Setup done before the first
+// KeepRunning() call is not timed; the loop body is repeated until the
+// benchmark has run for long enough to give a stable per-iteration time.
+class BenchmarkState {
+ public:
+  explicit BenchmarkState(base::TimeDelta min_running_time);
+  ~BenchmarkState();
+
+  // Returns true while the benchmark should keep iterating. Timing starts
+  // at the first call and stops at the call that returns false.
+  bool KeepRunning();
+
+  int64_t iterations() const { return iterations_; }
+  base::TimeDelta elapsed() const { return elapsed_; }
+
+ private:
+  base::TimeDelta min_running_time_;
+  base::TimeTicks start_;
+  base::TimeDelta elapsed_;
+  int64_t iterations_;
+
+  DISALLOW_COPY_AND_ASSIGN(BenchmarkState);
+};
+
+using BenchmarkFunction = void (*)(BenchmarkState* state);
+
+// Holds every benchmark registered through ELECTRON_BENCHMARK.
+class BenchmarkRegistry {
+ public:
+  static BenchmarkRegistry* GetInstance();
+
+  void Register(const std::string& name, BenchmarkFunction function);
+
+  // Runs all registered benchmarks in registration order and returns one
+  // result dictionary per benchmark, ready for JSON serialization.
+  std::unique_ptr<base::ListValue> RunAll();
+
+ private:
+  friend struct base::DefaultLazyInstanceTraits<BenchmarkRegistry>;
+
+  BenchmarkRegistry();
+  ~BenchmarkRegistry();
+
+  std::vector<std::pair<std::string, BenchmarkFunction>> benchmarks_;
+
+  DISALLOW_COPY_AND_ASSIGN(BenchmarkRegistry);
+};
+
+// Registers a benchmark at static initialization time, gtest-style.
+class BenchmarkRegistrar {
+ public:
+  BenchmarkRegistrar(const char* name, BenchmarkFunction function);
+};
+
+}  // namespace benchmarks
+
+}  // namespace atom
+
+// Defines and registers a benchmark:
+//
+//   ELECTRON_BENCHMARK(MyHotPath) {
+//     HeavySetup setup;  // not timed
+//     while (state->KeepRunning())
+//       RunHotPath(&setup);
+//   }
+#define ELECTRON_BENCHMARK(name) \
+  static void name(atom::benchmarks::BenchmarkState* state); \
+  static atom::benchmarks::BenchmarkRegistrar registrar_##name(#name, &name); \
+  static void name(atom::benchmarks::BenchmarkState* state)
+
+#endif  // ATOM_BENCHMARKS_BENCHMARK_H_
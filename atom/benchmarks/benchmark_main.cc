@@ -0,0 +1,58 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include <iostream>
+#include <string>
+
+#include "atom/benchmarks/benchmark.h"
+#include "atom/browser/javascript_environment.h"
+#include "base/at_exit.h"
+#include "base/command_line.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/json/json_writer.h"
+#include "base/message_loop/message_loop.h"
+#include "gin/v8_initializer.h"
+
+namespace {
+
+// Pass --output=path to write the results there instead of stdout, so CI
+// can archive them for trend tracking.
+const char kOutputSwitch[] = "output";
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  base::AtExitManager at_exit;
+  base::CommandLine::Init(argc, argv);
+  base::MessageLoop message_loop;
+
+#if defined(V8_USE_EXTERNAL_STARTUP_DATA)
+  gin::V8Initializer::LoadV8Snapshot();
+  gin::V8Initializer::LoadV8Natives();
+#endif
+
+  // Gives V8 benchmarks an isolate with an entered context, matching the
+  // environment the converters run in inside the browser process.
+  atom::JavascriptEnvironment js_env;
+
+  std::unique_ptr<base::ListValue> results =
+      atom::benchmarks::BenchmarkRegistry::GetInstance()->RunAll();
+
+  std::string json;
+  base::JSONWriter::WriteWithOptions(
+      *results, base::JSONWriter::OPTIONS_PRETTY_PRINT, &json);
+
+  base::FilePath output =
+      base::CommandLine::ForCurrentProcess()->GetSwitchValuePath(kOutputSwitch);
+  if (output.empty()) {
+    std::cout << json;
+  } else if (base::WriteFile(output, json.data(), json.size()) !=
+             static_cast<int>(json.size())) {
+    std::cerr << "Failed to write results to " << output.value() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "atom/benchmarks/benchmark.h"
+#include "atom/common/native_mate_converters/v8_value_converter.h"
+#include "base/memory/ptr_util.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/values.h"
+#include "v8/include/v8.h"
+
+namespace {
+
+// Shaped like the details dictionaries the webRequest module builds for
+// every intercepted request: a handful of scalars plus a headers map.
+std::unique_ptr<base::DictionaryValue> BuildRequestDetails() {
+  auto details = base::MakeUnique<base::DictionaryValue>();
+  details->SetInteger("id", 42);
+  details->SetString("url", "https://example.com/assets/app/bundle.min.js");
+  details->SetString("method", "GET");
+  details->SetInteger("webContentsId", 1);
+  details->SetString("resourceType", "script");
+  details->SetDouble("timestamp", 1234567890.123);
+  auto headers = base::MakeUnique<base::DictionaryValue>();
+  headers->SetString("Accept", "*/*");
+  headers->SetString("Accept-Encoding", "gzip, deflate, br");
+  headers->SetString("Cache-Control", "no-cache");
+  headers->SetString("Cookie", std::string(512, 'c'));
+  headers->SetString("Referer", "https://example.com/");
+  headers->SetString("User-Agent", std::string(128, 'u'));
+  details->Set("requestHeaders", std::move(headers));
+  return details;
+}
+
+// Shaped like a typical structured ipc payload: a list of records.
+std::unique_ptr<base::ListValue> BuildRecordList() {
+  auto list = base::MakeUnique<base::ListValue>();
+  for (int i = 0; i < 100; ++i) {
+    auto record = base::MakeUnique<base::DictionaryValue>();
+    record->SetInteger("index", i);
+    record->SetString("key", "record-" + base::IntToString(i));
+    record->SetString("payload", std::string(256, 'p'));
+    record->SetBoolean("dirty", i % 2 == 0);
+    list->Append(std::move(record));
+  }
+  return list;
+}
+
+}  // namespace
+
+ELECTRON_BENCHMARK(V8ValueConverterToV8RequestDetails) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  std::unique_ptr<base::DictionaryValue> details = BuildRequestDetails();
+  atom::V8ValueConverter converter;
+  while (state->KeepRunning())
+    converter.ToV8Value(details.get(), context);
+}
+
+ELECTRON_BENCHMARK(V8ValueConverterFromV8RequestDetails) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  std::unique_ptr<base::DictionaryValue> details = BuildRequestDetails();
+  atom::V8ValueConverter converter;
+  v8::Local<v8::Value> value = converter.ToV8Value(details.get(), context);
+  while (state->KeepRunning())
+    delete converter.FromV8Value(value, context);
+}
+
+ELECTRON_BENCHMARK(V8ValueConverterToV8RecordList) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  std::unique_ptr<base::ListValue> list = BuildRecordList();
+  atom::V8ValueConverter converter;
+  while (state->KeepRunning())
+    converter.ToV8Value(list.get(), context);
+}
+
+ELECTRON_BENCHMARK(V8ValueConverterFromV8RecordList) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  std::unique_ptr<base::ListValue> list = BuildRecordList();
+  atom::V8ValueConverter converter;
+  v8::Local<v8::Value> value = converter.ToV8Value(list.get(), context);
+  while (state->KeepRunning())
+    delete converter.FromV8Value(value, context);
+}
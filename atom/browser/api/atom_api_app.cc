@@ -12,8 +12,14 @@
 #include "atom/browser/api/atom_api_web_contents.h"
 #include "atom/browser/atom_browser_context.h"
 #include "atom/browser/atom_browser_main_parts.h"
+#include "atom/browser/bridge_task_runner.h"
+#include "atom/browser/ipc_stats.h"
+#include "atom/browser/js_task_scheduler.h"
 #include "atom/browser/login_handler.h"
+#include "atom/browser/main_thread_watchdog.h"
 #include "atom/browser/relauncher.h"
+#include "atom/browser/render_process_content_settings.h"
+#include "atom/browser/unresponsive_suppressor.h"
 #include "atom/common/atom_command_line.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
@@ -23,11 +29,13 @@
 #include "atom/common/native_mate_converters/value_converter.h"
 #include "atom/common/node_includes.h"
 #include "atom/common/options_switches.h"
+#include "atom/common/startup_timings.h"
 #include "base/command_line.h"
 #include "base/environment.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/path_service.h"
+#include "base/process/process_info.h"
 #include "base/strings/string_util.h"
 #include "base/sys_info.h"
 #include "brightray/browser/brightray_paths.h"
@@ -44,6 +52,7 @@
 #include "content/public/common/content_switches.h"
 #include "media/audio/audio_manager.h"
 #include "native_mate/object_template_builder.h"
+#include "net/base/net_errors.h"
 #include "net/ssl/ssl_cert_request_info.h"
 #include "ui/base/l10n/l10n_util.h"
 #include "ui/gfx/image/image.h"
@@ -51,6 +60,8 @@
 #if defined(OS_WIN)
 #include "atom/browser/ui/win/jump_list.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task_runner_util.h"
+#include "base/threading/thread.h"
 #endif
 
 using atom::Browser;
@@ -413,9 +424,22 @@ bool NotificationCallbackWrapper(
   return !Browser::Get()->is_shutting_down();
 }
 
+// Builds the key used to cache resolved client certificates: the host
+// pattern of the challenge plus the issuer list the server advertised.
+std::string ClientCertCacheKey(net::SSLCertRequestInfo* cert_request_info) {
+  std::string key = cert_request_info->host_and_port.ToString();
+  for (const std::string& authority : cert_request_info->cert_authorities) {
+    key.push_back('\0');
+    key.append(authority);
+  }
+  return key;
+}
+
 void OnClientCertificateSelected(
     v8::Isolate* isolate,
     std::shared_ptr<content::ClientCertificateDelegate> delegate,
+    const base::Callback<void(scoped_refptr<net::X509Certificate>)>&
+        cert_resolved,
     mate::Arguments* args) {
   if (args->Length() == 2) {
     delegate->ContinueWithCertificate(nullptr);
@@ -441,8 +465,10 @@ void OnClientCertificateSelected(
 
   auto certs = net::X509Certificate::CreateCertificateListFromBytes(
       data.c_str(), data.length(), net::X509Certificate::FORMAT_AUTO);
-  if (!certs.empty())
+  if (!certs.empty()) {
+    cert_resolved.Run(certs[0]);
     delegate->ContinueWithCertificate(certs[0].get());
+  }
 }
 
 void PassLoginInformation(scoped_refptr<LoginHandler> login_handler,
@@ -487,6 +513,22 @@ int ImportIntoCertStore(
 }
 #endif
 
+// Default interval used when getMetricsSnapshot() is called without an
+// explicit startMetricsSampling().
+const int kDefaultMetricsSamplingIntervalMs = 1000;
+
+std::unique_ptr<base::ProcessMetrics> CreateProcessMetricsForHandle(
+    base::ProcessHandle handle) {
+#if defined(OS_MACOSX)
+  return std::unique_ptr<base::ProcessMetrics>(
+      base::ProcessMetrics::CreateProcessMetrics(
+          handle, content::BrowserChildProcessHost::GetPortProvider()));
+#else
+  return std::unique_ptr<base::ProcessMetrics>(
+      base::ProcessMetrics::CreateProcessMetrics(handle));
+#endif
+}
+
 void OnIconDataAvailable(v8::Isolate* isolate,
                          const App::FileIconCallback& callback,
                          gfx::Image* icon) {
@@ -516,6 +558,13 @@ App::App(v8::Isolate* isolate) {
           pid,
           base::ProcessMetrics::CreateCurrentProcessMetrics()));
   app_metrics_[pid] = std::move(process_metric);
+  metrics_sampler_.reset(new ProcessMetricsSampler);
+  // The sampler needs its own instance; CPU usage is derived from
+  // successive queries on the same ProcessMetrics object.
+  metrics_sampler_->AddProcess(
+      content::PROCESS_TYPE_BROWSER, pid,
+      std::unique_ptr<base::ProcessMetrics>(
+          base::ProcessMetrics::CreateCurrentProcessMetrics()));
   Init(isolate);
 }
 
@@ -571,9 +620,24 @@ void App::OnFinishLaunching(const base::DictionaryValue& launch_info) {
   // applications. Only affects pulseaudio currently.
   media::AudioManager::SetGlobalAppName(Browser::Get()->GetName());
 #endif
+  // The watchdog is created after this object, in PreMainMessageLoopRun,
+  // so the callback can not be registered from the constructor.
+  auto* watchdog = AtomBrowserMainParts::Get()->main_thread_watchdog();
+  if (watchdog) {
+    watchdog->SetStallCallback(
+        base::Bind(&App::OnMainThreadStall, base::Unretained(this)));
+  }
   Emit("ready", launch_info);
 }
 
+void App::OnMainThreadStall(base::TimeDelta duration,
+                            const std::string& task_annotation) {
+  mate::Dictionary details = mate::Dictionary::CreateEmpty(isolate());
+  details.Set("durationMs", duration.InMillisecondsF());
+  details.Set("location", task_annotation);
+  Emit("main-thread-stall", details);
+}
+
 void App::OnAccessibilitySupportChanged() {
   Emit("accessibility-support-changed", IsAccessibilitySupportEnabled());
 }
@@ -656,6 +720,20 @@ void App::SelectClientCertificate(
     content::WebContents* web_contents,
     net::SSLCertRequestInfo* cert_request_info,
     std::unique_ptr<content::ClientCertificateDelegate> delegate) {
+  const std::string cache_key = ClientCertCacheKey(cert_request_info);
+  auto cached = resolved_client_certs_.find(cache_key);
+  if (cached != resolved_client_certs_.end()) {
+    // Short-circuit repeated challenges from the same server, as long as
+    // the certificate resolved last time is still among the offered ones.
+    for (const auto& cert : cert_request_info->client_certs) {
+      if (cert->Equals(cached->second.get())) {
+        delegate->ContinueWithCertificate(cert.get());
+        return;
+      }
+    }
+    resolved_client_certs_.erase(cached);
+  }
+
   std::shared_ptr<content::ClientCertificateDelegate>
       shared_delegate(delegate.release());
   bool prevent_default =
@@ -665,12 +743,22 @@ void App::SelectClientCertificate(
            cert_request_info->client_certs,
            base::Bind(&OnClientCertificateSelected,
                       isolate(),
-                      shared_delegate));
+                      shared_delegate,
+                      base::Bind(&App::CacheResolvedClientCert,
+                                 base::Unretained(this),
+                                 cache_key)));
 
   // Default to first certificate from the platform store.
-  if (!prevent_default)
+  if (!prevent_default) {
+    CacheResolvedClientCert(cache_key, cert_request_info->client_certs[0]);
     shared_delegate->ContinueWithCertificate(
         cert_request_info->client_certs[0].get());
+  }
+}
+
+void App::CacheResolvedClientCert(const std::string& cache_key,
+                                  scoped_refptr<net::X509Certificate> cert) {
+  resolved_client_certs_[cache_key] = std::move(cert);
 }
 
 void App::OnGpuProcessCrashed(base::TerminationStatus status) {
@@ -709,21 +797,17 @@ void App::RenderProcessDisconnected(base::ProcessId host_pid) {
 void App::ChildProcessLaunched(int process_type, base::ProcessHandle handle) {
   auto pid = base::GetProcId(handle);
 
-#if defined(OS_MACOSX)
-  std::unique_ptr<base::ProcessMetrics> metrics(
-      base::ProcessMetrics::CreateProcessMetrics(
-          handle, content::BrowserChildProcessHost::GetPortProvider()));
-#else
-  std::unique_ptr<base::ProcessMetrics> metrics(
-      base::ProcessMetrics::CreateProcessMetrics(handle));
-#endif
   std::unique_ptr<atom::ProcessMetric> process_metric(
-      new atom::ProcessMetric(process_type, pid, std::move(metrics)));
+      new atom::ProcessMetric(process_type, pid,
+                              CreateProcessMetricsForHandle(handle)));
   app_metrics_[pid] = std::move(process_metric);
+  metrics_sampler_->AddProcess(process_type, pid,
+                               CreateProcessMetricsForHandle(handle));
 }
 
 void App::ChildProcessDisconnected(base::ProcessId pid) {
   app_metrics_.erase(pid);
+  metrics_sampler_->RemoveProcess(pid);
 }
 
 base::FilePath App::GetAppPath() const {
@@ -875,6 +959,8 @@ void App::ImportCertificate(
   }
 
   int rv = ImportIntoCertStore(certificate_manager_model_.get(), options);
+  if (rv == net::OK)
+    resolved_client_certs_.clear();
   callback.Run(rv);
 }
 
@@ -885,6 +971,8 @@ void App::OnCertificateManagerModelCreated(
   certificate_manager_model_ = std::move(model);
   int rv = ImportIntoCertStore(certificate_manager_model_.get(),
                                *(options.get()));
+  if (rv == net::OK)
+    resolved_client_certs_.clear();
   callback.Run(rv);
 }
 #endif
@@ -908,19 +996,18 @@ v8::Local<v8::Value> App::GetJumpListSettings() {
   return dict.GetHandle();
 }
 
-JumpListResult App::SetJumpList(v8::Local<v8::Value> val,
-                                mate::Arguments* args) {
+struct App::JumpListUpdateRequest {
+  bool delete_jump_list = false;
   std::vector<JumpListCategory> categories;
-  bool delete_jump_list = val->IsNull();
-  if (!delete_jump_list &&
-    !mate::ConvertFromV8(args->isolate(), val, &categories)) {
-    args->ThrowError("Argument must be null or an array of categories");
-    return JumpListResult::ARGUMENT_ERROR;
-  }
+};
 
-  JumpList jump_list(Browser::Get()->GetAppUserModelID());
+// static
+JumpListResult App::UpdateJumpListOnWorker(
+    const base::string16& app_id,
+    std::unique_ptr<JumpListUpdateRequest> request) {
+  JumpList jump_list(app_id);
 
-  if (delete_jump_list) {
+  if (request->delete_jump_list) {
     return jump_list.Delete()
       ? JumpListResult::SUCCESS
       : JumpListResult::GENERIC_ERROR;
@@ -930,7 +1017,7 @@ JumpListResult App::SetJumpList(v8::Local<v8::Value> val,
   if (!jump_list.Begin())
     return JumpListResult::GENERIC_ERROR;
 
-  JumpListResult result = jump_list.AppendCategories(categories);
+  JumpListResult result = jump_list.AppendCategories(request->categories);
   // AppendCategories may have failed to add some categories, but it's better
   // to have something than nothing so try to commit the changes anyway.
   if (!jump_list.Commit()) {
@@ -944,6 +1031,59 @@ JumpListResult App::SetJumpList(v8::Local<v8::Value> val,
 
   return result;
 }
+
+void App::SetJumpList(v8::Local<v8::Value> val, mate::Arguments* args) {
+  std::unique_ptr<JumpListUpdateRequest> request(new JumpListUpdateRequest);
+  request->delete_jump_list = val->IsNull();
+  if (!request->delete_jump_list &&
+    !mate::ConvertFromV8(args->isolate(), val, &request->categories)) {
+    args->ThrowError("Argument must be null or an array of categories");
+    return;
+  }
+
+  JumpListResultCallback callback;
+  args->GetNext(&callback);
+
+  pending_jump_list_request_ = std::move(request);
+  if (!callback.is_null())
+    pending_jump_list_callbacks_.push_back(callback);
+  if (!jump_list_update_in_flight_)
+    DispatchJumpListUpdate();
+}
+
+void App::DispatchJumpListUpdate() {
+  if (!pending_jump_list_request_)
+    return;
+
+  if (!jump_list_worker_) {
+    jump_list_worker_.reset(new base::Thread("JumpListWorker"));
+    jump_list_worker_->init_com_with_mta(false);
+    base::Thread::Options options;
+    options.message_loop_type = base::MessageLoop::TYPE_UI;
+    jump_list_worker_->StartWithOptions(options);
+  }
+
+  jump_list_update_in_flight_ = true;
+  inflight_jump_list_callbacks_.swap(pending_jump_list_callbacks_);
+  base::PostTaskAndReplyWithResult(
+      jump_list_worker_->task_runner().get(), FROM_HERE,
+      base::Bind(&App::UpdateJumpListOnWorker,
+                 base::string16(Browser::Get()->GetAppUserModelID()),
+                 base::Passed(&pending_jump_list_request_)),
+      base::Bind(&App::OnJumpListUpdated, base::Unretained(this)));
+}
+
+void App::OnJumpListUpdated(JumpListResult result) {
+  jump_list_update_in_flight_ = false;
+
+  std::vector<JumpListResultCallback> callbacks;
+  callbacks.swap(inflight_jump_list_callbacks_);
+  for (const auto& callback : callbacks)
+    callback.Run(result);
+
+  // Run the coalesced request that arrived while we were busy, if any.
+  DispatchJumpListUpdate();
+}
 #endif  // defined(OS_WIN)
 
 void App::GetFileIcon(const base::FilePath& path,
@@ -1022,6 +1162,133 @@ std::vector<mate::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
   return result;
 }
 
+void App::StartMetricsSampling(mate::Arguments* args) {
+  int interval_ms = kDefaultMetricsSamplingIntervalMs;
+  args->GetNext(&interval_ms);
+  if (interval_ms < 100) {
+    args->ThrowError("Sampling interval must be at least 100 ms");
+    return;
+  }
+  metrics_sampler_->Start(interval_ms);
+}
+
+void App::StopMetricsSampling() {
+  metrics_sampler_->Stop();
+}
+
+v8::Local<v8::Value> App::GetMetricsSnapshot(v8::Isolate* isolate) {
+  // Make plain reads work without an explicit start.
+  if (!metrics_sampler_->IsSampling())
+    metrics_sampler_->Start(kDefaultMetricsSamplingIntervalMs);
+
+  ProcessMetricsSampler::Snapshot snapshot =
+      metrics_sampler_->GetLatestSnapshot();
+
+  std::vector<mate::Dictionary> metrics;
+  for (const auto& sample : snapshot.samples) {
+    mate::Dictionary pid_dict = mate::Dictionary::CreateEmpty(isolate);
+    mate::Dictionary memory_dict = mate::Dictionary::CreateEmpty(isolate);
+    mate::Dictionary cpu_dict = mate::Dictionary::CreateEmpty(isolate);
+
+    memory_dict.Set("workingSetSize",
+        static_cast<double>(sample.working_set_size >> 10));
+    memory_dict.Set("peakWorkingSetSize",
+        static_cast<double>(sample.peak_working_set_size >> 10));
+    memory_dict.Set("privateBytes",
+        static_cast<double>(sample.private_bytes >> 10));
+    memory_dict.Set("sharedBytes",
+        static_cast<double>(sample.shared_bytes >> 10));
+    pid_dict.Set("memory", memory_dict);
+
+    cpu_dict.Set("percentCPUUsage", sample.percent_cpu_usage);
+    cpu_dict.Set("idleWakeupsPerSecond", sample.idle_wakeups_per_second);
+    pid_dict.Set("cpu", cpu_dict);
+
+    pid_dict.Set("pid", sample.pid);
+    pid_dict.Set("type", content::GetProcessTypeNameInEnglish(sample.type));
+    metrics.push_back(pid_dict);
+  }
+
+  mate::Dictionary result = mate::Dictionary::CreateEmpty(isolate);
+  result.Set("sampledAt", snapshot.timestamp.ToJsTime());
+  result.Set("metrics", metrics);
+  return result.GetHandle();
+}
+
+std::vector<mate::Dictionary> App::GetIPCStats(v8::Isolate* isolate) {
+  std::vector<mate::Dictionary> result;
+  for (const auto& entry : ipc_stats::GetAll()) {
+    mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+    dict.Set("channel", entry.first);
+    dict.Set("messageCount", static_cast<double>(entry.second.message_count));
+    dict.Set("totalBytes", static_cast<double>(entry.second.total_bytes));
+    dict.Set("maxMessageBytes",
+             static_cast<double>(entry.second.max_message_bytes));
+    dict.Set("serializeTimeMs", entry.second.serialize_time.InMillisecondsF());
+    result.push_back(dict);
+  }
+  return result;
+}
+
+void App::ResetIPCStats() {
+  ipc_stats::Reset();
+}
+
+std::vector<mate::Dictionary> App::GetRecentSuppressions(v8::Isolate* isolate) {
+  std::vector<mate::Dictionary> result;
+  base::TimeTicks now = base::TimeTicks::Now();
+  for (const auto& record : atom::GetRecentSuppressions()) {
+    mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+    dict.Set("reason", record.reason);
+    dict.Set("durationMs", record.duration.InMillisecondsF());
+    dict.Set("endedMsAgo",
+             (now - (record.start_time + record.duration)).InMillisecondsF());
+    result.push_back(dict);
+  }
+  return result;
+}
+
+void App::SetContentSettings(const base::DictionaryValue& settings) {
+  RenderProcessContentSettings::GetInstance()->SetRules(
+      settings.CreateDeepCopy());
+}
+
+void App::PostTask(const base::Closure& task, mate::Arguments* args) {
+  JsTaskScheduler::Priority priority =
+      JsTaskScheduler::PRIORITY_USER_VISIBLE;
+  mate::Dictionary options;
+  std::string name;
+  if (args->GetNext(&options) && options.Get("priority", &name)) {
+    if (name == "user-blocking") {
+      priority = JsTaskScheduler::PRIORITY_USER_BLOCKING;
+    } else if (name == "user-visible") {
+      priority = JsTaskScheduler::PRIORITY_USER_VISIBLE;
+    } else if (name == "background") {
+      priority = JsTaskScheduler::PRIORITY_BACKGROUND;
+    } else {
+      args->ThrowError("Invalid task priority: " + name);
+      return;
+    }
+  }
+  AtomBrowserMainParts::Get()->js_task_scheduler()->PostTask(priority, task);
+}
+
+v8::Local<v8::Value> App::GetStartupTimings(v8::Isolate* isolate) {
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+
+  base::Time creation_time = base::CurrentProcessInfo::CreationTime();
+  if (!creation_time.is_null())
+    dict.Set("processStart", creation_time.ToJsTime());
+
+  for (const auto& milestone : startup_timings::GetAll())
+    dict.Set(milestone.first, milestone.second.ToJsTime());
+
+  dict.Set("bridgeTaskHighWaterMark",
+           static_cast<int>(BridgeTaskRunner::GetBufferedHighWaterMark()));
+
+  return dict.GetHandle();
+}
+
 v8::Local<v8::Value> App::GetGPUFeatureStatus(v8::Isolate* isolate) {
   auto status = content::GetFeatureStatus();
   return mate::ConvertToV8(isolate,
@@ -1101,6 +1368,15 @@ void App::BuildPrototype(
                  &App::DisableHardwareAcceleration)
       .SetMethod("getFileIcon", &App::GetFileIcon)
       .SetMethod("getAppMetrics", &App::GetAppMetrics)
+      .SetMethod("getMetricsSnapshot", &App::GetMetricsSnapshot)
+      .SetMethod("getStartupTimings", &App::GetStartupTimings)
+      .SetMethod("getIPCStats", &App::GetIPCStats)
+      .SetMethod("resetIPCStats", &App::ResetIPCStats)
+      .SetMethod("getRecentSuppressions", &App::GetRecentSuppressions)
+      .SetMethod("setContentSettings", &App::SetContentSettings)
+      .SetMethod("postTask", &App::PostTask)
+      .SetMethod("startMetricsSampling", &App::StartMetricsSampling)
+      .SetMethod("stopMetricsSampling", &App::StopMetricsSampling)
       .SetMethod("getGPUFeatureStatus", &App::GetGPUFeatureStatus)
       // TODO(juturu): Remove in 2.0, deprecate before then with warnings
       .SetMethod("getAppMemoryInfo", &App::GetAppMetrics);
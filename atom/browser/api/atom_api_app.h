@@ -5,6 +5,7 @@
 #ifndef ATOM_BROWSER_API_ATOM_API_APP_H_
 #define ATOM_BROWSER_API_ATOM_API_APP_H_
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -14,6 +15,7 @@
 #include "atom/browser/atom_browser_client.h"
 #include "atom/browser/browser.h"
 #include "atom/browser/browser_observer.h"
+#include "atom/browser/process_metrics_sampler.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "base/process/process_iterator.h"
 #include "base/task/cancelable_task_tracker.h"
@@ -25,6 +27,7 @@
 #include "native_mate/dictionary.h"
 #include "native_mate/handle.h"
 #include "net/base/completion_callback.h"
+#include "net/cert/x509_certificate.h"
 
 #if defined(USE_NSS_CERTS)
 #include "chrome/browser/certificate_manager_model.h"
@@ -32,6 +35,7 @@
 
 namespace base {
 class FilePath;
+class Thread;
 }
 
 namespace mate {
@@ -112,6 +116,8 @@ class App : public AtomBrowserClient::Delegate,
   void OnLogin(LoginHandler* login_handler,
                const base::DictionaryValue& request_details) override;
   void OnAccessibilitySupportChanged() override;
+  void OnMainThreadStall(base::TimeDelta duration,
+                         const std::string& task_annotation);
 #if defined(OS_MACOSX)
   void OnContinueUserActivity(
       bool* prevent_default,
@@ -173,18 +179,35 @@ class App : public AtomBrowserClient::Delegate,
   void ImportCertificate(const base::DictionaryValue& options,
                          const net::CompletionCallback& callback);
 #endif
+
+  // Remembers which client certificate was resolved for a given host
+  // pattern and issuer list, so repeated TLS challenges from the same
+  // server short-circuit without another trip through the platform store.
+  void CacheResolvedClientCert(const std::string& cache_key,
+                               scoped_refptr<net::X509Certificate> cert);
   void GetFileIcon(const base::FilePath& path,
                    mate::Arguments* args);
 
   std::vector<mate::Dictionary> GetAppMetrics(v8::Isolate* isolate);
+  void StartMetricsSampling(mate::Arguments* args);
+  void StopMetricsSampling();
+  v8::Local<v8::Value> GetMetricsSnapshot(v8::Isolate* isolate);
+  v8::Local<v8::Value> GetStartupTimings(v8::Isolate* isolate);
+  std::vector<mate::Dictionary> GetIPCStats(v8::Isolate* isolate);
+  void ResetIPCStats();
+  std::vector<mate::Dictionary> GetRecentSuppressions(v8::Isolate* isolate);
+  void SetContentSettings(const base::DictionaryValue& settings);
+  void PostTask(const base::Closure& task, mate::Arguments* args);
   v8::Local<v8::Value> GetGPUFeatureStatus(v8::Isolate* isolate);
 
 #if defined(OS_WIN)
   // Get the current Jump List settings.
   v8::Local<v8::Value> GetJumpListSettings();
 
-  // Set or remove a custom Jump List for the application.
-  JumpListResult SetJumpList(v8::Local<v8::Value> val, mate::Arguments* args);
+  // Set or remove a custom Jump List for the application. The COM
+  // transaction runs on a dedicated STA worker thread; the optional
+  // callback receives the result string.
+  void SetJumpList(v8::Local<v8::Value> val, mate::Arguments* args);
 #endif  // defined(OS_WIN)
 
   std::unique_ptr<ProcessSingleton> process_singleton_;
@@ -193,6 +216,11 @@ class App : public AtomBrowserClient::Delegate,
   std::unique_ptr<CertificateManagerModel> certificate_manager_model_;
 #endif
 
+  // Client certificates resolved during this session, keyed by host
+  // pattern and issuer list.
+  std::map<std::string, scoped_refptr<net::X509Certificate>>
+      resolved_client_certs_;
+
   // Tracks tasks requesting file icons.
   base::CancelableTaskTracker cancelable_task_tracker_;
 
@@ -203,6 +231,38 @@ class App : public AtomBrowserClient::Delegate,
                          std::unique_ptr<atom::ProcessMetric>>;
   ProcessMetricMap app_metrics_;
 
+  // Samples the processes in |app_metrics_| off the UI thread for
+  // getMetricsSnapshot().
+  std::unique_ptr<ProcessMetricsSampler> metrics_sampler_;
+
+#if defined(OS_WIN)
+  using JumpListResultCallback = base::Callback<void(JumpListResult)>;
+
+  struct JumpListUpdateRequest;
+
+  // Runs |request| as one Jump List COM transaction, blocking until done;
+  // only ever called on |jump_list_worker_|.
+  static JumpListResult UpdateJumpListOnWorker(
+      const base::string16& app_id,
+      std::unique_ptr<JumpListUpdateRequest> request);
+
+  // Sends the queued Jump List update, if any, to the worker thread.
+  void DispatchJumpListUpdate();
+  void OnJumpListUpdated(JumpListResult result);
+
+  // STA worker serializing Jump List COM transactions off the UI thread.
+  std::unique_ptr<base::Thread> jump_list_worker_;
+  bool jump_list_update_in_flight_ = false;
+
+  // Rapid successive updates are coalesced: while a transaction is in
+  // flight only the most recent queued request is kept, and the callbacks
+  // of superseded requests run with the result of the update that actually
+  // went through.
+  std::unique_ptr<JumpListUpdateRequest> pending_jump_list_request_;
+  std::vector<JumpListResultCallback> pending_jump_list_callbacks_;
+  std::vector<JumpListResultCallback> inflight_jump_list_callbacks_;
+#endif  // defined(OS_WIN)
+
   DISALLOW_COPY_AND_ASSIGN(App);
 };
 
@@ -110,6 +110,10 @@ void BrowserView::SetBounds(const gfx::Rect& bounds) {
   view_->SetBounds(bounds);
 }
 
+void BrowserView::SetVisible(bool visible) {
+  view_->SetVisible(visible);
+}
+
 void BrowserView::SetBackgroundColor(const std::string& color_name) {
   view_->SetBackgroundColor(ParseHexColor(color_name));
 }
@@ -130,6 +134,7 @@ void BrowserView::BuildPrototype(v8::Isolate* isolate,
       .MakeDestroyable()
       .SetMethod("setAutoResize", &BrowserView::SetAutoResize)
       .SetMethod("setBounds", &BrowserView::SetBounds)
+      .SetMethod("setVisible", &BrowserView::SetVisible)
       .SetMethod("setBackgroundColor", &BrowserView::SetBackgroundColor)
       .SetProperty("webContents", &BrowserView::WebContents)
       .SetProperty("id", &BrowserView::ID);
@@ -152,6 +157,10 @@ void Initialize(v8::Local<v8::Object> exports,
 
   mate::Dictionary browser_view(
       isolate, BrowserView::GetConstructor(isolate)->GetFunction());
+  browser_view.SetMethod("beginLayoutTransaction",
+                         &atom::NativeBrowserView::BeginLayoutTransaction);
+  browser_view.SetMethod("commitLayoutTransaction",
+                         &atom::NativeBrowserView::CommitLayoutTransaction);
 
   mate::Dictionary dict(isolate, exports);
   dict.Set("BrowserView", browser_view);
@@ -53,6 +53,7 @@ class BrowserView : public mate::TrackableObject<BrowserView> {
 
   void SetAutoResize(AutoResizeFlags flags);
   void SetBounds(const gfx::Rect& bounds);
+  void SetVisible(bool visible);
   void SetBackgroundColor(const std::string& color_name);
 
   v8::Local<v8::Value> WebContents();
@@ -128,6 +128,17 @@ bool MatchesCookie(const base::DictionaryValue* filter,
   return true;
 }
 
+// Returns whether |cookie| matches |filter|, including the url key, which
+// is reduced to a domain match against the url host.
+bool MatchesFilter(const base::DictionaryValue* filter,
+                   const net::CanonicalCookie& cookie) {
+  std::string url;
+  if (filter->GetString("url", &url) &&
+      !MatchesDomain(GURL(url).host(), cookie.Domain()))
+    return false;
+  return MatchesCookie(filter, cookie);
+}
+
 // Helper to returns the CookieStore.
 inline net::CookieStore* GetCookieStore(
     scoped_refptr<net::URLRequestContextGetter> getter) {
@@ -169,6 +180,32 @@ void GetCookiesOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
         filtered_callback);
 }
 
+// Applies every filter to each cookie in one pass, and passes the per
+// filter results to |callback|.
+void FilterManyCookies(std::unique_ptr<base::ListValue> filters,
+                       const Cookies::GetManyCallback& callback,
+                       const net::CookieList& list) {
+  std::vector<net::CookieList> results(filters->GetSize());
+  for (const auto& cookie : list) {
+    for (size_t i = 0; i < filters->GetSize(); ++i) {
+      const base::DictionaryValue* filter = nullptr;
+      if (filters->GetDictionary(i, &filter) && MatchesFilter(filter, cookie))
+        results[i].push_back(cookie);
+    }
+  }
+  RunCallbackInUI(base::Bind(callback, Cookies::SUCCESS, results));
+}
+
+// Receives cookies matching all |filters| in IO thread.
+void GetManyCookiesOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
+                        std::unique_ptr<base::ListValue> filters,
+                        const Cookies::GetManyCallback& callback) {
+  // One walk of the whole jar serves every filter; the filters are applied
+  // before anything crosses back to the UI thread.
+  GetCookieStore(getter)->GetAllCookiesAsync(
+      base::Bind(FilterManyCookies, base::Passed(&filters), callback));
+}
+
 // Removes cookie with |url| and |name| in IO thread.
 void RemoveCookieOnIOThread(scoped_refptr<net::URLRequestContextGetter> getter,
                             const GURL& url, const std::string& name,
@@ -190,10 +227,11 @@ void FlushCookieStoreOnIOThread(
   GetCookieStore(getter)->FlushStore(base::Bind(RunCallbackInUI, callback));
 }
 
-// Sets cookie with |details| in IO thread.
-void SetCookieOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
-                   std::unique_ptr<base::DictionaryValue> details,
-                   const Cookies::SetCallback& callback) {
+// Commits one cookie described by |details|; |callback| receives the
+// store's success flag.
+void SetCookieWithDetails(net::CookieStore* store,
+                          const base::DictionaryValue* details,
+                          const net::CookieStore::SetCookiesCallback& callback) {
   std::string url, name, value, domain, path;
   bool secure = false;
   bool http_only = false;
@@ -229,11 +267,66 @@ void SetCookieOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
         base::Time::FromDoubleT(last_access_date);
   }
 
-  GetCookieStore(getter)->SetCookieWithDetailsAsync(
+  store->SetCookieWithDetailsAsync(
       GURL(url), name, value, domain, path, creation_time,
       expiration_time, last_access_time, secure, http_only,
       net::CookieSameSite::DEFAULT_MODE, net::COOKIE_PRIORITY_DEFAULT,
-      base::Bind(OnSetCookie, callback));
+      callback);
+}
+
+// Sets cookie with |details| in IO thread.
+void SetCookieOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
+                   std::unique_ptr<base::DictionaryValue> details,
+                   const Cookies::SetCallback& callback) {
+  SetCookieWithDetails(GetCookieStore(getter), details.get(),
+                       base::Bind(OnSetCookie, callback));
+}
+
+void SetManyCookiesOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
+                        std::unique_ptr<base::ListValue> details_list,
+                        size_t index,
+                        bool all_succeeded,
+                        const Cookies::SetCallback& callback);
+
+// Advances the chain after one cookie of the batch commits.
+void DidSetOneCookie(scoped_refptr<net::URLRequestContextGetter> getter,
+                     std::unique_ptr<base::ListValue> details_list,
+                     size_t next_index,
+                     bool all_succeeded,
+                     const Cookies::SetCallback& callback,
+                     bool success) {
+  SetManyCookiesOnIO(getter, std::move(details_list), next_index,
+                     all_succeeded && success, callback);
+}
+
+// Commits the cookies of |details_list| one after another without leaving
+// the IO thread, then flushes the store once for the whole batch. The
+// callback reports FAILED when any entry failed.
+void SetManyCookiesOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
+                        std::unique_ptr<base::ListValue> details_list,
+                        size_t index,
+                        bool all_succeeded,
+                        const Cookies::SetCallback& callback) {
+  if (index >= details_list->GetSize()) {
+    GetCookieStore(getter)->FlushStore(base::Bind(
+        RunCallbackInUI,
+        base::Bind(callback,
+                   all_succeeded ? Cookies::SUCCESS : Cookies::FAILED)));
+    return;
+  }
+
+  const base::DictionaryValue* details = nullptr;
+  if (!details_list->GetDictionary(index, &details)) {
+    SetManyCookiesOnIO(getter, std::move(details_list), index + 1, false,
+                       callback);
+    return;
+  }
+
+  net::CookieStore* store = GetCookieStore(getter);
+  SetCookieWithDetails(store, details,
+                       base::Bind(DidSetOneCookie, getter,
+                                  base::Passed(&details_list), index + 1,
+                                  all_succeeded, callback));
 }
 
 }  // namespace
@@ -259,6 +352,15 @@ void Cookies::Get(const base::DictionaryValue& filter,
       base::Bind(GetCookiesOnIO, getter, Passed(&copied), callback));
 }
 
+void Cookies::GetMany(const base::ListValue& filters,
+                      const GetManyCallback& callback) {
+  std::unique_ptr<base::ListValue> copied(filters.CreateDeepCopy());
+  auto getter = make_scoped_refptr(request_context_getter_);
+  content::BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::Bind(GetManyCookiesOnIO, getter, Passed(&copied), callback));
+}
+
 void Cookies::Remove(const GURL& url, const std::string& name,
                      const base::Closure& callback) {
   auto getter = make_scoped_refptr(request_context_getter_);
@@ -276,6 +378,16 @@ void Cookies::Set(const base::DictionaryValue& details,
       base::Bind(SetCookieOnIO, getter, Passed(&copied), callback));
 }
 
+void Cookies::SetMany(const base::ListValue& details_list,
+                      const SetCallback& callback) {
+  std::unique_ptr<base::ListValue> copied(details_list.CreateDeepCopy());
+  auto getter = make_scoped_refptr(request_context_getter_);
+  content::BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::Bind(SetManyCookiesOnIO, getter, Passed(&copied), 0u, true,
+                 callback));
+}
+
 void Cookies::FlushStore(const base::Closure& callback) {
   auto getter = make_scoped_refptr(request_context_getter_);
   content::BrowserThread::PostTask(
@@ -283,6 +395,10 @@ void Cookies::FlushStore(const base::Closure& callback) {
       base::Bind(FlushCookieStoreOnIOThread, getter, callback));
 }
 
+void Cookies::SetChangeFilter(const base::ListValue& filters) {
+  cookie_delegate_->SetChangeFilters(filters.CreateDeepCopy());
+}
+
 void Cookies::OnCookieChanged(const net::CanonicalCookie& cookie,
                               bool removed,
                               net::CookieStore::ChangeCause cause) {
@@ -303,9 +419,12 @@ void Cookies::BuildPrototype(v8::Isolate* isolate,
   prototype->SetClassName(mate::StringToV8(isolate, "Cookies"));
   mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetMethod("get", &Cookies::Get)
+      .SetMethod("getMany", &Cookies::GetMany)
       .SetMethod("remove", &Cookies::Remove)
       .SetMethod("set", &Cookies::Set)
-      .SetMethod("flushStore", &Cookies::FlushStore);
+      .SetMethod("setMany", &Cookies::SetMany)
+      .SetMethod("flushStore", &Cookies::FlushStore)
+      .SetMethod("setChangeFilter", &Cookies::SetChangeFilter);
 }
 
 }  // namespace api
@@ -6,6 +6,7 @@
 #define ATOM_BROWSER_API_ATOM_API_COOKIES_H_
 
 #include <string>
+#include <vector>
 
 #include "atom/browser/api/trackable_object.h"
 #include "atom/browser/net/atom_cookie_delegate.h"
@@ -15,6 +16,7 @@
 
 namespace base {
 class DictionaryValue;
+class ListValue;
 }
 
 namespace net {
@@ -36,6 +38,8 @@ class Cookies : public mate::TrackableObject<Cookies>,
   };
 
   using GetCallback = base::Callback<void(Error, const net::CookieList&)>;
+  using GetManyCallback =
+      base::Callback<void(Error, const std::vector<net::CookieList>&)>;
   using SetCallback = base::Callback<void(Error)>;
 
   static mate::Handle<Cookies> Create(v8::Isolate* isolate,
@@ -50,10 +54,21 @@ class Cookies : public mate::TrackableObject<Cookies>,
   ~Cookies() override;
 
   void Get(const base::DictionaryValue& filter, const GetCallback& callback);
+  // Runs all |filters| in a single pass over the cookie store on the IO
+  // thread; the result has one cookie list per filter, in order.
+  void GetMany(const base::ListValue& filters,
+               const GetManyCallback& callback);
   void Remove(const GURL& url, const std::string& name,
               const base::Closure& callback);
   void Set(const base::DictionaryValue& details, const SetCallback& callback);
+  // Commits all cookies in |details_list| in one IO-thread pass and
+  // flushes the store once for the whole batch.
+  void SetMany(const base::ListValue& details_list,
+               const SetCallback& callback);
   void FlushStore(const base::Closure& callback);
+  // Restricts which cookie changes emit the "changed" event. The filters are
+  // evaluated on the IO thread so non-matching changes never cross threads.
+  void SetChangeFilter(const base::ListValue& filters);
 
   // AtomCookieDelegate::Observer:
   void OnCookieChanged(const net::CanonicalCookie& cookie,
@@ -4,7 +4,9 @@
 
 #include "atom/browser/api/atom_api_debugger.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "atom/browser/atom_browser_main_parts.h"
 #include "atom/common/native_mate_converters/callback.h"
@@ -25,7 +27,8 @@ namespace api {
 
 Debugger::Debugger(v8::Isolate* isolate, content::WebContents* web_contents)
     : web_contents_(web_contents),
-      previous_request_id_(0) {
+      previous_request_id_(0),
+      raw_events_(false) {
   Init(isolate);
 }
 
@@ -54,24 +57,42 @@ void Debugger::DispatchProtocolMessage(DevToolsAgentHost* agent_host,
   if (parsed_message.IsEmpty()) {
     return;
   }
-
-  std::unique_ptr<base::DictionaryValue> dict(new base::DictionaryValue());
-  if (!mate::ConvertFromV8(isolate(), parsed_message.ToLocalChecked(),
-                           dict.get())) {
+  v8::Local<v8::Value> parsed = parsed_message.ToLocalChecked();
+  if (!parsed->IsObject())
     return;
-  }
+  v8::Local<v8::Object> message_object = parsed.As<v8::Object>();
 
-  int id;
-  if (!dict->GetInteger("id", &id)) {
+  v8::Local<v8::Value> id_value =
+      message_object->Get(mate::StringToV8(isolate(), "id"));
+  if (!id_value->IsNumber()) {
+    // Event. Filtering and dispatch work on the parsed V8 value directly;
+    // unwanted events never get converted at all.
     std::string method;
-    if (!dict->GetString("method", &method))
+    if (!mate::ConvertFromV8(
+            isolate(),
+            message_object->Get(mate::StringToV8(isolate(), "method")),
+            &method) ||
+        method.empty())
+      return;
+    if (!ShouldDispatchEvent(method))
       return;
-    base::DictionaryValue* params_value = nullptr;
-    base::DictionaryValue params;
-    if (dict->GetDictionary("params", &params_value))
-      params.Swap(params_value);
+    if (raw_events_) {
+      Emit("raw-message", message);
+      return;
+    }
+    v8::Local<v8::Value> params =
+        message_object->Get(mate::StringToV8(isolate(), "params"));
+    if (!params->IsObject())
+      params = v8::Object::New(isolate());
     Emit("message", method, params);
   } else {
+    std::unique_ptr<base::DictionaryValue> dict(new base::DictionaryValue());
+    if (!mate::ConvertFromV8(isolate(), parsed, dict.get()))
+      return;
+
+    int id;
+    if (!dict->GetInteger("id", &id))
+      return;
     auto send_command_callback = pending_requests_[id];
     pending_requests_.erase(id);
     if (send_command_callback.is_null())
@@ -150,6 +171,40 @@ void Debugger::SendCommand(mate::Arguments* args) {
   agent_host_->DispatchProtocolMessage(this, json_args);
 }
 
+void Debugger::SetEventFilter(mate::Arguments* args) {
+  // Array of "Domain" or "Domain.method" strings, or null to clear.
+  std::vector<std::string> filters;
+  v8::Local<v8::Value> value;
+  if (!args->GetNext(&filters) &&
+      !(args->GetNext(&value) && value->IsNull())) {
+    args->ThrowError("Must pass null or an Array of domain/method names");
+    return;
+  }
+
+  event_domains_.clear();
+  event_methods_.clear();
+  for (const std::string& filter : filters) {
+    if (filter.find('.') == std::string::npos)
+      event_domains_.insert(filter);
+    else
+      event_methods_.insert(filter);
+  }
+}
+
+void Debugger::SetRawEventMode(bool enabled) {
+  raw_events_ = enabled;
+}
+
+bool Debugger::ShouldDispatchEvent(const std::string& method) const {
+  if (event_domains_.empty() && event_methods_.empty())
+    return true;
+  if (event_methods_.find(method) != event_methods_.end())
+    return true;
+  const size_t dot = method.find('.');
+  return dot != std::string::npos &&
+         event_domains_.find(method.substr(0, dot)) != event_domains_.end();
+}
+
 // static
 mate::Handle<Debugger> Debugger::Create(
     v8::Isolate* isolate,
@@ -165,7 +220,9 @@ void Debugger::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("attach", &Debugger::Attach)
       .SetMethod("isAttached", &Debugger::IsAttached)
       .SetMethod("detach", &Debugger::Detach)
-      .SetMethod("sendCommand", &Debugger::SendCommand);
+      .SetMethod("sendCommand", &Debugger::SendCommand)
+      .SetMethod("setEventFilter", &Debugger::SetEventFilter)
+      .SetMethod("setRawEventMode", &Debugger::SetRawEventMode);
 }
 
 }  // namespace api
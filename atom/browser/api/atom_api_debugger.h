@@ -6,6 +6,7 @@
 #define ATOM_BROWSER_API_ATOM_API_DEBUGGER_H_
 
 #include <map>
+#include <set>
 #include <string>
 
 #include "atom/browser/api/trackable_object.h"
@@ -58,6 +59,11 @@ class Debugger: public mate::TrackableObject<Debugger>,
   bool IsAttached();
   void Detach();
   void SendCommand(mate::Arguments* args);
+  void SetEventFilter(mate::Arguments* args);
+  void SetRawEventMode(bool enabled);
+
+  // Returns whether an event named |method| passes the installed filter.
+  bool ShouldDispatchEvent(const std::string& method) const;
 
   content::WebContents* web_contents_;  // Weak Reference.
   scoped_refptr<content::DevToolsAgentHost> agent_host_;
@@ -65,6 +71,14 @@ class Debugger: public mate::TrackableObject<Debugger>,
   PendingRequestMap pending_requests_;
   int previous_request_id_;
 
+  // Subscribed CDP domains and fully qualified methods; events matching
+  // neither are dropped before any conversion. Both empty means no filter.
+  std::set<std::string> event_domains_;
+  std::set<std::string> event_methods_;
+  // When set, events are emitted as "raw-message" with the unparsed
+  // protocol message.
+  bool raw_events_;
+
   DISALLOW_COPY_AND_ASSIGN(Debugger);
 };
 
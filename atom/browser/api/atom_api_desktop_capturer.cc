@@ -39,7 +39,9 @@ namespace atom {
 
 namespace api {
 
-DesktopCapturer::DesktopCapturer(v8::Isolate* isolate) {
+DesktopCapturer::DesktopCapturer(v8::Isolate* isolate)
+    : capture_window_(false),
+      capture_screen_(false) {
   Init(isolate);
 }
 
@@ -49,6 +51,20 @@ DesktopCapturer::~DesktopCapturer() {
 void DesktopCapturer::StartHandling(bool capture_window,
                                     bool capture_screen,
                                     const gfx::Size& thumbnail_size) {
+  // When the request shape is unchanged, reuse the existing media list:
+  // its worker keeps a content hash per source, so windows that have not
+  // changed skip capture scaling entirely, and the capturers themselves
+  // are not re-created.
+  if (media_list_ && capture_window == capture_window_ &&
+      capture_screen == capture_screen_ &&
+      thumbnail_size == thumbnail_size_) {
+    media_list_->Update();
+    return;
+  }
+  capture_window_ = capture_window;
+  capture_screen_ = capture_screen;
+  thumbnail_size_ = thumbnail_size;
+
   webrtc::DesktopCaptureOptions options =
       webrtc::DesktopCaptureOptions::CreateDefault();
 
@@ -41,6 +41,12 @@ class DesktopCapturer: public mate::EventEmitter<DesktopCapturer>,
  private:
   std::unique_ptr<DesktopMediaList> media_list_;
 
+  // The shape of the last request, so an unchanged request can reuse
+  // |media_list_| and its per-source content hashes.
+  bool capture_window_;
+  bool capture_screen_;
+  gfx::Size thumbnail_size_;
+
   DISALLOW_COPY_AND_ASSIGN(DesktopCapturer);
 };
 
@@ -9,6 +9,7 @@
 #include "atom/common/native_mate_converters/accelerator_converter.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "base/stl_util.h"
+#include "content/public/browser/browser_thread.h"
 #include "native_mate/dictionary.h"
 
 #include "atom/common/node_includes.h"
@@ -19,6 +20,17 @@ namespace atom {
 
 namespace api {
 
+namespace {
+
+// Runs on the platform dispatch thread; hops straight to the UI thread
+// without waiting behind the platform message pump.
+void DispatchFastShortcut(const base::Closure& callback) {
+  content::BrowserThread::PostTask(
+      content::BrowserThread::UI, FROM_HERE, callback);
+}
+
+}  // namespace
+
 GlobalShortcut::GlobalShortcut(v8::Isolate* isolate) {
   Init(isolate);
 }
@@ -49,10 +61,26 @@ bool GlobalShortcut::Register(const ui::Accelerator& accelerator,
   return true;
 }
 
+bool GlobalShortcut::RegisterFast(const ui::Accelerator& accelerator,
+                                  const base::Closure& callback) {
+  if (!Register(accelerator, callback))
+    return false;
+
+  // The fast callback consumes the event on the dispatch thread, so the
+  // observer path in OnKeyPressed never sees this accelerator.
+  GlobalShortcutListener::GetInstance()->RegisterFastCallback(
+      accelerator, base::Bind(&DispatchFastShortcut, callback));
+  fast_accelerators_.insert(accelerator);
+  return true;
+}
+
 void GlobalShortcut::Unregister(const ui::Accelerator& accelerator) {
   if (!ContainsKey(accelerator_callback_map_, accelerator))
     return;
 
+  if (fast_accelerators_.erase(accelerator))
+    GlobalShortcutListener::GetInstance()->UnregisterFastCallback(accelerator);
+
   accelerator_callback_map_.erase(accelerator);
   GlobalShortcutListener::GetInstance()->UnregisterAccelerator(
       accelerator, this);
@@ -63,6 +91,9 @@ bool GlobalShortcut::IsRegistered(const ui::Accelerator& accelerator) {
 }
 
 void GlobalShortcut::UnregisterAll() {
+  for (const ui::Accelerator& accelerator : fast_accelerators_)
+    GlobalShortcutListener::GetInstance()->UnregisterFastCallback(accelerator);
+  fast_accelerators_.clear();
   accelerator_callback_map_.clear();
   GlobalShortcutListener::GetInstance()->UnregisterAccelerators(this);
 }
@@ -78,6 +109,7 @@ void GlobalShortcut::BuildPrototype(
   prototype->SetClassName(mate::StringToV8(isolate, "GlobalShortcut"));
   mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetMethod("register", &GlobalShortcut::Register)
+      .SetMethod("registerFast", &GlobalShortcut::RegisterFast)
       .SetMethod("isRegistered", &GlobalShortcut::IsRegistered)
       .SetMethod("unregister", &GlobalShortcut::Unregister)
       .SetMethod("unregisterAll", &GlobalShortcut::UnregisterAll);
@@ -6,6 +6,7 @@
 #define ATOM_BROWSER_API_ATOM_API_GLOBAL_SHORTCUT_H_
 
 #include <map>
+#include <set>
 #include <string>
 
 #include "atom/browser/api/trackable_object.h"
@@ -35,6 +36,8 @@ class GlobalShortcut : public extensions::GlobalShortcutListener::Observer,
 
   bool Register(const ui::Accelerator& accelerator,
                 const base::Closure& callback);
+  bool RegisterFast(const ui::Accelerator& accelerator,
+                    const base::Closure& callback);
   bool IsRegistered(const ui::Accelerator& accelerator);
   void Unregister(const ui::Accelerator& accelerator);
   void UnregisterAll();
@@ -44,6 +47,10 @@ class GlobalShortcut : public extensions::GlobalShortcutListener::Observer,
 
   AcceleratorCallbackMap accelerator_callback_map_;
 
+  // Accelerators registered through the fast dispatch path, so Unregister
+  // knows to drop their native fast callback as well.
+  std::set<ui::Accelerator> fast_accelerators_;
+
   DISALLOW_COPY_AND_ASSIGN(GlobalShortcut);
 };
 
@@ -109,6 +109,10 @@ void Menu::SetIcon(int index, const gfx::Image& image) {
   model_->SetIcon(index, image);
 }
 
+void Menu::SetLabel(int index, const base::string16& label) {
+  model_->SetLabel(index, label);
+}
+
 void Menu::SetSublabel(int index, const base::string16& sublabel) {
   model_->SetSublabel(index, sublabel);
 }
@@ -165,6 +169,7 @@ void Menu::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("insertSeparator", &Menu::InsertSeparatorAt)
       .SetMethod("insertSubMenu", &Menu::InsertSubMenuAt)
       .SetMethod("setIcon", &Menu::SetIcon)
+      .SetMethod("setLabel", &Menu::SetLabel)
       .SetMethod("setSublabel", &Menu::SetSublabel)
       .SetMethod("setRole", &Menu::SetRole)
       .SetMethod("clear", &Menu::Clear)
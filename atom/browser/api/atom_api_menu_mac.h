@@ -28,6 +28,7 @@ class MenuMac : public Menu {
                  int32_t window_id, int x, int y, int positioning_item,
                  bool async);
   void ClosePopupAt(int32_t window_id) override;
+  void SetLabel(int index, const base::string16& label) override;
 
  private:
   friend class Menu;
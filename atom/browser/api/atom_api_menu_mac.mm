@@ -13,6 +13,7 @@
 #include "brightray/browser/inspectable_web_contents_view.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/web_contents.h"
+#include "ui/base/l10n/l10n_util_mac.h"
 
 #include "atom/common/node_includes.h"
 
@@ -107,11 +108,11 @@ void MenuMac::PopupOnUI(const base::WeakPtr<NativeWindow>& native_window,
     base::mac::ScopedSendingEvent sendingEventScoper;
 
     // Don't emit unresponsive event when showing menu.
-    atom::UnresponsiveSuppressor suppressor;
+    atom::UnresponsiveSuppressor suppressor("popup-menu");
     [menu popUpMenuPositioningItem:item atLocation:position inView:view];
   } else {
     // Don't emit unresponsive event when showing menu.
-    atom::UnresponsiveSuppressor suppressor;
+    atom::UnresponsiveSuppressor suppressor("popup-menu");
     [menu popUpMenuPositioningItem:item atLocation:position inView:view];
     close_callback.Run();
   }
@@ -121,6 +122,23 @@ void MenuMac::ClosePopupAt(int32_t window_id) {
   popup_controllers_.erase(window_id);
 }
 
+void MenuMac::SetLabel(int index, const base::string16& label) {
+  Menu::SetLabel(index, label);
+
+  // The application menu is built eagerly, so update the title of the
+  // affected item in place instead of rebuilding the whole NSMenu. Items in
+  // submenus are reported as dynamic by the model and are refreshed by
+  // AtomMenuController when displaying.
+  if (menu_controller_ && index >= 0 &&
+      index < [[menu_controller_ menu] numberOfItems]) {
+    NSMenuItem* item = [[menu_controller_ menu] itemAtIndex:index];
+    NSString* title = l10n_util::FixUpWindowsStyleLabel(label);
+    [item setTitle:title];
+    if ([item hasSubmenu])
+      [[item submenu] setTitle:title];
+  }
+}
+
 // static
 void Menu::SetApplicationMenu(Menu* base_menu) {
   MenuMac* menu = static_cast<MenuMac*>(base_menu);
@@ -46,7 +46,7 @@ void MenuViews::PopupAt(
     flags |= MenuRunner::ASYNC;
 
   // Don't emit unresponsive event when showing menu.
-  atom::UnresponsiveSuppressor suppressor;
+  atom::UnresponsiveSuppressor suppressor("popup-menu");
 
   // Show the menu.
   int32_t window_id = window->ID();
@@ -15,7 +15,7 @@ namespace atom {
 
 namespace api {
 
-PowerMonitor::PowerMonitor(v8::Isolate* isolate) {
+PowerMonitor::PowerMonitor(v8::Isolate* isolate) : suspended_(false) {
   base::PowerMonitor::Get()->AddObserver(this);
   Init(isolate);
 }
@@ -32,11 +32,26 @@ void PowerMonitor::OnPowerStateChange(bool on_battery_power) {
 }
 
 void PowerMonitor::OnSuspend() {
+  suspend_time_ = base::Time::Now();
+  suspended_ = true;
   Emit("suspend");
 }
 
 void PowerMonitor::OnResume() {
-  Emit("resume");
+  // A resume without a matching suspend has no measurable sleep duration;
+  // emit it bare rather than with a bogus one.
+  if (!suspended_) {
+    Emit("resume");
+    return;
+  }
+  suspended_ = false;
+
+  v8::Locker locker(isolate());
+  v8::HandleScope handle_scope(isolate());
+  mate::Dictionary details = mate::Dictionary::CreateEmpty(isolate());
+  details.Set("sleepDuration",
+              (base::Time::Now() - suspend_time_).InSecondsF());
+  Emit("resume", details);
 }
 
 // static
@@ -8,6 +8,7 @@
 #include "atom/browser/api/trackable_object.h"
 #include "base/compiler_specific.h"
 #include "base/power_monitor/power_observer.h"
+#include "base/time/time.h"
 #include "native_mate/handle.h"
 
 namespace atom {
@@ -32,6 +33,11 @@ class PowerMonitor : public mate::TrackableObject<PowerMonitor>,
   void OnResume() override;
 
  private:
+  // Wall-clock time of the last suspend, used to compute how long the
+  // system actually slept; TimeTicks may not advance during sleep.
+  base::Time suspend_time_;
+  bool suspended_;
+
   DISALLOW_COPY_AND_ASSIGN(PowerMonitor);
 };
 
@@ -10,6 +10,7 @@
 #include "atom/browser/net/url_request_async_asar_job.h"
 #include "atom/browser/net/url_request_buffer_job.h"
 #include "atom/browser/net/url_request_fetch_job.h"
+#include "atom/browser/net/url_request_stream_job.h"
 #include "atom/browser/net/url_request_string_job.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/value_converter.h"
@@ -91,6 +92,70 @@ void Protocol::RegisterServiceWorkerSchemes(
   atom::AtomBrowserClient::SetCustomServiceWorkerSchemes(schemes);
 }
 
+void Protocol::RegisterProtocols(mate::Arguments* args) {
+  std::vector<mate::Dictionary> dicts;
+  if (!args->GetNext(&dicts)) {
+    args->ThrowError("Must pass an Array of {scheme, type, handler} objects");
+    return;
+  }
+  CompletionCallback callback;
+  args->GetNext(&callback);
+
+  std::vector<BatchEntry> entries;
+  entries.reserve(dicts.size());
+  for (const mate::Dictionary& dict : dicts) {
+    BatchEntry entry;
+    if (!dict.Get("scheme", &entry.scheme) ||
+        !dict.Get("type", &entry.type) ||
+        !dict.Get("handler", &entry.handler)) {
+      args->ThrowError("Each entry requires scheme, type and handler");
+      return;
+    }
+    entries.push_back(entry);
+  }
+
+  content::BrowserThread::PostTaskAndReplyWithResult(
+      content::BrowserThread::IO, FROM_HERE,
+      base::Bind(&Protocol::RegisterProtocolsInIO,
+                 request_context_getter_, isolate(), entries),
+      base::Bind(&Protocol::OnIOCompleted,
+                 GetWeakPtr(), callback));
+}
+
+// static
+Protocol::ProtocolError Protocol::RegisterProtocolsInIO(
+    scoped_refptr<brightray::URLRequestContextGetter> request_context_getter,
+    v8::Isolate* isolate,
+    const std::vector<BatchEntry>& entries) {
+  // The whole batch is applied in one pass over the job factory; the first
+  // error is reported but later entries are still registered.
+  ProtocolError result = PROTOCOL_OK;
+  for (const BatchEntry& entry : entries) {
+    ProtocolError error;
+    if (entry.type == "string") {
+      error = RegisterProtocolInIO<URLRequestStringJob>(
+          request_context_getter, isolate, entry.scheme, entry.handler);
+    } else if (entry.type == "buffer") {
+      error = RegisterProtocolInIO<URLRequestBufferJob>(
+          request_context_getter, isolate, entry.scheme, entry.handler);
+    } else if (entry.type == "file") {
+      error = RegisterProtocolInIO<URLRequestAsyncAsarJob>(
+          request_context_getter, isolate, entry.scheme, entry.handler);
+    } else if (entry.type == "http") {
+      error = RegisterProtocolInIO<URLRequestFetchJob>(
+          request_context_getter, isolate, entry.scheme, entry.handler);
+    } else if (entry.type == "stream") {
+      error = RegisterProtocolInIO<URLRequestStreamJob>(
+          request_context_getter, isolate, entry.scheme, entry.handler);
+    } else {
+      error = PROTOCOL_FAIL;
+    }
+    if (error != PROTOCOL_OK && result == PROTOCOL_OK)
+      result = error;
+  }
+  return result;
+}
+
 void Protocol::UnregisterProtocol(
     const std::string& scheme, mate::Arguments* args) {
   CompletionCallback callback;
@@ -208,6 +273,9 @@ void Protocol::BuildPrototype(
                  &Protocol::RegisterProtocol<URLRequestAsyncAsarJob>)
       .SetMethod("registerHttpProtocol",
                  &Protocol::RegisterProtocol<URLRequestFetchJob>)
+      .SetMethod("registerStreamProtocol",
+                 &Protocol::RegisterProtocol<URLRequestStreamJob>)
+      .SetMethod("registerProtocols", &Protocol::RegisterProtocols)
       .SetMethod("unregisterProtocol", &Protocol::UnregisterProtocol)
       .SetMethod("isProtocolHandled", &Protocol::IsProtocolHandled)
       .SetMethod("interceptStringProtocol",
@@ -218,6 +286,8 @@ void Protocol::BuildPrototype(
                  &Protocol::InterceptProtocol<URLRequestAsyncAsarJob>)
       .SetMethod("interceptHttpProtocol",
                  &Protocol::InterceptProtocol<URLRequestFetchJob>)
+      .SetMethod("interceptStreamProtocol",
+                 &Protocol::InterceptProtocol<URLRequestStreamJob>)
       .SetMethod("uninterceptProtocol", &Protocol::UninterceptProtocol);
 }
 
@@ -127,6 +127,22 @@ class Protocol : public mate::TrackableObject<Protocol> {
       return PROTOCOL_FAIL;
   }
 
+  // One scheme/handler pair of a batch registration.
+  struct BatchEntry {
+    std::string scheme;
+    std::string type;
+    Handler handler;
+  };
+
+  // Register multiple protocols in one IO-thread transaction instead of one
+  // UI/IO round-trip per scheme. Entries are {scheme, type, handler} where
+  // |type| is one of string/buffer/file/http/stream.
+  void RegisterProtocols(mate::Arguments* args);
+  static ProtocolError RegisterProtocolsInIO(
+      scoped_refptr<brightray::URLRequestContextGetter> request_context_getter,
+      v8::Isolate* isolate,
+      const std::vector<BatchEntry>& entries);
+
   // Unregister the protocol handler that handles |scheme|.
   void UnregisterProtocol(const std::string& scheme, mate::Arguments* args);
   static ProtocolError UnregisterProtocolInIO(
@@ -47,10 +47,28 @@ std::vector<std::string> MetricsToArray(uint32_t metrics) {
   return array;
 }
 
+// Compare two copies of the same display and return the metrics that differ,
+// as a DISPLAY_METRIC_* bitmask. Some platforms report coarse change masks;
+// diffing against our cached copy keeps the emitted list accurate.
+uint32_t DiffDisplays(const display::Display& old_display,
+                      const display::Display& new_display) {
+  uint32_t metrics = display::DisplayObserver::DISPLAY_METRIC_NONE;
+  if (old_display.bounds() != new_display.bounds())
+    metrics |= display::DisplayObserver::DISPLAY_METRIC_BOUNDS;
+  if (old_display.work_area() != new_display.work_area())
+    metrics |= display::DisplayObserver::DISPLAY_METRIC_WORK_AREA;
+  if (old_display.device_scale_factor() != new_display.device_scale_factor())
+    metrics |= display::DisplayObserver::DISPLAY_METRIC_DEVICE_SCALE_FACTOR;
+  if (old_display.rotation() != new_display.rotation())
+    metrics |= display::DisplayObserver::DISPLAY_METRIC_ROTATION;
+  return metrics;
+}
+
 }  // namespace
 
 Screen::Screen(v8::Isolate* isolate, display::Screen* screen)
-    : screen_(screen) {
+    : screen_(screen),
+      cached_displays_(screen->GetAllDisplays()) {
   screen_->AddObserver(this);
   Init(isolate);
 }
@@ -68,7 +86,7 @@ display::Display Screen::GetPrimaryDisplay() {
 }
 
 std::vector<display::Display> Screen::GetAllDisplays() {
-  return screen_->GetAllDisplays();
+  return cached_displays_;
 }
 
 display::Display Screen::GetDisplayNearestPoint(const gfx::Point& point) {
@@ -80,15 +98,26 @@ display::Display Screen::GetDisplayMatching(const gfx::Rect& match_rect) {
 }
 
 void Screen::OnDisplayAdded(const display::Display& new_display) {
+  cached_displays_.push_back(new_display);
   Emit("display-added", new_display);
 }
 
 void Screen::OnDisplayRemoved(const display::Display& old_display) {
+  auto iter = FindById(&cached_displays_, old_display.id());
+  if (iter != cached_displays_.end())
+    cached_displays_.erase(iter);
   Emit("display-removed", old_display);
 }
 
 void Screen::OnDisplayMetricsChanged(const display::Display& display,
                                      uint32_t changed_metrics) {
+  auto iter = FindById(&cached_displays_, display.id());
+  if (iter == cached_displays_.end()) {
+    cached_displays_.push_back(display);
+  } else {
+    changed_metrics |= DiffDisplays(*iter, display);
+    *iter = display;
+  }
   Emit("display-metrics-changed", display, MetricsToArray(changed_metrics));
 }
 
@@ -53,6 +53,10 @@ class Screen : public mate::EventEmitter<Screen>,
  private:
   display::Screen* screen_;
 
+  // Snapshot of the display list, kept current by the observer callbacks so
+  // reads never go back to the platform.
+  std::vector<display::Display> cached_displays_;
+
   DISALLOW_COPY_AND_ASSIGN(Screen);
 };
 
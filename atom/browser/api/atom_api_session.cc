@@ -4,8 +4,10 @@
 
 #include "atom/browser/api/atom_api_session.h"
 
+#include <algorithm>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atom/browser/api/atom_api_cookies.h"
@@ -17,6 +19,7 @@
 #include "atom/browser/atom_permission_manager.h"
 #include "atom/browser/browser.h"
 #include "atom/browser/net/atom_cert_verifier.h"
+#include "atom/browser/net/segmented_downloader.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/content_converter.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
@@ -26,16 +29,23 @@
 #include "atom/common/node_includes.h"
 #include "base/files/file_path.h"
 #include "base/guid.h"
+#include "base/memory/ptr_util.h"
+#include "base/strings/pattern.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
+#include "base/task_runner_util.h"
 #include "base/threading/thread_task_runner_handle.h"
+#include "base/time/time.h"
+#include "brightray/browser/browser_client.h"
 #include "brightray/browser/media/media_device_id_salt.h"
 #include "brightray/browser/net/devtools_network_conditions.h"
 #include "brightray/browser/net/devtools_network_controller_handle.h"
+#include "brightray/browser/url_request_context_getter.h"
 #include "chrome/common/pref_names.h"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/download_manager_delegate.h"
+#include "content/public/browser/indexed_db_context.h"
 #include "content/public/browser/storage_partition.h"
 #include "native_mate/dictionary.h"
 #include "native_mate/object_template_builder.h"
@@ -44,11 +54,15 @@
 #include "net/dns/host_cache.h"
 #include "net/http/http_auth_handler_factory.h"
 #include "net/http/http_auth_preferences.h"
+#include "net/http/http_network_session.h"
+#include "net/http/http_request_info.h"
+#include "net/http/http_stream_factory.h"
 #include "net/proxy/proxy_config_service_fixed.h"
 #include "net/proxy/proxy_service.h"
 #include "net/url_request/static_http_user_agent_settings.h"
 #include "net/url_request/url_request_context.h"
 #include "net/url_request/url_request_context_getter.h"
+#include "storage/browser/quota/quota_manager.h"
 #include "ui/base/l10n/l10n_util.h"
 
 using atom::api::Cookies;
@@ -198,8 +212,10 @@ struct Converter<net::ProxyConfig> {
       out->set_pac_url(pac_url);
     } else {
       out->proxy_rules().ParseFromString(proxy_rules);
-      out->proxy_rules().bypass_rules.ParseFromString(proxy_bypass_rules);
     }
+    // The bypass rules also apply to PAC configs, where they are matched
+    // before the script runs.
+    out->proxy_rules().bypass_rules.ParseFromString(proxy_bypass_rules);
     return true;
   }
 };
@@ -339,7 +355,7 @@ void DoCacheActionInIO(
     on_get_backend.Run(net::OK);
 }
 
-void SetProxyInIO(net::URLRequestContextGetter* getter,
+void SetProxyInIO(brightray::URLRequestContextGetter* getter,
                   const net::ProxyConfig& config,
                   const base::Closure& callback) {
   auto proxy_service = getter->GetURLRequestContext()->proxy_service();
@@ -347,6 +363,9 @@ void SetProxyInIO(net::URLRequestContextGetter* getter,
       new net::ProxyConfigServiceFixed(config)));
   // Refetches and applies the new pac script if provided.
   proxy_service->ForceReloadProxyConfig();
+  // For PAC configs the bypass rules are matched before the script runs,
+  // so bypassed hosts skip PAC execution entirely.
+  getter->SetProxyBypassRules(config.proxy_rules().bypass_rules);
   RunCallbackInUI(callback);
 }
 
@@ -398,6 +417,39 @@ void ClearAuthCacheInIO(
     RunCallbackInUI(callback);
 }
 
+void OnDumpNetLogDone(const base::Callback<void(bool)>& callback,
+                      bool success) {
+  if (!callback.is_null())
+    callback.Run(success);
+}
+
+void PreconnectInIO(
+    const scoped_refptr<net::URLRequestContextGetter>& context_getter,
+    const GURL& url,
+    int num_sockets) {
+  auto request_context = context_getter->GetURLRequestContext();
+  auto network_session =
+      request_context->http_transaction_factory()->GetSession();
+  if (!network_session)
+    return;
+
+  net::HttpRequestInfo request_info;
+  request_info.url = url;
+  request_info.method = "GET";
+  request_info.load_flags = net::LOAD_NORMAL;
+  network_session->http_stream_factory()->PreconnectStreams(num_sockets,
+                                                            request_info);
+}
+
+void RunSegmentedDownloadCompletion(
+    scoped_refptr<atom::SegmentedDownloader> downloader,
+    const atom::SegmentedDownloader::CompletionCallback& callback,
+    bool success,
+    const std::string& error) {
+  if (!callback.is_null())
+    callback.Run(success, error);
+}
+
 void AllowNTLMCredentialsForDomainsInIO(
     const scoped_refptr<net::URLRequestContextGetter>& context_getter,
     const std::string& domains) {
@@ -436,6 +488,353 @@ void DownloadIdCallback(content::DownloadManager* download_manager,
       std::vector<content::DownloadItem::ReceivedSlice>());
 }
 
+struct CacheEntryInfo {
+  std::string url;
+  int64_t size;
+  base::Time last_used;
+};
+
+// Walks the HTTP disk cache one entry at a time on the IO thread, optionally
+// dooming the entries selected by the prune options, and reports on the UI
+// thread. Going entry by entry keeps the cache responsive to regular
+// requests while the walk is in progress.
+class CacheWalker : public base::RefCountedThreadSafe<CacheWalker> {
+ public:
+  struct PruneOptions {
+    PruneOptions() : size_ceiling(-1), dry_run(false) {}
+
+    std::string url_pattern;  // Wildcard pattern; empty matches everything.
+    base::Time used_before;   // Only entries last used before this; null
+                              // disables the age filter.
+    int64_t size_ceiling;     // Evict least-recently-used matches until the
+                              // rest fit under this many bytes; -1 evicts
+                              // every match.
+    bool dry_run;             // Report what would be evicted, doom nothing.
+  };
+
+  using DoneCallback = base::Callback<void(const base::DictionaryValue&)>;
+
+  // Enumerates the cache without deleting anything.
+  CacheWalker(const scoped_refptr<net::URLRequestContextGetter>& getter,
+              const DoneCallback& callback)
+      : context_getter_(getter),
+        callback_(callback),
+        prune_(false),
+        backend_(nullptr),
+        current_entry_(nullptr),
+        doom_index_(0) {}
+
+  // Dooms the entries selected by |options|.
+  CacheWalker(const scoped_refptr<net::URLRequestContextGetter>& getter,
+              const PruneOptions& options,
+              const DoneCallback& callback)
+      : context_getter_(getter),
+        callback_(callback),
+        prune_(true),
+        options_(options),
+        backend_(nullptr),
+        current_entry_(nullptr),
+        doom_index_(0) {}
+
+  void Run() {
+    BrowserThread::PostTask(
+        BrowserThread::IO, FROM_HERE,
+        base::Bind(&CacheWalker::OpenBackendInIO, this));
+  }
+
+ private:
+  friend class base::RefCountedThreadSafe<CacheWalker>;
+  ~CacheWalker() {}
+
+  void OpenBackendInIO() {
+    auto http_cache = context_getter_->GetURLRequestContext()->
+        http_transaction_factory()->GetCache();
+    if (!http_cache) {
+      Report();
+      return;
+    }
+    int rv = http_cache->GetBackend(
+        &backend_, base::Bind(&CacheWalker::OnBackendOpened, this));
+    if (rv != net::ERR_IO_PENDING)
+      OnBackendOpened(rv);
+  }
+
+  void OnBackendOpened(int result) {
+    if (result != net::OK || !backend_) {
+      Report();
+      return;
+    }
+    iterator_ = backend_->CreateIterator();
+    WalkEntries();
+  }
+
+  // Loops synchronously while the backend completes inline (the memory-only
+  // backend always does) instead of recursing once per entry.
+  void WalkEntries() {
+    while (true) {
+      current_entry_ = nullptr;
+      int rv = iterator_->OpenNextEntry(
+          &current_entry_, base::Bind(&CacheWalker::OnEntryOpened, this));
+      if (rv == net::ERR_IO_PENDING)
+        return;
+      if (!HandleEntry(rv))
+        return;
+    }
+  }
+
+  void OnEntryOpened(int result) {
+    if (HandleEntry(result))
+      WalkEntries();
+  }
+
+  // Returns false when the walk is over.
+  bool HandleEntry(int result) {
+    if (result != net::OK || !current_entry_) {
+      iterator_.reset();
+      SelectAndDoom();
+      return false;
+    }
+    CacheEntryInfo info;
+    info.url = current_entry_->GetKey();
+    // Stream 0 holds the response headers, stream 1 the body.
+    info.size = current_entry_->GetDataSize(0) + current_entry_->GetDataSize(1);
+    info.last_used = current_entry_->GetLastUsed();
+    current_entry_->Close();
+    current_entry_ = nullptr;
+    entries_.push_back(info);
+    return true;
+  }
+
+  void SelectAndDoom() {
+    if (!prune_) {
+      Report();
+      return;
+    }
+
+    std::vector<CacheEntryInfo> matched;
+    int64_t matched_size = 0;
+    for (const auto& entry : entries_) {
+      if (!options_.url_pattern.empty() &&
+          !base::MatchPattern(entry.url, options_.url_pattern))
+        continue;
+      if (!options_.used_before.is_null() &&
+          entry.last_used >= options_.used_before)
+        continue;
+      matched.push_back(entry);
+      matched_size += entry.size;
+    }
+
+    if (options_.size_ceiling >= 0) {
+      // Evict in LRU order only until the matched set fits.
+      std::sort(matched.begin(), matched.end(),
+                [](const CacheEntryInfo& a, const CacheEntryInfo& b) {
+                  return a.last_used < b.last_used;
+                });
+      for (const auto& entry : matched) {
+        if (matched_size <= options_.size_ceiling)
+          break;
+        doom_list_.push_back(entry);
+        matched_size -= entry.size;
+      }
+    } else {
+      doom_list_.swap(matched);
+    }
+
+    if (options_.dry_run)
+      Report();
+    else
+      DoomNext();
+  }
+
+  void DoomNext() {
+    while (doom_index_ < doom_list_.size()) {
+      int rv = backend_->DoomEntry(
+          doom_list_[doom_index_].url,
+          base::Bind(&CacheWalker::OnEntryDoomed, this));
+      ++doom_index_;
+      if (rv == net::ERR_IO_PENDING)
+        return;
+    }
+    Report();
+  }
+
+  void OnEntryDoomed(int result) {
+    DoomNext();
+  }
+
+  void Report() {
+    if (!BrowserThread::CurrentlyOn(BrowserThread::UI)) {
+      BrowserThread::PostTask(
+          BrowserThread::UI, FROM_HERE,
+          base::Bind(&CacheWalker::Report, this));
+      return;
+    }
+
+    base::DictionaryValue result;
+    const std::vector<CacheEntryInfo>& reported =
+        prune_ ? doom_list_ : entries_;
+    int64_t total_size = 0;
+    auto list = base::MakeUnique<base::ListValue>();
+    for (const auto& info : reported) {
+      auto entry = base::MakeUnique<base::DictionaryValue>();
+      entry->SetString("url", info.url);
+      entry->SetDouble("size", static_cast<double>(info.size));
+      entry->SetDouble("lastUsed", info.last_used.ToJsTime());
+      list->Append(std::move(entry));
+      total_size += info.size;
+    }
+    result.Set("entries", std::move(list));
+    result.SetDouble("totalSize", static_cast<double>(total_size));
+    callback_.Run(result);
+  }
+
+  scoped_refptr<net::URLRequestContextGetter> context_getter_;
+  DoneCallback callback_;
+  bool prune_;
+  PruneOptions options_;
+  disk_cache::Backend* backend_;  // Owned by the HTTP cache.
+  std::unique_ptr<disk_cache::Backend::Iterator> iterator_;
+  disk_cache::Entry* current_entry_;
+  std::vector<CacheEntryInfo> entries_;
+  std::vector<CacheEntryInfo> doom_list_;
+  size_t doom_index_;
+
+  DISALLOW_COPY_AND_ASSIGN(CacheWalker);
+};
+
+const char* StorageTypeToString(storage::StorageType type) {
+  switch (type) {
+    case storage::kStorageTypeTemporary:
+      return "temporary";
+    case storage::kStorageTypePersistent:
+      return "persistent";
+    case storage::kStorageTypeSyncable:
+      return "syncable";
+    default:
+      return "unknown";
+  }
+}
+
+// Queries each storage backend for usage numbers on the thread it lives on
+// and replies on the UI thread once all of them have reported, so a cleanup
+// UI gets every origin's byte count from one call instead of walking the
+// profile directory.
+class StorageUsageQuery
+    : public base::RefCountedThreadSafe<StorageUsageQuery> {
+ public:
+  using DoneCallback = base::Callback<void(const base::DictionaryValue&)>;
+
+  explicit StorageUsageQuery(const DoneCallback& callback)
+      : callback_(callback),
+        pending_backends_(0),
+        http_cache_size_(-1) {}
+
+  void Run(content::StoragePartition* storage_partition,
+           const scoped_refptr<net::URLRequestContextGetter>& context_getter) {
+    pending_backends_ = 3;
+
+    // Quota-managed storage (indexeddb, filesystem, websql, appcache) is
+    // accounted by the quota manager on the IO thread.
+    BrowserThread::PostTask(
+        BrowserThread::IO, FROM_HERE,
+        base::Bind(&StorageUsageQuery::QueryQuotaInIO, this,
+                   make_scoped_refptr(storage_partition->GetQuotaManager())));
+
+    // IndexedDB sizes have to be read on its own task runner; the quota
+    // numbers above only break usage down per host, not per origin.
+    scoped_refptr<content::IndexedDBContext> indexed_db_context(
+        storage_partition->GetIndexedDBContext());
+    indexed_db_context->TaskRunner()->PostTask(
+        FROM_HERE,
+        base::Bind(&StorageUsageQuery::QueryIndexedDB, this,
+                   indexed_db_context));
+
+    // The HTTP cache backend only reports a total; it has no per-origin
+    // accounting.
+    BrowserThread::PostTask(
+        BrowserThread::IO, FROM_HERE,
+        base::Bind(&DoCacheActionInIO, context_getter,
+                   Session::CacheAction::STATS,
+                   base::Bind(&StorageUsageQuery::OnHttpCacheSize, this)));
+  }
+
+ private:
+  friend class base::RefCountedThreadSafe<StorageUsageQuery>;
+  ~StorageUsageQuery() {}
+
+  void QueryQuotaInIO(
+      const scoped_refptr<storage::QuotaManager>& quota_manager) {
+    quota_manager->GetUsageInfo(
+        base::Bind(&StorageUsageQuery::OnQuotaUsage, this));
+  }
+
+  void OnQuotaUsage(const std::vector<storage::UsageInfo>& entries) {
+    quota_usage_ = entries;
+    BackendDone();
+  }
+
+  void QueryIndexedDB(
+      const scoped_refptr<content::IndexedDBContext>& indexed_db_context) {
+    for (const auto& info : indexed_db_context->GetAllOriginsInfo())
+      indexed_db_usage_.push_back(
+          std::make_pair(info.origin().spec(), info.size()));
+    BackendDone();
+  }
+
+  void OnHttpCacheSize(int result) {
+    if (result >= 0)
+      http_cache_size_ = result;
+    BackendDone();
+  }
+
+  void BackendDone() {
+    if (!BrowserThread::CurrentlyOn(BrowserThread::UI)) {
+      BrowserThread::PostTask(
+          BrowserThread::UI, FROM_HERE,
+          base::Bind(&StorageUsageQuery::BackendDone, this));
+      return;
+    }
+
+    if (--pending_backends_ > 0)
+      return;
+
+    base::DictionaryValue result;
+    result.SetDouble("httpCacheSize",
+                     http_cache_size_ < 0
+                         ? 0
+                         : static_cast<double>(http_cache_size_));
+
+    auto quota = base::MakeUnique<base::ListValue>();
+    for (const auto& info : quota_usage_) {
+      auto entry = base::MakeUnique<base::DictionaryValue>();
+      entry->SetString("host", info.host);
+      entry->SetString("type", StorageTypeToString(info.type));
+      entry->SetDouble("usage", static_cast<double>(info.usage));
+      quota->Append(std::move(entry));
+    }
+    result.Set("quota", std::move(quota));
+
+    auto indexed_db = base::MakeUnique<base::ListValue>();
+    for (const auto& usage : indexed_db_usage_) {
+      auto entry = base::MakeUnique<base::DictionaryValue>();
+      entry->SetString("origin", usage.first);
+      entry->SetDouble("size", static_cast<double>(usage.second));
+      indexed_db->Append(std::move(entry));
+    }
+    result.Set("indexedDB", std::move(indexed_db));
+
+    callback_.Run(result);
+  }
+
+  DoneCallback callback_;
+  int pending_backends_;
+  int64_t http_cache_size_;
+  std::vector<storage::UsageInfo> quota_usage_;
+  std::vector<std::pair<std::string, int64_t>> indexed_db_usage_;
+
+  DISALLOW_COPY_AND_ASSIGN(StorageUsageQuery);
+};
+
 }  // namespace
 
 Session::Session(v8::Isolate* isolate, AtomBrowserContext* browser_context)
@@ -512,9 +911,64 @@ void Session::FlushStorageData() {
   storage_partition->Flush();
 }
 
+void Session::GetCacheEntries(mate::Arguments* args) {
+  // getCacheEntries(callback)
+  CacheWalker::DoneCallback callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError("Must pass callback");
+    return;
+  }
+
+  scoped_refptr<CacheWalker> walker = new CacheWalker(
+      make_scoped_refptr(browser_context_->GetRequestContext()), callback);
+  walker->Run();
+}
+
+void Session::PruneCache(mate::Arguments* args) {
+  // pruneCache(options, callback)
+  mate::Dictionary options;
+  CacheWalker::DoneCallback callback;
+  if (!args->GetNext(&options) || !args->GetNext(&callback)) {
+    args->ThrowError("Must pass options and callback");
+    return;
+  }
+
+  CacheWalker::PruneOptions prune_options;
+  options.Get("urlPattern", &prune_options.url_pattern);
+  double max_age_seconds = 0;
+  if (options.Get("maxAge", &max_age_seconds) && max_age_seconds > 0) {
+    prune_options.used_before =
+        base::Time::Now() - base::TimeDelta::FromSecondsD(max_age_seconds);
+  }
+  double size_ceiling = -1;
+  if (options.Get("sizeCeiling", &size_ceiling) && size_ceiling >= 0)
+    prune_options.size_ceiling = static_cast<int64_t>(size_ceiling);
+  options.Get("dryRun", &prune_options.dry_run);
+
+  scoped_refptr<CacheWalker> walker = new CacheWalker(
+      make_scoped_refptr(browser_context_->GetRequestContext()),
+      prune_options, callback);
+  walker->Run();
+}
+
+void Session::GetStorageUsage(mate::Arguments* args) {
+  // getStorageUsage(callback)
+  StorageUsageQuery::DoneCallback callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError("Must pass callback");
+    return;
+  }
+
+  auto storage_partition =
+      content::BrowserContext::GetStoragePartition(browser_context(), nullptr);
+  scoped_refptr<StorageUsageQuery> query = new StorageUsageQuery(callback);
+  query->Run(storage_partition,
+             make_scoped_refptr(browser_context_->GetRequestContext()));
+}
+
 void Session::SetProxy(const net::ProxyConfig& config,
                        const base::Closure& callback) {
-  auto getter = browser_context_->GetRequestContext();
+  auto getter = browser_context_->url_request_context_getter();
   BrowserThread::PostTask(BrowserThread::IO, FROM_HERE,
       base::Bind(&SetProxyInIO, base::Unretained(getter), config, callback));
 }
@@ -581,6 +1035,19 @@ void Session::SetPermissionRequestHandler(v8::Local<v8::Value> val,
   permission_manager->SetPermissionRequestHandler(handler);
 }
 
+void Session::SetPermissionCacheTTL(int64_t ttl_ms) {
+  auto permission_manager = static_cast<AtomPermissionManager*>(
+      browser_context()->GetPermissionManager());
+  permission_manager->SetPermissionCacheTTL(
+      base::TimeDelta::FromMilliseconds(std::max(ttl_ms, INT64_C(0))));
+}
+
+void Session::ClearPermissionCache() {
+  auto permission_manager = static_cast<AtomPermissionManager*>(
+      browser_context()->GetPermissionManager());
+  permission_manager->ClearPermissionCache();
+}
+
 void Session::ClearHostResolverCache(mate::Arguments* args) {
   base::Closure callback;
   args->GetNext(&callback);
@@ -607,6 +1074,40 @@ void Session::ClearAuthCache(mate::Arguments* args) {
                  options, callback));
 }
 
+void Session::DumpNetLog(const base::FilePath& path, mate::Arguments* args) {
+  base::Callback<void(bool)> callback;
+  args->GetNext(&callback);
+
+  // Writing the ring buffer snapshot does blocking file I/O, so run it
+  // on the blocking pool and report the result back on the UI thread.
+  // The NetLog outlives the blocking pool, so Unretained is safe.
+  auto* net_log = brightray::BrowserClient::Get()->net_log();
+  base::PostTaskAndReplyWithResult(
+      BrowserThread::GetBlockingPool(), FROM_HERE,
+      base::Bind(&brightray::NetLog::DumpRingBuffer,
+                 base::Unretained(net_log), path),
+      base::Bind(&OnDumpNetLogDone, callback));
+}
+
+void Session::Preconnect(const GURL& url, mate::Arguments* args) {
+  if (!url.is_valid() || !url.SchemeIsHTTPOrHTTPS()) {
+    args->ThrowError("Must pass a valid http or https url");
+    return;
+  }
+
+  int num_sockets = 1;
+  args->GetNext(&num_sockets);
+  if (num_sockets < 1)
+    num_sockets = 1;
+
+  // Opens the sockets (including any TLS handshake) ahead of the first
+  // request so connection setup overlaps app initialization.
+  BrowserThread::PostTask(BrowserThread::IO, FROM_HERE,
+      base::Bind(&PreconnectInIO,
+                 make_scoped_refptr(browser_context_->GetRequestContext()),
+                 url, num_sockets));
+}
+
 void Session::AllowNTLMCredentialsForDomains(const std::string& domains) {
   BrowserThread::PostTask(BrowserThread::IO, FROM_HERE,
       base::Bind(&AllowNTLMCredentialsForDomainsInIO,
@@ -646,6 +1147,45 @@ void Session::GetBlobData(
                  callback));
 }
 
+v8::Local<v8::Value> Session::StreamBlobData(const std::string& uuid,
+                                             mate::Arguments* args) {
+  int chunk_size = 1024 * 1024;  // 1MB
+  mate::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("chunkSize", &chunk_size);
+  if (chunk_size <= 0)
+    chunk_size = 1024 * 1024;
+
+  AtomBlobReader::CompletionCallback data_callback;
+  if (!args->GetNext(&data_callback)) {
+    args->ThrowError();
+    return v8::Null(args->isolate());
+  }
+
+  scoped_refptr<AtomBlobReader::StreamController> controller =
+      new AtomBlobReader::StreamController;
+  AtomBlobReader* blob_reader =
+      browser_context()->GetBlobReader();
+  BrowserThread::PostTask(BrowserThread::IO, FROM_HERE,
+      base::Bind(&AtomBlobReader::StartStreaming,
+                 base::Unretained(blob_reader),
+                 uuid,
+                 chunk_size,
+                 data_callback,
+                 controller));
+
+  // The handle the consumer uses to drive the stream: resume() requests
+  // the next chunk, abort() stops delivery.
+  mate::Dictionary handle = mate::Dictionary::CreateEmpty(args->isolate());
+  handle.SetMethod("resume",
+                   base::Bind(&AtomBlobReader::StreamController::Resume,
+                              controller));
+  handle.SetMethod("abort",
+                   base::Bind(&AtomBlobReader::StreamController::Abort,
+                              controller));
+  return handle.GetHandle();
+}
+
 void Session::CreateInterruptedDownload(const mate::Dictionary& options) {
   int64_t offset = 0, length = 0;
   double start_time = 0.0;
@@ -677,6 +1217,36 @@ void Session::CreateInterruptedDownload(const mate::Dictionary& options) {
       length, last_modified, etag, base::Time::FromDoubleT(start_time)));
 }
 
+void Session::DownloadURLSegmented(const mate::Dictionary& options,
+                                   mate::Arguments* args) {
+  GURL url;
+  base::FilePath path;
+  int segments = 4;
+  options.Get("url", &url);
+  options.Get("path", &path);
+  options.Get("segments", &segments);
+  if (!url.is_valid() || !url.SchemeIsHTTPOrHTTPS() || path.empty()) {
+    args->ThrowError("Must pass a valid http or https url and non-empty path");
+    return;
+  }
+  if (segments < 1)
+    segments = 1;
+
+  SegmentedDownloader::ProgressCallback progress;
+  SegmentedDownloader::CompletionCallback completion;
+  args->GetNext(&progress);
+  args->GetNext(&completion);
+
+  scoped_refptr<SegmentedDownloader> downloader = new SegmentedDownloader(
+      make_scoped_refptr(browser_context_->GetRequestContext()),
+      url, path, segments);
+  // Binding the downloader into its own completion callback keeps it alive
+  // until the download finishes or fails.
+  downloader->Start(progress,
+                    base::Bind(&RunSegmentedDownloadCompletion,
+                               downloader, completion));
+}
+
 v8::Local<v8::Value> Session::Cookies(v8::Isolate* isolate) {
   if (cookies_.IsEmpty()) {
     auto handle = Cookies::Create(isolate, browser_context());
@@ -745,8 +1315,11 @@ void Session::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("resolveProxy", &Session::ResolveProxy)
       .SetMethod("getCacheSize", &Session::DoCacheAction<CacheAction::STATS>)
       .SetMethod("clearCache", &Session::DoCacheAction<CacheAction::CLEAR>)
+      .SetMethod("getCacheEntries", &Session::GetCacheEntries)
+      .SetMethod("pruneCache", &Session::PruneCache)
       .SetMethod("clearStorageData", &Session::ClearStorageData)
       .SetMethod("flushStorageData", &Session::FlushStorageData)
+      .SetMethod("getStorageUsage", &Session::GetStorageUsage)
       .SetMethod("setProxy", &Session::SetProxy)
       .SetMethod("setDownloadPath", &Session::SetDownloadPath)
       .SetMethod("enableNetworkEmulation", &Session::EnableNetworkEmulation)
@@ -754,13 +1327,19 @@ void Session::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("_setCertificateVerifyProc", &Session::SetCertVerifyProc)
       .SetMethod("setPermissionRequestHandler",
                  &Session::SetPermissionRequestHandler)
+      .SetMethod("setPermissionCacheTTL", &Session::SetPermissionCacheTTL)
+      .SetMethod("clearPermissionCache", &Session::ClearPermissionCache)
       .SetMethod("clearHostResolverCache", &Session::ClearHostResolverCache)
       .SetMethod("clearAuthCache", &Session::ClearAuthCache)
+      .SetMethod("dumpNetLog", &Session::DumpNetLog)
+      .SetMethod("preconnect", &Session::Preconnect)
       .SetMethod("allowNTLMCredentialsForDomains",
                  &Session::AllowNTLMCredentialsForDomains)
       .SetMethod("setUserAgent", &Session::SetUserAgent)
       .SetMethod("getUserAgent", &Session::GetUserAgent)
       .SetMethod("getBlobData", &Session::GetBlobData)
+      .SetMethod("streamBlobData", &Session::StreamBlobData)
+      .SetMethod("downloadURLSegmented", &Session::DownloadURLSegmented)
       .SetMethod("createInterruptedDownload",
                  &Session::CreateInterruptedDownload)
       .SetProperty("cookies", &Session::Cookies)
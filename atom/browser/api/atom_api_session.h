@@ -64,8 +64,11 @@ class Session: public mate::TrackableObject<Session>,
   void ResolveProxy(const GURL& url, ResolveProxyCallback callback);
   template<CacheAction action>
   void DoCacheAction(const net::CompletionCallback& callback);
+  void GetCacheEntries(mate::Arguments* args);
+  void PruneCache(mate::Arguments* args);
   void ClearStorageData(mate::Arguments* args);
   void FlushStorageData();
+  void GetStorageUsage(mate::Arguments* args);
   void SetProxy(const net::ProxyConfig& config, const base::Closure& callback);
   void SetDownloadPath(const base::FilePath& path);
   void EnableNetworkEmulation(const mate::Dictionary& options);
@@ -73,14 +76,22 @@ class Session: public mate::TrackableObject<Session>,
   void SetCertVerifyProc(v8::Local<v8::Value> proc, mate::Arguments* args);
   void SetPermissionRequestHandler(v8::Local<v8::Value> val,
                                    mate::Arguments* args);
+  void SetPermissionCacheTTL(int64_t ttl_ms);
+  void ClearPermissionCache();
   void ClearHostResolverCache(mate::Arguments* args);
   void ClearAuthCache(mate::Arguments* args);
+  void DumpNetLog(const base::FilePath& path, mate::Arguments* args);
+  void Preconnect(const GURL& url, mate::Arguments* args);
   void AllowNTLMCredentialsForDomains(const std::string& domains);
   void SetUserAgent(const std::string& user_agent, mate::Arguments* args);
   std::string GetUserAgent();
   void GetBlobData(const std::string& uuid,
                    const AtomBlobReader::CompletionCallback& callback);
+  v8::Local<v8::Value> StreamBlobData(const std::string& uuid,
+                                      mate::Arguments* args);
   void CreateInterruptedDownload(const mate::Dictionary& options);
+  void DownloadURLSegmented(const mate::Dictionary& options,
+                            mate::Arguments* args);
   v8::Local<v8::Value> Cookies(v8::Isolate* isolate);
   v8::Local<v8::Value> Protocol(v8::Isolate* isolate);
   v8::Local<v8::Value> WebRequest(v8::Isolate* isolate);
@@ -5,6 +5,7 @@
 #include "atom/browser/api/atom_api_tray.h"
 
 #include <string>
+#include <vector>
 
 #include "atom/browser/api/atom_api_menu.h"
 #include "atom/browser/browser.h"
@@ -142,6 +143,35 @@ void Tray::SetImage(v8::Isolate* isolate, mate::Handle<NativeImage> image) {
 #endif
 }
 
+void Tray::SetImageFrames(
+    v8::Isolate* isolate,
+    const std::vector<mate::Handle<NativeImage>>& frames) {
+  image_frames_.clear();
+  image_frames_.reserve(frames.size());
+  for (const auto& frame : frames) {
+#if defined(OS_WIN)
+    // Keep our own copy, the HICON returned here is owned by the
+    // NativeImage and dies with it.
+    image_frames_.push_back(base::win::ScopedHICON(
+        CopyIcon(frame->GetHICON(GetSystemMetrics(SM_CXSMICON)))));
+#else
+    image_frames_.push_back(frame->image());
+#endif
+  }
+}
+
+void Tray::DisplayFrame(mate::Arguments* args, int index) {
+  if (index < 0 || static_cast<size_t>(index) >= image_frames_.size()) {
+    args->ThrowError("Invalid frame index");
+    return;
+  }
+#if defined(OS_WIN)
+  tray_icon_->SetImage(image_frames_[index].get());
+#else
+  tray_icon_->SetImage(image_frames_[index]);
+#endif
+}
+
 void Tray::SetPressedImage(v8::Isolate* isolate,
                            mate::Handle<NativeImage> image) {
 #if defined(OS_WIN)
@@ -208,6 +238,8 @@ void Tray::BuildPrototype(v8::Isolate* isolate,
   mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .MakeDestroyable()
       .SetMethod("setImage", &Tray::SetImage)
+      .SetMethod("setImageFrames", &Tray::SetImageFrames)
+      .SetMethod("displayFrame", &Tray::DisplayFrame)
       .SetMethod("setPressedImage", &Tray::SetPressedImage)
       .SetMethod("setToolTip", &Tray::SetToolTip)
       .SetMethod("setTitle", &Tray::SetTitle)
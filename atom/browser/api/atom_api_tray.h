@@ -14,6 +14,12 @@
 #include "atom/browser/ui/tray_icon_observer.h"
 #include "native_mate/handle.h"
 
+#if defined(OS_WIN)
+#include "base/win/scoped_gdi_object.h"
+#else
+#include "ui/gfx/image/image.h"
+#endif
+
 namespace gfx {
 class Image;
 }
@@ -61,6 +67,9 @@ class Tray : public mate::TrackableObject<Tray>,
   void OnDragEnded() override;
 
   void SetImage(v8::Isolate* isolate, mate::Handle<NativeImage> image);
+  void SetImageFrames(v8::Isolate* isolate,
+                      const std::vector<mate::Handle<NativeImage>>& frames);
+  void DisplayFrame(mate::Arguments* args, int index);
   void SetPressedImage(v8::Isolate* isolate, mate::Handle<NativeImage> image);
   void SetToolTip(const std::string& tool_tip);
   void SetTitle(const std::string& title);
@@ -74,6 +83,14 @@ class Tray : public mate::TrackableObject<Tray>,
   v8::Global<v8::Object> menu_;
   std::unique_ptr<TrayIcon> tray_icon_;
 
+  // Pre-converted animation frames, so flipping between them with
+  // displayFrame() skips the per-call image conversion.
+#if defined(OS_WIN)
+  std::vector<base::win::ScopedHICON> image_frames_;
+#else
+  std::vector<gfx::Image> image_frames_;
+#endif
+
   DISALLOW_COPY_AND_ASSIGN(Tray);
 };
 
@@ -12,8 +12,15 @@
 #include "atom/common/native_mate_converters/net_converter.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/common/node_includes.h"
+#include "base/files/file.h"
 #include "native_mate/dictionary.h"
 
+#if defined(OS_WIN)
+#include "atom/node/osfhandle.h"
+#else
+#include <unistd.h>
+#endif
+
 namespace mate {
 
 template <>
@@ -175,6 +182,7 @@ void URLRequest::BuildPrototype(v8::Isolate* isolate,
       // Request API
       .MakeDestroyable()
       .SetMethod("write", &URLRequest::Write)
+      .SetMethod("uploadFile", &URLRequest::UploadFile)
       .SetMethod("cancel", &URLRequest::Cancel)
       .SetMethod("setExtraHeader", &URLRequest::SetExtraHeader)
       .SetMethod("removeExtraHeader", &URLRequest::RemoveExtraHeader)
@@ -228,6 +236,56 @@ bool URLRequest::Write(scoped_refptr<const net::IOBufferWithSize> buffer,
   return false;
 }
 
+bool URLRequest::UploadFile(int fd,
+                            int64_t offset,
+                            int64_t length,
+                            bool is_last) {
+  if (request_state_.Canceled() || request_state_.Failed() ||
+      request_state_.Finished() || request_state_.Closed()) {
+    return false;
+  }
+
+  // Duplicate the descriptor so the upload owns its own reference to the
+  // open file; JS stays free to close the original fd at any time.
+#if defined(OS_WIN)
+  // fds crossing the JS boundary were created by node.dll's instance of the
+  // CRT, so they can only be translated back to OS handles there.
+  HANDLE handle = reinterpret_cast<HANDLE>(node::get_osfhandle(fd));
+  if (handle == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  HANDLE duplicated_handle = INVALID_HANDLE_VALUE;
+  if (!::DuplicateHandle(::GetCurrentProcess(), handle, ::GetCurrentProcess(),
+                         &duplicated_handle, 0, FALSE,
+                         DUPLICATE_SAME_ACCESS)) {
+    return false;
+  }
+  base::File file(duplicated_handle);
+#else
+  base::File file(dup(fd));
+#endif
+  if (!file.IsValid()) {
+    return false;
+  }
+
+  if (request_state_.NotStarted()) {
+    request_state_.SetFlag(RequestStateFlags::kStarted);
+    // Pin on first write.
+    Pin();
+  }
+
+  if (is_last) {
+    request_state_.SetFlag(RequestStateFlags::kFinished);
+    EmitRequestEvent(true, "finish");
+  }
+
+  DCHECK(atom_request_);
+  if (atom_request_) {
+    return atom_request_->UploadFile(std::move(file), offset, length, is_last);
+  }
+  return false;
+}
+
 void URLRequest::Cancel() {
   if (request_state_.Canceled() || request_state_.Closed()) {
     // Cancel only once.
@@ -377,6 +435,11 @@ void URLRequest::OnResponseData(
     return;
   }
   Emit("data", buffer);
+  // The JS data handler has run synchronously; hand the bytes back to the
+  // IO thread's in-flight budget so it can resume reading.
+  if (atom_request_) {
+    atom_request_->NotifyResponseDataConsumed(buffer->size());
+  }
 }
 
 void URLRequest::OnResponseCompleted() {
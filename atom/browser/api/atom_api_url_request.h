@@ -174,6 +174,7 @@ class URLRequest : public mate::EventEmitter<URLRequest> {
   bool Canceled() const;
   bool Failed() const;
   bool Write(scoped_refptr<const net::IOBufferWithSize> buffer, bool is_last);
+  bool UploadFile(int fd, int64_t offset, int64_t length, bool is_last);
   void Cancel();
   void FollowRedirect();
   bool SetExtraHeader(const std::string& name, const std::string& value);
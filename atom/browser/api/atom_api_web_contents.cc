@@ -4,8 +4,11 @@
 
 #include "atom/browser/api/atom_api_web_contents.h"
 
+#include <memory>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "atom/browser/api/atom_api_debugger.h"
 #include "atom/browser/api/atom_api_session.h"
@@ -13,6 +16,7 @@
 #include "atom/browser/atom_browser_client.h"
 #include "atom/browser/atom_browser_context.h"
 #include "atom/browser/atom_browser_main_parts.h"
+#include "atom/browser/ipc_stats.h"
 #include "atom/browser/atom_javascript_dialog_manager.h"
 #include "atom/browser/child_web_contents_tracker.h"
 #include "atom/browser/lib/bluetooth_chooser.h"
@@ -21,6 +25,7 @@
 #include "atom/browser/osr/osr_output_device.h"
 #include "atom/browser/osr/osr_render_widget_host_view.h"
 #include "atom/browser/osr/osr_web_contents_view.h"
+#include "atom/browser/print_to_pdf_scheduler.h"
 #include "atom/browser/ui/drag_util.h"
 #include "atom/browser/web_contents_permission_helper.h"
 #include "atom/browser/web_contents_preferences.h"
@@ -29,10 +34,12 @@
 #include "atom/common/api/api_messages.h"
 #include "atom/common/api/event_emitter_caller.h"
 #include "atom/common/color_util.h"
+#include "atom/common/crash_reporter/scoped_crash_key.h"
 #include "atom/common/mouse_util.h"
 #include "atom/common/native_mate_converters/blink_converter.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/content_converter.h"
+#include "atom/common/native_mate_converters/dictionary_schema.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
 #include "atom/common/native_mate_converters/gfx_converter.h"
 #include "atom/common/native_mate_converters/gurl_converter.h"
@@ -41,9 +48,14 @@
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
 #include "atom/common/options_switches.h"
+#include "base/memory/shared_memory.h"
+#include "base/pickle.h"
 #include "base/process/process_handle.h"
+#include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task_runner_util.h"
 #include "base/threading/thread_task_runner_handle.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
 #include "brightray/browser/inspectable_web_contents.h"
 #include "brightray/browser/inspectable_web_contents_view.h"
@@ -59,7 +71,9 @@
 #include "content/public/browser/navigation_details.h"
 #include "content/public/browser/navigation_entry.h"
 #include "content/public/browser/navigation_handle.h"
+#include "content/public/browser/browser_thread.h"
 #include "content/public/browser/plugin_service.h"
+#include "content/public/browser/restore_type.h"
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/render_process_host.h"
 #include "content/public/browser/render_view_host.h"
@@ -71,6 +85,8 @@
 #include "content/public/browser/storage_partition.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/common/context_menu_params.h"
+#include "content/public/common/page_state.h"
+#include "ipc/ipc_message_utils.h"
 #include "native_mate/converter.h"
 #include "native_mate/dictionary.h"
 #include "native_mate/object_template_builder.h"
@@ -79,6 +95,9 @@
 #include "third_party/WebKit/public/web/WebFindOptions.h"
 #include "ui/display/screen.h"
 #include "ui/events/base_event_utils.h"
+#include "ui/gfx/codec/png_codec.h"
+#include "ui/gfx/image/image_util.h"
+#include "ui/gfx/skia_util.h"
 
 #if !defined(OS_MACOSX)
 #include "ui/aura/window.h"
@@ -268,6 +287,55 @@ void OnCapturePageDone(const base::Callback<void(const gfx::Image&)>& callback,
   callback.Run(gfx::Image::CreateFrom1xBitmap(bitmap));
 }
 
+// Runs on the blocking pool so encoding never blocks the UI thread.
+std::unique_ptr<std::vector<unsigned char>> EncodeCapturedPage(
+    const SkBitmap& bitmap, bool use_jpeg, int quality) {
+  std::unique_ptr<std::vector<unsigned char>> encoded(
+      new std::vector<unsigned char>);
+  if (use_jpeg) {
+    gfx::JPEG1xEncodedDataFromImage(gfx::Image::CreateFrom1xBitmap(bitmap),
+                                    quality, encoded.get());
+  } else {
+    gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false, encoded.get());
+  }
+  return encoded;
+}
+
+void OnCapturePageEncoded(
+    const base::Callback<void(v8::Local<v8::Value>)>& callback,
+    std::unique_ptr<std::vector<unsigned char>> encoded) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  if (encoded->empty()) {
+    callback.Run(v8::Null(isolate));
+    return;
+  }
+  callback.Run(node::Buffer::Copy(
+      isolate, reinterpret_cast<const char*>(encoded->data()),
+      encoded->size()).ToLocalChecked());
+}
+
+void OnCapturePageScaledDone(
+    const base::Callback<void(v8::Local<v8::Value>)>& callback,
+    bool use_jpeg,
+    int quality,
+    const SkBitmap& bitmap,
+    content::ReadbackResponse response) {
+  if (response != content::ReadbackResponse::READBACK_SUCCESS) {
+    v8::Isolate* isolate = v8::Isolate::GetCurrent();
+    v8::Locker locker(isolate);
+    v8::HandleScope handle_scope(isolate);
+    callback.Run(v8::Null(isolate));
+    return;
+  }
+
+  base::PostTaskAndReplyWithResult(
+      content::BrowserThread::GetBlockingPool(), FROM_HERE,
+      base::Bind(&EncodeCapturedPage, bitmap, use_jpeg, quality),
+      base::Bind(&OnCapturePageEncoded, callback));
+}
+
 }  // namespace
 
 WebContents::WebContents(v8::Isolate* isolate,
@@ -279,7 +347,9 @@ WebContents::WebContents(v8::Isolate* isolate,
       type_(type),
       request_id_(0),
       background_throttling_(true),
-      enable_devtools_(true) {
+      enable_devtools_(true),
+      paint_dirty_only_(false),
+      dispatching_message_bytes_(0) {
   if (type == REMOTE) {
     web_contents->SetUserAgentOverride(GetBrowserContext()->GetUserAgent());
     Init(isolate);
@@ -298,9 +368,13 @@ WebContents::WebContents(v8::Isolate* isolate, const mate::Dictionary& options)
       type_(BROWSER_WINDOW),
       request_id_(0),
       background_throttling_(true),
-      enable_devtools_(true) {
+      enable_devtools_(true),
+      paint_dirty_only_(false),
+      dispatching_message_bytes_(0) {
   // Read options.
   options.Get("backgroundThrottling", &background_throttling_);
+  options.Get("paintDirtyOnly", &paint_dirty_only_);
+  options.Get("eventRateLimit", &event_rate_limit_ms_);
 
   // FIXME(zcbenz): We should read "type" parameter for better design, but
   // on Windows we have encountered a compiler bug that if we read "type"
@@ -742,7 +816,62 @@ void WebContents::MediaStoppedPlaying(const MediaPlayerInfo& video_type,
 }
 
 void WebContents::DidChangeThemeColor(SkColor theme_color) {
-  Emit("did-change-theme-color", atom::ToRGBHex(theme_color));
+  EmitThrottled("did-change-theme-color",
+                base::Bind(&WebContents::EmitThemeColorChanged,
+                           base::Unretained(this),
+                           atom::ToRGBHex(theme_color)));
+}
+
+void WebContents::EmitThemeColorChanged(const std::string& color) {
+  Emit("did-change-theme-color", color);
+}
+
+void WebContents::EmitThrottled(const std::string& name,
+                                const base::Closure& emit) {
+  if (event_rate_limit_ms_ <= 0) {
+    emit.Run();
+    return;
+  }
+
+  auto& slot = throttled_events_[name];
+  if (!slot)
+    slot.reset(new ThrottledEvent);
+  if (slot->flush_pending) {
+    // Within the cooldown window only the newest value survives.
+    slot->latest = emit;
+    return;
+  }
+
+  slot->flush_pending = true;
+  slot->flush.Reset(base::Bind(&WebContents::FlushThrottledEvent,
+                               base::Unretained(this), name));
+  content::BrowserThread::PostDelayedTask(
+      content::BrowserThread::UI, FROM_HERE, slot->flush.callback(),
+      base::TimeDelta::FromMilliseconds(event_rate_limit_ms_));
+  emit.Run();
+}
+
+void WebContents::FlushThrottledEvent(const std::string& name) {
+  auto it = throttled_events_.find(name);
+  if (it == throttled_events_.end())
+    return;
+
+  ThrottledEvent* slot = it->second.get();
+  if (slot->latest.is_null()) {
+    slot->flush_pending = false;
+    return;
+  }
+
+  // Emit the latest queued value and re-arm the window, so a steady
+  // stream of updates settles into one emit per interval.
+  base::Closure emit = slot->latest;
+  slot->latest.Reset();
+  slot->flush.Reset(base::Bind(&WebContents::FlushThrottledEvent,
+                               base::Unretained(this), name));
+  content::BrowserThread::PostDelayedTask(
+      content::BrowserThread::UI, FROM_HERE, slot->flush.callback(),
+      base::TimeDelta::FromMilliseconds(event_rate_limit_ms_));
+  emit.Run();
 }
 
 void WebContents::DocumentLoadedInFrame(
@@ -841,7 +970,13 @@ void WebContents::DidUpdateFaviconURL(
     if (url.is_valid())
       unique_urls.insert(url);
   }
-  Emit("page-favicon-updated", unique_urls);
+  EmitThrottled("page-favicon-updated",
+                base::Bind(&WebContents::EmitFaviconUpdated,
+                           base::Unretained(this), unique_urls));
+}
+
+void WebContents::EmitFaviconUpdated(const std::set<GURL>& urls) {
+  Emit("page-favicon-updated", urls);
 }
 
 void WebContents::DevToolsReloadPage() {
@@ -881,9 +1016,16 @@ void WebContents::DevToolsClosed() {
 }
 
 bool WebContents::OnMessageReceived(const IPC::Message& message) {
+  // The channel name is only known after the handler deserialized the
+  // message, so remember the raw size for it here.
+  if (message.type() == AtomViewHostMsg_Message::ID ||
+      message.type() == AtomViewHostMsg_Message_Sync::ID)
+    dispatching_message_bytes_ = message.size();
+
   bool handled = true;
   IPC_BEGIN_MESSAGE_MAP(WebContents, message)
     IPC_MESSAGE_HANDLER(AtomViewHostMsg_Message, OnRendererMessage)
+    IPC_MESSAGE_HANDLER(AtomViewHostMsg_Message_Shm, OnRendererMessageShm)
     IPC_MESSAGE_HANDLER_DELAY_REPLY(AtomViewHostMsg_Message_Sync,
                                     OnRendererMessageSync)
     IPC_MESSAGE_HANDLER_DELAY_REPLY(AtomViewHostMsg_SetTemporaryZoomLevel,
@@ -928,6 +1070,10 @@ bool WebContents::OnMessageReceived(const IPC::Message& message,
 // be destroyed on close, and WebContentsDestroyed would be called for it, so
 // we need to make sure the api::WebContents is also deleted.
 void WebContents::WebContentsDestroyed() {
+  // Drop print jobs scheduled by this WebContents; their callbacks run
+  // with an error.
+  PrintToPDFScheduler::GetInstance()->CancelJobsFor(this);
+
   // Cleanup relationships with other parts.
   RemoveFromWeakMap();
 
@@ -944,6 +1090,7 @@ void WebContents::WebContentsDestroyed() {
 
 void WebContents::NavigationEntryCommitted(
     const content::LoadCommittedDetails& details) {
+  PruneNavigationEntries();
   Emit("navigation-entry-commited", details.entry->GetURL(),
        details.is_in_page, details.did_replace_entry);
 }
@@ -984,27 +1131,40 @@ void WebContents::LoadURL(const GURL& url, const mate::Dictionary& options) {
 
   content::NavigationController::LoadURLParams params(url);
 
+  // Keys are interned once per isolate instead of allocated per call.
+  enum {
+    LOAD_URL_HTTP_REFERRER,
+    LOAD_URL_USER_AGENT,
+    LOAD_URL_EXTRA_HEADERS,
+    LOAD_URL_POST_DATA,
+    LOAD_URL_BASE_URL_FOR_DATA_URL,
+  };
+  static const mate::DictionarySchema kLoadURLSchema(
+      {"httpReferrer", "userAgent", "extraHeaders", "postData",
+       "baseURLForDataURL"});
+
   GURL http_referrer;
-  if (options.Get("httpReferrer", &http_referrer))
+  if (kLoadURLSchema.Get(options, LOAD_URL_HTTP_REFERRER, &http_referrer))
     params.referrer = content::Referrer(http_referrer.GetAsReferrer(),
                                         blink::WebReferrerPolicyDefault);
 
   std::string user_agent;
-  if (options.Get("userAgent", &user_agent))
+  if (kLoadURLSchema.Get(options, LOAD_URL_USER_AGENT, &user_agent))
     web_contents()->SetUserAgentOverride(user_agent);
 
   std::string extra_headers;
-  if (options.Get("extraHeaders", &extra_headers))
+  if (kLoadURLSchema.Get(options, LOAD_URL_EXTRA_HEADERS, &extra_headers))
     params.extra_headers = extra_headers;
 
   scoped_refptr<content::ResourceRequestBodyImpl> body;
-  if (options.Get("postData", &body)) {
+  if (kLoadURLSchema.Get(options, LOAD_URL_POST_DATA, &body)) {
     params.post_data = body;
     params.load_type = content::NavigationController::LOAD_TYPE_HTTP_POST;
   }
 
   GURL base_url_for_data_url;
-  if (options.Get("baseURLForDataURL", &base_url_for_data_url)) {
+  if (kLoadURLSchema.Get(options, LOAD_URL_BASE_URL_FOR_DATA_URL,
+                         &base_url_for_data_url)) {
     params.base_url_for_data_url = base_url_for_data_url;
     params.load_type = content::NavigationController::LOAD_TYPE_DATA;
   }
@@ -1084,6 +1244,104 @@ void WebContents::GoToOffset(int offset) {
   web_contents()->GetController().GoToOffset(offset);
 }
 
+void WebContents::SetHistoryLimit(int limit) {
+  history_limit_ = limit;
+  PruneNavigationEntries();
+}
+
+void WebContents::PruneNavigationEntries() {
+  if (history_limit_ <= 0)
+    return;
+
+  auto& controller = web_contents()->GetController();
+  // Drop the oldest entries; stop at the current one, which can not be
+  // removed.
+  while (controller.GetEntryCount() > history_limit_ &&
+         controller.GetCurrentEntryIndex() > 0) {
+    if (!controller.RemoveEntryAtIndex(0))
+      break;
+  }
+}
+
+v8::Local<v8::Value> WebContents::SerializeHistory(v8::Isolate* isolate) {
+  const auto& controller = web_contents()->GetController();
+  base::Pickle pickle;
+  pickle.WriteInt(kNavigationStateVersion);
+  pickle.WriteInt(controller.GetEntryCount());
+  pickle.WriteInt(controller.GetCurrentEntryIndex());
+  for (int i = 0; i < controller.GetEntryCount(); ++i) {
+    content::NavigationEntry* entry = controller.GetEntryAtIndex(i);
+    pickle.WriteString(entry->GetURL().spec());
+    pickle.WriteString(entry->GetVirtualURL().spec());
+    pickle.WriteString16(entry->GetTitle());
+    pickle.WriteString(entry->GetReferrer().url.spec());
+    pickle.WriteInt(entry->GetReferrer().policy);
+    pickle.WriteString(entry->GetPageState().ToEncodedData());
+  }
+  return node::Buffer::Copy(isolate,
+                            static_cast<const char*>(pickle.data()),
+                            pickle.size()).ToLocalChecked();
+}
+
+bool WebContents::RestoreHistory(v8::Local<v8::Value> state) {
+  if (!node::Buffer::HasInstance(state))
+    return false;
+
+  auto& controller = web_contents()->GetController();
+  // Restoring is only possible before the WebContents has navigated.
+  if (controller.GetEntryCount() > 0 || controller.GetPendingEntry())
+    return false;
+
+  base::Pickle pickle(node::Buffer::Data(state),
+                      node::Buffer::Length(state));
+  base::PickleIterator iter(pickle);
+  int version = 0;
+  int count = 0;
+  int current_index = 0;
+  if (!iter.ReadInt(&version) || version != kNavigationStateVersion ||
+      !iter.ReadInt(&count) || !iter.ReadInt(&current_index) ||
+      count <= 0 || current_index < 0 || current_index >= count)
+    return false;
+
+  std::vector<std::unique_ptr<content::NavigationEntry>> entries;
+  for (int i = 0; i < count; ++i) {
+    std::string url;
+    std::string virtual_url;
+    base::string16 title;
+    std::string referrer_url;
+    int referrer_policy = 0;
+    std::string page_state;
+    if (!iter.ReadString(&url) || !iter.ReadString(&virtual_url) ||
+        !iter.ReadString16(&title) || !iter.ReadString(&referrer_url) ||
+        !iter.ReadInt(&referrer_policy) || !iter.ReadString(&page_state))
+      return false;
+
+    auto entry = content::NavigationController::CreateNavigationEntry(
+        GURL(url),
+        content::Referrer(
+            GURL(referrer_url),
+            static_cast<blink::WebReferrerPolicy>(referrer_policy)),
+        ui::PAGE_TRANSITION_RELOAD,
+        false,
+        std::string(),
+        web_contents()->GetBrowserContext());
+    entry->SetVirtualURL(GURL(virtual_url));
+    entry->SetTitle(title);
+    if (page_state.empty())
+      entry->SetPageState(content::PageState::CreateFromURL(GURL(url)));
+    else
+      entry->SetPageState(
+          content::PageState::CreateFromEncodedData(page_state));
+    entries.push_back(std::move(entry));
+  }
+
+  controller.Restore(current_index,
+                     content::RestoreType::LAST_SESSION_EXITED_CLEANLY,
+                     &entries);
+  controller.LoadIfNecessary();
+  return true;
+}
+
 const std::string WebContents::GetWebRTCIPHandlingPolicy() const {
   return web_contents()->
     GetMutableRendererPrefs()->webrtc_ip_handling_policy;
@@ -1116,8 +1374,12 @@ std::string WebContents::GetUserAgent() {
 
 bool WebContents::SavePage(const base::FilePath& full_file_path,
                            const content::SavePageType& save_type,
-                           const SavePageHandler::SavePageCallback& callback) {
-  auto handler = new SavePageHandler(web_contents(), callback);
+                           const SavePageHandler::SavePageCallback& callback,
+                           mate::Arguments* args) {
+  SavePageHandler::ProgressCallback progress_callback;
+  args->GetNext(&progress_callback);
+  auto handler =
+      new SavePageHandler(web_contents(), callback, progress_callback);
   return handler->Handle(full_file_path, save_type);
 }
 
@@ -1147,6 +1409,16 @@ void WebContents::OpenDevTools(mate::Arguments* args) {
   managed_web_contents()->ShowDevTools();
 }
 
+void WebContents::PreloadDevTools() {
+  if (type_ == REMOTE)
+    return;
+
+  if (!enable_devtools_)
+    return;
+
+  managed_web_contents()->PreloadDevTools();
+}
+
 void WebContents::CloseDevTools() {
   if (type_ == REMOTE)
     return;
@@ -1269,10 +1541,79 @@ std::vector<printing::PrinterBasicInfo> WebContents::GetPrinterList() {
   return printers;
 }
 
+namespace {
+
+// Bumped whenever the binary navigation state layout changes, so stale
+// snapshots from older builds are rejected instead of misparsed.
+const int kNavigationStateVersion = 1;
+
+PrintToPDFScheduler::Priority PrintToPDFPriorityFromString(
+    const std::string& name) {
+  if (name == "high")
+    return PrintToPDFScheduler::PRIORITY_HIGH;
+  if (name == "low")
+    return PrintToPDFScheduler::PRIORITY_LOW;
+  return PrintToPDFScheduler::PRIORITY_NORMAL;
+}
+
+void OnScheduledPrintToPDFDone(
+    const WebContents::PrintToPDFCallback& callback,
+    const base::Callback<bool()>& done,
+    v8::Local<v8::Value> error,
+    v8::Local<v8::Value> data) {
+  // The scheduler says whether the job is still live; a job that already
+  // timed out or was cancelled has run its callback with an error.
+  if (done.Run())
+    callback.Run(error, data);
+}
+
+void StartScheduledPrintToPDF(
+    content::WebContents* web_contents,
+    std::unique_ptr<base::DictionaryValue> settings,
+    const WebContents::PrintToPDFCallback& callback,
+    const base::Callback<bool()>& done) {
+  printing::PrintPreviewMessageHandler::FromWebContents(web_contents)->
+      PrintToPDF(*settings,
+                 base::Bind(&OnScheduledPrintToPDFDone, callback, done));
+}
+
+void DropScheduledPrintToPDF(const WebContents::PrintToPDFCallback& callback,
+                             const std::string& error) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  callback.Run(v8::Exception::Error(mate::StringToV8(isolate, error)),
+               v8::Null(isolate));
+}
+
+}  // namespace
+
 void WebContents::PrintToPDF(const base::DictionaryValue& setting,
                              const PrintToPDFCallback& callback) {
-  printing::PrintPreviewMessageHandler::FromWebContents(web_contents())->
-      PrintToPDF(setting, callback);
+  std::unique_ptr<base::DictionaryValue> settings = setting.CreateDeepCopy();
+
+  // The scheduler options are for us, not for the print preview code in
+  // the renderer, so strip them from the forwarded settings.
+  std::string priority_name;
+  settings->GetString("schedulerPriority", &priority_name);
+  settings->Remove("schedulerPriority", nullptr);
+
+  int timeout_ms = 60 * 1000;
+  settings->GetInteger("schedulerTimeout", &timeout_ms);
+  settings->Remove("schedulerTimeout", nullptr);
+
+  int concurrency = 0;
+  if (settings->GetInteger("schedulerConcurrency", &concurrency))
+    PrintToPDFScheduler::GetInstance()->SetMaxConcurrency(concurrency);
+  settings->Remove("schedulerConcurrency", nullptr);
+
+  PrintToPDFScheduler::GetInstance()->Schedule(
+      this,
+      PrintToPDFPriorityFromString(priority_name),
+      base::TimeDelta::FromMilliseconds(timeout_ms),
+      base::Bind(&StartScheduledPrintToPDF, web_contents(),
+                 base::Passed(&settings), callback),
+      base::Bind(&DropScheduledPrintToPDF, callback));
 }
 
 void WebContents::AddWorkSpace(mate::Arguments* args,
@@ -1396,7 +1737,15 @@ void WebContents::TabTraverse(bool reverse) {
 bool WebContents::SendIPCMessage(bool all_frames,
                                  const base::string16& channel,
                                  const base::ListValue& args) {
-  return Send(new AtomViewMsg_Message(routing_id(), all_frames, channel, args));
+  // Constructing the message serializes the arguments, which is the part
+  // of the send that scales with payload size.
+  base::TimeTicks start = base::TimeTicks::Now();
+  auto* message =
+      new AtomViewMsg_Message(routing_id(), all_frames, channel, args);
+  std::string channel_name = base::UTF16ToUTF8(channel);
+  ipc_stats::RecordSerialize(channel_name, base::TimeTicks::Now() - start);
+  ipc_stats::RecordMessage(channel_name, message->size());
+  return Send(message);
 }
 
 void WebContents::SendInputEvent(v8::Isolate* isolate,
@@ -1434,6 +1783,14 @@ void WebContents::SendInputEvent(v8::Isolate* isolate,
       isolate, "Invalid event object")));
 }
 
+void WebContents::SendInputEvents(
+    v8::Isolate* isolate, const std::vector<v8::Local<v8::Value>>& events) {
+  // One binding crossing and handle scope for the whole array; callers
+  // forwarding streams of input events use this instead of per-event calls.
+  for (const auto& event : events)
+    SendInputEvent(isolate, event);
+}
+
 void WebContents::BeginFrameSubscription(mate::Arguments* args) {
   bool only_dirty = false;
   FrameSubscriber::FrameCaptureCallback callback;
@@ -1448,6 +1805,7 @@ void WebContents::BeginFrameSubscription(mate::Arguments* args) {
   if (view) {
     std::unique_ptr<FrameSubscriber> frame_subscriber(new FrameSubscriber(
         isolate(), view, callback, only_dirty));
+    frame_subscriber_ = frame_subscriber->GetWeakPtr();
     view->BeginFrameSubscription(std::move(frame_subscriber));
   }
 }
@@ -1458,6 +1816,19 @@ void WebContents::EndFrameSubscription() {
     view->EndFrameSubscription();
 }
 
+v8::Local<v8::Value> WebContents::GetOSRStats(v8::Isolate* isolate) {
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+  if (frame_subscriber_) {
+    dict.Set("framesDelivered", frame_subscriber_->frames_delivered());
+    dict.Set("framesDropped", frame_subscriber_->frames_dropped());
+    dict.Set("lastCaptureLatency",
+             frame_subscriber_->last_capture_latency_ms());
+    dict.Set("averageCaptureLatency",
+             frame_subscriber_->average_capture_latency_ms());
+  }
+  return dict.GetHandle();
+}
+
 void WebContents::StartDrag(const mate::Dictionary& item,
                             mate::Arguments* args) {
   base::FilePath file;
@@ -1533,7 +1904,63 @@ void WebContents::CapturePage(mate::Arguments* args) {
                         kBGRA_8888_SkColorType);
 }
 
+void WebContents::CapturePageScaled(mate::Arguments* args) {
+  gfx::Rect rect;
+  mate::Dictionary options;
+  base::Callback<void(v8::Local<v8::Value>)> callback;
+
+  if (!(args->Length() == 2 && args->GetNext(&options)
+                            && args->GetNext(&callback)) &&
+      !(args->Length() == 3 && args->GetNext(&rect)
+                            && args->GetNext(&options)
+                            && args->GetNext(&callback))) {
+    args->ThrowError();
+    return;
+  }
+
+  gfx::Size target_size;
+  options.Get("size", &target_size);
+  if (target_size.IsEmpty()) {
+    args->ThrowError("Must specify non-empty 'size' option");
+    return;
+  }
+
+  std::string format = "png";
+  options.Get("format", &format);
+  bool use_jpeg = format == "jpeg";
+  if (!use_jpeg && format != "png") {
+    args->ThrowError("'format' must be 'png' or 'jpeg'");
+    return;
+  }
+  int quality = 80;
+  options.Get("quality", &quality);
+
+  const auto view = web_contents()->GetRenderWidgetHostView();
+  if (!view) {
+    callback.Run(v8::Null(args->isolate()));
+    return;
+  }
+
+  // Capture full page if user doesn't specify a |rect|.
+  const gfx::Size view_size = rect.IsEmpty() ? view->GetViewBounds().size() :
+                                               rect.size();
+
+  // Request readback already scaled to the target size, so the compositor
+  // does the downscale and full-resolution pixels never cross to the CPU.
+  view->CopyFromSurface(gfx::Rect(rect.origin(), view_size),
+                        target_size,
+                        base::Bind(&OnCapturePageScaledDone, callback,
+                                   use_jpeg, quality),
+                        kBGRA_8888_SkColorType);
+}
+
 void WebContents::OnCursorChange(const content::WebCursor& cursor) {
+  EmitThrottled("cursor-changed",
+                base::Bind(&WebContents::EmitCursorChanged,
+                           base::Unretained(this), cursor));
+}
+
+void WebContents::EmitCursorChanged(const content::WebCursor& cursor) {
   content::WebCursor::CursorInfo info;
   cursor.GetCursorInfo(&info);
 
@@ -1566,6 +1993,19 @@ bool WebContents::IsOffScreenOrEmbedderOffscreen() const {
 }
 
 void WebContents::OnPaint(const gfx::Rect& dirty_rect, const SkBitmap& bitmap) {
+  if (paint_dirty_only_ &&
+      dirty_rect != gfx::Rect(bitmap.width(), bitmap.height())) {
+    // Copy out only the damaged scanlines, so mostly-static content pays
+    // for the pixels that changed instead of the whole frame; the dirty
+    // rect tells the consumer where the region belongs.
+    SkBitmap dirty;
+    SkBitmap copy;
+    if (bitmap.extractSubset(&dirty, gfx::RectToSkIRect(dirty_rect)) &&
+        dirty.copyTo(&copy)) {
+      Emit("paint", dirty_rect, gfx::Image::CreateFrom1xBitmap(copy));
+      return;
+    }
+  }
   Emit("paint", dirty_rect, gfx::Image::CreateFrom1xBitmap(bitmap));
 }
 
@@ -1617,6 +2057,33 @@ int WebContents::GetFrameRate() const {
   return osr_rwhv ? osr_rwhv->GetFrameRate() : 0;
 }
 
+void WebContents::SetFrameRateAutoThrottle(bool enabled) {
+  if (!IsOffScreen())
+    return;
+
+  auto* osr_rwhv = static_cast<OffScreenRenderWidgetHostView*>(
+      web_contents()->GetRenderWidgetHostView());
+  if (osr_rwhv)
+    osr_rwhv->SetFrameRateAutoThrottle(enabled);
+}
+
+bool WebContents::IsFrameRateAutoThrottled() const {
+  if (!IsOffScreen())
+    return false;
+
+  const auto* osr_rwhv = static_cast<OffScreenRenderWidgetHostView*>(
+      web_contents()->GetRenderWidgetHostView());
+  return osr_rwhv && osr_rwhv->IsFrameRateAutoThrottled();
+}
+
+void WebContents::SetPaintDirtyOnly(bool dirty_only) {
+  paint_dirty_only_ = dirty_only;
+}
+
+bool WebContents::IsPaintDirtyOnly() const {
+  return paint_dirty_only_;
+}
+
 void WebContents::Invalidate() {
   if (IsOffScreen()) {
     auto* osr_rwhv = static_cast<OffScreenRenderWidgetHostView*>(
@@ -1755,11 +2222,15 @@ void WebContents::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("_goBack", &WebContents::GoBack)
       .SetMethod("_goForward", &WebContents::GoForward)
       .SetMethod("_goToOffset", &WebContents::GoToOffset)
+      .SetMethod("_setHistoryLimit", &WebContents::SetHistoryLimit)
+      .SetMethod("_serializeHistory", &WebContents::SerializeHistory)
+      .SetMethod("_restoreHistory", &WebContents::RestoreHistory)
       .SetMethod("isCrashed", &WebContents::IsCrashed)
       .SetMethod("setUserAgent", &WebContents::SetUserAgent)
       .SetMethod("getUserAgent", &WebContents::GetUserAgent)
       .SetMethod("savePage", &WebContents::SavePage)
       .SetMethod("openDevTools", &WebContents::OpenDevTools)
+      .SetMethod("preloadDevTools", &WebContents::PreloadDevTools)
       .SetMethod("closeDevTools", &WebContents::CloseDevTools)
       .SetMethod("isDevToolsOpened", &WebContents::IsDevToolsOpened)
       .SetMethod("isDevToolsFocused", &WebContents::IsDevToolsFocused)
@@ -1789,9 +2260,11 @@ void WebContents::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("tabTraverse", &WebContents::TabTraverse)
       .SetMethod("_send", &WebContents::SendIPCMessage)
       .SetMethod("sendInputEvent", &WebContents::SendInputEvent)
+      .SetMethod("sendInputEvents", &WebContents::SendInputEvents)
       .SetMethod("beginFrameSubscription",
                  &WebContents::BeginFrameSubscription)
       .SetMethod("endFrameSubscription", &WebContents::EndFrameSubscription)
+      .SetMethod("getOSRStats", &WebContents::GetOSRStats)
       .SetMethod("startDrag", &WebContents::StartDrag)
       .SetMethod("setSize", &WebContents::SetSize)
       .SetMethod("isGuest", &WebContents::IsGuest)
@@ -1801,6 +2274,12 @@ void WebContents::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("isPainting", &WebContents::IsPainting)
       .SetMethod("setFrameRate", &WebContents::SetFrameRate)
       .SetMethod("getFrameRate", &WebContents::GetFrameRate)
+      .SetMethod("setFrameRateAutoThrottle",
+                 &WebContents::SetFrameRateAutoThrottle)
+      .SetMethod("isFrameRateAutoThrottled",
+                 &WebContents::IsFrameRateAutoThrottled)
+      .SetMethod("setPaintDirtyOnly", &WebContents::SetPaintDirtyOnly)
+      .SetMethod("isPaintDirtyOnly", &WebContents::IsPaintDirtyOnly)
       .SetMethod("invalidate", &WebContents::Invalidate)
       .SetMethod("setZoomLevel", &WebContents::SetZoomLevel)
       .SetMethod("_getZoomLevel", &WebContents::GetZoomLevel)
@@ -1822,6 +2301,7 @@ void WebContents::BuildPrototype(v8::Isolate* isolate,
                  &WebContents::ShowDefinitionForSelection)
       .SetMethod("copyImageAt", &WebContents::CopyImageAt)
       .SetMethod("capturePage", &WebContents::CapturePage)
+      .SetMethod("capturePageScaled", &WebContents::CapturePageScaled)
       .SetMethod("setEmbedder", &WebContents::SetEmbedder)
       .SetMethod("setWebRTCIPHandlingPolicy",
                  &WebContents::SetWebRTCIPHandlingPolicy)
@@ -1840,13 +2320,137 @@ AtomBrowserContext* WebContents::GetBrowserContext() const {
 
 void WebContents::OnRendererMessage(const base::string16& channel,
                                     const base::ListValue& args) {
+  TRACE_EVENT1("electron", "WebContents::OnRendererMessage",
+               "channel", base::UTF16ToUTF8(channel));
+  crash_reporter::ScopedCrashKey channel_key("ipc-channel",
+                                             base::UTF16ToUTF8(channel));
+  ipc_stats::RecordMessage(base::UTF16ToUTF8(channel),
+                           dispatching_message_bytes_);
   // webContents.emit(channel, new Event(), args...);
   Emit(base::UTF16ToUTF8(channel), args);
 }
 
+namespace {
+
+// Matches kSharedMemoryThreshold in atom_api_renderer_ipc.cc: payloads this
+// large arrived through shared memory and should be handed to V8 without
+// being copied into the heap again.
+const size_t kExternalizeThreshold = 256 * 1024;
+
+// Backs an externalized V8 string with the bytes read out of shared memory.
+class ExternalizedString : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit ExternalizedString(std::string data) : data_(std::move(data)) {}
+  const char* data() const override { return data_.data(); }
+  size_t length() const override { return data_.size(); }
+
+ private:
+  std::string data_;
+
+  DISALLOW_COPY_AND_ASSIGN(ExternalizedString);
+};
+
+// Owns the binary values that zero-copy Buffers point into; deleted when the
+// last such Buffer is garbage collected.
+struct ShmBinaryHolder {
+  std::vector<std::unique_ptr<base::Value>> values;
+  int buffers = 0;
+};
+
+void ReleaseShmBinary(char* data, void* hint) {
+  ShmBinaryHolder* holder = static_cast<ShmBinaryHolder*>(hint);
+  if (--holder->buffers == 0)
+    delete holder;
+}
+
+// Converts an argument list received through shared memory to V8. Large
+// ASCII strings become externalized strings and large binary blobs become
+// Buffers wrapping the parsed bytes directly; everything else goes through
+// the regular converter. Only top level arguments are inspected, which is
+// where ipcRenderer.send puts its payloads.
+v8::Local<v8::Value> ConvertShmArguments(v8::Isolate* isolate,
+                                         base::ListValue* args) {
+  std::vector<std::pair<size_t, v8::Local<v8::Value>>> externalized;
+  ShmBinaryHolder* holder = new ShmBinaryHolder;
+  for (size_t i = 0; i < args->GetSize(); ++i) {
+    base::Value* value = nullptr;
+    if (!args->Get(i, &value))
+      continue;
+    if (value->GetType() == base::Value::Type::STRING) {
+      std::string str;
+      if (!value->GetAsString(&str) || str.size() < kExternalizeThreshold ||
+          !base::IsStringASCII(str))
+        continue;
+      auto* resource = new ExternalizedString(std::move(str));
+      v8::Local<v8::String> external;
+      if (!v8::String::NewExternalOneByte(isolate, resource)
+               .ToLocal(&external))
+        continue;
+      externalized.push_back(std::make_pair(i, external.As<v8::Value>()));
+      args->Set(i, base::Value::CreateNullValue());
+    } else if (value->GetType() == base::Value::Type::BINARY) {
+      if (static_cast<base::BinaryValue*>(value)->GetSize() <
+          kExternalizeThreshold)
+        continue;
+      std::unique_ptr<base::Value> owned;
+      if (!args->Remove(i, &owned))
+        continue;
+      auto* binary = static_cast<base::BinaryValue*>(owned.get());
+      v8::Local<v8::Object> buffer;
+      if (!node::Buffer::New(isolate, binary->GetBuffer(), binary->GetSize(),
+                             &ReleaseShmBinary, holder).ToLocal(&buffer)) {
+        args->Insert(i, std::move(owned));
+        continue;
+      }
+      holder->values.push_back(std::move(owned));
+      holder->buffers++;
+      externalized.push_back(std::make_pair(i, buffer.As<v8::Value>()));
+      args->Insert(i, base::Value::CreateNullValue());
+    }
+  }
+  if (holder->buffers == 0)
+    delete holder;
+
+  v8::Local<v8::Value> converted = mate::ConvertToV8(isolate, *args);
+  if (!externalized.empty() && converted->IsArray()) {
+    v8::Local<v8::Array> array = converted.As<v8::Array>();
+    for (const auto& pair : externalized)
+      array->Set(static_cast<uint32_t>(pair.first), pair.second);
+  }
+  return converted;
+}
+
+}  // namespace
+
+void WebContents::OnRendererMessageShm(const base::string16& channel,
+                                       const base::SharedMemoryHandle& handle,
+                                       uint32_t size) {
+  TRACE_EVENT2("electron", "WebContents::OnRendererMessageShm",
+               "channel", base::UTF16ToUTF8(channel),
+               "bytes", size);
+  ipc_stats::RecordMessage(base::UTF16ToUTF8(channel), size);
+  base::SharedMemory shm(handle, true /* read_only */);
+  base::ListValue args;
+  if (shm.Map(size)) {
+    base::Pickle pickle(static_cast<const char*>(shm.memory()), size);
+    base::PickleIterator iter(pickle);
+    if (!IPC::ReadParam(&pickle, &iter, &args))
+      args.Clear();
+  }
+  v8::Locker locker(isolate());
+  v8::HandleScope handle_scope(isolate());
+  Emit(base::UTF16ToUTF8(channel), ConvertShmArguments(isolate(), &args));
+}
+
 void WebContents::OnRendererMessageSync(const base::string16& channel,
                                         const base::ListValue& args,
                                         IPC::Message* message) {
+  TRACE_EVENT1("electron", "WebContents::OnRendererMessageSync",
+               "channel", base::UTF16ToUTF8(channel));
+  crash_reporter::ScopedCrashKey channel_key("ipc-channel",
+                                             base::UTF16ToUTF8(channel));
+  ipc_stats::RecordMessage(base::UTF16ToUTF8(channel),
+                           dispatching_message_bytes_);
   // webContents.emit(channel, new Event(sender, message), args...);
   EmitWithSender(base::UTF16ToUTF8(channel), web_contents(), message, args);
 }
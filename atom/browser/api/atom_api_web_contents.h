@@ -5,6 +5,9 @@
 #ifndef ATOM_BROWSER_API_ATOM_API_WEB_CONTENTS_H_
 #define ATOM_BROWSER_API_ATOM_API_WEB_CONTENTS_H_
 
+#include <map>
+#include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -13,6 +16,8 @@
 #include "atom/browser/api/trackable_object.h"
 #include "atom/browser/common_web_contents_delegate.h"
 #include "atom/browser/ui/autofill_popup.h"
+#include "base/cancelable_callback.h"
+#include "base/memory/shared_memory_handle.h"
 #include "content/common/cursors/webcursor.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "content/public/common/favicon_url.h"
@@ -97,6 +102,9 @@ class WebContents : public mate::TrackableObject<WebContents>,
   void GoBack();
   void GoForward();
   void GoToOffset(int offset);
+  void SetHistoryLimit(int limit);
+  v8::Local<v8::Value> SerializeHistory(v8::Isolate* isolate);
+  bool RestoreHistory(v8::Local<v8::Value> state);
   const std::string GetWebRTCIPHandlingPolicy() const;
   void SetWebRTCIPHandlingPolicy(const std::string& webrtc_ip_handling_policy);
   bool IsCrashed() const;
@@ -105,8 +113,10 @@ class WebContents : public mate::TrackableObject<WebContents>,
   void InsertCSS(const std::string& css);
   bool SavePage(const base::FilePath& full_file_path,
                 const content::SavePageType& save_type,
-                const SavePageHandler::SavePageCallback& callback);
+                const SavePageHandler::SavePageCallback& callback,
+                mate::Arguments* args);
   void OpenDevTools(mate::Arguments* args);
+  void PreloadDevTools();
   void CloseDevTools();
   bool IsDevToolsOpened();
   bool IsDevToolsFocused();
@@ -160,10 +170,13 @@ class WebContents : public mate::TrackableObject<WebContents>,
 
   // Send WebInputEvent to the page.
   void SendInputEvent(v8::Isolate* isolate, v8::Local<v8::Value> input_event);
+  void SendInputEvents(v8::Isolate* isolate,
+                       const std::vector<v8::Local<v8::Value>>& events);
 
   // Subscribe to the frame updates.
   void BeginFrameSubscription(mate::Arguments* args);
   void EndFrameSubscription();
+  v8::Local<v8::Value> GetOSRStats(v8::Isolate* isolate);
 
   // Dragging native items.
   void StartDrag(const mate::Dictionary& item, mate::Arguments* args);
@@ -171,6 +184,7 @@ class WebContents : public mate::TrackableObject<WebContents>,
   // Captures the page with |rect|, |callback| would be called when capturing is
   // done.
   void CapturePage(mate::Arguments* args);
+  void CapturePageScaled(mate::Arguments* args);
 
   // Methods for creating <webview>.
   void SetSize(const SetSizeParams& params);
@@ -185,6 +199,10 @@ class WebContents : public mate::TrackableObject<WebContents>,
   bool IsPainting() const;
   void SetFrameRate(int frame_rate);
   int GetFrameRate() const;
+  void SetFrameRateAutoThrottle(bool enabled);
+  bool IsFrameRateAutoThrottled() const;
+  void SetPaintDirtyOnly(bool dirty_only);
+  bool IsPaintDirtyOnly() const;
   void Invalidate();
   gfx::Size GetSizeForNewRenderView(content::WebContents*) const override;
 
@@ -351,8 +369,27 @@ class WebContents : public mate::TrackableObject<WebContents>,
   void DevToolsClosed() override;
 
  private:
+  // State of one rate-limited event: whether a cooldown window is open,
+  // and the newest emit queued during it (latest value wins).
+  struct ThrottledEvent {
+    bool flush_pending = false;
+    base::Closure latest;
+    base::CancelableClosure flush;
+  };
+
   AtomBrowserContext* GetBrowserContext() const;
 
+  // Drops the oldest navigation entries when over the history limit.
+  void PruneNavigationEntries();
+
+  // Runs |emit| now or, when the event's cooldown window is open, queues
+  // it to run at the end of the window, replacing any older queued emit.
+  void EmitThrottled(const std::string& name, const base::Closure& emit);
+  void FlushThrottledEvent(const std::string& name);
+  void EmitThemeColorChanged(const std::string& color);
+  void EmitFaviconUpdated(const std::set<GURL>& urls);
+  void EmitCursorChanged(const content::WebCursor& cursor);
+
   uint32_t GetNextRequestId() {
     return ++request_id_;
   }
@@ -364,6 +401,11 @@ class WebContents : public mate::TrackableObject<WebContents>,
   void OnRendererMessage(const base::string16& channel,
                          const base::ListValue& args);
 
+  // Called when received a message whose payload lives in shared memory.
+  void OnRendererMessageShm(const base::string16& channel,
+                            const base::SharedMemoryHandle& handle,
+                            uint32_t size);
+
   // Called when received a synchronous message from renderer.
   void OnRendererMessageSync(const base::string16& channel,
                              const base::ListValue& args,
@@ -402,6 +444,26 @@ class WebContents : public mate::TrackableObject<WebContents>,
   // Whether to enable devtools.
   bool enable_devtools_;
 
+  // Whether offscreen paint events deliver only the damaged region.
+  bool paint_dirty_only_;
+
+  // Raw size of the AtomViewHostMsg_Message currently being dispatched,
+  // remembered in OnMessageReceived so the channel handlers can attribute
+  // the bytes. Dispatch is synchronous on the UI thread.
+  size_t dispatching_message_bytes_;
+
+  // The active frame subscriber, for getOSRStats; owned by the view.
+  base::WeakPtr<FrameSubscriber> frame_subscriber_;
+
+  // Maximum number of navigation entries to keep; 0 means unlimited.
+  int history_limit_ = 0;
+
+  // Minimum interval between emits of a rate-limited event; 0 disables
+  // the limiting. Set with the eventRateLimit web preference.
+  int event_rate_limit_ms_ = 0;
+
+  std::map<std::string, std::unique_ptr<ThrottledEvent>> throttled_events_;
+
   DISALLOW_COPY_AND_ASSIGN(WebContents);
 };
 
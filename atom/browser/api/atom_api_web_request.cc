@@ -4,13 +4,18 @@
 
 #include "atom/browser/api/atom_api_web_request.h"
 
+#include <memory>
 #include <string>
+#include <utility>
 
 #include "atom/browser/atom_browser_context.h"
 #include "atom/browser/net/atom_network_delegate.h"
+#include "atom/browser/net/request_qos_rules.h"
+#include "atom/browser/net/web_request_rules.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/net_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
+#include "base/memory/ptr_util.h"
 #include "content/public/browser/browser_thread.h"
 #include "native_mate/dictionary.h"
 #include "native_mate/object_template_builder.h"
@@ -80,6 +85,46 @@ void WebRequest::SetListener(Method method, Event type, mate::Arguments* args) {
                                      patterns, listener));
 }
 
+void WebRequest::SetRules(mate::Arguments* args) {
+  // Array of rule objects, or null to clear.
+  std::unique_ptr<WebRequestRules> rules;
+  base::ListValue rule_list;
+  v8::Local<v8::Value> value;
+  if (args->GetNext(&rule_list)) {
+    rules = base::MakeUnique<WebRequestRules>();
+    rules->Parse(rule_list);
+  } else if (!(args->GetNext(&value) && value->IsNull())) {
+    args->ThrowError("Must pass null or an Array of rules");
+    return;
+  }
+
+  auto delegate = browser_context_->network_delegate();
+  BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::Bind(&AtomNetworkDelegate::SetRulesInIO,
+                 base::Unretained(delegate), base::Passed(&rules)));
+}
+
+void WebRequest::SetQoS(mate::Arguments* args) {
+  // Array of QoS class objects, or null to clear.
+  std::unique_ptr<RequestQoSRules> rules;
+  base::ListValue class_list;
+  v8::Local<v8::Value> value;
+  if (args->GetNext(&class_list)) {
+    rules = base::MakeUnique<RequestQoSRules>();
+    rules->Parse(class_list);
+  } else if (!(args->GetNext(&value) && value->IsNull())) {
+    args->ThrowError("Must pass null or an Array of QoS classes");
+    return;
+  }
+
+  auto delegate = browser_context_->network_delegate();
+  BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::Bind(&AtomNetworkDelegate::SetQoSRulesInIO,
+                 base::Unretained(delegate), base::Passed(&rules)));
+}
+
 // static
 mate::Handle<WebRequest> WebRequest::Create(
     v8::Isolate* isolate,
@@ -115,7 +160,9 @@ void WebRequest::BuildPrototype(v8::Isolate* isolate,
                     AtomNetworkDelegate::kOnCompleted>)
       .SetMethod("onErrorOccurred",
                  &WebRequest::SetSimpleListener<
-                    AtomNetworkDelegate::kOnErrorOccurred>);
+                    AtomNetworkDelegate::kOnErrorOccurred>)
+      .SetMethod("setRules", &WebRequest::SetRules)
+      .SetMethod("setQoS", &WebRequest::SetQoS);
 }
 
 }  // namespace api
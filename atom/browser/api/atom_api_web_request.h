@@ -36,6 +36,14 @@ class WebRequest : public mate::TrackableObject<WebRequest> {
   template<typename Listener, typename Method, typename Event>
   void SetListener(Method method, Event type, mate::Arguments* args);
 
+  // Installs declarative rules handled on the IO thread without calling
+  // into JS; see WebRequestRules for the rule format.
+  void SetRules(mate::Arguments* args);
+
+  // Installs QoS classes that map URL patterns to request priorities; see
+  // RequestQoSRules for the class format.
+  void SetQoS(mate::Arguments* args);
+
  private:
   scoped_refptr<AtomBrowserContext> browser_context_;
 
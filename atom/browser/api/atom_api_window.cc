@@ -36,6 +36,40 @@
 
 #include "atom/common/node_includes.h"
 
+namespace mate {
+
+template<>
+struct Converter<atom::WindowState> {
+  static bool FromV8(v8::Isolate* isolate, v8::Handle<v8::Value> val,
+                     atom::WindowState* out) {
+    mate::Dictionary dict;
+    if (!ConvertFromV8(isolate, val, &dict))
+      return false;
+    if (!dict.Get("bounds", &(out->bounds)))
+      return false;
+    dict.Get("displayId", &(out->display_id));
+    dict.Get("maximized", &(out->maximized));
+    dict.Get("minimized", &(out->minimized));
+    dict.Get("fullscreen", &(out->fullscreen));
+    dict.Get("alwaysOnTop", &(out->always_on_top));
+    return true;
+  }
+
+  static v8::Local<v8::Value> ToV8(v8::Isolate* isolate,
+                                   const atom::WindowState& state) {
+    mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+    dict.Set("bounds", state.bounds);
+    dict.Set("displayId", state.display_id);
+    dict.Set("maximized", state.maximized);
+    dict.Set("minimized", state.minimized);
+    dict.Set("fullscreen", state.fullscreen);
+    dict.Set("alwaysOnTop", state.always_on_top);
+    return dict.GetHandle();
+  }
+};
+
+}  // namespace mate
+
 #if defined(OS_WIN)
 namespace mate {
 
@@ -235,6 +269,10 @@ void Window::OnWindowResize() {
   Emit("resize");
 }
 
+void Window::OnWindowResized() {
+  Emit("resized");
+}
+
 void Window::OnWindowMove() {
   Emit("move");
 }
@@ -243,6 +281,10 @@ void Window::OnWindowMoved() {
   Emit("moved");
 }
 
+void Window::OnWindowStateCaptured(const WindowState& state) {
+  Emit("window-state-captured", state);
+}
+
 void Window::OnWindowEnterFullScreen() {
   Emit("enter-full-screen");
 }
@@ -412,6 +454,14 @@ gfx::Rect Window::GetBounds() {
   return window_->GetBounds();
 }
 
+WindowState Window::GetWindowState() {
+  return window_->GetWindowState();
+}
+
+void Window::RestoreWindowState(const WindowState& state) {
+  window_->RestoreWindowState(state);
+}
+
 void Window::SetContentBounds(const gfx::Rect& bounds, mate::Arguments* args) {
   bool animate = false;
   args->GetNext(&animate);
@@ -949,6 +999,8 @@ void Window::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("getNativeWindowHandle", &Window::GetNativeWindowHandle)
       .SetMethod("getBounds", &Window::GetBounds)
       .SetMethod("setBounds", &Window::SetBounds)
+      .SetMethod("getWindowState", &Window::GetWindowState)
+      .SetMethod("restoreWindowState", &Window::RestoreWindowState)
       .SetMethod("getSize", &Window::GetSize)
       .SetMethod("setSize", &Window::SetSize)
       .SetMethod("getContentBounds", &Window::GetContentBounds)
@@ -74,8 +74,10 @@ class Window : public mate::TrackableObject<Window>,
   void OnWindowMinimize() override;
   void OnWindowRestore() override;
   void OnWindowResize() override;
+  void OnWindowResized() override;
   void OnWindowMove() override;
   void OnWindowMoved() override;
+  void OnWindowStateCaptured(const WindowState& state) override;
   void OnWindowScrollTouchBegin() override;
   void OnWindowScrollTouchEnd() override;
   void OnWindowScrollTouchEdge() override;
@@ -121,6 +123,8 @@ class Window : public mate::TrackableObject<Window>,
   bool IsFullscreen();
   void SetBounds(const gfx::Rect& bounds, mate::Arguments* args);
   gfx::Rect GetBounds();
+  WindowState GetWindowState();
+  void RestoreWindowState(const WindowState& state);
   void SetSize(int width, int height, mate::Arguments* args);
   std::vector<int> GetSize();
   void SetContentSize(int width, int height, mate::Arguments* args);
@@ -4,9 +4,12 @@
 
 #include "atom/browser/api/frame_subscriber.h"
 
+#include <memory>
+
 #include "atom/common/native_mate_converters/gfx_converter.h"
 #include "base/bind.h"
 #include "content/public/browser/render_widget_host.h"
+#include "native_mate/dictionary.h"
 #include "ui/display/display.h"
 #include "ui/display/screen.h"
 
@@ -16,6 +19,17 @@ namespace atom {
 
 namespace api {
 
+namespace {
+
+// Keeps the captured frame's pixel memory alive while JS holds the
+// externalized Buffer; the pixel ref is released when the Buffer is
+// garbage collected.
+void FreeFramePixels(char* data, void* hint) {
+  delete static_cast<SkBitmap*>(hint);
+}
+
+}  // namespace
+
 FrameSubscriber::FrameSubscriber(v8::Isolate* isolate,
                                  content::RenderWidgetHostView* view,
                                  const FrameCaptureCallback& callback,
@@ -24,6 +38,8 @@ FrameSubscriber::FrameSubscriber(v8::Isolate* isolate,
       view_(view),
       callback_(callback),
       only_dirty_(only_dirty),
+      frames_delivered_(0),
+      frames_dropped_(0),
       source_id_for_copy_request_(base::UnguessableToken::Create()),
       weak_factory_(this) {
 }
@@ -58,40 +74,80 @@ bool FrameSubscriber::ShouldCaptureFrame(
       rect,
       rect.size(),
       base::Bind(&FrameSubscriber::OnFrameDelivered,
-                 weak_factory_.GetWeakPtr(), callback_, rect),
+                 weak_factory_.GetWeakPtr(), callback_, rect,
+                 present_time, base::TimeTicks::Now()),
       kBGRA_8888_SkColorType);
 
   return false;
 }
 
+base::WeakPtr<FrameSubscriber> FrameSubscriber::GetWeakPtr() {
+  return weak_factory_.GetWeakPtr();
+}
+
 const base::UnguessableToken& FrameSubscriber::GetSourceIdForCopyRequest() {
   return source_id_for_copy_request_;
 }
 
 void FrameSubscriber::OnFrameDelivered(const FrameCaptureCallback& callback,
                                        const gfx::Rect& damage_rect,
+                                       base::TimeTicks present_time,
+                                       base::TimeTicks capture_time,
                                        const SkBitmap& bitmap,
                                        content::ReadbackResponse response) {
-  if (response != content::ReadbackResponse::READBACK_SUCCESS)
+  const base::TimeTicks delivery_time = base::TimeTicks::Now();
+  if (response != content::ReadbackResponse::READBACK_SUCCESS) {
+    frames_dropped_++;
     return;
+  }
+
+  frames_delivered_++;
+  last_capture_latency_ = delivery_time - capture_time;
+  total_capture_latency_ += last_capture_latency_;
 
   v8::Locker locker(isolate_);
   v8::HandleScope handle_scope(isolate_);
 
   size_t rgb_arr_size = bitmap.width() * bitmap.height() *
     bitmap.bytesPerPixel();
-  v8::MaybeLocal<v8::Object> buffer = node::Buffer::New(isolate_, rgb_arr_size);
-  if (buffer.IsEmpty())
-    return;
-
-  bitmap.copyPixelsTo(
-    reinterpret_cast<uint8_t*>(node::Buffer::Data(buffer.ToLocalChecked())),
-    rgb_arr_size);
+  v8::MaybeLocal<v8::Object> buffer;
+  if (bitmap.rowBytes() ==
+      static_cast<size_t>(bitmap.width() * bitmap.bytesPerPixel())) {
+    // Hand the captured pixels to JS without copying: the Buffer
+    // externalizes the bitmap's own pixel memory, and a heap SkBitmap keeps
+    // the pixel ref alive until the Buffer is collected. At 1080p/60fps the
+    // memcpy this replaces moved ~500MB/s.
+    std::unique_ptr<SkBitmap> frame(new SkBitmap(bitmap));
+    buffer = node::Buffer::New(
+        isolate_, static_cast<char*>(frame->getPixels()), rgb_arr_size,
+        &FreeFramePixels, frame.get());
+    if (buffer.IsEmpty())
+      return;
+    frame.release();
+  } else {
+    // Padded rows would leak into the flat buffer; fall back to a copy.
+    buffer = node::Buffer::New(isolate_, rgb_arr_size);
+    if (buffer.IsEmpty())
+      return;
+    bitmap.copyPixelsTo(
+      reinterpret_cast<uint8_t*>(node::Buffer::Data(buffer.ToLocalChecked())),
+      rgb_arr_size);
+  }
 
   v8::Local<v8::Value> damage =
       mate::Converter<gfx::Rect>::ToV8(isolate_, damage_rect);
 
-  callback_.Run(buffer.ToLocalChecked(), damage);
+  // Timestamps share the TimeTicks origin, so consumers can subtract
+  // them to locate where latency accrues.
+  mate::Dictionary timing = mate::Dictionary::CreateEmpty(isolate_);
+  timing.Set("presentTime",
+             (present_time - base::TimeTicks()).InMillisecondsF());
+  timing.Set("captureTime",
+             (capture_time - base::TimeTicks()).InMillisecondsF());
+  timing.Set("deliveryTime",
+             (delivery_time - base::TimeTicks()).InMillisecondsF());
+
+  callback_.Run(buffer.ToLocalChecked(), damage, timing.GetHandle());
 }
 
 }  // namespace api
@@ -7,6 +7,7 @@
 
 #include "base/callback.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "content/browser/renderer_host/render_widget_host_view_frame_subscriber.h"
 #include "content/public/browser/readback_types.h"
 #include "content/public/browser/render_widget_host_view.h"
@@ -20,8 +21,11 @@ namespace api {
 
 class FrameSubscriber : public content::RenderWidgetHostViewFrameSubscriber {
  public:
+  // Receives the frame buffer, the damage rect and a timing dictionary
+  // with presentTime/captureTime/deliveryTime in milliseconds.
   using FrameCaptureCallback =
-      base::Callback<void(v8::Local<v8::Value>, v8::Local<v8::Value>)>;
+      base::Callback<void(v8::Local<v8::Value>, v8::Local<v8::Value>,
+                          v8::Local<v8::Value>)>;
 
   FrameSubscriber(v8::Isolate* isolate,
                   content::RenderWidgetHostView* view,
@@ -34,9 +38,25 @@ class FrameSubscriber : public content::RenderWidgetHostViewFrameSubscriber {
                           DeliverFrameCallback* callback) override;
   const base::UnguessableToken& GetSourceIdForCopyRequest() override;
 
+  // Cumulative counters for webContents.getOSRStats().
+  uint32_t frames_delivered() const { return frames_delivered_; }
+  uint32_t frames_dropped() const { return frames_dropped_; }
+  double last_capture_latency_ms() const {
+    return last_capture_latency_.InMillisecondsF();
+  }
+  double average_capture_latency_ms() const {
+    if (frames_delivered_ == 0)
+      return 0.0;
+    return total_capture_latency_.InMillisecondsF() / frames_delivered_;
+  }
+
+  base::WeakPtr<FrameSubscriber> GetWeakPtr();
+
  private:
   void OnFrameDelivered(const FrameCaptureCallback& callback,
                         const gfx::Rect& damage_rect,
+                        base::TimeTicks present_time,
+                        base::TimeTicks capture_time,
                         const SkBitmap& bitmap,
                         content::ReadbackResponse response);
 
@@ -45,6 +65,11 @@ class FrameSubscriber : public content::RenderWidgetHostViewFrameSubscriber {
   FrameCaptureCallback callback_;
   bool only_dirty_;
 
+  uint32_t frames_delivered_;
+  uint32_t frames_dropped_;
+  base::TimeDelta last_capture_latency_;
+  base::TimeDelta total_capture_latency_;
+
   base::UnguessableToken source_id_for_copy_request_;
 
   base::WeakPtrFactory<FrameSubscriber> weak_factory_;
@@ -10,15 +10,18 @@
 #include "base/callback.h"
 #include "base/files/file_path.h"
 #include "content/public/browser/web_contents.h"
+#include "native_mate/dictionary.h"
 
 namespace atom {
 
 namespace api {
 
 SavePageHandler::SavePageHandler(content::WebContents* web_contents,
-                                 const SavePageCallback& callback)
+                                 const SavePageCallback& callback,
+                                 const ProgressCallback& progress_callback)
     : web_contents_(web_contents),
-      callback_(callback) {
+      callback_(callback),
+      progress_callback_(progress_callback) {
 }
 
 SavePageHandler::~SavePageHandler() {
@@ -65,7 +68,21 @@ void SavePageHandler::OnDownloadUpdated(content::DownloadItem* item) {
       callback_.Run(v8::Exception::Error(error_message));
     }
     Destroy(item);
+    return;
   }
+
+  if (progress_callback_.is_null())
+    return;
+
+  // Forward incremental progress as chromium streams resources to disk,
+  // so long-running saves can be monitored from JS.
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  mate::Dictionary progress = mate::Dictionary::CreateEmpty(isolate);
+  progress.Set("receivedBytes", item->GetReceivedBytes());
+  progress.Set("totalBytes", item->GetTotalBytes());
+  progress_callback_.Run(progress.GetHandle());
 }
 
 void SavePageHandler::Destroy(content::DownloadItem* item) {
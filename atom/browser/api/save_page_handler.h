@@ -29,9 +29,11 @@ class SavePageHandler : public content::DownloadManager::Observer,
                         public content::DownloadItem::Observer {
  public:
   using SavePageCallback = base::Callback<void(v8::Local<v8::Value>)>;
+  using ProgressCallback = base::Callback<void(v8::Local<v8::Value>)>;
 
   SavePageHandler(content::WebContents* web_contents,
-                  const SavePageCallback& callback);
+                  const SavePageCallback& callback,
+                  const ProgressCallback& progress_callback);
   ~SavePageHandler();
 
   bool Handle(const base::FilePath& full_path,
@@ -49,6 +51,7 @@ class SavePageHandler : public content::DownloadManager::Observer,
 
   content::WebContents* web_contents_;  // weak
   SavePageCallback callback_;
+  ProgressCallback progress_callback_;
 };
 
 }  // namespace api
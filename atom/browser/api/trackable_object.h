@@ -8,7 +8,7 @@
 #include <vector>
 
 #include "atom/browser/api/event_emitter.h"
-#include "atom/common/key_weak_map.h"
+#include "atom/common/slab_weak_map.h"
 #include "base/bind.h"
 #include "base/memory/weak_ptr.h"
 #include "native_mate/object_template_builder.h"
@@ -118,24 +118,19 @@ class TrackableObject : public TrackableObjectBase,
   void InitWith(v8::Isolate* isolate, v8::Local<v8::Object> wrapper) override {
     WrappableBase::InitWith(isolate, wrapper);
     if (!weak_map_) {
-      weak_map_ = new atom::KeyWeakMap<int32_t>;
+      weak_map_ = new atom::SlabWeakMap;
     }
-    weak_map_id_ = ++next_id_;
-    weak_map_->Set(isolate, weak_map_id_, wrapper);
+    weak_map_id_ = weak_map_->Add(isolate, wrapper);
   }
 
  private:
-  static int32_t next_id_;
-  static atom::KeyWeakMap<int32_t>* weak_map_;  // leaked on purpose
+  static atom::SlabWeakMap* weak_map_;  // leaked on purpose
 
   DISALLOW_COPY_AND_ASSIGN(TrackableObject);
 };
 
 template<typename T>
-int32_t TrackableObject<T>::next_id_ = 0;
-
-template<typename T>
-atom::KeyWeakMap<int32_t>* TrackableObject<T>::weak_map_ = nullptr;
+atom::SlabWeakMap* TrackableObject<T>::weak_map_ = nullptr;
 
 }  // namespace mate
 
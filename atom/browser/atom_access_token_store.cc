@@ -63,23 +63,27 @@ AtomAccessTokenStore::~AtomAccessTokenStore() {
 
 void AtomAccessTokenStore::LoadAccessTokens(
     const LoadAccessTokensCallback& callback) {
-  std::unique_ptr<base::Environment> env(base::Environment::Create());
-  std::string api_key;
-  if (!env->GetVar("GOOGLE_API_KEY", &api_key))
-    api_key = GOOGLEAPIS_API_KEY;
-  // Equivalent to access_token_map[kGeolocationProviderURL].
-  // Somehow base::string16 is causing compilation errors when used in a pair
-  // of std::map on Linux, this can work around it.
-  device::AccessTokenStore::AccessTokenMap access_token_map;
-  std::pair<GURL, base::string16> token_pair;
-  token_pair.first = GURL(GOOGLEAPIS_ENDPOINT + api_key);
-  access_token_map.insert(token_pair);
-
-  callback.Run(access_token_map, request_context_getter_.get());
+  if (!tokens_loaded_) {
+    std::unique_ptr<base::Environment> env(base::Environment::Create());
+    std::string api_key;
+    if (!env->GetVar("GOOGLE_API_KEY", &api_key))
+      api_key = GOOGLEAPIS_API_KEY;
+    // Equivalent to access_token_map[kGeolocationProviderURL].
+    // Somehow base::string16 is causing compilation errors when used in a pair
+    // of std::map on Linux, this can work around it.
+    std::pair<GURL, base::string16> token_pair;
+    token_pair.first = GURL(GOOGLEAPIS_ENDPOINT + api_key);
+    access_token_map_.insert(token_pair);
+    tokens_loaded_ = true;
+  }
+
+  callback.Run(access_token_map_, request_context_getter_.get());
 }
 
 void AtomAccessTokenStore::SaveAccessToken(const GURL& server_url,
                                            const base::string16& access_token) {
+  // Keep the cached map current so later loads return the saved token.
+  access_token_map_[server_url] = access_token;
 }
 
 }  // namespace atom
@@ -26,6 +26,13 @@ class AtomAccessTokenStore : public device::AccessTokenStore {
 
  private:
   scoped_refptr<internal::GeoURLRequestContextGetter> request_context_getter_;
+
+  // The token map handed to every LoadAccessTokens call, built once on
+  // first load and updated in place by SaveAccessToken, so steady-state
+  // geolocation requests do no environment or string work.
+  bool tokens_loaded_ = false;
+  AccessTokenMap access_token_map_;
+
   DISALLOW_COPY_AND_ASSIGN(AtomAccessTokenStore);
 };
 
@@ -4,6 +4,9 @@
 
 #include "atom/browser/atom_blob_reader.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "content/browser/blob_storage/chrome_blob_storage_context.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/io_buffer.h"
@@ -46,6 +49,53 @@ void RunCallbackInUI(
 
 }  // namespace
 
+AtomBlobReader::StreamController::StreamController()
+    : resume_pending_(false),
+      aborted_(false) {
+}
+
+AtomBlobReader::StreamController::~StreamController() {
+}
+
+void AtomBlobReader::StreamController::Resume() {
+  base::AutoLock auto_lock(lock_);
+  if (aborted_)
+    return;
+  if (resume_closure_.is_null()) {
+    // The reader has not parked yet; remember the request.
+    resume_pending_ = true;
+    return;
+  }
+  BrowserThread::PostTask(BrowserThread::IO, FROM_HERE, resume_closure_);
+  resume_closure_.Reset();
+}
+
+void AtomBlobReader::StreamController::Abort() {
+  base::AutoLock auto_lock(lock_);
+  aborted_ = true;
+  if (!resume_closure_.is_null()) {
+    // Wake the parked reader so it can destroy itself.
+    BrowserThread::PostTask(BrowserThread::IO, FROM_HERE, resume_closure_);
+    resume_closure_.Reset();
+  }
+}
+
+bool AtomBlobReader::StreamController::IsAborted() {
+  base::AutoLock auto_lock(lock_);
+  return aborted_;
+}
+
+void AtomBlobReader::StreamController::AwaitResume(
+    const base::Closure& closure) {
+  base::AutoLock auto_lock(lock_);
+  if (aborted_ || resume_pending_) {
+    resume_pending_ = false;
+    BrowserThread::PostTask(BrowserThread::IO, FROM_HERE, closure);
+    return;
+  }
+  resume_closure_ = closure;
+}
+
 AtomBlobReader::AtomBlobReader(
     content::ChromeBlobStorageContext* blob_context,
     storage::FileSystemContext* file_system_context)
@@ -79,6 +129,31 @@ void AtomBlobReader::StartReading(
   blob_read_helper->Read();
 }
 
+void AtomBlobReader::StartStreaming(
+    const std::string& uuid,
+    int chunk_size,
+    const AtomBlobReader::CompletionCallback& data_callback,
+    scoped_refptr<StreamController> controller) {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  auto blob_data_handle =
+      blob_context_->context()->GetBlobDataFromUUID(uuid);
+  auto callback = base::Bind(&RunCallbackInUI,
+                             data_callback);
+  if (!blob_data_handle) {
+    BrowserThread::PostTask(BrowserThread::UI, FROM_HERE,
+        base::Bind(callback, nullptr, 0));
+    return;
+  }
+
+  auto blob_reader = blob_data_handle->CreateReader(
+      file_system_context_.get(),
+      BrowserThread::GetTaskRunnerForThread(BrowserThread::FILE).get());
+  BlobStreamHelper* blob_stream_helper = new BlobStreamHelper(
+      std::move(blob_reader), chunk_size, callback, controller);
+  blob_stream_helper->Stream();
+}
+
 AtomBlobReader::BlobReadHelper::BlobReadHelper(
     std::unique_ptr<storage::BlobReader> blob_reader,
     const BlobReadHelper::CompletionCallback& callback)
@@ -135,4 +210,107 @@ void AtomBlobReader::BlobReadHelper::DidReadBlobData(
   delete this;
 }
 
+AtomBlobReader::BlobStreamHelper::BlobStreamHelper(
+    std::unique_ptr<storage::BlobReader> blob_reader,
+    int chunk_size,
+    const BlobStreamHelper::DataCallback& callback,
+    scoped_refptr<StreamController> controller)
+    : blob_reader_(std::move(blob_reader)),
+      chunk_size_(chunk_size),
+      remaining_(0),
+      data_callback_(callback),
+      controller_(controller) {
+}
+
+AtomBlobReader::BlobStreamHelper::~BlobStreamHelper() {
+}
+
+void AtomBlobReader::BlobStreamHelper::Stream() {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  storage::BlobReader::Status size_status = blob_reader_->CalculateSize(
+      base::Bind(&AtomBlobReader::BlobStreamHelper::DidCalculateSize,
+                 base::Unretained(this)));
+  if (size_status != storage::BlobReader::Status::IO_PENDING)
+    DidCalculateSize(net::OK);
+}
+
+void AtomBlobReader::BlobStreamHelper::DidCalculateSize(int result) {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  if (result != net::OK) {
+    Finish();
+    return;
+  }
+
+  remaining_ = blob_reader_->total_size();
+  ReadNextChunk();
+}
+
+void AtomBlobReader::BlobStreamHelper::ReadNextChunk() {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  if (controller_->IsAborted()) {
+    delete this;
+    return;
+  }
+
+  if (remaining_ == 0) {
+    Finish();
+    return;
+  }
+
+  uint64_t chunk_size =
+      std::min(static_cast<uint64_t>(chunk_size_), remaining_);
+  scoped_refptr<net::IOBuffer> chunk =
+      new net::IOBuffer(static_cast<size_t>(chunk_size));
+  int bytes_read = 0;
+  auto callback = base::Bind(&AtomBlobReader::BlobStreamHelper::DidReadChunk,
+                             base::Unretained(this),
+                             base::RetainedRef(chunk));
+  storage::BlobReader::Status read_status = blob_reader_->Read(
+      chunk.get(),
+      chunk_size,
+      &bytes_read,
+      callback);
+  if (read_status != storage::BlobReader::Status::IO_PENDING)
+    callback.Run(bytes_read);
+}
+
+void AtomBlobReader::BlobStreamHelper::DidReadChunk(
+    const scoped_refptr<net::IOBuffer>& chunk,
+    int bytes_read) {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  if (controller_->IsAborted()) {
+    delete this;
+    return;
+  }
+
+  if (bytes_read <= 0) {
+    Finish();
+    return;
+  }
+
+  remaining_ -= bytes_read;
+  char* data = new char[bytes_read];
+  memcpy(data, chunk->data(), bytes_read);
+  BrowserThread::PostTask(BrowserThread::UI, FROM_HERE,
+      base::Bind(data_callback_, data, bytes_read));
+  // Park until the consumer asks for more; only one chunk of the blob is
+  // ever held in memory at a time.
+  controller_->AwaitResume(
+      base::Bind(&AtomBlobReader::BlobStreamHelper::ReadNextChunk,
+                 base::Unretained(this)));
+}
+
+void AtomBlobReader::BlobStreamHelper::Finish() {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  // A null buffer tells the consumer the stream has ended.
+  BrowserThread::PostTask(BrowserThread::UI, FROM_HERE,
+      base::Bind(data_callback_, nullptr, 0));
+  delete this;
+}
+
 }  // namespace atom
@@ -5,9 +5,12 @@
 #ifndef ATOM_BROWSER_ATOM_BLOB_READER_H_
 #define ATOM_BROWSER_ATOM_BLOB_READER_H_
 
+#include <memory>
 #include <string>
 
 #include "base/callback.h"
+#include "base/memory/ref_counted.h"
+#include "base/synchronization/lock.h"
 
 namespace content {
 class ChromeBlobStorageContext;
@@ -34,9 +37,46 @@ namespace atom {
 // A class to keep track of the blob context. All methods,
 // except Ctor are expected to be called on IO thread.
 class AtomBlobReader {
+ private:
+  class BlobStreamHelper;
+
  public:
   using CompletionCallback = base::Callback<void(v8::Local<v8::Value>)>;
 
+  // Coordinates backpressure and cancellation between the consumer on the
+  // UI thread and the IO thread reader of a streamed blob.
+  class StreamController
+      : public base::RefCountedThreadSafe<StreamController> {
+   public:
+    StreamController();
+
+    // Requests the next chunk. The reader stays parked between chunks
+    // until this is called, which bounds the stream to one chunk of
+    // memory at a time.
+    void Resume();
+
+    // Stops the stream; the data callback receives no further chunks.
+    void Abort();
+
+   private:
+    friend class base::RefCountedThreadSafe<StreamController>;
+    friend class AtomBlobReader;
+    friend class BlobStreamHelper;
+
+    ~StreamController();
+
+    bool IsAborted();
+    // Parks |closure| until Resume posts it to the IO thread.
+    void AwaitResume(const base::Closure& closure);
+
+    base::Lock lock_;
+    base::Closure resume_closure_;
+    bool resume_pending_;
+    bool aborted_;
+
+    DISALLOW_COPY_AND_ASSIGN(StreamController);
+  };
+
   AtomBlobReader(content::ChromeBlobStorageContext* blob_context,
                  storage::FileSystemContext* file_system_context);
   ~AtomBlobReader();
@@ -45,6 +85,14 @@ class AtomBlobReader {
       const std::string& uuid,
       const AtomBlobReader::CompletionCallback& callback);
 
+  // Reads the blob in |chunk_size| byte chunks, invoking |data_callback|
+  // once per chunk and with a null buffer when the stream ends. The next
+  // chunk is not read until |controller| is resumed.
+  void StartStreaming(const std::string& uuid,
+                      int chunk_size,
+                      const AtomBlobReader::CompletionCallback& data_callback,
+                      scoped_refptr<StreamController> controller);
+
  private:
   // A self-destroyed helper class to read the blob data.
   // Must be accessed on IO thread.
@@ -69,6 +117,37 @@ class AtomBlobReader {
     DISALLOW_COPY_AND_ASSIGN(BlobReadHelper);
   };
 
+  // A self-destroyed helper that reads the blob in fixed-size chunks,
+  // parking between chunks until the consumer resumes the stream.
+  // Must be accessed on IO thread.
+  class BlobStreamHelper {
+   public:
+    using DataCallback = base::Callback<void(char*, int)>;
+
+    BlobStreamHelper(std::unique_ptr<storage::BlobReader> blob_reader,
+                     int chunk_size,
+                     const DataCallback& callback,
+                     scoped_refptr<StreamController> controller);
+    ~BlobStreamHelper();
+
+    void Stream();
+
+   private:
+    void DidCalculateSize(int result);
+    void ReadNextChunk();
+    void DidReadChunk(const scoped_refptr<net::IOBuffer>& chunk,
+                      int bytes_read);
+    void Finish();
+
+    std::unique_ptr<storage::BlobReader> blob_reader_;
+    int chunk_size_;
+    uint64_t remaining_;
+    DataCallback data_callback_;
+    scoped_refptr<StreamController> controller_;
+
+    DISALLOW_COPY_AND_ASSIGN(BlobStreamHelper);
+  };
+
   scoped_refptr<content::ChromeBlobStorageContext> blob_context_;
   scoped_refptr<storage::FileSystemContext> file_system_context_;
 
@@ -12,11 +12,14 @@
 #include "atom/browser/bridge_task_runner.h"
 #include "atom/browser/browser.h"
 #include "atom/browser/javascript_environment.h"
+#include "atom/browser/js_task_scheduler.h"
+#include "atom/browser/main_thread_watchdog.h"
 #include "atom/browser/node_debugger.h"
 #include "atom/common/api/atom_bindings.h"
 #include "atom/common/asar/asar_util.h"
 #include "atom/common/node_bindings.h"
 #include "atom/common/node_includes.h"
+#include "atom/common/startup_timings.h"
 #include "base/command_line.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "chrome/browser/browser_process.h"
@@ -25,6 +28,11 @@
 #include "device/geolocation/geolocation_provider.h"
 #include "v8/include/v8-debug.h"
 
+#if defined(OS_WIN)
+#include "atom/browser/ui/file_dialog.h"
+#include "content/public/browser/browser_thread.h"
+#endif
+
 #if defined(USE_X11)
 #include "chrome/browser/ui/libgtkui/gtk_util.h"
 #include "ui/events/devices/x11/touch_factory_x11.h"
@@ -123,6 +131,10 @@ void AtomBrowserMainParts::PostEarlyInitialization() {
   bridge_task_runner_ = new BridgeTaskRunner;
   base::ThreadTaskRunnerHandle handle(bridge_task_runner_);
 
+  // Tasks posted before the message loop runs are buffered by the bridge
+  // task runner, so the scheduler is usable as soon as scripts can call it.
+  js_task_scheduler_.reset(new JsTaskScheduler);
+
   // The ProxyResolverV8 has setup a complete V8 environment, in order to
   // avoid conflicts we only initialize our V8 environment after that.
   js_env_.reset(new JavascriptEnvironment);
@@ -133,6 +145,7 @@ void AtomBrowserMainParts::PostEarlyInitialization() {
   node::Environment* env =
       node_bindings_->CreateEnvironment(js_env_->context());
   node_env_.reset(new NodeEnvironment(env));
+  startup_timings::Record(startup_timings::kNodeEnvironmentCreated);
 
   // Enable support for v8 inspector
   node_debugger_.reset(new NodeDebugger(env));
@@ -143,6 +156,7 @@ void AtomBrowserMainParts::PostEarlyInitialization() {
 
   // Load everything.
   node_bindings_->LoadEnvironment(env);
+  startup_timings::Record(startup_timings::kBrowserScriptLoaded);
 
   // Wrap the uv loop with global env.
   node_bindings_->set_uv_env(env);
@@ -169,6 +183,10 @@ void AtomBrowserMainParts::PreMainMessageLoopRun() {
   content::WebUIControllerFactory::RegisterFactory(
       AtomWebUIControllerFactory::GetInstance());
 
+  // Start watching main thread responsiveness.
+  main_thread_watchdog_.reset(new MainThreadWatchdog);
+  main_thread_watchdog_->Start();
+
   brightray::BrowserMainParts::PreMainMessageLoopRun();
   bridge_task_runner_->MessageLoopIsReady();
   bridge_task_runner_ = nullptr;
@@ -183,6 +201,16 @@ void AtomBrowserMainParts::PreMainMessageLoopRun() {
   std::unique_ptr<base::DictionaryValue> empty_info(new base::DictionaryValue);
   Browser::Get()->DidFinishLaunching(*empty_info);
 #endif
+
+#if defined(OS_WIN)
+  // Warm up the shared dialog thread once startup work has settled, so the
+  // first file dialog presents without paying thread and COM setup.
+  content::BrowserThread::PostAfterStartupTask(
+      FROM_HERE,
+      content::BrowserThread::GetTaskRunnerForThread(
+          content::BrowserThread::UI),
+      base::Bind(&file_dialog::PrewarmDialogs));
+#endif
 }
 
 bool AtomBrowserMainParts::MainMessageLoopRun(int* result_code) {
@@ -200,6 +228,14 @@ void AtomBrowserMainParts::PostMainMessageLoopStart() {
 }
 
 void AtomBrowserMainParts::PostMainMessageLoopRun() {
+  if (main_thread_watchdog_) {
+    main_thread_watchdog_->Stop();
+    main_thread_watchdog_.reset();
+  }
+
+  // Drop queued callbacks; the JavaScript environment is going away.
+  js_task_scheduler_.reset();
+
   brightray::BrowserMainParts::PostMainMessageLoopRun();
 
   js_env_->OnMessageLoopDestroying();
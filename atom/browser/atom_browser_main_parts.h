@@ -20,6 +20,8 @@ namespace atom {
 class AtomBindings;
 class Browser;
 class JavascriptEnvironment;
+class JsTaskScheduler;
+class MainThreadWatchdog;
 class NodeBindings;
 class NodeDebugger;
 class NodeEnvironment;
@@ -45,6 +47,12 @@ class AtomBrowserMainParts : public brightray::BrowserMainParts {
 
   Browser* browser() { return browser_.get(); }
 
+  MainThreadWatchdog* main_thread_watchdog() {
+    return main_thread_watchdog_.get();
+  }
+
+  JsTaskScheduler* js_task_scheduler() { return js_task_scheduler_.get(); }
+
  protected:
   // content::BrowserMainParts:
   void PreEarlyInitialization() override;
@@ -84,6 +92,8 @@ class AtomBrowserMainParts : public brightray::BrowserMainParts {
   std::unique_ptr<AtomBindings> atom_bindings_;
   std::unique_ptr<NodeEnvironment> node_env_;
   std::unique_ptr<NodeDebugger> node_debugger_;
+  std::unique_ptr<MainThreadWatchdog> main_thread_watchdog_;
+  std::unique_ptr<JsTaskScheduler> js_task_scheduler_;
 
   base::Timer gc_timer_;
 
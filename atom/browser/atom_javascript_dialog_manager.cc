@@ -5,6 +5,7 @@
 #include "atom/browser/atom_javascript_dialog_manager.h"
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atom/browser/api/atom_api_web_contents.h"
@@ -18,9 +19,35 @@ using content::JavaScriptDialogType;
 
 namespace atom {
 
+namespace {
+
+// An origin that shows more than this many dialogs inside the rate window
+// is offered the suppression checkbox.
+const size_t kMaxDialogsPerWindow = 3;
+const int kDialogRateWindowSeconds = 10;
+
+const char kSuppressCheckboxLabel[] =
+    "Prevent this page from creating additional dialogs";
+
+}  // namespace
+
+AtomJavaScriptDialogManager::DialogRequest::DialogRequest()
+    : dialog_type(JavaScriptDialogType::JAVASCRIPT_DIALOG_TYPE_ALERT) {}
+
+AtomJavaScriptDialogManager::DialogRequest::DialogRequest(
+    DialogRequest&& other) = default;
+
+AtomJavaScriptDialogManager::DialogRequest&
+AtomJavaScriptDialogManager::DialogRequest::operator=(DialogRequest&& other) =
+    default;
+
+AtomJavaScriptDialogManager::DialogRequest::~DialogRequest() {}
+
 AtomJavaScriptDialogManager::AtomJavaScriptDialogManager(
     api::WebContents* api_web_contents)
-    : api_web_contents_(api_web_contents) {}
+    : api_web_contents_(api_web_contents), weak_factory_(this) {}
+
+AtomJavaScriptDialogManager::~AtomJavaScriptDialogManager() {}
 
 void AtomJavaScriptDialogManager::RunJavaScriptDialog(
     content::WebContents* web_contents,
@@ -36,17 +63,93 @@ void AtomJavaScriptDialogManager::RunJavaScriptDialog(
     return;
   }
 
+  const GURL origin = origin_url.GetOrigin();
+
+  // Fast path: once the user asked to suppress an origin's dialogs, answer
+  // right here without showing anything or waking JS.
+  if (origins_[origin.spec()].suppressed) {
+    *did_suppress_message = true;
+    return;
+  }
+
+  DialogRequest request;
+  request.web_contents = web_contents;
+  request.origin = origin;
+  request.dialog_type = dialog_type;
+  request.message_text = message_text;
+  request.callbacks.push_back(callback);
+
+  // An identical dialog that is already showing or queued answers this
+  // request too; alert storms collapse into one dialog.
+  if (CoalesceRequest(&request))
+    return;
+
+  queue_.push_back(std::move(request));
+  if (!dialog_showing_)
+    ShowNextDialog();
+}
+
+bool AtomJavaScriptDialogManager::CoalesceRequest(DialogRequest* request) {
+  if (dialog_showing_ &&
+      active_request_.origin == request->origin &&
+      active_request_.dialog_type == request->dialog_type &&
+      active_request_.message_text == request->message_text) {
+    active_request_.callbacks.push_back(request->callbacks.front());
+    return true;
+  }
+  for (DialogRequest& queued : queue_) {
+    if (queued.origin == request->origin &&
+        queued.dialog_type == request->dialog_type &&
+        queued.message_text == request->message_text) {
+      queued.callbacks.push_back(request->callbacks.front());
+      return true;
+    }
+  }
+  return false;
+}
+
+void AtomJavaScriptDialogManager::ShowNextDialog() {
+  active_request_ = std::move(queue_.front());
+  queue_.pop_front();
+  dialog_showing_ = true;
+
+  OriginState& state = origins_[active_request_.origin.spec()];
+  const base::TimeTicks now = base::TimeTicks::Now();
+  const base::TimeTicks window_start =
+      now - base::TimeDelta::FromSeconds(kDialogRateWindowSeconds);
+  while (!state.recent_dialogs.empty() &&
+         state.recent_dialogs.front() < window_start)
+    state.recent_dialogs.pop_front();
+  state.recent_dialogs.push_back(now);
+  suppress_offered_ = state.recent_dialogs.size() > kMaxDialogsPerWindow;
+
   std::vector<std::string> buttons = {"OK"};
-  if (dialog_type == JavaScriptDialogType::JAVASCRIPT_DIALOG_TYPE_CONFIRM) {
+  if (active_request_.dialog_type ==
+      JavaScriptDialogType::JAVASCRIPT_DIALOG_TYPE_CONFIRM) {
     buttons.push_back("Cancel");
   }
 
-  atom::ShowMessageBox(NativeWindow::FromWebContents(web_contents),
-                       atom::MessageBoxType::MESSAGE_BOX_TYPE_NONE, buttons, -1,
-                       0, atom::MessageBoxOptions::MESSAGE_BOX_NONE, "",
-                       base::UTF16ToUTF8(message_text), "", "", false,
-                       gfx::ImageSkia(),
-                       base::Bind(&OnMessageBoxCallback, callback));
+  atom::ShowMessageBox(
+      NativeWindow::FromWebContents(active_request_.web_contents),
+      atom::MessageBoxType::MESSAGE_BOX_TYPE_NONE, buttons, -1, 0,
+      atom::MessageBoxOptions::MESSAGE_BOX_NONE, "",
+      base::UTF16ToUTF8(active_request_.message_text), "",
+      suppress_offered_ ? kSuppressCheckboxLabel : "", false,
+      gfx::ImageSkia(),
+      base::Bind(&AtomJavaScriptDialogManager::OnDialogClosed,
+                 weak_factory_.GetWeakPtr()));
+}
+
+void AtomJavaScriptDialogManager::OnDialogClosed(int code,
+                                                 bool checkbox_checked) {
+  if (suppress_offered_ && checkbox_checked)
+    origins_[active_request_.origin.spec()].suppressed = true;
+
+  RunCallbacks(&active_request_.callbacks, code == 0);
+  dialog_showing_ = false;
+
+  if (!queue_.empty())
+    ShowNextDialog();
 }
 
 void AtomJavaScriptDialogManager::RunBeforeUnloadDialog(
@@ -61,14 +164,25 @@ void AtomJavaScriptDialogManager::RunBeforeUnloadDialog(
 void AtomJavaScriptDialogManager::CancelDialogs(
     content::WebContents* web_contents,
     bool reset_state) {
+  // The showing native dialog cannot be dismissed programmatically, but its
+  // renderer must not stay blocked; answer everything with a cancel. The
+  // late OnDialogClosed finds no callbacks left to run.
+  RunCallbacks(&active_request_.callbacks, false);
+  for (DialogRequest& queued : queue_)
+    RunCallbacks(&queued.callbacks, false);
+  queue_.clear();
+
+  if (reset_state)
+    origins_.clear();
 }
 
 // static
-void AtomJavaScriptDialogManager::OnMessageBoxCallback(
-    const DialogClosedCallback& callback,
-    int code,
-    bool checkbox_checked) {
-  callback.Run(code == 0, base::string16());
+void AtomJavaScriptDialogManager::RunCallbacks(
+    std::vector<DialogClosedCallback>* callbacks,
+    bool success) {
+  for (const DialogClosedCallback& callback : *callbacks)
+    callback.Run(success, base::string16());
+  callbacks->clear();
 }
 
 }  // namespace atom
@@ -5,9 +5,15 @@
 #ifndef ATOM_BROWSER_ATOM_JAVASCRIPT_DIALOG_MANAGER_H_
 #define ATOM_BROWSER_ATOM_JAVASCRIPT_DIALOG_MANAGER_H_
 
+#include <deque>
+#include <map>
 #include <string>
+#include <vector>
 
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "content/public/browser/javascript_dialog_manager.h"
+#include "url/gurl.h"
 
 namespace atom {
 
@@ -18,6 +24,7 @@ class WebContents;
 class AtomJavaScriptDialogManager : public content::JavaScriptDialogManager {
  public:
   explicit AtomJavaScriptDialogManager(api::WebContents* api_web_contents);
+  ~AtomJavaScriptDialogManager() override;
 
   // content::JavaScriptDialogManager implementations.
   void RunJavaScriptDialog(
@@ -36,10 +43,50 @@ class AtomJavaScriptDialogManager : public content::JavaScriptDialogManager {
                      bool reset_state) override;
 
  private:
-  static void OnMessageBoxCallback(const DialogClosedCallback& callback,
-                                   int code,
-                                   bool checkbox_checked);
+  // A requested dialog waiting for its turn. Identical requests from the
+  // same origin coalesce into one entry with several callbacks.
+  struct DialogRequest {
+    DialogRequest();
+    DialogRequest(DialogRequest&& other);
+    DialogRequest& operator=(DialogRequest&& other);
+    ~DialogRequest();
+
+    content::WebContents* web_contents = nullptr;
+    GURL origin;
+    content::JavaScriptDialogType dialog_type;
+    base::string16 message_text;
+    std::vector<DialogClosedCallback> callbacks;
+  };
+
+  struct OriginState {
+    // Timestamps of recently shown dialogs, pruned to the rate window.
+    std::deque<base::TimeTicks> recent_dialogs;
+    // Set when the user asked to suppress further dialogs; requests are
+    // then answered here without showing anything or waking JS.
+    bool suppressed = false;
+  };
+
+  // Merges |request| into an identical queued or showing entry. Returns
+  // whether the request was absorbed.
+  bool CoalesceRequest(DialogRequest* request);
+
+  void ShowNextDialog();
+  void OnDialogClosed(int code, bool checkbox_checked);
+
+  static void RunCallbacks(std::vector<DialogClosedCallback>* callbacks,
+                           bool success);
+
   api::WebContents* api_web_contents_;
+
+  std::deque<DialogRequest> queue_;
+  DialogRequest active_request_;
+  bool dialog_showing_ = false;
+  // Whether the showing dialog offers the suppression checkbox.
+  bool suppress_offered_ = false;
+
+  std::map<std::string, OriginState> origins_;
+
+  base::WeakPtrFactory<AtomJavaScriptDialogManager> weak_factory_;
 };
 
 }  // namespace atom
@@ -4,6 +4,7 @@
 
 #include "atom/browser/atom_permission_manager.h"
 
+#include <utility>
 #include <vector>
 
 #include "atom/browser/web_contents_preferences.h"
@@ -89,6 +90,37 @@ void AtomPermissionManager::SetPermissionRequestHandler(
     pending_requests_.Clear();
   }
   request_handler_ = handler;
+  // Decisions made by the previous handler do not speak for the new one.
+  decision_cache_.clear();
+}
+
+void AtomPermissionManager::SetPermissionCacheTTL(base::TimeDelta ttl) {
+  cache_ttl_ = ttl;
+  if (cache_ttl_.is_zero())
+    decision_cache_.clear();
+}
+
+void AtomPermissionManager::ClearPermissionCache() {
+  decision_cache_.clear();
+}
+
+bool AtomPermissionManager::GetCachedDecision(
+    const GURL& origin,
+    content::PermissionType permission,
+    blink::mojom::PermissionStatus* status) {
+  if (cache_ttl_.is_zero())
+    return false;
+
+  auto iter = decision_cache_.find(std::make_pair(origin, permission));
+  if (iter == decision_cache_.end())
+    return false;
+  if (base::TimeTicks::Now() >= iter->second.expiry) {
+    decision_cache_.erase(iter);
+    return false;
+  }
+
+  *status = iter->second.status;
+  return true;
 }
 
 int AtomPermissionManager::RequestPermission(
@@ -134,15 +166,28 @@ int AtomPermissionManager::RequestPermissions(
   int request_id = pending_requests_.Add(base::MakeUnique<PendingRequest>(
       render_frame_host, permissions, response_callback));
 
+  const GURL origin = requesting_origin.GetOrigin();
   for (size_t i = 0; i < permissions.size(); ++i) {
     auto permission = permissions[i];
     if (permission == content::PermissionType::MIDI_SYSEX) {
       content::ChildProcessSecurityPolicy::GetInstance()->
           GrantSendMidiSysExMessage(render_frame_host->GetProcess()->GetID());
     }
-    const auto callback =
-        base::Bind(&AtomPermissionManager::OnPermissionResponse,
-                   base::Unretained(this), request_id, i);
+
+    // Repeated identical checks are answered from the cache without waking
+    // the JS handler.
+    blink::mojom::PermissionStatus cached_status;
+    if (GetCachedDecision(origin, permission, &cached_status)) {
+      OnPermissionResponse(request_id, i, cached_status);
+      continue;
+    }
+
+    const auto callback = cache_ttl_.is_zero()
+        ? base::Bind(&AtomPermissionManager::OnPermissionResponse,
+                     base::Unretained(this), request_id, i)
+        : base::Bind(&AtomPermissionManager::OnPermissionResponseForCache,
+                     base::Unretained(this), request_id, i, origin,
+                     permission);
     request_handler_.Run(web_contents, permission, callback);
   }
 
@@ -164,6 +209,21 @@ void AtomPermissionManager::OnPermissionResponse(
   }
 }
 
+void AtomPermissionManager::OnPermissionResponseForCache(
+    int request_id,
+    int permission_id,
+    const GURL& origin,
+    content::PermissionType permission,
+    blink::mojom::PermissionStatus status) {
+  if (!cache_ttl_.is_zero()) {
+    CachedDecision decision;
+    decision.status = status;
+    decision.expiry = base::TimeTicks::Now() + cache_ttl_;
+    decision_cache_[std::make_pair(origin, permission)] = decision;
+  }
+  OnPermissionResponse(request_id, permission_id, status);
+}
+
 void AtomPermissionManager::CancelPermissionRequest(int request_id) {
   auto pending_request = pending_requests_.Lookup(request_id);
   if (!pending_request)
@@ -178,6 +238,8 @@ void AtomPermissionManager::ResetPermission(
     content::PermissionType permission,
     const GURL& requesting_origin,
     const GURL& embedding_origin) {
+  decision_cache_.erase(
+      std::make_pair(requesting_origin.GetOrigin(), permission));
 }
 
 blink::mojom::PermissionStatus AtomPermissionManager::GetPermissionStatus(
@@ -6,11 +6,14 @@
 #define ATOM_BROWSER_ATOM_PERMISSION_MANAGER_H_
 
 #include <map>
+#include <utility>
 #include <vector>
 
 #include "base/callback.h"
 #include "base/id_map.h"
+#include "base/time/time.h"
 #include "content/public/browser/permission_manager.h"
+#include "url/gurl.h"
 
 namespace content {
 class WebContents;
@@ -35,6 +38,14 @@ class AtomPermissionManager : public content::PermissionManager {
   // Handler to dispatch permission requests in JS.
   void SetPermissionRequestHandler(const RequestHandler& handler);
 
+  // Enables caching of handler decisions per (origin, permission type) for
+  // |ttl|; the JS handler is only consulted on cache miss. A zero TTL
+  // disables the cache, which is the default.
+  void SetPermissionCacheTTL(base::TimeDelta ttl);
+
+  // Drops all cached decisions.
+  void ClearPermissionCache();
+
   // content::PermissionManager:
   int RequestPermission(
       content::PermissionType permission,
@@ -56,6 +67,11 @@ class AtomPermissionManager : public content::PermissionManager {
   void OnPermissionResponse(int request_id,
                             int permission_id,
                             blink::mojom::PermissionStatus status);
+  void OnPermissionResponseForCache(int request_id,
+                                    int permission_id,
+                                    const GURL& origin,
+                                    content::PermissionType permission,
+                                    blink::mojom::PermissionStatus status);
 
   // content::PermissionManager:
   void CancelPermissionRequest(int request_id) override;
@@ -78,10 +94,25 @@ class AtomPermissionManager : public content::PermissionManager {
   class PendingRequest;
   using PendingRequestsMap = IDMap<std::unique_ptr<PendingRequest>>;
 
+  struct CachedDecision {
+    blink::mojom::PermissionStatus status;
+    base::TimeTicks expiry;
+  };
+  using DecisionKey = std::pair<GURL, content::PermissionType>;
+
+  // Returns whether an unexpired decision for (origin, permission) exists,
+  // filling |*status|.
+  bool GetCachedDecision(const GURL& origin,
+                         content::PermissionType permission,
+                         blink::mojom::PermissionStatus* status);
+
   RequestHandler request_handler_;
 
   PendingRequestsMap pending_requests_;
 
+  base::TimeDelta cache_ttl_;
+  std::map<DecisionKey, CachedDecision> decision_cache_;
+
   DISALLOW_COPY_AND_ASSIGN(AtomPermissionManager);
 };
 
@@ -4,30 +4,86 @@
 
 #include "atom/browser/bridge_task_runner.h"
 
+#include <algorithm>
+
+#include "base/bind.h"
 #include "base/message_loop/message_loop.h"
 
 namespace atom {
 
+namespace {
+
+// Number of buffered tasks posted to the real task runner per batch. Small
+// enough that native work the loop already has (input, paint scheduling)
+// interleaves with a large startup backlog instead of waiting behind it.
+const size_t kFlushBatchSize = 64;
+
+// Largest number of tasks ever buffered while waiting for the message
+// loop. Lives outside the runner because the runner is dropped right after
+// the flush, while app.getStartupTimings() reads this much later.
+size_t g_buffered_high_water_mark = 0;
+
+}  // namespace
+
+// static
+size_t BridgeTaskRunner::GetBufferedHighWaterMark() {
+  return g_buffered_high_water_mark;
+}
+
 void BridgeTaskRunner::MessageLoopIsReady() {
   auto message_loop = base::MessageLoop::current();
   CHECK(message_loop);
-  for (const TaskPair& task : tasks_) {
-    message_loop->task_runner()->PostDelayedTask(
-        base::get<0>(task), base::get<1>(task), base::get<2>(task));
+
+  // Immediate tasks flush ahead of delayed ones: startup-critical work is
+  // posted without a delay, while delayed tasks have already declared they
+  // can wait. The partition is stable so FIFO order holds within each lane.
+  std::stable_partition(tasks_.begin(), tasks_.end(),
+                        [](const TaskPair& task) {
+                          return base::get<2>(task).is_zero();
+                        });
+  FlushBatch();
+}
+
+void BridgeTaskRunner::FlushBatch() {
+  auto message_loop = base::MessageLoop::current();
+  CHECK(message_loop);
+
+  size_t end = std::min(tasks_.size(), flush_position_ + kFlushBatchSize);
+  for (; flush_position_ < end; ++flush_position_) {
+    const TaskPair& task = tasks_[flush_position_];
+    if (base::get<3>(task)) {
+      message_loop->task_runner()->PostNonNestableDelayedTask(
+          base::get<0>(task), base::get<1>(task), base::get<2>(task));
+    } else {
+      message_loop->task_runner()->PostDelayedTask(
+          base::get<0>(task), base::get<1>(task), base::get<2>(task));
+    }
   }
-  for (const TaskPair& task : non_nestable_tasks_) {
-    message_loop->task_runner()->PostNonNestableDelayedTask(
-        base::get<0>(task), base::get<1>(task), base::get<2>(task));
+
+  if (flush_position_ < tasks_.size()) {
+    // Yield; the continuation runs after whatever the loop already has
+    // queued, so the remaining backlog cannot stall it.
+    message_loop->task_runner()->PostTask(
+        FROM_HERE, base::Bind(&BridgeTaskRunner::FlushBatch, this));
+  } else {
+    tasks_.clear();
+    flush_position_ = 0;
   }
 }
 
+void BridgeTaskRunner::RecordHighWaterMark() const {
+  if (tasks_.size() > g_buffered_high_water_mark)
+    g_buffered_high_water_mark = tasks_.size();
+}
+
 bool BridgeTaskRunner::PostDelayedTask(
     const tracked_objects::Location& from_here,
     const base::Closure& task,
     base::TimeDelta delay) {
   auto message_loop = base::MessageLoop::current();
   if (!message_loop) {
-    tasks_.push_back(std::make_tuple(from_here, task, delay));
+    tasks_.push_back(std::make_tuple(from_here, task, delay, false));
+    RecordHighWaterMark();
     return true;
   }
 
@@ -48,7 +104,8 @@ bool BridgeTaskRunner::PostNonNestableDelayedTask(
     base::TimeDelta delay) {
   auto message_loop = base::MessageLoop::current();
   if (!message_loop) {
-    non_nestable_tasks_.push_back(std::make_tuple(from_here, task, delay));
+    tasks_.push_back(std::make_tuple(from_here, task, delay, true));
+    RecordHighWaterMark();
     return true;
   }
 
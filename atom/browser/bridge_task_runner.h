@@ -20,9 +20,17 @@ class BridgeTaskRunner : public base::SingleThreadTaskRunner {
   BridgeTaskRunner() {}
   ~BridgeTaskRunner() override {}
 
-  // Called when message loop is ready.
+  // Called when message loop is ready. The buffered tasks are flushed in
+  // batches, immediate tasks ahead of delayed ones, yielding to the message
+  // loop between batches so a large startup backlog cannot monopolize the
+  // loop ahead of input and first paint.
   void MessageLoopIsReady();
 
+  // The largest number of tasks that were buffered at once while waiting
+  // for the message loop. Kept across the runner's destruction so it can
+  // be reported by app.getStartupTimings().
+  static size_t GetBufferedHighWaterMark();
+
   // base::SingleThreadTaskRunner:
   bool PostDelayedTask(const tracked_objects::Location& from_here,
                        const base::Closure& task,
@@ -34,10 +42,19 @@ class BridgeTaskRunner : public base::SingleThreadTaskRunner {
       base::TimeDelta delay) override;
 
  private:
-  using TaskPair = std::tuple<
-      tracked_objects::Location, base::Closure, base::TimeDelta>;
+  using TaskPair = std::tuple<tracked_objects::Location, base::Closure,
+                              base::TimeDelta, bool /* non_nestable */>;
+
+  // Posts the next batch of buffered tasks to the real task runner and
+  // reposts itself while any remain.
+  void FlushBatch();
+
+  void RecordHighWaterMark() const;
+
+  // Buffered tasks in post order; partitioned so immediate tasks come
+  // first once the flush starts.
   std::vector<TaskPair> tasks_;
-  std::vector<TaskPair> non_nestable_tasks_;
+  size_t flush_position_ = 0;
 
   DISALLOW_COPY_AND_ASSIGN(BridgeTaskRunner);
 };
@@ -9,11 +9,50 @@
 #include "atom/browser/native_window.h"
 #include "atom/browser/window_list.h"
 #include "atom/common/atom_version.h"
+#include "base/bind.h"
+#include "base/time/time.h"
 #include "brightray/common/application_info.h"
 #include "chrome/browser/ui/libgtkui/unity_service.h"
+#include "content/public/browser/browser_thread.h"
 
 namespace atom {
 
+namespace {
+
+// Unity badge updates go through libunity, which talks to the launcher
+// over D-Bus synchronously, so a badge storm (apps updating the badge on
+// every message delta) can stall the UI thread. Updates are coalesced:
+// the first one is pushed right away, later ones within the cooldown
+// window only record the value, and a trailing flush pushes the final
+// value once the window elapses.
+const int kBadgeUpdateIntervalMs = 100;
+
+int g_pending_badge_count = 0;
+int g_pushed_badge_count = -1;
+bool g_badge_flush_pending = false;
+
+void FlushBadgeCount();
+
+void ScheduleBadgeFlush() {
+  g_badge_flush_pending = true;
+  content::BrowserThread::PostDelayedTask(
+      content::BrowserThread::UI, FROM_HERE,
+      base::Bind(&FlushBadgeCount),
+      base::TimeDelta::FromMilliseconds(kBadgeUpdateIntervalMs));
+}
+
+void FlushBadgeCount() {
+  if (g_pending_badge_count == g_pushed_badge_count) {
+    g_badge_flush_pending = false;
+    return;
+  }
+  unity::SetDownloadCount(g_pending_badge_count);
+  g_pushed_badge_count = g_pending_badge_count;
+  ScheduleBadgeFlush();
+}
+
+}  // namespace
+
 void Browser::Focus() {
   // Focus on the first visible window.
   for (const auto& window : WindowList::GetWindows()) {
@@ -49,13 +88,19 @@ bool Browser::IsDefaultProtocolClient(const std::string& protocol,
 }
 
 bool Browser::SetBadgeCount(int count) {
-  if (IsUnityRunning()) {
-    unity::SetDownloadCount(count);
-    badge_count_ = count;
-    return true;
-  } else {
+  if (!IsUnityRunning())
     return false;
+
+  badge_count_ = count;
+  g_pending_badge_count = count;
+  if (!g_badge_flush_pending) {
+    // Leading edge: push immediately so a lone update is not delayed,
+    // then open a cooldown window that coalesces any storm behind it.
+    unity::SetDownloadCount(count);
+    g_pushed_badge_count = count;
+    ScheduleBadgeFlush();
   }
+  return true;
 }
 
 void Browser::SetLoginItemSettings(LoginItemSettings settings) {
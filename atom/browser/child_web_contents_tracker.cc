@@ -5,28 +5,77 @@
 #include "atom/browser/child_web_contents_tracker.h"
 
 #include <unordered_set>
+#include <utility>
+
+#include "base/lazy_instance.h"
+#include "base/memory/ref_counted.h"
+#include "base/synchronization/lock.h"
 
 namespace atom {
 
 namespace {
 
-std::unordered_set<content::WebContents*> g_child_web_contents;
+// The set of child WebContents is published as an immutable ref-counted
+// snapshot that is replaced, never mutated, when a child is created or
+// destroyed on the UI thread. Queries from any thread grab a reference to
+// the current snapshot and search it without a hop to the UI thread; the
+// lock is only held while the snapshot pointer is copied or swapped, never
+// during the lookup itself.
+struct Snapshot : public base::RefCountedThreadSafe<Snapshot> {
+  std::unordered_set<const content::WebContents*> contents;
+
+ private:
+  friend class base::RefCountedThreadSafe<Snapshot>;
+  ~Snapshot() {}
+};
+
+struct TrackerState {
+  base::Lock lock;
+  scoped_refptr<const Snapshot> snapshot;
+};
+
+base::LazyInstance<TrackerState>::Leaky g_tracker_state =
+    LAZY_INSTANCE_INITIALIZER;
+
+scoped_refptr<const Snapshot> GetSnapshot() {
+  TrackerState* state = g_tracker_state.Pointer();
+  base::AutoLock auto_lock(state->lock);
+  return state->snapshot;
+}
+
+void PublishSnapshot(scoped_refptr<const Snapshot> snapshot) {
+  TrackerState* state = g_tracker_state.Pointer();
+  base::AutoLock auto_lock(state->lock);
+  state->snapshot = std::move(snapshot);
+}
 
 }  // namespace
 
 ChildWebContentsTracker::ChildWebContentsTracker(
     content::WebContents* web_contents)
     : content::WebContentsObserver(web_contents) {
-  g_child_web_contents.insert(web_contents);
+  scoped_refptr<Snapshot> snapshot(new Snapshot);
+  scoped_refptr<const Snapshot> current = GetSnapshot();
+  if (current)
+    snapshot->contents = current->contents;
+  snapshot->contents.insert(web_contents);
+  PublishSnapshot(snapshot);
 }
 
 bool ChildWebContentsTracker::IsChildWebContents(
     content::WebContents* web_contents) {
-  return g_child_web_contents.find(web_contents) != g_child_web_contents.end();
+  scoped_refptr<const Snapshot> snapshot = GetSnapshot();
+  return snapshot &&
+         snapshot->contents.find(web_contents) != snapshot->contents.end();
 }
 
 void ChildWebContentsTracker::WebContentsDestroyed() {
-  g_child_web_contents.erase(web_contents());
+  scoped_refptr<Snapshot> snapshot(new Snapshot);
+  scoped_refptr<const Snapshot> current = GetSnapshot();
+  if (current)
+    snapshot->contents = current->contents;
+  snapshot->contents.erase(web_contents());
+  PublishSnapshot(snapshot);
   delete this;
 }
 
@@ -14,6 +14,9 @@ namespace atom {
 class ChildWebContentsTracker : public content::WebContentsObserver {
  public:
   explicit ChildWebContentsTracker(content::WebContents* web_contents);
+
+  // Queries a read-only snapshot of the tracked set and may be called from
+  // any thread. The pointer is only used as a key, it is never dereferenced.
   static bool IsChildWebContents(content::WebContents* web_contents);
 
  protected:
@@ -0,0 +1,73 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/host_zoom_index.h"
+
+#include <map>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/lazy_instance.h"
+
+namespace atom {
+
+namespace {
+
+// One index per HostZoomMap (i.e. per storage partition). Browser
+// contexts are never torn down before process exit, so neither are
+// their indexes.
+base::LazyInstance<std::map<content::HostZoomMap*,
+                            std::unique_ptr<HostZoomIndex>>>::Leaky
+    g_indexes = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+// static
+HostZoomIndex* HostZoomIndex::GetForHostZoomMap(
+    content::HostZoomMap* zoom_map) {
+  auto& index = g_indexes.Get()[zoom_map];
+  if (!index)
+    index.reset(new HostZoomIndex(zoom_map));
+  return index.get();
+}
+
+HostZoomIndex::HostZoomIndex(content::HostZoomMap* zoom_map)
+    : zoom_map_(zoom_map),
+      default_level_(zoom_map->GetDefaultZoomLevel()) {
+  subscription_ = zoom_map_->AddZoomLevelChangedCallback(
+      base::Bind(&HostZoomIndex::OnZoomLevelChanged, base::Unretained(this)));
+}
+
+HostZoomIndex::~HostZoomIndex() {
+}
+
+const HostZoomIndex::Entry& HostZoomIndex::Lookup(const std::string& scheme,
+                                                  const std::string& host) {
+  // A default-level change does not always come through the change
+  // callback, but it shifts every host without an explicit level.
+  double default_level = zoom_map_->GetDefaultZoomLevel();
+  if (default_level != default_level_) {
+    default_level_ = default_level;
+    cache_.clear();
+  }
+
+  std::string key = scheme + ':' + host;
+  auto it = cache_.find(key);
+  if (it != cache_.end())
+    return it->second;
+
+  Entry entry;
+  entry.has_host_level = zoom_map_->HasZoomLevel(scheme, host);
+  entry.level = zoom_map_->GetZoomLevelForHostAndScheme(scheme, host);
+  return cache_.insert(std::make_pair(std::move(key), entry)).first->second;
+}
+
+void HostZoomIndex::OnZoomLevelChanged(
+    const content::HostZoomMap::ZoomLevelChange& change) {
+  // Changes are rare next to navigations; dropping the whole cache is
+  // simpler than modelling HostZoomMap's host/scheme fallback rules.
+  cache_.clear();
+}
+
+}  // namespace atom
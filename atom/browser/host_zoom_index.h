@@ -0,0 +1,65 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_HOST_ZOOM_INDEX_H_
+#define ATOM_BROWSER_HOST_ZOOM_INDEX_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "base/macros.h"
+#include "content/public/browser/host_zoom_map.h"
+
+namespace atom {
+
+// Caches resolved per-host zoom levels in front of a HostZoomMap.
+//
+// HostZoomMap resolves a host with multiple string-keyed map lookups
+// (scheme+host, then host, then the default), and the zoom controller
+// queries it at least twice per navigation. With many distinct origins
+// this shows up on the UI thread. The index interns the scheme:host key
+// once and answers subsequent navigations with a single hash lookup;
+// any change reported by the HostZoomMap invalidates the cache, so
+// entries are rebuilt lazily and are always consistent with the map.
+//
+// Lives on the UI thread. Indexes are created per HostZoomMap and kept
+// for the life of the process, matching the lifetime of the browser
+// contexts that own the maps.
+class HostZoomIndex {
+ public:
+  struct Entry {
+    // Whether the map has an explicit level for this scheme+host.
+    bool has_host_level;
+    // The resolved level, including host-only and default fallbacks.
+    double level;
+  };
+
+  // Returns the index for |zoom_map|, creating it on first use.
+  static HostZoomIndex* GetForHostZoomMap(content::HostZoomMap* zoom_map);
+
+  // Resolves the zoom level of |scheme| + |host|, consulting the
+  // HostZoomMap only the first time a host is seen.
+  const Entry& Lookup(const std::string& scheme, const std::string& host);
+
+ private:
+  explicit HostZoomIndex(content::HostZoomMap* zoom_map);
+  ~HostZoomIndex();
+
+  void OnZoomLevelChanged(const content::HostZoomMap::ZoomLevelChange& change);
+
+  content::HostZoomMap* zoom_map_;  // weak reference.
+  std::unique_ptr<content::HostZoomMap::Subscription> subscription_;
+
+  std::unordered_map<std::string, Entry> cache_;
+  // Default level the cache was built against; a change to it affects
+  // entries without explicit host levels, so it flushes the cache too.
+  double default_level_;
+
+  DISALLOW_COPY_AND_ASSIGN(HostZoomIndex);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_HOST_ZOOM_INDEX_H_
@@ -0,0 +1,58 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/ipc_stats.h"
+
+#include <algorithm>
+
+#include "base/lazy_instance.h"
+#include "base/synchronization/lock.h"
+
+namespace atom {
+
+namespace ipc_stats {
+
+namespace {
+
+struct Stats {
+  base::Lock lock;
+  std::map<std::string, ChannelStats> channels;
+};
+
+base::LazyInstance<Stats>::Leaky g_stats = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+void RecordMessage(const std::string& channel, size_t bytes) {
+  Stats* stats = g_stats.Pointer();
+  base::AutoLock auto_lock(stats->lock);
+  ChannelStats& channel_stats = stats->channels[channel];
+  channel_stats.message_count++;
+  channel_stats.total_bytes += bytes;
+  channel_stats.max_message_bytes =
+      std::max(channel_stats.max_message_bytes,
+               static_cast<uint64_t>(bytes));
+}
+
+void RecordSerialize(const std::string& channel, base::TimeDelta duration) {
+  Stats* stats = g_stats.Pointer();
+  base::AutoLock auto_lock(stats->lock);
+  stats->channels[channel].serialize_time += duration;
+}
+
+std::map<std::string, ChannelStats> GetAll() {
+  Stats* stats = g_stats.Pointer();
+  base::AutoLock auto_lock(stats->lock);
+  return stats->channels;
+}
+
+void Reset() {
+  Stats* stats = g_stats.Pointer();
+  base::AutoLock auto_lock(stats->lock);
+  stats->channels.clear();
+}
+
+}  // namespace ipc_stats
+
+}  // namespace atom
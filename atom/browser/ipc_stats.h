@@ -0,0 +1,46 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_IPC_STATS_H_
+#define ATOM_BROWSER_IPC_STATS_H_
+
+#include <map>
+#include <string>
+
+#include "base/time/time.h"
+
+namespace atom {
+
+// Per-channel counters for the JavaScript ipc traffic flowing through the
+// browser process, kept cheap enough to stay enabled. Recording happens
+// on the UI thread where the messages are dispatched; reading happens
+// from app.getIPCStats().
+namespace ipc_stats {
+
+struct ChannelStats {
+  ChannelStats() : message_count(0), total_bytes(0), max_message_bytes(0) {}
+
+  uint64_t message_count;
+  uint64_t total_bytes;
+  uint64_t max_message_bytes;
+  // Time spent serializing outgoing payloads; zero for channels that only
+  // receive.
+  base::TimeDelta serialize_time;
+};
+
+// Counts one message of |bytes| on |channel|.
+void RecordMessage(const std::string& channel, size_t bytes);
+
+// Adds time spent serializing an outgoing payload on |channel|.
+void RecordSerialize(const std::string& channel, base::TimeDelta duration);
+
+std::map<std::string, ChannelStats> GetAll();
+
+void Reset();
+
+}  // namespace ipc_stats
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_IPC_STATS_H_
@@ -7,6 +7,9 @@
 #include <string>
 
 #include "base/command_line.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/logging.h"
 #include "base/message_loop/message_loop.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "content/public/common/content_switches.h"
@@ -44,6 +47,26 @@ bool JavascriptEnvironment::Initialize() {
   if (!js_flags.empty())
     v8::V8::SetFlagsFromString(js_flags.c_str(), js_flags.size());
 
+  // --custom-v8-snapshot=path lets an app substitute a startup snapshot
+  // with its own pure-JS bootstrap baked in, so launch deserializes that
+  // heap instead of re-executing the scripts. The blob must be produced by
+  // the mksnapshot matching this V8 version.
+  base::FilePath snapshot_path =
+      cmd->GetSwitchValuePath("custom-v8-snapshot");
+  if (!snapshot_path.empty()) {
+    // V8 keeps referencing the data for the life of the process.
+    std::string* snapshot_data = new std::string;
+    if (base::ReadFileToString(snapshot_path, snapshot_data)) {
+      v8::StartupData blob = {snapshot_data->data(),
+                              static_cast<int>(snapshot_data->size())};
+      v8::V8::SetSnapshotDataBlob(&blob);
+    } else {
+      delete snapshot_data;
+      LOG(ERROR) << "Failed to read custom V8 snapshot from "
+                 << snapshot_path.value();
+    }
+  }
+
   gin::IsolateHolder::Initialize(gin::IsolateHolder::kNonStrictMode,
                                  gin::IsolateHolder::kStableV8Extras,
                                  gin::ArrayBufferAllocator::SharedInstance());
@@ -0,0 +1,101 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/js_task_scheduler.h"
+
+#include "base/bind.h"
+#include "base/location.h"
+#include "base/threading/thread_task_runner_handle.h"
+
+namespace atom {
+
+namespace {
+
+// After this many consecutive callbacks run while lower priority work was
+// waiting, one waiting lower priority callback runs so background work
+// keeps making progress under sustained high priority load.
+const int kStarvationRunLimit = 8;
+
+}  // namespace
+
+JsTaskScheduler::JsTaskScheduler()
+    : pump_scheduled_(false),
+      runs_while_starving_(0),
+      weak_ptr_factory_(this) {
+}
+
+JsTaskScheduler::~JsTaskScheduler() {
+}
+
+void JsTaskScheduler::PostTask(Priority priority, const base::Closure& task) {
+  queues_[priority].push(task);
+  SchedulePump();
+}
+
+void JsTaskScheduler::SchedulePump() {
+  if (pump_scheduled_)
+    return;
+
+  pump_scheduled_ = true;
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::Bind(&JsTaskScheduler::RunOneTask,
+                            weak_ptr_factory_.GetWeakPtr()));
+}
+
+int JsTaskScheduler::PickQueue() {
+  int highest = -1;
+  for (int i = 0; i < PRIORITY_COUNT; ++i) {
+    if (!queues_[i].empty()) {
+      highest = i;
+      break;
+    }
+  }
+  if (highest < 0)
+    return -1;
+
+  if (runs_while_starving_ >= kStarvationRunLimit) {
+    for (int i = PRIORITY_COUNT - 1; i > highest; --i) {
+      if (!queues_[i].empty()) {
+        runs_while_starving_ = 0;
+        return i;
+      }
+    }
+  }
+
+  bool lower_priority_waiting = false;
+  for (int i = highest + 1; i < PRIORITY_COUNT; ++i) {
+    if (!queues_[i].empty())
+      lower_priority_waiting = true;
+  }
+  if (lower_priority_waiting)
+    ++runs_while_starving_;
+  else
+    runs_while_starving_ = 0;
+
+  return highest;
+}
+
+void JsTaskScheduler::RunOneTask() {
+  pump_scheduled_ = false;
+
+  int queue = PickQueue();
+  if (queue < 0)
+    return;
+
+  base::Closure task = queues_[queue].front();
+  queues_[queue].pop();
+
+  // Schedule the next turn before running the callback, so callbacks that
+  // post further tasks coalesce into the already pending turn.
+  for (int i = 0; i < PRIORITY_COUNT; ++i) {
+    if (!queues_[i].empty()) {
+      SchedulePump();
+      break;
+    }
+  }
+
+  task.Run();
+}
+
+}  // namespace atom
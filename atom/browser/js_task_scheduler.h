@@ -0,0 +1,62 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_JS_TASK_SCHEDULER_H_
+#define ATOM_BROWSER_JS_TASK_SCHEDULER_H_
+
+#include <queue>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/memory/weak_ptr.h"
+
+namespace atom {
+
+// Runs JavaScript callbacks on the UI thread in priority order instead of
+// the message loop's single FIFO. Only one callback runs per message loop
+// turn, so native input and UI work interleaves between callbacks, and
+// user-blocking callbacks always go ahead of background ones. Lower
+// priority queues are protected from starvation: after a run of higher
+// priority callbacks while lower priority work is waiting, one waiting
+// callback is let through.
+class JsTaskScheduler {
+ public:
+  enum Priority {
+    PRIORITY_USER_BLOCKING = 0,
+    PRIORITY_USER_VISIBLE,
+    PRIORITY_BACKGROUND,
+    PRIORITY_COUNT,
+  };
+
+  JsTaskScheduler();
+  ~JsTaskScheduler();
+
+  void PostTask(Priority priority, const base::Closure& task);
+
+ private:
+  // Posts one RunOneTask turn to the message loop if none is pending.
+  void SchedulePump();
+  void RunOneTask();
+
+  // Returns the index of the queue the next callback should come from,
+  // honoring priority order and the starvation cap, or -1 if all queues
+  // are empty.
+  int PickQueue();
+
+  std::queue<base::Closure> queues_[PRIORITY_COUNT];
+
+  bool pump_scheduled_;
+
+  // Number of consecutive callbacks run while a lower priority queue had
+  // work waiting.
+  int runs_while_starving_;
+
+  base::WeakPtrFactory<JsTaskScheduler> weak_ptr_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(JsTaskScheduler);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_JS_TASK_SCHEDULER_H_
@@ -4,8 +4,15 @@
 
 #include "atom/browser/login_handler.h"
 
+#include <map>
+#include <set>
+#include <string>
+
 #include "atom/browser/browser.h"
 #include "atom/common/native_mate_converters/net_converter.h"
+#include "base/lazy_instance.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/render_frame_host.h"
@@ -28,6 +35,38 @@ void ResetLoginHandlerForRequest(net::URLRequest* request) {
   content::ResourceDispatcherHost::Get()->ClearLoginDelegateForRequest(request);
 }
 
+// How long credentials accepted through the "login" event keep answering
+// repeated challenges before JavaScript is consulted again.
+const int kCredentialCacheTTLMinutes = 10;
+
+// Credentials that previously satisfied a challenge, kept so repeated
+// challenges for the same realm are answered on the IO thread without a
+// round trip to JavaScript. Only accessed on the IO thread.
+struct CachedCredential {
+  net::AuthCredentials credentials;
+  base::TimeTicks expiry;
+};
+
+base::LazyInstance<std::map<std::string, CachedCredential>>::Leaky
+    g_credential_cache = LAZY_INSTANCE_INITIALIZER;
+
+// Requests whose current challenge was answered from the cache. A second
+// challenge on such a request means the cached credentials were rejected
+// by the server, so they must be dropped instead of replayed forever.
+// Entries for requests that complete successfully are never removed, so
+// the set is cleared once it grows past |kAnsweredRequestsLimit|; losing
+// a live marker only costs one extra replay of stale credentials.
+const size_t kAnsweredRequestsLimit = 100;
+base::LazyInstance<std::set<const net::URLRequest*>>::Leaky
+    g_cache_answered_requests = LAZY_INSTANCE_INITIALIZER;
+
+std::string CredentialCacheKey(const net::AuthChallengeInfo* auth_info) {
+  return (auth_info->is_proxy ? "proxy/" : "server/") + auth_info->scheme +
+         "/" + auth_info->challenger.host() + ":" +
+         base::UintToString(auth_info->challenger.port()) + "/" +
+         auth_info->realm;
+}
+
 }  // namespace
 
 LoginHandler::LoginHandler(net::AuthChallengeInfo* auth_info,
@@ -40,6 +79,37 @@ LoginHandler::LoginHandler(net::AuthChallengeInfo* auth_info,
   content::ResourceRequestInfo::ForRequest(request_)->GetAssociatedRenderFrame(
       &render_process_host_id_,  &render_frame_id_);
 
+  const std::string cache_key = CredentialCacheKey(auth_info);
+  auto* cache = g_credential_cache.Pointer();
+  auto* answered = g_cache_answered_requests.Pointer();
+  auto answered_iter = answered->find(request_);
+  if (answered_iter != answered->end()) {
+    // This request already tried the cached credentials and got challenged
+    // again, so they are stale; drop them and fall through to JavaScript.
+    answered->erase(answered_iter);
+    cache->erase(cache_key);
+  } else {
+    auto iter = cache->find(cache_key);
+    if (iter != cache->end()) {
+      if (base::TimeTicks::Now() < iter->second.expiry) {
+        // Answer the challenge from the cache without raising the "login"
+        // event. SetAuth can not be called from inside CreateLoginDelegate,
+        // so bounce through the IO message loop.
+        if (answered->size() >= kAnsweredRequestsLimit)
+          answered->clear();
+        answered->insert(request_);
+        TestAndSetAuthHandled();
+        BrowserThread::PostTask(
+            BrowserThread::IO, FROM_HERE,
+            base::Bind(&LoginHandler::DoLogin, this,
+                       iter->second.credentials.username(),
+                       iter->second.credentials.password()));
+        return;
+      }
+      cache->erase(iter);
+    }
+  }
+
   // Fill request details on IO thread.
   std::unique_ptr<base::DictionaryValue> request_details(
       new base::DictionaryValue);
@@ -84,6 +154,7 @@ void LoginHandler::CancelAuth() {
 
 void LoginHandler::OnRequestCancelled() {
   TestAndSetAuthHandled();
+  g_cache_answered_requests.Get().erase(request_);
   request_ = nullptr;
 }
 
@@ -111,7 +182,13 @@ void LoginHandler::DoLogin(const base::string16& username,
   DCHECK_CURRENTLY_ON(BrowserThread::IO);
 
   if (request_) {
-    request_->SetAuth(net::AuthCredentials(username, password));
+    net::AuthCredentials credentials(username, password);
+    CachedCredential& entry = g_credential_cache.Get()[
+        CredentialCacheKey(auth_info_.get())];
+    entry.credentials = credentials;
+    entry.expiry = base::TimeTicks::Now() +
+        base::TimeDelta::FromMinutes(kCredentialCacheTTLMinutes);
+    request_->SetAuth(credentials);
     ResetLoginHandlerForRequest(request_);
   }
 }
@@ -0,0 +1,102 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/main_thread_watchdog.h"
+
+#include "atom/browser/unresponsive_suppressor.h"
+#include "base/logging.h"
+#include "base/pending_task.h"
+
+namespace atom {
+
+namespace {
+
+// Long enough to ignore ordinary heavy tasks, short enough to catch
+// stalls well before the renderer unresponsive timeout kicks in.
+const int kStallThresholdMs = 250;
+
+// How often the watchdog thread checks on the task in flight.
+const int kHeartbeatIntervalMs = 100;
+
+}  // namespace
+
+MainThreadWatchdog::MainThreadWatchdog()
+    : stall_threshold_(
+          base::TimeDelta::FromMilliseconds(kStallThresholdMs)),
+      stop_event_(base::WaitableEvent::ResetPolicy::MANUAL,
+                  base::WaitableEvent::InitialState::NOT_SIGNALED),
+      stall_logged_(false) {
+}
+
+MainThreadWatchdog::~MainThreadWatchdog() {
+  DCHECK(!thread_);
+}
+
+void MainThreadWatchdog::Start() {
+  if (thread_)
+    return;
+  base::MessageLoop::current()->AddTaskObserver(this);
+  thread_.reset(new base::DelegateSimpleThread(this, "MainThreadWatchdog"));
+  thread_->Start();
+}
+
+void MainThreadWatchdog::Stop() {
+  if (!thread_)
+    return;
+  stop_event_.Signal();
+  thread_->Join();
+  thread_.reset();
+  base::MessageLoop::current()->RemoveTaskObserver(this);
+}
+
+void MainThreadWatchdog::SetStallCallback(const StallCallback& callback) {
+  stall_callback_ = callback;
+}
+
+void MainThreadWatchdog::WillProcessTask(
+    const base::PendingTask& pending_task) {
+  base::AutoLock auto_lock(lock_);
+  current_task_start_ = base::TimeTicks::Now();
+  current_task_annotation_ = pending_task.posted_from.ToString();
+  stall_logged_ = false;
+}
+
+void MainThreadWatchdog::DidProcessTask(
+    const base::PendingTask& pending_task) {
+  base::TimeDelta duration;
+  std::string annotation;
+  {
+    base::AutoLock auto_lock(lock_);
+    if (current_task_start_.is_null())
+      return;
+    duration = base::TimeTicks::Now() - current_task_start_;
+    annotation.swap(current_task_annotation_);
+    current_task_start_ = base::TimeTicks();
+  }
+
+  if (duration < stall_threshold_ || IsUnresponsiveEventSuppressed())
+    return;
+  if (!stall_callback_.is_null())
+    stall_callback_.Run(duration, annotation);
+}
+
+void MainThreadWatchdog::Run() {
+  base::TimeDelta interval =
+      base::TimeDelta::FromMilliseconds(kHeartbeatIntervalMs);
+  while (!stop_event_.TimedWait(interval)) {
+    base::AutoLock auto_lock(lock_);
+    if (current_task_start_.is_null() || stall_logged_)
+      continue;
+    base::TimeDelta elapsed = base::TimeTicks::Now() - current_task_start_;
+    if (elapsed < stall_threshold_)
+      continue;
+    // The stall callback can only fire after the task yields; log from
+    // here so a stall is visible while the main thread is still stuck.
+    LOG(WARNING) << "Main thread has been busy for " << elapsed.InMilliseconds()
+                 << "ms running task posted from " << current_task_annotation_;
+    stall_logged_ = true;
+  }
+}
+
+}  // namespace atom
@@ -0,0 +1,76 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_MAIN_THREAD_WATCHDOG_H_
+#define ATOM_BROWSER_MAIN_THREAD_WATCHDOG_H_
+
+#include <memory>
+#include <string>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/message_loop/message_loop.h"
+#include "base/synchronization/lock.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/threading/simple_thread.h"
+#include "base/time/time.h"
+
+namespace atom {
+
+// Measures main-thread responsiveness. A task observer on the UI
+// message loop records when each task starts and where it was posted
+// from; a watchdog thread heartbeats against that record and logs
+// stalls while they are still in progress. When a task that exceeded
+// the stall threshold finishes, the stall callback runs on the UI
+// thread with the duration and the task's posted-from annotation, so
+// apps get C++-level jank visibility instead of inferring it from
+// JavaScript timers.
+//
+// Stalls are not reported while an UnresponsiveSuppressor is active
+// (modal dialogs, printing), matching the renderer unresponsive events.
+class MainThreadWatchdog : public base::MessageLoop::TaskObserver,
+                           public base::DelegateSimpleThread::Delegate {
+ public:
+  using StallCallback =
+      base::Callback<void(base::TimeDelta duration,
+                          const std::string& task_annotation)>;
+
+  MainThreadWatchdog();
+  ~MainThreadWatchdog() override;
+
+  // Both called on the UI thread, with its message loop running.
+  void Start();
+  void Stop();
+
+  // |callback| runs on the UI thread after a stalled task completes.
+  void SetStallCallback(const StallCallback& callback);
+
+ private:
+  // base::MessageLoop::TaskObserver:
+  void WillProcessTask(const base::PendingTask& pending_task) override;
+  void DidProcessTask(const base::PendingTask& pending_task) override;
+
+  // base::DelegateSimpleThread::Delegate:
+  void Run() override;
+
+  // Stalls shorter than this are considered normal scheduling noise.
+  base::TimeDelta stall_threshold_;
+
+  StallCallback stall_callback_;  // UI thread.
+
+  std::unique_ptr<base::DelegateSimpleThread> thread_;
+  base::WaitableEvent stop_event_;
+
+  base::Lock lock_;
+  // Non-null start marks a task in flight; all guarded by |lock_|.
+  base::TimeTicks current_task_start_;
+  std::string current_task_annotation_;
+  bool stall_logged_;
+
+  DISALLOW_COPY_AND_ASSIGN(MainThreadWatchdog);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_MAIN_THREAD_WATCHDOG_H_
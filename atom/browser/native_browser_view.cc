@@ -4,15 +4,109 @@
 
 #include "atom/browser/native_browser_view.h"
 
+#include <utility>
+#include <vector>
+
 #include "atom/browser/api/atom_api_web_contents.h"
+#include "base/lazy_instance.h"
+#include "base/logging.h"
 #include "brightray/browser/inspectable_web_contents_view.h"
+#include "ui/gfx/geometry/rect.h"
 
 namespace atom {
 
+namespace {
+
+// A view's not-yet-applied changes inside the current layout transaction.
+// Only the last value written for each property is kept.
+struct PendingLayout {
+  PendingLayout() : has_bounds(false), has_visible(false), visible(false) {}
+
+  bool has_bounds;
+  gfx::Rect bounds;
+  bool has_visible;
+  bool visible;
+};
+
+using PendingLayoutList =
+    std::vector<std::pair<NativeBrowserView*, PendingLayout>>;
+
+// Pending changes, in the order the first change for each view arrived.
+base::LazyInstance<PendingLayoutList>::Leaky g_pending_layouts =
+    LAZY_INSTANCE_INITIALIZER;
+
+int g_layout_transaction_depth = 0;
+
+PendingLayout* GetPendingLayout(NativeBrowserView* view) {
+  PendingLayoutList* list = g_pending_layouts.Pointer();
+  for (auto& entry : *list) {
+    if (entry.first == view)
+      return &entry.second;
+  }
+  list->push_back(std::make_pair(view, PendingLayout()));
+  return &list->back().second;
+}
+
+}  // namespace
+
 NativeBrowserView::NativeBrowserView(
     brightray::InspectableWebContentsView* web_contents_view)
     : web_contents_view_(web_contents_view) {}
 
-NativeBrowserView::~NativeBrowserView() {}
+NativeBrowserView::~NativeBrowserView() {
+  // Drop changes an open transaction may have collected for this view.
+  if (g_layout_transaction_depth > 0) {
+    PendingLayoutList* list = g_pending_layouts.Pointer();
+    for (auto it = list->begin(); it != list->end(); ++it) {
+      if (it->first == this) {
+        list->erase(it);
+        break;
+      }
+    }
+  }
+}
+
+// static
+void NativeBrowserView::BeginLayoutTransaction() {
+  ++g_layout_transaction_depth;
+}
+
+// static
+void NativeBrowserView::CommitLayoutTransaction() {
+  DCHECK_GT(g_layout_transaction_depth, 0);
+  if (g_layout_transaction_depth == 0 || --g_layout_transaction_depth > 0)
+    return;
+
+  // Apply everything in one pass, so all the changes reach the compositor
+  // within the same frame instead of one invalidation per call.
+  PendingLayoutList pending;
+  pending.swap(*g_pending_layouts.Pointer());
+  for (auto& entry : pending) {
+    if (entry.second.has_bounds)
+      entry.first->SetBoundsImpl(entry.second.bounds);
+    if (entry.second.has_visible)
+      entry.first->SetVisibleImpl(entry.second.visible);
+  }
+}
+
+void NativeBrowserView::SetBounds(const gfx::Rect& bounds) {
+  if (g_layout_transaction_depth > 0) {
+    PendingLayout* pending = GetPendingLayout(this);
+    pending->has_bounds = true;
+    pending->bounds = bounds;
+    return;
+  }
+  SetBoundsImpl(bounds);
+}
+
+void NativeBrowserView::SetVisible(bool visible) {
+  if (g_layout_transaction_depth > 0) {
+    PendingLayout* pending = GetPendingLayout(this);
+    pending->has_visible = true;
+    pending->visible = visible;
+    return;
+  }
+  SetVisibleImpl(visible);
+}
 
 }  // namespace atom
@@ -34,18 +34,32 @@ class NativeBrowserView {
   static NativeBrowserView* Create(
       brightray::InspectableWebContentsView* web_contents_view);
 
+  // Transactional layout. Between BeginLayoutTransaction() and
+  // CommitLayoutTransaction(), bounds and visibility changes on every
+  // NativeBrowserView are collected instead of applied immediately; the
+  // commit then applies all pending changes in one pass, so a layout that
+  // touches several views is composited as a single update instead of one
+  // per view. Transactions nest, only the outermost commit applies.
+  static void BeginLayoutTransaction();
+  static void CommitLayoutTransaction();
+
   brightray::InspectableWebContentsView* GetInspectableWebContentsView() {
     return web_contents_view_;
   }
 
   virtual void SetAutoResizeFlags(uint8_t flags) = 0;
-  virtual void SetBounds(const gfx::Rect& bounds) = 0;
+  void SetBounds(const gfx::Rect& bounds);
+  void SetVisible(bool visible);
   virtual void SetBackgroundColor(SkColor color) = 0;
 
  protected:
   explicit NativeBrowserView(
       brightray::InspectableWebContentsView* web_contents_view);
 
+  // Platform implementations, called directly or from a transaction commit.
+  virtual void SetBoundsImpl(const gfx::Rect& bounds) = 0;
+  virtual void SetVisibleImpl(bool visible) = 0;
+
   brightray::InspectableWebContentsView* web_contents_view_;
 
  private:
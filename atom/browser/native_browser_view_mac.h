@@ -18,9 +18,12 @@ class NativeBrowserViewMac : public NativeBrowserView {
   ~NativeBrowserViewMac() override;
 
   void SetAutoResizeFlags(uint8_t flags) override;
-  void SetBounds(const gfx::Rect& bounds) override;
   void SetBackgroundColor(SkColor color) override;
 
+ protected:
+  void SetBoundsImpl(const gfx::Rect& bounds) override;
+  void SetVisibleImpl(bool visible) override;
+
  private:
   DISALLOW_COPY_AND_ASSIGN(NativeBrowserViewMac);
 };
@@ -36,7 +36,7 @@ void NativeBrowserViewMac::SetAutoResizeFlags(uint8_t flags) {
   view.autoresizingMask = autoresizing_mask;
 }
 
-void NativeBrowserViewMac::SetBounds(const gfx::Rect& bounds) {
+void NativeBrowserViewMac::SetBoundsImpl(const gfx::Rect& bounds) {
   auto* view = GetInspectableWebContentsView()->GetNativeView();
   auto* superview = view.superview;
   const auto superview_height = superview ? superview.frame.size.height : 0;
@@ -45,6 +45,11 @@ void NativeBrowserViewMac::SetBounds(const gfx::Rect& bounds) {
                  bounds.width(), bounds.height());
 }
 
+void NativeBrowserViewMac::SetVisibleImpl(bool visible) {
+  auto* view = GetInspectableWebContentsView()->GetNativeView();
+  view.hidden = !visible;
+}
+
 void NativeBrowserViewMac::SetBackgroundColor(SkColor color) {
   auto* view = GetInspectableWebContentsView()->GetNativeView();
   view.wantsLayer = YES;
@@ -17,11 +17,16 @@ NativeBrowserViewViews::NativeBrowserViewViews(
 
 NativeBrowserViewViews::~NativeBrowserViewViews() {}
 
-void NativeBrowserViewViews::SetBounds(const gfx::Rect& bounds) {
+void NativeBrowserViewViews::SetBoundsImpl(const gfx::Rect& bounds) {
   auto* view = GetInspectableWebContentsView()->GetView();
   view->SetBoundsRect(bounds);
 }
 
+void NativeBrowserViewViews::SetVisibleImpl(bool visible) {
+  auto* view = GetInspectableWebContentsView()->GetView();
+  view->SetVisible(visible);
+}
+
 void NativeBrowserViewViews::SetBackgroundColor(SkColor color) {
   auto* view = GetInspectableWebContentsView()->GetView();
   view->set_background(views::Background::CreateSolidBackground(color));
@@ -19,9 +19,12 @@ class NativeBrowserViewViews : public NativeBrowserView {
   void SetAutoResizeFlags(uint8_t flags) override {
     auto_resize_flags_ = flags;
   }
-  void SetBounds(const gfx::Rect& bounds) override;
   void SetBackgroundColor(SkColor color) override;
 
+ protected:
+  void SetBoundsImpl(const gfx::Rect& bounds) override;
+  void SetVisibleImpl(bool visible) override;
+
  private:
   uint8_t auto_resize_flags_;
 
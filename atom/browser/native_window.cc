@@ -16,6 +16,7 @@
 #include "atom/common/api/api_messages.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
 #include "atom/common/options_switches.h"
+#include "atom/common/startup_timings.h"
 #include "base/files/file_util.h"
 #include "base/json/json_writer.h"
 #include "base/message_loop/message_loop.h"
@@ -35,6 +36,8 @@
 #include "ipc/ipc_message_macros.h"
 #include "native_mate/dictionary.h"
 #include "third_party/skia/include/core/SkRegion.h"
+#include "ui/display/display.h"
+#include "ui/display/screen.h"
 #include "ui/gfx/codec/png_codec.h"
 #include "ui/gfx/geometry/point.h"
 #include "ui/gfx/geometry/rect.h"
@@ -67,6 +70,8 @@ NativeWindow::NativeWindow(
       is_modal_(false),
       inspectable_web_contents_(inspectable_web_contents),
       weak_factory_(this) {
+  startup_timings::Record(startup_timings::kWindowCreated);
+
   options.Get(options::kFrame, &has_frame_);
   options.Get(options::kTransparent, &transparent_);
   options.Get(options::kEnableLargerThanScreen, &enable_larger_than_screen_);
@@ -398,6 +403,41 @@ void NativeWindow::PreviewFile(const std::string& path,
 void NativeWindow::CloseFilePreview() {
 }
 
+WindowState NativeWindow::GetWindowState() {
+  WindowState state;
+  state.bounds = GetBounds();
+  state.display_id = display::Screen::GetScreen()
+      ->GetDisplayMatching(state.bounds).id();
+  state.maximized = IsMaximized();
+  state.minimized = IsMinimized();
+  state.fullscreen = IsFullscreen();
+  state.always_on_top = IsAlwaysOnTop();
+  return state;
+}
+
+void NativeWindow::RestoreWindowState(const WindowState& state) {
+  gfx::Rect bounds = state.bounds;
+  display::Display display =
+      display::Screen::GetScreen()->GetDisplayMatching(bounds);
+  // The display the state was captured on may be gone; fit the bounds
+  // to the nearest display rather than restoring off-screen.
+  if (state.display_id != -1 && display.id() != state.display_id)
+    bounds.AdjustToFit(display.work_area());
+  SetBounds(bounds, false);
+
+  if (state.always_on_top != IsAlwaysOnTop())
+    SetAlwaysOnTop(state.always_on_top);
+
+  // Modes that override the normal bounds come last, so leaving them
+  // later returns the window to the bounds set above.
+  if (state.fullscreen)
+    SetFullScreen(true);
+  else if (state.maximized)
+    Maximize();
+  else if (state.minimized)
+    Minimize();
+}
+
 void NativeWindow::RequestToClosePage() {
   bool prevent_default = false;
   for (NativeWindowObserver& observer : observers_)
@@ -522,11 +562,18 @@ void NativeWindow::NotifyWindowRestore() {
 void NativeWindow::NotifyWindowResize() {
   for (NativeWindowObserver& observer : observers_)
     observer.OnWindowResize();
+  ScheduleWindowStateCapture();
 }
 
 void NativeWindow::NotifyWindowMove() {
   for (NativeWindowObserver& observer : observers_)
     observer.OnWindowMove();
+  ScheduleWindowStateCapture();
+}
+
+void NativeWindow::NotifyWindowResized() {
+  for (NativeWindowObserver& observer : observers_)
+    observer.OnWindowResized();
 }
 
 void NativeWindow::NotifyWindowMoved() {
@@ -639,6 +686,8 @@ void NativeWindow::BeforeUnloadDialogCancelled() {
 }
 
 void NativeWindow::DidFirstVisuallyNonEmptyPaint() {
+  startup_timings::Record(startup_timings::kFirstPaint);
+
   if (IsVisible())
     return;
 
@@ -673,6 +722,26 @@ void NativeWindow::UpdateDraggableRegions(
   draggable_region_ = DraggableRegionsToSkRegion(regions);
 }
 
+void NativeWindow::ScheduleWindowStateCapture() {
+  // Unlike the unresponsive closure this resets on every event, so the
+  // capture fires once the move/resize stream goes quiet.
+  window_state_capture_closure_.Reset(
+      base::Bind(&NativeWindow::NotifyWindowStateCaptured,
+                 weak_factory_.GetWeakPtr()));
+  base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(
+      FROM_HERE,
+      window_state_capture_closure_.callback(),
+      base::TimeDelta::FromMilliseconds(500));
+}
+
+void NativeWindow::NotifyWindowStateCaptured() {
+  if (is_closed_)
+    return;
+  WindowState state = GetWindowState();
+  for (NativeWindowObserver& observer : observers_)
+    observer.OnWindowStateCaptured(state);
+}
+
 void NativeWindow::ScheduleUnresponsiveEvent(int ms) {
   if (!window_unresposive_closure_.IsCancelled())
     return;
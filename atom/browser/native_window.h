@@ -12,6 +12,7 @@
 
 #include "atom/browser/native_window_observer.h"
 #include "atom/browser/ui/accelerator_util.h"
+#include "atom/browser/window_state.h"
 #include "atom/browser/ui/atom_menu_model.h"
 #include "base/cancelable_callback.h"
 #include "base/memory/weak_ptr.h"
@@ -203,6 +204,13 @@ class NativeWindow : public base::SupportsUserData,
                            const std::string& display_name);
   virtual void CloseFilePreview();
 
+  // Window state persistence APIs. Capturing returns everything needed
+  // to recreate the window's placement; restoring applies a saved state
+  // in one pass without animations, so it can run before first paint
+  // without a layout per setter.
+  virtual WindowState GetWindowState();
+  virtual void RestoreWindowState(const WindowState& state);
+
   base::WeakPtr<NativeWindow> GetWeakPtr() {
     return weak_factory_.GetWeakPtr();
   }
@@ -238,6 +246,7 @@ class NativeWindow : public base::SupportsUserData,
   void NotifyWindowRestore();
   void NotifyWindowMove();
   void NotifyWindowResize();
+  void NotifyWindowResized();
   void NotifyWindowMoved();
   void NotifyWindowScrollTouchBegin();
   void NotifyWindowScrollTouchEnd();
@@ -314,6 +323,14 @@ class NativeWindow : public base::SupportsUserData,
   // Dispatch ReadyToShow event to observers.
   void NotifyReadyToShow();
 
+  // Arms (or re-arms) the debounce for a window state capture, so a
+  // stream of move/resize events produces one OnWindowStateCaptured
+  // per gesture instead of one per event.
+  void ScheduleWindowStateCapture();
+
+  // Dispatch the captured state to observers.
+  void NotifyWindowStateCaptured();
+
   // Whether window has standard frame.
   bool has_frame_;
 
@@ -337,6 +354,10 @@ class NativeWindow : public base::SupportsUserData,
   // it should be cancelled when we can prove that the window is responsive.
   base::CancelableClosure window_unresposive_closure_;
 
+  // Pending debounced window state capture; reset on every move/resize
+  // event so it fires once the gesture settles.
+  base::CancelableClosure window_state_capture_closure_;
+
   // Used to display sheets at the appropriate horizontal and vertical offsets
   // on macOS.
   double sheet_offset_x_;
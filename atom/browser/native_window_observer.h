@@ -7,6 +7,7 @@
 
 #include <string>
 
+#include "atom/browser/window_state.h"
 #include "base/strings/string16.h"
 #include "base/values.h"
 #include "ui/base/window_open_disposition.h"
@@ -64,8 +65,12 @@ class NativeWindowObserver {
   virtual void OnWindowMinimize() {}
   virtual void OnWindowRestore() {}
   virtual void OnWindowResize() {}
+  virtual void OnWindowResized() {}
   virtual void OnWindowMove() {}
   virtual void OnWindowMoved() {}
+  // Called once per move/resize gesture, debounced, with a fresh state
+  // snapshot suitable for persisting.
+  virtual void OnWindowStateCaptured(const WindowState& state) {}
   virtual void OnWindowScrollTouchBegin() {}
   virtual void OnWindowScrollTouchEnd() {}
   virtual void OnWindowScrollTouchEdge() {}
@@ -151,9 +151,12 @@ NativeWindowViews::NativeWindowViews(
       resizable_(true),
       maximizable_(true),
       minimizable_(true),
-      fullscreenable_(true) {
+      fullscreenable_(true),
+      bounds_event_coalescing_ms_(0),
+      weak_factory_(this) {
   options.Get(options::kTitle, &title_);
   options.Get(options::kAutoHideMenuBar, &menu_bar_autohide_);
+  options.Get(options::kBoundsEventCoalescing, &bounds_event_coalescing_ms_);
 
 #if defined(OS_WIN)
   // On Windows we rely on the CanResize() to indicate whether window can be
@@ -1081,11 +1084,52 @@ void NativeWindowViews::OnWidgetBoundsChanged(
     return;
 
   if (widget_size_ != bounds.size()) {
-    NotifyWindowResize();
+    if (bounds_event_coalescing_ms_ > 0)
+      ScheduleResizeFlush();
+    else
+      NotifyWindowResize();
     widget_size_ = bounds.size();
   }
 }
 
+void NativeWindowViews::ScheduleMoveFlush() {
+  // Emit the leading event of a new burst so listeners still get prompt
+  // feedback, then swallow the stream until it goes quiet.
+  if (move_flush_closure_.IsCancelled())
+    NotifyWindowMove();
+  move_flush_closure_.Reset(
+      base::Bind(&NativeWindowViews::FlushWindowMove,
+                 weak_factory_.GetWeakPtr()));
+  content::BrowserThread::PostDelayedTask(
+      content::BrowserThread::UI, FROM_HERE,
+      move_flush_closure_.callback(),
+      base::TimeDelta::FromMilliseconds(bounds_event_coalescing_ms_));
+}
+
+void NativeWindowViews::ScheduleResizeFlush() {
+  if (resize_flush_closure_.IsCancelled())
+    NotifyWindowResize();
+  resize_flush_closure_.Reset(
+      base::Bind(&NativeWindowViews::FlushWindowResize,
+                 weak_factory_.GetWeakPtr()));
+  content::BrowserThread::PostDelayedTask(
+      content::BrowserThread::UI, FROM_HERE,
+      resize_flush_closure_.callback(),
+      base::TimeDelta::FromMilliseconds(bounds_event_coalescing_ms_));
+}
+
+void NativeWindowViews::FlushWindowMove() {
+  move_flush_closure_.Cancel();
+  NotifyWindowMove();
+  NotifyWindowMoved();
+}
+
+void NativeWindowViews::FlushWindowResize() {
+  resize_flush_closure_.Cancel();
+  NotifyWindowResize();
+  NotifyWindowResized();
+}
+
 void NativeWindowViews::DeleteDelegate() {
   if (is_modal() && NativeWindow::parent()) {
     NativeWindowViews* parent =
@@ -1179,7 +1223,10 @@ views::NonClientFrameView* NativeWindowViews::CreateNonClientFrameView(
 }
 
 void NativeWindowViews::OnWidgetMove() {
-  NotifyWindowMove();
+  if (bounds_event_coalescing_ms_ > 0)
+    ScheduleMoveFlush();
+  else
+    NotifyWindowMove();
 }
 
 gfx::Rect NativeWindowViews::ContentBoundsToWindowBounds(
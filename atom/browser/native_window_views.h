@@ -12,6 +12,8 @@
 
 #include "atom/browser/ui/accelerator_util.h"
 #include "atom/browser/ui/autofill_popup.h"
+#include "base/cancelable_callback.h"
+#include "base/memory/weak_ptr.h"
 #include "ui/views/widget/widget_delegate.h"
 #include "ui/views/widget/widget_observer.h"
 
@@ -196,6 +198,14 @@ class NativeWindowViews : public NativeWindow,
   // Returns the restore state for the window.
   ui::WindowShowState GetRestoredState();
 
+  // Coalesce the move/resize event streams: emit a leading event when a
+  // burst starts, swallow the intermediate ones, and flush a trailing
+  // event plus the final moved/resized event once the stream goes quiet.
+  void ScheduleMoveFlush();
+  void ScheduleResizeFlush();
+  void FlushWindowMove();
+  void FlushWindowResize();
+
   std::unique_ptr<views::Widget> window_;
   views::View* web_view_;  // Managed by inspectable_web_contents_.
 
@@ -279,6 +289,13 @@ class NativeWindowViews : public NativeWindow,
   std::string title_;
   gfx::Size widget_size_;
 
+  // Interval for coalescing move/resize events, 0 emits every event.
+  int bounds_event_coalescing_ms_;
+  base::CancelableClosure move_flush_closure_;
+  base::CancelableClosure resize_flush_closure_;
+
+  base::WeakPtrFactory<NativeWindowViews> weak_factory_;
+
   DISALLOW_COPY_AND_ASSIGN(NativeWindowViews);
 };
 
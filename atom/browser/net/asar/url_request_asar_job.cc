@@ -4,6 +4,8 @@
 
 #include "atom/browser/net/asar/url_request_asar_job.h"
 
+#include <string.h>
+
 #include <string>
 #include <vector>
 
@@ -43,6 +45,8 @@ URLRequestAsarJob::URLRequestAsarJob(
     net::NetworkDelegate* network_delegate)
     : net::URLRequestJob(request, network_delegate),
       type_(TYPE_ERROR),
+      mapped_data_(nullptr),
+      mapped_pos_(0),
       remaining_bytes_(0),
       seek_offset_(0),
       range_parse_result_(net::OK),
@@ -88,6 +92,7 @@ void URLRequestAsarJob::InitializeAsarJob(
   archive_ = archive;
   file_path_ = file_path;
   file_info_ = file_info;
+  mapped_data_ = archive->GetFileData(file_info);
 }
 
 void URLRequestAsarJob::InitializeFileJob(
@@ -100,7 +105,11 @@ void URLRequestAsarJob::InitializeFileJob(
 }
 
 void URLRequestAsarJob::Start() {
-  if (type_ == TYPE_ASAR) {
+  if (type_ == TYPE_ASAR && mapped_data_) {
+    // The content is available through the archive's memory mapping, no
+    // file needs to be opened.
+    DidOpen(net::OK);
+  } else if (type_ == TYPE_ASAR) {
     int flags = base::File::FLAG_OPEN |
                 base::File::FLAG_READ |
                 base::File::FLAG_ASYNC;
@@ -140,6 +149,16 @@ int URLRequestAsarJob::ReadRawData(net::IOBuffer* dest, int dest_size) {
   if (!dest_size)
     return 0;
 
+  if (type_ == TYPE_ASAR && mapped_data_) {
+    // Serve directly from the archive's memory mapping, which avoids the
+    // file stream and its per-chunk async hop to the file thread.
+    memcpy(dest->data(), mapped_data_ + mapped_pos_, dest_size);
+    mapped_pos_ += dest_size;
+    remaining_bytes_ -= dest_size;
+    DCHECK_GE(remaining_bytes_, 0);
+    return dest_size;
+  }
+
   int rv = stream_->Read(dest,
                          dest_size,
                          base::Bind(&URLRequestAsarJob::DidRead,
@@ -297,7 +316,11 @@ void URLRequestAsarJob::DidOpen(int result) {
                      byte_range_.first_byte_position() + 1;
   seek_offset_ = byte_range_.first_byte_position() + read_offset;
 
-  if (remaining_bytes_ > 0 && seek_offset_ != 0) {
+  if (type_ == TYPE_ASAR && mapped_data_) {
+    // No stream to seek, just remember the read position in the mapping.
+    mapped_pos_ = byte_range_.first_byte_position();
+    DidSeek(seek_offset_);
+  } else if (remaining_bytes_ > 0 && seek_offset_ != 0) {
     int rv = stream_->Seek(seek_offset_,
                            base::Bind(&URLRequestAsarJob::DidSeek,
                                       weak_ptr_factory_.GetWeakPtr()));
@@ -112,6 +112,13 @@ class URLRequestAsarJob : public net::URLRequestJob {
   base::FilePath file_path_;
   Archive::FileInfo file_info_;
 
+  // Points at the file's content inside the archive's memory mapping, or
+  // nullptr when the archive could not be mapped. When set, reads are
+  // served synchronously from the mapping instead of going through
+  // |stream_|.
+  const uint8_t* mapped_data_;
+  int64_t mapped_pos_;
+
   std::unique_ptr<net::FileStream> stream_;
   FileMetaInfo meta_info_;
   scoped_refptr<base::TaskRunner> file_task_runner_;
@@ -22,6 +22,11 @@ namespace atom {
 
 namespace {
 
+// Bounds for the verification response cache. A connection storm to one
+// backend verifies once and replays the response for the rest.
+const size_t kMaxCachedResponses = 256;
+const int kCachedResponseTTLMinutes = 30;
+
 class Response : public base::LinkNode<Response> {
  public:
   Response(net::CertVerifyResult* verify_result,
@@ -117,6 +122,7 @@ class CertVerifierRequest : public AtomCertVerifier::Request {
   void NotifyResponseInIO(int result) {
     custom_response_ = result;
     first_response_ = false;
+    cert_verifier_->CacheResponse(params_, custom_response_, error_, result_);
     // Responding to first request in the list will initiate destruction of
     // the class, respond to others in the list inside destructor.
     base::LinkNode<Response>* response_node = response_list_.head();
@@ -147,13 +153,16 @@ class CertVerifierRequest : public AtomCertVerifier::Request {
 };
 
 AtomCertVerifier::AtomCertVerifier(AtomCTDelegate* ct_delegate)
-    : default_cert_verifier_(net::CertVerifier::CreateDefault()),
+    : response_cache_(kMaxCachedResponses),
+      default_cert_verifier_(net::CertVerifier::CreateDefault()),
       ct_delegate_(ct_delegate) {}
 
 AtomCertVerifier::~AtomCertVerifier() {}
 
 void AtomCertVerifier::SetVerifyProc(const VerifyProc& proc) {
   verify_proc_ = proc;
+  // Cached responses reflect the previous proc's decisions.
+  response_cache_.Clear();
 }
 
 int AtomCertVerifier::Verify(
@@ -170,6 +179,18 @@ int AtomCertVerifier::Verify(
     return default_cert_verifier_->Verify(params, crl_set, verify_result,
                                           callback, out_req, net_log);
   } else {
+    const CachedResponse* cached = FindCachedResponse(params);
+    if (cached) {
+      if (cached->custom_response == net::ERR_ABORTED) {
+        *verify_result = cached->result;
+        return cached->error;
+      }
+      verify_result->Reset();
+      verify_result->verified_cert = params.certificate();
+      ct_delegate_->AddCTExcludedHost(params.hostname());
+      return cached->custom_response;
+    }
+
     CertVerifierRequest* request = FindRequest(params);
     if (!request) {
       out_req->reset();
@@ -206,4 +227,29 @@ CertVerifierRequest* AtomCertVerifier::FindRequest(
   return nullptr;
 }
 
+void AtomCertVerifier::CacheResponse(const RequestParams& params,
+                                     int custom_response,
+                                     int error,
+                                     const net::CertVerifyResult& result) {
+  CachedResponse response;
+  response.custom_response = custom_response;
+  response.error = error;
+  response.result = result;
+  response.expiry = base::TimeTicks::Now() +
+      base::TimeDelta::FromMinutes(kCachedResponseTTLMinutes);
+  response_cache_.Put(params, response);
+}
+
+const AtomCertVerifier::CachedResponse* AtomCertVerifier::FindCachedResponse(
+    const RequestParams& params) {
+  auto it = response_cache_.Get(params);
+  if (it == response_cache_.end())
+    return nullptr;
+  if (it->second.expiry <= base::TimeTicks::Now()) {
+    response_cache_.Erase(it);
+    return nullptr;
+  }
+  return &it->second;
+}
+
 }  // namespace atom
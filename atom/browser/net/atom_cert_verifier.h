@@ -9,7 +9,10 @@
 #include <memory>
 #include <string>
 
+#include "base/containers/mru_cache.h"
+#include "base/time/time.h"
 #include "net/cert/cert_verifier.h"
+#include "net/cert/cert_verify_result.h"
 
 namespace atom {
 
@@ -51,10 +54,30 @@ class AtomCertVerifier : public net::CertVerifier {
  private:
   friend class CertVerifierRequest;
 
+  // Outcome of a completed verification through the custom proc, kept so
+  // repeated connections to the same (certificate, host) within the TTL do
+  // not pay the UI-thread round-trip again.
+  struct CachedResponse {
+    int custom_response;
+    int error;
+    net::CertVerifyResult result;
+    base::TimeTicks expiry;
+  };
+
   void RemoveRequest(const RequestParams& params);
   CertVerifierRequest* FindRequest(const RequestParams& params);
 
+  // Stores the outcome of a finished verification in the cache.
+  void CacheResponse(const RequestParams& params,
+                     int custom_response,
+                     int error,
+                     const net::CertVerifyResult& result);
+  // Returns the unexpired cached response for |params|, or null. The
+  // pointer is invalidated by the next cache operation.
+  const CachedResponse* FindCachedResponse(const RequestParams& params);
+
   std::map<RequestParams, CertVerifierRequest*> inflight_requests_;
+  base::MRUCache<RequestParams, CachedResponse> response_cache_;
   VerifyProc verify_proc_;
   std::unique_ptr<net::CertVerifier> default_cert_verifier_;
   AtomCTDelegate* ct_delegate_;
@@ -4,10 +4,35 @@
 
 #include "atom/browser/net/atom_cookie_delegate.h"
 
+#include <string>
+
+#include "base/strings/string_util.h"
 #include "content/public/browser/browser_thread.h"
 
 namespace atom {
 
+namespace {
+
+// Returns whether cookie |domain| matches the |filter| domain, following the
+// usual cookie domain rules: the filter matches the domain itself and any of
+// its subdomains, ignoring leading '.' characters on either side.
+bool MatchesFilterDomain(const std::string& filter,
+                         const std::string& domain) {
+  std::string normalized_filter(filter);
+  if (!normalized_filter.empty() && normalized_filter[0] == '.')
+    normalized_filter.erase(0, 1);
+  std::string normalized_domain(domain);
+  if (!normalized_domain.empty() && normalized_domain[0] == '.')
+    normalized_domain.erase(0, 1);
+
+  if (normalized_domain == normalized_filter)
+    return true;
+  return base::EndsWith(normalized_domain, "." + normalized_filter,
+                        base::CompareCase::INSENSITIVE_ASCII);
+}
+
+}  // namespace
+
 AtomCookieDelegate::AtomCookieDelegate() {
 }
 
@@ -22,6 +47,41 @@ void AtomCookieDelegate::RemoveObserver(Observer* observer) {
   observers_.RemoveObserver(observer);
 }
 
+void AtomCookieDelegate::SetChangeFilters(
+    std::unique_ptr<base::ListValue> filters) {
+  if (filters && filters->empty())
+    filters.reset();
+  content::BrowserThread::PostTask(
+      content::BrowserThread::IO,
+      FROM_HERE,
+      base::Bind(&AtomCookieDelegate::SetChangeFiltersOnIO,
+                 this, base::Passed(&filters)));
+}
+
+void AtomCookieDelegate::SetChangeFiltersOnIO(
+    std::unique_ptr<base::ListValue> filters) {
+  change_filters_ = std::move(filters);
+}
+
+bool AtomCookieDelegate::PassesChangeFilters(
+    const net::CanonicalCookie& cookie) {
+  if (!change_filters_)
+    return true;
+  for (size_t i = 0; i < change_filters_->GetSize(); ++i) {
+    const base::DictionaryValue* filter = nullptr;
+    if (!change_filters_->GetDictionary(i, &filter))
+      continue;
+    std::string str;
+    if (filter->GetString("name", &str) && str != cookie.Name())
+      continue;
+    if (filter->GetString("domain", &str) &&
+        !MatchesFilterDomain(str, cookie.Domain()))
+      continue;
+    return true;
+  }
+  return false;
+}
+
 void AtomCookieDelegate::NotifyObservers(
     const net::CanonicalCookie& cookie,
     bool removed,
@@ -34,6 +94,9 @@ void AtomCookieDelegate::OnCookieChanged(
     const net::CanonicalCookie& cookie,
     bool removed,
     net::CookieStore::ChangeCause cause) {
+  // Drop uninteresting changes here so they never cross to the UI thread.
+  if (!PassesChangeFilters(cookie))
+    return;
   content::BrowserThread::PostTask(
       content::BrowserThread::UI,
       FROM_HERE,
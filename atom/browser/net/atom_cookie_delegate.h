@@ -5,7 +5,10 @@
 #ifndef ATOM_BROWSER_NET_ATOM_COOKIE_DELEGATE_H_
 #define ATOM_BROWSER_NET_ATOM_COOKIE_DELEGATE_H_
 
+#include <memory>
+
 #include "base/observer_list.h"
+#include "base/values.h"
 #include "net/cookies/cookie_monster.h"
 
 namespace atom {
@@ -27,6 +30,12 @@ class AtomCookieDelegate : public net::CookieMonsterDelegate {
   void AddObserver(Observer* observer);
   void RemoveObserver(Observer* observer);
 
+  // Restricts which cookie changes are forwarded to the UI thread. |filters|
+  // is a list of dictionaries with optional "domain" and "name" keys; a
+  // change is forwarded when it matches any filter. Passing null or an empty
+  // list forwards every change again. Can be called from any thread.
+  void SetChangeFilters(std::unique_ptr<base::ListValue> filters);
+
   // net::CookieMonsterDelegate:
   void OnCookieChanged(const net::CanonicalCookie& cookie,
                        bool removed,
@@ -36,6 +45,14 @@ class AtomCookieDelegate : public net::CookieMonsterDelegate {
  private:
   base::ObserverList<Observer> observers_;
 
+  // Only accessed on the IO thread, where cookie changes arrive.
+  std::unique_ptr<base::ListValue> change_filters_;
+
+  void SetChangeFiltersOnIO(std::unique_ptr<base::ListValue> filters);
+
+  // Whether the change to |cookie| passes |change_filters_|.
+  bool PassesChangeFilters(const net::CanonicalCookie& cookie);
+
   void NotifyObservers(const net::CanonicalCookie& cookie,
                        bool removed,
                        net::CookieStore::ChangeCause cause);
@@ -4,30 +4,106 @@
 
 #include "atom/browser/net/atom_ct_delegate.h"
 
+#include "base/strings/string_util.h"
 #include "content/public/browser/browser_thread.h"
 
 namespace atom {
 
+namespace {
+
+// How long a memoized per-host decision stays valid.
+const int kDecisionCacheTTLSeconds = 60;
+
+// Upper bound on memoized decisions; the cache is dropped wholesale when it
+// fills up, which is cheaper than tracking use order at this size.
+const size_t kMaxCachedDecisions = 1024;
+
+// Strips the leading '.' or "*." from a suffix rule.
+std::string NormalizeSuffixRule(const std::string& rule) {
+  if (base::StartsWith(rule, "*.", base::CompareCase::SENSITIVE))
+    return rule.substr(2);
+  if (!rule.empty() && rule[0] == '.')
+    return rule.substr(1);
+  return rule;
+}
+
+}  // namespace
+
 AtomCTDelegate::AtomCTDelegate() {}
 
 AtomCTDelegate::~AtomCTDelegate() {}
 
 void AtomCTDelegate::AddCTExcludedHost(const std::string& host) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
-  ct_excluded_hosts_.insert(host);
+  // An exact exclusion only changes the decision for that host, so only its
+  // cache entry needs to go.
+  if (ct_excluded_hosts_.insert(host).second)
+    decision_cache_.erase(host);
+}
+
+void AtomCTDelegate::SetCTExcludedHosts(
+    const std::vector<std::string>& hosts) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  ct_excluded_hosts_.clear();
+  ct_excluded_suffixes_.clear();
+  for (const std::string& host : hosts) {
+    if (!host.empty() && (host[0] == '.' || host[0] == '*'))
+      ct_excluded_suffixes_.insert(NormalizeSuffixRule(host));
+    else
+      ct_excluded_hosts_.insert(host);
+  }
+  decision_cache_.clear();
 }
 
 void AtomCTDelegate::ClearCTExcludedHostsList() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
   ct_excluded_hosts_.clear();
+  ct_excluded_suffixes_.clear();
+  decision_cache_.clear();
 }
 
 AtomCTDelegate::CTRequirementLevel AtomCTDelegate::IsCTRequiredForHost(
     const std::string& host) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
-  if (!ct_excluded_hosts_.empty() &&
-      (ct_excluded_hosts_.find(host) != ct_excluded_hosts_.end()))
+  if (ct_excluded_hosts_.empty() && ct_excluded_suffixes_.empty())
+    return CTRequirementLevel::DEFAULT;
+
+  auto iter = decision_cache_.find(host);
+  if (iter != decision_cache_.end()) {
+    if (iter->second.first > base::TimeTicks::Now())
+      return iter->second.second;
+    decision_cache_.erase(iter);
+  }
+
+  CTRequirementLevel level = EvaluateHost(host);
+  if (decision_cache_.size() >= kMaxCachedDecisions)
+    decision_cache_.clear();
+  decision_cache_[host] = std::make_pair(
+      base::TimeTicks::Now() +
+          base::TimeDelta::FromSeconds(kDecisionCacheTTLSeconds),
+      level);
+  return level;
+}
+
+AtomCTDelegate::CTRequirementLevel AtomCTDelegate::EvaluateHost(
+    const std::string& host) const {
+  if (ct_excluded_hosts_.find(host) != ct_excluded_hosts_.end())
     return CTRequirementLevel::NOT_REQUIRED;
+
+  // Match suffix rules against the host and every parent domain, one set
+  // lookup per label instead of a scan over all rules.
+  if (!ct_excluded_suffixes_.empty()) {
+    std::string candidate(host);
+    while (true) {
+      if (ct_excluded_suffixes_.find(candidate) !=
+          ct_excluded_suffixes_.end())
+        return CTRequirementLevel::NOT_REQUIRED;
+      size_t next_dot = candidate.find('.');
+      if (next_dot == std::string::npos)
+        break;
+      candidate.erase(0, next_dot + 1);
+    }
+  }
   return CTRequirementLevel::DEFAULT;
 }
 
@@ -5,9 +5,13 @@
 #ifndef ATOM_BROWSER_NET_ATOM_CT_DELEGATE_H_
 #define ATOM_BROWSER_NET_ATOM_CT_DELEGATE_H_
 
+#include <map>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/time/time.h"
 #include "net/http/transport_security_state.h"
 
 namespace atom {
@@ -18,13 +22,28 @@ class AtomCTDelegate : public net::TransportSecurityState::RequireCTDelegate {
   ~AtomCTDelegate() override;
 
   void AddCTExcludedHost(const std::string& host);
+  // Replaces the excluded hosts in one call. Entries with a leading '.' or
+  // "*." are treated as suffix rules matching the domain itself and all of
+  // its subdomains; other entries match exactly.
+  void SetCTExcludedHosts(const std::vector<std::string>& hosts);
   void ClearCTExcludedHostsList();
 
   // net::TransportSecurityState::RequireCTDelegate:
   CTRequirementLevel IsCTRequiredForHost(const std::string& host) override;
 
  private:
+  // Computes the requirement level without consulting the decision cache.
+  CTRequirementLevel EvaluateHost(const std::string& host) const;
+
   std::set<std::string> ct_excluded_hosts_;
+  // Suffix rules, stored without the leading '.' or "*.".
+  std::set<std::string> ct_excluded_suffixes_;
+
+  // Recent per-host decisions with their expiry time; cleared whenever the
+  // excluded host lists change.
+  std::map<std::string, std::pair<base::TimeTicks, CTRequirementLevel>>
+      decision_cache_;
+
   DISALLOW_COPY_AND_ASSIGN(AtomCTDelegate);
 };
 
@@ -4,8 +4,11 @@
 
 #include "atom/browser/net/atom_network_delegate.h"
 
+#include <memory>
 #include <utility>
 
+#include "atom/browser/net/request_qos_rules.h"
+#include "atom/browser/net/web_request_rules.h"
 #include "atom/common/native_mate_converters/net_converter.h"
 #include "base/stl_util.h"
 #include "base/strings/string_util.h"
@@ -56,28 +59,25 @@ void RunResponseListener(
   return listener.Run(*(details.get()), callback);
 }
 
-// Test whether the URL of |request| matches |patterns|.
+// Test whether the URL of |request| matches the compiled filter patterns.
 bool MatchesFilterCondition(net::URLRequest* request,
-                            const URLPatterns& patterns) {
-  if (patterns.empty())
-    return true;
-
-  for (const auto& pattern : patterns) {
-    if (pattern.MatchesURL(request->url()))
-      return true;
-  }
-  return false;
+                            const URLPatternMatcher& matcher) {
+  return matcher.Matches(request->url());
 }
 
 // Overloaded by multiple types to fill the |details| object.
+// The details dictionaries are built per event per request on the IO
+// thread, so the fillers below stick to the WithoutPathExpansion setters,
+// which skip splitting every key on '.'.
 void ToDictionary(base::DictionaryValue* details, net::URLRequest* request) {
   FillRequestDetails(details, request);
-  details->SetInteger("id", request->identifier());
-  details->SetDouble("timestamp", base::Time::Now().ToDoubleT() * 1000);
+  details->SetIntegerWithoutPathExpansion("id", request->identifier());
+  details->SetDoubleWithoutPathExpansion(
+      "timestamp", base::Time::Now().ToDoubleT() * 1000);
   auto info = content::ResourceRequestInfo::ForRequest(request);
-  details->SetString("resourceType",
-                     info ? ResourceTypeToString(info->GetResourceType())
-                          : "other");
+  details->SetStringWithoutPathExpansion(
+      "resourceType",
+      info ? ResourceTypeToString(info->GetResourceType()) : "other");
 }
 
 void ToDictionary(base::DictionaryValue* details,
@@ -86,7 +86,7 @@ void ToDictionary(base::DictionaryValue* details,
   net::HttpRequestHeaders::Iterator it(headers);
   while (it.GetNext())
     dict->SetStringWithoutPathExpansion(it.name(), it.value());
-  details->Set("requestHeaders", std::move(dict));
+  details->SetWithoutPathExpansion("requestHeaders", std::move(dict));
 }
 
 void ToDictionary(base::DictionaryValue* details,
@@ -99,38 +99,39 @@ void ToDictionary(base::DictionaryValue* details,
   std::string key;
   std::string value;
   while (headers->EnumerateHeaderLines(&iter, &key, &value)) {
-    if (dict->HasKey(key)) {
-      base::ListValue* values = nullptr;
-      if (dict->GetList(key, &values))
-        values->AppendString(value);
-    } else {
-      std::unique_ptr<base::ListValue> values(new base::ListValue);
-      values->AppendString(value);
-      dict->Set(key, std::move(values));
+    base::ListValue* values = nullptr;
+    if (!dict->GetListWithoutPathExpansion(key, &values)) {
+      values = new base::ListValue;
+      dict->SetWithoutPathExpansion(key,
+                                    std::unique_ptr<base::ListValue>(values));
     }
+    values->AppendString(value);
   }
-  details->Set("responseHeaders", std::move(dict));
-  details->SetString("statusLine", headers->GetStatusLine());
-  details->SetInteger("statusCode", headers->response_code());
+  details->SetWithoutPathExpansion("responseHeaders", std::move(dict));
+  details->SetStringWithoutPathExpansion("statusLine",
+                                         headers->GetStatusLine());
+  details->SetIntegerWithoutPathExpansion("statusCode",
+                                          headers->response_code());
 }
 
 void ToDictionary(base::DictionaryValue* details, const GURL& location) {
-  details->SetString("redirectURL", location.spec());
+  details->SetStringWithoutPathExpansion("redirectURL", location.spec());
 }
 
 void ToDictionary(base::DictionaryValue* details,
                   const net::HostPortPair& host_port) {
   if (host_port.host().empty())
-    details->SetString("ip", host_port.host());
+    details->SetStringWithoutPathExpansion("ip", host_port.host());
 }
 
 void ToDictionary(base::DictionaryValue* details, bool from_cache) {
-  details->SetBoolean("fromCache", from_cache);
+  details->SetBooleanWithoutPathExpansion("fromCache", from_cache);
 }
 
 void ToDictionary(base::DictionaryValue* details,
                   const net::URLRequestStatus& status) {
-  details->SetString("error", net::ErrorToString(status.error()));
+  details->SetStringWithoutPathExpansion(
+      "error", net::ErrorToString(status.error()));
 }
 
 // Helper function to fill |details| with arbitrary |args|.
@@ -206,20 +207,37 @@ void AtomNetworkDelegate::SetSimpleListenerInIO(
     SimpleEvent type,
     const URLPatterns& patterns,
     const SimpleListener& callback) {
-  if (callback.is_null())
+  if (callback.is_null()) {
     simple_listeners_.erase(type);
-  else
-    simple_listeners_[type] = { patterns, callback };
+  } else {
+    // Compile the patterns once here so matching per request is cheap.
+    SimpleListenerInfo& info = simple_listeners_[type];
+    info.matcher.Compile(patterns);
+    info.listener = callback;
+  }
 }
 
 void AtomNetworkDelegate::SetResponseListenerInIO(
     ResponseEvent type,
     const URLPatterns& patterns,
     const ResponseListener& callback) {
-  if (callback.is_null())
+  if (callback.is_null()) {
     response_listeners_.erase(type);
-  else
-    response_listeners_[type] = { patterns, callback };
+  } else {
+    ResponseListenerInfo& info = response_listeners_[type];
+    info.matcher.Compile(patterns);
+    info.listener = callback;
+  }
+}
+
+void AtomNetworkDelegate::SetRulesInIO(
+    std::unique_ptr<WebRequestRules> rules) {
+  rules_ = std::move(rules);
+}
+
+void AtomNetworkDelegate::SetQoSRulesInIO(
+    std::unique_ptr<RequestQoSRules> rules) {
+  qos_rules_ = std::move(rules);
 }
 
 void AtomNetworkDelegate::SetDevToolsNetworkEmulationClientId(
@@ -232,6 +250,21 @@ int AtomNetworkDelegate::OnBeforeURLRequest(
     net::URLRequest* request,
     const net::CompletionCallback& callback,
     GURL* new_url) {
+  if (qos_rules_) {
+    net::RequestPriority priority;
+    if (qos_rules_->GetPriority(request->url(), &priority))
+      request->SetPriority(priority);
+  }
+
+  if (rules_) {
+    // Static rules resolve the request on this thread; a dynamic match or
+    // no match falls through to the JS listener.
+    bool handled = false;
+    int result = rules_->OnBeforeRequest(request->url(), new_url, &handled);
+    if (handled)
+      return result;
+  }
+
   if (!base::ContainsKey(response_listeners_, kOnBeforeRequest))
     return brightray::NetworkDelegate::OnBeforeURLRequest(
         request, callback, new_url);
@@ -253,6 +286,14 @@ int AtomNetworkDelegate::OnBeforeStartTransaction(
     headers->SetHeader(
         DevToolsNetworkTransaction::kDevToolsEmulateNetworkConditionsClientId,
         client_id);
+
+  if (rules_) {
+    bool handled = false;
+    rules_->OnBeforeSendHeaders(request->url(), headers, &handled);
+    if (handled)
+      return net::OK;
+  }
+
   if (!base::ContainsKey(response_listeners_, kOnBeforeSendHeaders))
     return brightray::NetworkDelegate::OnBeforeStartTransaction(
         request, callback, headers);
@@ -361,7 +402,7 @@ int AtomNetworkDelegate::HandleResponseEvent(
     Out out,
     Args... args) {
   const auto& info = response_listeners_[type];
-  if (!MatchesFilterCondition(request, info.url_patterns))
+  if (!MatchesFilterCondition(request, info.matcher))
     return net::OK;
 
   std::unique_ptr<base::DictionaryValue> details(new base::DictionaryValue);
@@ -384,7 +425,7 @@ template<typename...Args>
 void AtomNetworkDelegate::HandleSimpleEvent(
     SimpleEvent type, net::URLRequest* request, Args... args) {
   const auto& info = simple_listeners_[type];
-  if (!MatchesFilterCondition(request, info.url_patterns))
+  if (!MatchesFilterCondition(request, info.matcher))
     return;
 
   std::unique_ptr<base::DictionaryValue> details(new base::DictionaryValue);
@@ -6,9 +6,11 @@
 #define ATOM_BROWSER_NET_ATOM_NETWORK_DELEGATE_H_
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 
+#include "atom/browser/net/url_pattern_matcher.h"
 #include "base/callback.h"
 #include "base/synchronization/lock.h"
 #include "base/values.h"
@@ -23,6 +25,9 @@ class URLPattern;
 
 namespace atom {
 
+class RequestQoSRules;
+class WebRequestRules;
+
 using URLPatterns = std::set<URLPattern>;
 
 const char* ResourceTypeToString(content::ResourceType type);
@@ -49,12 +54,12 @@ class AtomNetworkDelegate : public brightray::NetworkDelegate {
   };
 
   struct SimpleListenerInfo {
-    URLPatterns url_patterns;
+    URLPatternMatcher matcher;
     SimpleListener listener;
   };
 
   struct ResponseListenerInfo {
-    URLPatterns url_patterns;
+    URLPatternMatcher matcher;
     ResponseListener listener;
   };
 
@@ -67,6 +72,12 @@ class AtomNetworkDelegate : public brightray::NetworkDelegate {
   void SetResponseListenerInIO(ResponseEvent type,
                                const URLPatterns& patterns,
                                const ResponseListener& callback);
+  // Installs declarative rules evaluated on the IO thread before the JS
+  // listeners are consulted; pass null to clear them.
+  void SetRulesInIO(std::unique_ptr<WebRequestRules> rules);
+  // Installs QoS classes that reprioritize matching requests on the IO
+  // thread; pass null to clear them.
+  void SetQoSRulesInIO(std::unique_ptr<RequestQoSRules> rules);
 
   void SetDevToolsNetworkEmulationClientId(const std::string& client_id);
 
@@ -117,6 +128,8 @@ class AtomNetworkDelegate : public brightray::NetworkDelegate {
   std::map<SimpleEvent, SimpleListenerInfo> simple_listeners_;
   std::map<ResponseEvent, ResponseListenerInfo> response_listeners_;
   std::map<uint64_t, net::CompletionCallback> callbacks_;
+  std::unique_ptr<WebRequestRules> rules_;
+  std::unique_ptr<RequestQoSRules> qos_rules_;
 
   base::Lock lock_;
 
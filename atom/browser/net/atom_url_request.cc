@@ -4,6 +4,7 @@
 // found in the LICENSE file.
 
 #include "atom/browser/net/atom_url_request.h"
+#include <limits>
 #include <string>
 #include "atom/browser/api/atom_api_url_request.h"
 #include "atom/browser/atom_browser_context.h"
@@ -13,10 +14,17 @@
 #include "net/base/io_buffer.h"
 #include "net/base/load_flags.h"
 #include "net/base/upload_bytes_element_reader.h"
+#include "net/base/upload_file_element_reader.h"
 #include "net/url_request/redirect_info.h"
 
 namespace {
 const int kBufferSize = 4096;
+
+// Maximum number of response bytes in flight between the IO and UI threads.
+// Once exceeded the read loop stops pulling from the network until the UI
+// thread reports the posted buffers consumed, so a fast server cannot grow
+// the browser heap faster than JS drains the data events.
+const int64_t kInFlightReadBudget = 1024 * 1024;
 }  // namespace
 
 namespace atom {
@@ -48,7 +56,9 @@ class UploadOwnedIOBufferElementReader : public net::UploadBytesElementReader {
 AtomURLRequest::AtomURLRequest(api::URLRequest* delegate)
     : delegate_(delegate),
       is_chunked_upload_(false),
-      response_read_buffer_(new net::IOBuffer(kBufferSize)) {}
+      response_read_buffer_(new net::IOBuffer(kBufferSize)),
+      in_flight_bytes_(0),
+      read_paused_(false) {}
 
 AtomURLRequest::~AtomURLRequest() {
   DCHECK(!request_context_getter_);
@@ -139,6 +149,17 @@ bool AtomURLRequest::Write(scoped_refptr<const net::IOBufferWithSize> buffer,
       base::Bind(&AtomURLRequest::DoWriteBuffer, this, buffer, is_last));
 }
 
+bool AtomURLRequest::UploadFile(base::File file,
+                                int64_t offset,
+                                int64_t length,
+                                bool is_last) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  return content::BrowserThread::PostTask(
+      content::BrowserThread::IO, FROM_HERE,
+      base::Bind(&AtomURLRequest::DoUploadFile, this, base::Passed(&file),
+                 offset, length, is_last));
+}
+
 void AtomURLRequest::SetChunkedUpload(bool is_chunked_upload) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
 
@@ -198,6 +219,13 @@ void AtomURLRequest::SetLoadFlags(int flags) const {
       base::Bind(&AtomURLRequest::DoSetLoadFlags, this, flags));
 }
 
+void AtomURLRequest::NotifyResponseDataConsumed(int64_t bytes) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  content::BrowserThread::PostTask(
+      content::BrowserThread::IO, FROM_HERE,
+      base::Bind(&AtomURLRequest::DoNotifyDataConsumed, this, bytes));
+}
+
 void AtomURLRequest::DoWriteBuffer(
     scoped_refptr<const net::IOBufferWithSize> buffer,
     bool is_last) {
@@ -249,6 +277,45 @@ void AtomURLRequest::DoWriteBuffer(
   }
 }
 
+void AtomURLRequest::DoUploadFile(base::File file,
+                                  int64_t offset,
+                                  int64_t length,
+                                  bool is_last) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  if (!request_) {
+    return;
+  }
+
+  DCHECK(!is_chunked_upload_);
+  if (is_chunked_upload_) {
+    // A ChunkedUploadDataStream can only have bytes appended, there is no
+    // way to splice a file into it without reading the file into memory.
+    DoCancelWithError("Cannot upload a file with chunked encoding.", true);
+    return;
+  }
+
+  // The reader streams directly from the already-open file on the FILE
+  // thread while the body is sent, so the file is neither reopened nor
+  // buffered in memory.
+  uint64_t range_length = length < 0 ? std::numeric_limits<uint64_t>::max()
+                                     : static_cast<uint64_t>(length);
+  upload_element_readers_.push_back(std::unique_ptr<net::UploadElementReader>(
+      new net::UploadFileElementReader(
+          content::BrowserThread::GetTaskRunnerForThread(
+              content::BrowserThread::FILE)
+              .get(),
+          std::move(file), static_cast<uint64_t>(offset), range_length,
+          base::Time())));
+
+  if (is_last) {
+    auto elements_upload_data_stream = new net::ElementsUploadDataStream(
+        std::move(upload_element_readers_), 0);
+    request_->set_upload(
+        std::unique_ptr<net::UploadDataStream>(elements_upload_data_stream));
+    request_->Start();
+  }
+}
+
 void AtomURLRequest::DoCancel() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
   if (request_) {
@@ -315,6 +382,16 @@ void AtomURLRequest::DoSetLoadFlags(int flags) const {
   request_->SetLoadFlags(request_->load_flags() | flags);
 }
 
+void AtomURLRequest::DoNotifyDataConsumed(int64_t bytes) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  in_flight_bytes_ -= bytes;
+  DCHECK_GE(in_flight_bytes_, 0);
+  if (read_paused_ && in_flight_bytes_ < kInFlightReadBudget && request_) {
+    read_paused_ = false;
+    ReadResponse();
+  }
+}
+
 void AtomURLRequest::OnReceivedRedirect(net::URLRequest* request,
                                         const net::RedirectInfo& info,
                                         bool* defer_redirect) {
@@ -414,6 +491,14 @@ void AtomURLRequest::OnReadCompleted(net::URLRequest* request, int bytes_read) {
       data_transfer_error = true;
       break;
     }
+    in_flight_bytes_ += bytes_read;
+    if (in_flight_bytes_ >= kInFlightReadBudget) {
+      // Too much data queued towards the UI thread; suspend reading until
+      // DoNotifyDataConsumed drains the budget. The transport applies its
+      // own flow control while we stop calling Read.
+      read_paused_ = true;
+      return;
+    }
   } while (
       request_->Read(response_read_buffer_.get(), kBufferSize, &bytes_read));
   if (response_error) {
@@ -10,6 +10,7 @@
 #include <vector>
 #include "atom/browser/api/atom_api_url_request.h"
 #include "atom/browser/atom_browser_context.h"
+#include "base/files/file.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/weak_ptr.h"
 #include "net/base/auth.h"
@@ -35,6 +36,12 @@ class AtomURLRequest : public base::RefCountedThreadSafe<AtomURLRequest>,
   void Terminate();
 
   bool Write(scoped_refptr<const net::IOBufferWithSize> buffer, bool is_last);
+  // Appends |length| bytes starting at |offset| of the already-open |file| to
+  // the upload body. The file is streamed from disk while the request is
+  // sent, it is neither reopened nor buffered in memory. Not supported with
+  // chunked uploads, which can only carry in-memory chunks.
+  bool UploadFile(base::File file, int64_t offset, int64_t length,
+                  bool is_last);
   void SetChunkedUpload(bool is_chunked_upload);
   void Cancel();
   void FollowRedirect();
@@ -43,6 +50,10 @@ class AtomURLRequest : public base::RefCountedThreadSafe<AtomURLRequest>,
   void PassLoginInformation(const base::string16& username,
                             const base::string16& password) const;
   void SetLoadFlags(int flags) const;
+  // Called on the UI thread once the delegate has handed |bytes| of response
+  // data to JS, releasing them from the in-flight budget so the IO thread can
+  // resume reading from the network.
+  void NotifyResponseDataConsumed(int64_t bytes);
 
  protected:
   // Overrides of net::URLRequest::Delegate
@@ -70,6 +81,10 @@ class AtomURLRequest : public base::RefCountedThreadSafe<AtomURLRequest>,
   void DoTerminate();
   void DoWriteBuffer(scoped_refptr<const net::IOBufferWithSize> buffer,
                      bool is_last);
+  void DoUploadFile(base::File file,
+                    int64_t offset,
+                    int64_t length,
+                    bool is_last);
   void DoCancel();
   void DoFollowRedirect();
   void DoSetExtraHeader(const std::string& name,
@@ -80,6 +95,7 @@ class AtomURLRequest : public base::RefCountedThreadSafe<AtomURLRequest>,
   void DoCancelAuth() const;
   void DoCancelWithError(const std::string& error, bool isRequestError);
   void DoSetLoadFlags(int flags) const;
+  void DoNotifyDataConsumed(int64_t bytes);
 
   void ReadResponse();
   bool CopyAndPostBuffer(int bytes_read);
@@ -111,6 +127,12 @@ class AtomURLRequest : public base::RefCountedThreadSafe<AtomURLRequest>,
       upload_element_readers_;
   scoped_refptr<net::IOBuffer> response_read_buffer_;
 
+  // Response bytes posted to the UI thread but not yet consumed by JS, and
+  // whether reading is suspended waiting for the budget to drain. Both are
+  // only touched on the IO thread.
+  int64_t in_flight_bytes_;
+  bool read_paused_;
+
   DISALLOW_COPY_AND_ASSIGN(AtomURLRequest);
 };
 
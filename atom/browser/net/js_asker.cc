@@ -4,10 +4,14 @@
 
 #include "atom/browser/net/js_asker.h"
 
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/v8_value_converter.h"
+#include "base/containers/mru_cache.h"
+#include "base/time/time.h"
 
 namespace atom {
 
@@ -15,6 +19,29 @@ namespace internal {
 
 namespace {
 
+// The key with which a handler marks its response cacheable by URL, the value
+// is the time to live in seconds.
+const char kCacheTTLKey[] = "cacheTTL";
+
+// Bounds the per-URL cache so a handler marking many URLs cacheable can
+// not grow it without limit; the least recently used entry is evicted
+// beyond this.
+const size_t kMaxResponseCacheEntries = 256;
+
+struct CachedResponse {
+  base::TimeTicks expiry;
+  std::unique_ptr<base::Value> options;
+};
+
+// Response cache shared by all JS-registered protocols, only used on IO
+// thread.
+using ResponseCache = base::MRUCache<std::string, CachedResponse>;
+
+ResponseCache& GetResponseCache() {
+  static ResponseCache* cache = new ResponseCache(kMaxResponseCacheEntries);
+  return *cache;
+}
+
 // The callback which is passed to |handler|.
 void HandlerCallback(const BeforeStartCallback& before_start,
                      const ResponseCallback& callback,
@@ -70,6 +97,34 @@ bool IsErrorOptions(base::Value* value, int* error) {
   return false;
 }
 
+std::unique_ptr<base::Value> LookupResponseCache(const std::string& url) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  ResponseCache& cache = GetResponseCache();
+  auto iter = cache.Get(url);
+  if (iter == cache.end())
+    return nullptr;
+  if (iter->second.expiry <= base::TimeTicks::Now()) {
+    cache.Erase(iter);
+    return nullptr;
+  }
+  return iter->second.options->CreateDeepCopy();
+}
+
+void MaybeCacheResponse(const std::string& url, const base::Value* options) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  if (!options->IsType(base::Value::Type::DICTIONARY))
+    return;
+  double ttl = 0;
+  if (!static_cast<const base::DictionaryValue*>(options)->GetDouble(
+          kCacheTTLKey, &ttl) ||
+      ttl <= 0)
+    return;
+  CachedResponse entry;
+  entry.expiry = base::TimeTicks::Now() + base::TimeDelta::FromSecondsD(ttl);
+  entry.options = options->CreateDeepCopy();
+  GetResponseCache().Put(url, std::move(entry));
+}
+
 }  // namespace internal
 
 }  // namespace atom
@@ -40,6 +40,14 @@ void AskForOptions(v8::Isolate* isolate,
 // Test whether the |options| means an error.
 bool IsErrorOptions(base::Value* value, int* error);
 
+// Returns a copy of the cached response options for |url|, or nullptr when
+// there is no entry or the entry has expired. IO thread only.
+std::unique_ptr<base::Value> LookupResponseCache(const std::string& url);
+
+// Caches |options| for |url| when the handler has tagged the response
+// cacheable by giving it a positive "cacheTTL" (in seconds). IO thread only.
+void MaybeCacheResponse(const std::string& url, const base::Value* options);
+
 }  // namespace internal
 
 template<typename RequestJob>
@@ -69,6 +77,20 @@ class JsAsker : public RequestJob {
  private:
   // RequestJob:
   void Start() override {
+    // When the handler has tagged this URL's response cacheable, serve the
+    // cached options directly without the UI thread round-trip. The cached
+    // options already passed the error check when they were stored.
+    std::unique_ptr<base::Value> cached(
+        internal::LookupResponseCache(RequestJob::request()->url().spec()));
+    if (cached) {
+      content::BrowserThread::PostTask(
+          content::BrowserThread::IO, FROM_HERE,
+          base::Bind(&JsAsker::StartAsync,
+                     weak_factory_.GetWeakPtr(),
+                     base::Passed(&cached)));
+      return;
+    }
+
     std::unique_ptr<base::DictionaryValue> request_details(
         new base::DictionaryValue);
     FillRequestDetails(request_details.get(), RequestJob::request());
@@ -95,6 +117,8 @@ class JsAsker : public RequestJob {
   void OnResponse(bool success, std::unique_ptr<base::Value> value) {
     int error = net::ERR_NOT_IMPLEMENTED;
     if (success && value && !internal::IsErrorOptions(value.get(), &error)) {
+      internal::MaybeCacheResponse(RequestJob::request()->url().spec(),
+                                   value.get());
       StartAsync(std::move(value));
     } else {
       RequestJob::NotifyStartError(
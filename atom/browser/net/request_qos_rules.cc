@@ -0,0 +1,96 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/net/request_qos_rules.h"
+
+#include <set>
+#include <string>
+#include <utility>
+
+namespace atom {
+
+namespace {
+
+bool PriorityFromString(const std::string& name,
+                        net::RequestPriority* priority) {
+  if (name == "throttled")
+    *priority = net::THROTTLED;
+  else if (name == "idle")
+    *priority = net::IDLE;
+  else if (name == "lowest")
+    *priority = net::LOWEST;
+  else if (name == "low")
+    *priority = net::LOW;
+  else if (name == "medium")
+    *priority = net::MEDIUM;
+  else if (name == "highest")
+    *priority = net::HIGHEST;
+  else
+    return false;
+  return true;
+}
+
+}  // namespace
+
+RequestQoSRules::QoSClass::QoSClass() : priority(net::DEFAULT_PRIORITY) {}
+
+RequestQoSRules::QoSClass::QoSClass(QoSClass&& other) = default;
+
+RequestQoSRules::QoSClass& RequestQoSRules::QoSClass::operator=(
+    QoSClass&& other) = default;
+
+RequestQoSRules::QoSClass::~QoSClass() {}
+
+RequestQoSRules::RequestQoSRules() {}
+
+RequestQoSRules::~RequestQoSRules() {}
+
+size_t RequestQoSRules::Parse(const base::ListValue& classes) {
+  classes_.clear();
+  for (size_t i = 0; i < classes.GetSize(); ++i) {
+    const base::DictionaryValue* dict = nullptr;
+    if (!classes.GetDictionary(i, &dict))
+      continue;
+
+    QoSClass qos_class;
+    std::string priority;
+    if (!dict->GetString("priority", &priority) ||
+        !PriorityFromString(priority, &qos_class.priority))
+      continue;
+
+    const base::ListValue* urls = nullptr;
+    std::set<URLPattern> patterns;
+    if (dict->GetList("urls", &urls)) {
+      for (size_t j = 0; j < urls->GetSize(); ++j) {
+        std::string spec;
+        URLPattern pattern(URLPattern::SCHEME_ALL);
+        if (urls->GetString(j, &spec) &&
+            pattern.Parse(spec) == URLPattern::PARSE_SUCCESS)
+          patterns.insert(pattern);
+      }
+    }
+    // A class without a valid filter would reprioritize everything;
+    // require at least one pattern.
+    if (patterns.empty())
+      continue;
+    qos_class.matcher.Compile(patterns);
+
+    classes_.push_back(std::move(qos_class));
+  }
+  return classes_.size();
+}
+
+bool RequestQoSRules::GetPriority(const GURL& url,
+                                  net::RequestPriority* priority) const {
+  for (const QoSClass& qos_class : classes_) {
+    if (!qos_class.matcher.Matches(url))
+      continue;
+    // First match wins, mirroring WebRequestRules.
+    *priority = qos_class.priority;
+    return true;
+  }
+  return false;
+}
+
+}  // namespace atom
@@ -0,0 +1,59 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_NET_REQUEST_QOS_RULES_H_
+#define ATOM_BROWSER_NET_REQUEST_QOS_RULES_H_
+
+#include <vector>
+
+#include "atom/browser/net/url_pattern_matcher.h"
+#include "base/macros.h"
+#include "base/values.h"
+#include "net/base/request_priority.h"
+
+class GURL;
+
+namespace atom {
+
+// Maps requests to QoS classes by URL pattern. Each class carries a
+// net::RequestPriority that is applied to matching requests before they
+// reach the network, letting interactive traffic overtake bulk transfers
+// sharing the same session. Evaluated on the IO thread for every request,
+// so matching uses the compiled pattern trie.
+class RequestQoSRules {
+ public:
+  RequestQoSRules();
+  ~RequestQoSRules();
+
+  // Compiles |classes|, a list of dictionaries of the form
+  //   { urls: ['<pattern>', ...],
+  //     priority: 'throttled' | 'idle' | 'lowest' | 'low' | 'medium' |
+  //               'highest' }
+  // Entries that fail to parse are skipped. Returns the number of classes
+  // compiled.
+  size_t Parse(const base::ListValue& classes);
+
+  // Returns whether |url| belongs to a class; fills |*priority| with the
+  // first matching class's priority.
+  bool GetPriority(const GURL& url, net::RequestPriority* priority) const;
+
+ private:
+  struct QoSClass {
+    QoSClass();
+    QoSClass(QoSClass&& other);
+    QoSClass& operator=(QoSClass&& other);
+    ~QoSClass();
+
+    URLPatternMatcher matcher;
+    net::RequestPriority priority;
+  };
+
+  std::vector<QoSClass> classes_;
+
+  DISALLOW_COPY_AND_ASSIGN(RequestQoSRules);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_NET_REQUEST_QOS_RULES_H_
@@ -0,0 +1,354 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/net/segmented_downloader.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/format_macros.h"
+#include "base/memory/ptr_util.h"
+#include "base/strings/stringprintf.h"
+#include "content/public/browser/browser_thread.h"
+#include "net/base/load_flags.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/url_request/url_request_context.h"
+
+namespace atom {
+
+namespace {
+
+const int kReadBufferSize = 64 * 1024;
+
+}  // namespace
+
+SegmentedDownloader::Segment::Segment(SegmentedDownloader* downloader,
+                                      int index,
+                                      int64_t begin,
+                                      int64_t end)
+    : downloader_(downloader),
+      index_(index),
+      begin_(begin),
+      offset_(begin),
+      end_(end),
+      buffer_(new net::IOBuffer(kReadBufferSize)) {}
+
+SegmentedDownloader::Segment::~Segment() {}
+
+void SegmentedDownloader::Segment::Start(net::URLRequestContext* context,
+                                         const GURL& url) {
+  request_ = context->CreateRequest(
+      url, net::RequestPriority::DEFAULT_PRIORITY, this);
+  request_->SetLoadFlags(net::LOAD_DISABLE_CACHE |
+                         net::LOAD_DO_NOT_SEND_COOKIES);
+  if (end_ >= 0) {
+    request_->SetExtraRequestHeaderByName(
+        net::HttpRequestHeaders::kRange,
+        base::StringPrintf("bytes=%" PRId64 "-%" PRId64, begin_, end_ - 1),
+        true);
+  }
+  request_->Start();
+}
+
+void SegmentedDownloader::Segment::OnResponseStarted(
+    net::URLRequest* request) {
+  if (!request->status().is_success()) {
+    downloader_->OnSegmentDone(index_, false);
+    return;
+  }
+  // A ranged request must be answered with 206; a 200 body would be the
+  // whole payload and corrupt the other segments' work. The plain
+  // fallback request must not write an error body to disk and report it
+  // as the payload, so it requires a 2xx.
+  int response_code = request->GetResponseCode();
+  if (end_ >= 0 ? response_code != 206 : response_code / 100 != 2) {
+    downloader_->OnSegmentDone(index_, false);
+    return;
+  }
+  ReadMore();
+}
+
+void SegmentedDownloader::Segment::OnReadCompleted(net::URLRequest* request,
+                                                   int bytes_read) {
+  DidRead(bytes_read);
+}
+
+void SegmentedDownloader::Segment::ReadMore() {
+  int bytes_read = -1;
+  if (request_->Read(buffer_.get(), kReadBufferSize, &bytes_read))
+    DidRead(bytes_read);
+}
+
+void SegmentedDownloader::Segment::DidRead(int bytes_read) {
+  if (!request_->status().is_success() || bytes_read < 0) {
+    downloader_->OnSegmentDone(index_, false);
+    return;
+  }
+  if (bytes_read == 0) {
+    downloader_->OnSegmentDone(index_, true);
+    return;
+  }
+  // Hand the filled buffer to the FILE thread and pause reading until the
+  // write lands, which bounds buffered memory at one chunk per segment.
+  downloader_->WriteAt(index_, offset_, buffer_, bytes_read);
+  offset_ += bytes_read;
+}
+
+void SegmentedDownloader::Segment::OnWriteDone() {
+  downloader_->OnSegmentProgress(index_, received(),
+                                 end_ >= 0 ? end_ - begin_ : -1);
+  ReadMore();
+}
+
+SegmentedDownloader::SegmentedDownloader(
+    scoped_refptr<net::URLRequestContextGetter> request_context_getter,
+    const GURL& url,
+    const base::FilePath& path,
+    int num_segments)
+    : request_context_getter_(request_context_getter),
+      url_(url),
+      path_(path),
+      num_segments_(std::max(1, num_segments)),
+      active_segments_(0),
+      failed_(false),
+      canceled_(false) {}
+
+SegmentedDownloader::~SegmentedDownloader() {}
+
+void SegmentedDownloader::Start(const ProgressCallback& progress_callback,
+                                const CompletionCallback& completion_callback) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  progress_callback_ = progress_callback;
+  completion_callback_ = completion_callback;
+  content::BrowserThread::PostTask(
+      content::BrowserThread::IO, FROM_HERE,
+      base::Bind(&SegmentedDownloader::DoStart, this));
+}
+
+void SegmentedDownloader::Cancel() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  content::BrowserThread::PostTask(
+      content::BrowserThread::IO, FROM_HERE,
+      base::Bind(&SegmentedDownloader::DoCancel, this));
+}
+
+void SegmentedDownloader::DoStart() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  auto* context = request_context_getter_->GetURLRequestContext();
+  if (!context) {
+    Fail("Cannot start a download after shutdown.");
+    return;
+  }
+
+  // Probe the payload size and range support with a HEAD request before
+  // deciding how to split the work.
+  probe_request_ = context->CreateRequest(
+      url_, net::RequestPriority::DEFAULT_PRIORITY, this);
+  probe_request_->set_method("HEAD");
+  probe_request_->SetLoadFlags(net::LOAD_DISABLE_CACHE |
+                               net::LOAD_DO_NOT_SEND_COOKIES);
+  probe_request_->Start();
+}
+
+void SegmentedDownloader::OnResponseStarted(net::URLRequest* request) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  if (canceled_)
+    return;
+  if (!request->status().is_success()) {
+    Fail(net::ErrorToString(request->status().ToNetError()));
+    return;
+  }
+
+  int64_t total_size = request->GetExpectedContentSize();
+  bool accept_ranges = false;
+  net::HttpResponseHeaders* headers = request->response_headers();
+  if (headers)
+    accept_ranges = headers->HasHeaderValue("Accept-Ranges", "bytes");
+  probe_request_.reset();
+
+  StartSegments(total_size, accept_ranges);
+}
+
+void SegmentedDownloader::OnReadCompleted(net::URLRequest* request,
+                                          int bytes_read) {
+  // The probe is a HEAD request; there is no body to read.
+}
+
+void SegmentedDownloader::StartSegments(int64_t total_size,
+                                        bool accept_ranges) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  // Creating and preallocating the destination file are blocking disk
+  // operations and may not run on the IO thread.
+  bool ranged = accept_ranges && total_size > 0 && num_segments_ > 1;
+  content::BrowserThread::PostTaskAndReplyWithResult(
+      content::BrowserThread::FILE, FROM_HERE,
+      base::Bind(&SegmentedDownloader::CreateFile, this,
+                 ranged ? total_size : -1),
+      base::Bind(&SegmentedDownloader::DidCreateFile, this, total_size,
+                 ranged));
+}
+
+bool SegmentedDownloader::CreateFile(int64_t preallocate_size) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::FILE);
+  file_.Initialize(path_, base::File::FLAG_CREATE_ALWAYS |
+                              base::File::FLAG_WRITE);
+  if (!file_.IsValid())
+    return false;
+  // Preallocate so the segments can write at their offsets concurrently.
+  if (preallocate_size >= 0 && !file_.SetLength(preallocate_size))
+    return false;
+  return true;
+}
+
+void SegmentedDownloader::DidCreateFile(int64_t total_size,
+                                        bool ranged,
+                                        bool created) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  if (canceled_)
+    return;
+  if (!created) {
+    Fail("Failed to create the destination file.");
+    return;
+  }
+
+  auto* context = request_context_getter_->GetURLRequestContext();
+  if (!context) {
+    Fail("Cannot start a download after shutdown.");
+    return;
+  }
+
+  if (!ranged) {
+    // Single plain request; segment count degrades gracefully.
+    segments_.push_back(base::MakeUnique<Segment>(this, 0, 0, -1));
+    active_segments_ = 1;
+    segments_[0]->Start(context, url_);
+    return;
+  }
+
+  const int64_t segment_size =
+      (total_size + num_segments_ - 1) / num_segments_;
+  for (int i = 0; i < num_segments_; ++i) {
+    int64_t begin = i * segment_size;
+    int64_t end = std::min(begin + segment_size, total_size);
+    if (begin >= end)
+      break;
+    segments_.push_back(base::MakeUnique<Segment>(this, i, begin, end));
+  }
+  active_segments_ = static_cast<int>(segments_.size());
+  for (const auto& segment : segments_)
+    segment->Start(context, url_);
+}
+
+void SegmentedDownloader::OnSegmentProgress(int index,
+                                            int64_t received,
+                                            int64_t total) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  if (progress_callback_.is_null())
+    return;
+  content::BrowserThread::PostTask(
+      content::BrowserThread::UI, FROM_HERE,
+      base::Bind(progress_callback_, index, received, total));
+}
+
+void SegmentedDownloader::OnSegmentDone(int index, bool success) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  if (failed_ || canceled_)
+    return;
+  if (!success) {
+    Fail(base::StringPrintf("Segment %d failed.", index));
+    return;
+  }
+  if (--active_segments_ > 0)
+    return;
+
+  segments_.clear();
+  // Close on the FILE thread and only then report completion, so the
+  // callback can rely on all bytes having reached the file.
+  content::BrowserThread::PostTaskAndReply(
+      content::BrowserThread::FILE, FROM_HERE,
+      base::Bind(&SegmentedDownloader::DoClose, this),
+      base::Bind(&SegmentedDownloader::ReportResult, this, true,
+                 std::string()));
+}
+
+void SegmentedDownloader::Fail(const std::string& error) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  if (failed_ || canceled_)
+    return;
+  failed_ = true;
+  probe_request_.reset();
+  segments_.clear();
+  // The close task queues behind any in-flight writes on the FILE thread,
+  // so the file is only closed once they have drained.
+  content::BrowserThread::PostTaskAndReply(
+      content::BrowserThread::FILE, FROM_HERE,
+      base::Bind(&SegmentedDownloader::DoClose, this),
+      base::Bind(&SegmentedDownloader::ReportResult, this, false, error));
+}
+
+void SegmentedDownloader::DoCancel() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  canceled_ = true;
+  probe_request_.reset();
+  segments_.clear();
+  content::BrowserThread::PostTask(
+      content::BrowserThread::FILE, FROM_HERE,
+      base::Bind(&SegmentedDownloader::DoClose, this));
+}
+
+void SegmentedDownloader::WriteAt(int index,
+                                  int64_t offset,
+                                  scoped_refptr<net::IOBuffer> buffer,
+                                  int size) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  content::BrowserThread::PostTask(
+      content::BrowserThread::FILE, FROM_HERE,
+      base::Bind(&SegmentedDownloader::DoWrite, this, index, offset, buffer,
+                 size));
+}
+
+void SegmentedDownloader::DoWrite(int index,
+                                  int64_t offset,
+                                  scoped_refptr<net::IOBuffer> buffer,
+                                  int size) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::FILE);
+  bool success = file_.Write(offset, buffer->data(), size) == size;
+  content::BrowserThread::PostTask(
+      content::BrowserThread::IO, FROM_HERE,
+      base::Bind(&SegmentedDownloader::DidWrite, this, index, success));
+}
+
+void SegmentedDownloader::DidWrite(int index, bool success) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  if (failed_ || canceled_)
+    return;
+  if (!success) {
+    Fail(base::StringPrintf("Writing segment %d failed.", index));
+    return;
+  }
+  // Segments are indexed by their position in |segments_|.
+  if (index < static_cast<int>(segments_.size()))
+    segments_[index]->OnWriteDone();
+}
+
+void SegmentedDownloader::DoClose() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::FILE);
+  if (file_.IsValid())
+    file_.Close();
+}
+
+void SegmentedDownloader::ReportResult(bool success,
+                                       const std::string& error) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  if (completion_callback_.is_null())
+    return;
+  content::BrowserThread::PostTask(
+      content::BrowserThread::UI, FROM_HERE,
+      base::Bind(completion_callback_, success, error));
+}
+
+}  // namespace atom
@@ -0,0 +1,151 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_NET_SEGMENTED_DOWNLOADER_H_
+#define ATOM_BROWSER_NET_SEGMENTED_DOWNLOADER_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted.h"
+#include "net/base/io_buffer.h"
+#include "net/url_request/url_request.h"
+#include "net/url_request/url_request_context_getter.h"
+#include "url/gurl.h"
+
+namespace atom {
+
+// Downloads a URL over several parallel ranged requests writing into a
+// preallocated file, so large payloads are not limited by the throughput
+// of a single connection. Falls back to one plain request when the server
+// does not advertise byte range support. Created and driven from the UI
+// thread; network work happens on the IO thread while all blocking file
+// operations are posted to the FILE thread.
+class SegmentedDownloader
+    : public base::RefCountedThreadSafe<SegmentedDownloader>,
+      public net::URLRequest::Delegate {
+ public:
+  // Called on the UI thread with per-segment byte counts as the download
+  // makes progress.
+  using ProgressCallback =
+      base::Callback<void(int segment, int64_t received, int64_t total)>;
+  // Called once on the UI thread when the download finishes or fails.
+  using CompletionCallback =
+      base::Callback<void(bool success, const std::string& error)>;
+
+  SegmentedDownloader(
+      scoped_refptr<net::URLRequestContextGetter> request_context_getter,
+      const GURL& url,
+      const base::FilePath& path,
+      int num_segments);
+
+  void Start(const ProgressCallback& progress_callback,
+             const CompletionCallback& completion_callback);
+  void Cancel();
+
+ protected:
+  // net::URLRequest::Delegate, for the initial probe request.
+  void OnResponseStarted(net::URLRequest* request) override;
+  void OnReadCompleted(net::URLRequest* request, int bytes_read) override;
+
+ private:
+  friend class base::RefCountedThreadSafe<SegmentedDownloader>;
+
+  // One ranged request writing the byte range [begin, end) at its own file
+  // offset. IO thread only.
+  class Segment : public net::URLRequest::Delegate {
+   public:
+    Segment(SegmentedDownloader* downloader,
+            int index,
+            int64_t begin,
+            int64_t end);
+    ~Segment() override;
+
+    void Start(net::URLRequestContext* context, const GURL& url);
+
+    // Called by the downloader when the last handed-off buffer has been
+    // written, resuming the paused read loop.
+    void OnWriteDone();
+
+    // net::URLRequest::Delegate:
+    void OnResponseStarted(net::URLRequest* request) override;
+    void OnReadCompleted(net::URLRequest* request, int bytes_read) override;
+
+    int64_t received() const { return offset_ - begin_; }
+
+   private:
+    void ReadMore();
+    void DidRead(int bytes_read);
+
+    SegmentedDownloader* downloader_;
+    const int index_;
+    const int64_t begin_;
+    // Next write position; bytes before it have been written.
+    int64_t offset_;
+    // One past the last byte of the range, or -1 when streaming an
+    // unbounded single segment.
+    const int64_t end_;
+    scoped_refptr<net::IOBuffer> buffer_;
+    std::unique_ptr<net::URLRequest> request_;
+
+    DISALLOW_COPY_AND_ASSIGN(Segment);
+  };
+
+  ~SegmentedDownloader() override;
+
+  void DoStart();
+  void DoCancel();
+  // Hands the output file creation to the FILE thread once the probe
+  // determined the payload size and range support; the segments start in
+  // DidCreateFile when the file is ready.
+  void StartSegments(int64_t total_size, bool accept_ranges);
+  bool CreateFile(int64_t preallocate_size);
+  void DidCreateFile(int64_t total_size, bool ranged, bool created);
+  // Called by segments as bytes come off the wire and when they finish.
+  void OnSegmentProgress(int index, int64_t received, int64_t total);
+  void OnSegmentDone(int index, bool success);
+  void Fail(const std::string& error);
+  // Posts |buffer| to the FILE thread; DidWrite resumes the segment when
+  // the write lands.
+  void WriteAt(int index,
+               int64_t offset,
+               scoped_refptr<net::IOBuffer> buffer,
+               int size);
+  void DoWrite(int index,
+               int64_t offset,
+               scoped_refptr<net::IOBuffer> buffer,
+               int size);
+  void DidWrite(int index, bool success);
+  void DoClose();
+  void ReportResult(bool success, const std::string& error);
+
+  scoped_refptr<net::URLRequestContextGetter> request_context_getter_;
+  const GURL url_;
+  const base::FilePath path_;
+  const int num_segments_;
+
+  ProgressCallback progress_callback_;
+  CompletionCallback completion_callback_;
+
+  // FILE thread state: created, written and closed on the FILE thread
+  // only, blocking disk I/O is not allowed on the IO thread.
+  base::File file_;
+
+  // IO thread state.
+  std::unique_ptr<net::URLRequest> probe_request_;
+  std::vector<std::unique_ptr<Segment>> segments_;
+  int active_segments_;
+  bool failed_;
+  bool canceled_;
+
+  DISALLOW_COPY_AND_ASSIGN(SegmentedDownloader);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_NET_SEGMENTED_DOWNLOADER_H_
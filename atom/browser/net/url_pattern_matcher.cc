@@ -0,0 +1,101 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/net/url_pattern_matcher.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/memory/ptr_util.h"
+#include "base/strings/string_split.h"
+#include "url/gurl.h"
+
+namespace atom {
+
+namespace {
+
+// Splits |host| into labels ordered from the TLD inwards, the order in
+// which the trie is walked ("www.example.com" -> {"com", "example", "www"}).
+std::vector<std::string> ReversedHostLabels(const std::string& host) {
+  std::vector<std::string> labels = base::SplitString(
+      host, ".", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+  std::reverse(labels.begin(), labels.end());
+  return labels;
+}
+
+bool MatchesAny(const std::vector<const URLPattern*>& candidates,
+                const GURL& url) {
+  for (const URLPattern* pattern : candidates) {
+    if (pattern->MatchesURL(url))
+      return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+URLPatternMatcher::URLPatternMatcher() {}
+
+URLPatternMatcher::URLPatternMatcher(URLPatternMatcher&& other) = default;
+
+URLPatternMatcher& URLPatternMatcher::operator=(URLPatternMatcher&& other) =
+    default;
+
+URLPatternMatcher::~URLPatternMatcher() {}
+
+void URLPatternMatcher::Compile(const std::set<URLPattern>& patterns) {
+  patterns_.assign(patterns.begin(), patterns.end());
+  root_ = base::MakeUnique<TrieNode>();
+  unanchored_.clear();
+
+  for (const URLPattern& pattern : patterns_) {
+    // Patterns with no concrete host suffix ("*", "<all_urls>", file URLs)
+    // cannot be placed in the trie and are checked on every lookup.
+    if (pattern.match_all_urls() || pattern.host().empty()) {
+      unanchored_.push_back(&pattern);
+      continue;
+    }
+
+    TrieNode* node = root_.get();
+    for (const std::string& label : ReversedHostLabels(pattern.host())) {
+      std::unique_ptr<TrieNode>& child = node->children[label];
+      if (!child)
+        child = base::MakeUnique<TrieNode>();
+      node = child.get();
+    }
+    if (pattern.match_subdomains())
+      node->subtree.push_back(&pattern);
+    else
+      node->exact.push_back(&pattern);
+  }
+}
+
+bool URLPatternMatcher::Matches(const GURL& url) const {
+  // No filter means no restriction.
+  if (patterns_.empty())
+    return true;
+
+  if (MatchesAny(unanchored_, url))
+    return true;
+
+  // Walk the host suffix trie, collecting subdomain patterns anchored at
+  // every node on the way and exact-host patterns at the final node. The
+  // candidates still run the full URLPattern match, which checks scheme,
+  // port and path.
+  const TrieNode* node = root_.get();
+  const std::vector<std::string> labels = ReversedHostLabels(url.host());
+  for (size_t i = 0; i < labels.size(); ++i) {
+    auto it = node->children.find(labels[i]);
+    if (it == node->children.end())
+      return false;
+    node = it->second.get();
+    if (MatchesAny(node->subtree, url))
+      return true;
+    if (i == labels.size() - 1 && MatchesAny(node->exact, url))
+      return true;
+  }
+  return false;
+}
+
+}  // namespace atom
@@ -11,6 +11,7 @@
 #include "atom/browser/atom_browser_context.h"
 #include "base/memory/ptr_util.h"
 #include "base/strings/string_util.h"
+#include "brightray/browser/url_request_context_getter.h"
 #include "native_mate/dictionary.h"
 #include "net/base/io_buffer.h"
 #include "net/base/net_errors.h"
@@ -43,6 +44,22 @@ net::URLFetcher::RequestType GetRequestType(const std::string& raw) {
     return net::URLFetcher::GET;
 }
 
+// Returns the request context used by all fetch jobs started with
+// |session: null|. Sharing one isolated context instead of creating a fresh
+// one per job lets those jobs reuse each other's connections. The context and
+// its delegate are created lazily on the UI thread and intentionally leaked.
+scoped_refptr<net::URLRequestContextGetter> GetIsolatedRequestContextGetter() {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  static auto* delegate = new brightray::URLRequestContextGetter::Delegate;
+  static auto* getter = new scoped_refptr<brightray::URLRequestContextGetter>(
+      new brightray::URLRequestContextGetter(
+          delegate, nullptr, nullptr, base::FilePath(), true,
+          BrowserThread::GetTaskRunnerForThread(BrowserThread::IO),
+          BrowserThread::GetTaskRunnerForThread(BrowserThread::FILE),
+          nullptr, content::URLRequestInterceptorScopedVector()));
+  return *getter;
+}
+
 // Pipe the response writer back to URLRequestFetchJob.
 class ResponsePiper : public net::URLFetcherResponseWriter {
  public:
@@ -94,12 +111,8 @@ void URLRequestFetchJob::BeforeStartInUI(
   v8::Local<v8::Value> val;
   if (options.Get("session", &val)) {
     if (val->IsNull()) {
-      // We have to create the URLRequestContextGetter on UI thread.
-      url_request_context_getter_ = new brightray::URLRequestContextGetter(
-          this, nullptr, nullptr, base::FilePath(), true,
-          BrowserThread::GetTaskRunnerForThread(BrowserThread::IO),
-          BrowserThread::GetTaskRunnerForThread(BrowserThread::FILE),
-          nullptr, content::URLRequestInterceptorScopedVector());
+      // We have to fetch the URLRequestContextGetter on UI thread.
+      url_request_context_getter_ = GetIsolatedRequestContextGetter();
     } else {
       mate::Handle<api::Session> session;
       if (mate::ConvertFromV8(isolate, val, &session) && !session.IsEmpty()) {
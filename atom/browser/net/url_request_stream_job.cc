@@ -0,0 +1,303 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/net/url_request_stream_job.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "atom/common/api/event_emitter_caller.h"
+#include "atom/common/atom_constants.h"
+#include "atom/common/native_mate_converters/callback.h"
+#include "base/strings/string_number_conversions.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_response_headers.h"
+
+#include "atom/common/node_includes.h"
+
+namespace atom {
+
+namespace {
+
+// Response bytes buffered on the IO thread before the stream is paused,
+// and the level the buffer must drain to before it is resumed.
+const size_t kStreamPauseThreshold = 1024 * 1024;
+const size_t kStreamResumeThreshold = kStreamPauseThreshold / 2;
+
+}  // namespace
+
+namespace internal {
+
+StreamSubscriber::StreamSubscriber(v8::Isolate* isolate,
+                                   v8::Local<v8::Object> stream,
+                                   base::WeakPtr<URLRequestStreamJob> job)
+    : isolate_(isolate),
+      stream_(isolate, stream),
+      job_(job),
+      weak_factory_(this) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  On("data", base::Bind(&StreamSubscriber::OnData,
+                        weak_factory_.GetWeakPtr()));
+  On("end", base::Bind(&StreamSubscriber::OnEnd,
+                       weak_factory_.GetWeakPtr()));
+  On("error", base::Bind(&StreamSubscriber::OnError,
+                         weak_factory_.GetWeakPtr()));
+}
+
+StreamSubscriber::~StreamSubscriber() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  v8::Locker locker(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Context> context = isolate_->GetCurrentContext();
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::Object> stream = stream_.Get(isolate_);
+  for (auto& listener : listeners_) {
+    mate::internal::ValueVector args = {
+        mate::StringToV8(isolate_, listener.first),
+        listener.second.Get(isolate_)};
+    mate::internal::CallMethodWithArgs(isolate_, stream, "removeListener",
+                                       &args);
+  }
+}
+
+void StreamSubscriber::Pause() {
+  CallStreamMethod("pause");
+}
+
+void StreamSubscriber::Resume() {
+  CallStreamMethod("resume");
+}
+
+void StreamSubscriber::On(
+    const char* event,
+    base::Callback<void(mate::Arguments*)> callback) {  // NOLINT
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Value> fn = mate::ConvertToV8(isolate_, callback);
+  mate::internal::ValueVector args = {mate::StringToV8(isolate_, event), fn};
+  mate::internal::CallMethodWithArgs(isolate_, stream_.Get(isolate_), "on",
+                                     &args);
+  listeners_.emplace_back(event, v8::Global<v8::Value>(isolate_, fn));
+}
+
+void StreamSubscriber::CallStreamMethod(const char* method) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  v8::Locker locker(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Context> context = isolate_->GetCurrentContext();
+  v8::Context::Scope context_scope(context);
+  mate::internal::CallMethodWithArgs(isolate_, stream_.Get(isolate_), method,
+                                     0, nullptr);
+}
+
+void StreamSubscriber::OnData(mate::Arguments* args) {
+  v8::Local<v8::Value> buffer;
+  if (!args->GetNext(&buffer) || !node::Buffer::HasInstance(buffer)) {
+    OnError(args);
+    return;
+  }
+  const char* data = node::Buffer::Data(buffer);
+  std::vector<char> chunk(data, data + node::Buffer::Length(buffer));
+  content::BrowserThread::PostTask(
+      content::BrowserThread::IO, FROM_HERE,
+      base::Bind(&URLRequestStreamJob::OnData, job_, base::Passed(&chunk)));
+}
+
+void StreamSubscriber::OnEnd(mate::Arguments* args) {
+  content::BrowserThread::PostTask(
+      content::BrowserThread::IO, FROM_HERE,
+      base::Bind(&URLRequestStreamJob::OnEnd, job_));
+}
+
+void StreamSubscriber::OnError(mate::Arguments* args) {
+  content::BrowserThread::PostTask(
+      content::BrowserThread::IO, FROM_HERE,
+      base::Bind(&URLRequestStreamJob::OnError, job_, net::ERR_FAILED));
+}
+
+}  // namespace internal
+
+URLRequestStreamJob::URLRequestStreamJob(
+    net::URLRequest* request, net::NetworkDelegate* network_delegate)
+    : JsAsker<net::URLRequestJob>(request, network_delegate),
+      status_code_(net::HTTP_OK),
+      read_offset_(0),
+      buffered_bytes_(0),
+      ended_(false),
+      error_(net::OK),
+      paused_(false),
+      pending_buf_size_(0),
+      weak_factory_(this) {
+}
+
+URLRequestStreamJob::~URLRequestStreamJob() {
+  if (subscriber_) {
+    content::BrowserThread::DeleteSoon(content::BrowserThread::UI, FROM_HERE,
+                                       subscriber_.release());
+  }
+}
+
+void URLRequestStreamJob::BeforeStartInUI(v8::Isolate* isolate,
+                                          v8::Local<v8::Value> value) {
+  if (!value->IsObject())
+    return;
+
+  // Accept either the stream itself or an options object with the stream
+  // under |data|; a stream is recognized by its |on| method.
+  v8::Local<v8::Object> obj = value.As<v8::Object>();
+  v8::Local<v8::Value> on = obj->Get(mate::StringToV8(isolate, "on"));
+  if (!on->IsFunction()) {
+    v8::Local<v8::Value> data = obj->Get(mate::StringToV8(isolate, "data"));
+    if (!data->IsObject())
+      return;
+    obj = data.As<v8::Object>();
+    on = obj->Get(mate::StringToV8(isolate, "on"));
+    if (!on->IsFunction())
+      return;
+  }
+
+  subscriber_.reset(new internal::StreamSubscriber(
+      isolate, obj, weak_factory_.GetWeakPtr()));
+}
+
+void URLRequestStreamJob::StartAsync(std::unique_ptr<base::Value> options) {
+  if (!subscriber_) {
+    NotifyStartError(net::URLRequestStatus(
+        net::URLRequestStatus::FAILED, net::ERR_NOT_IMPLEMENTED));
+    return;
+  }
+
+  if (options->IsType(base::Value::Type::DICTIONARY)) {
+    base::DictionaryValue* dict =
+        static_cast<base::DictionaryValue*>(options.get());
+    int code = 0;
+    if (dict->GetInteger("statusCode", &code))
+      status_code_ = static_cast<net::HttpStatusCode>(code);
+    dict->GetString("mimeType", &mime_type_);
+    dict->GetString("charset", &charset_);
+  }
+
+  NotifyHeadersComplete();
+}
+
+void URLRequestStreamJob::Kill() {
+  weak_factory_.InvalidateWeakPtrs();
+  if (subscriber_) {
+    content::BrowserThread::DeleteSoon(content::BrowserThread::UI, FROM_HERE,
+                                       subscriber_.release());
+  }
+  net::URLRequestJob::Kill();
+}
+
+int URLRequestStreamJob::ReadRawData(net::IOBuffer* buf, int buf_size) {
+  if (buffered_bytes_ > 0)
+    return CopyToBuffer(buf, buf_size);
+  if (error_ != net::OK)
+    return error_;
+  if (ended_)
+    return 0;
+
+  // Nothing buffered; complete the read from OnData when a chunk arrives.
+  pending_buf_ = buf;
+  pending_buf_size_ = buf_size;
+  return net::ERR_IO_PENDING;
+}
+
+void URLRequestStreamJob::GetResponseInfo(net::HttpResponseInfo* info) {
+  std::string status("HTTP/1.1 ");
+  status.append(base::IntToString(status_code_));
+  status.append(" ");
+  status.append(net::GetHttpReasonPhrase(status_code_));
+  status.append("\0\0", 2);
+  auto* headers = new net::HttpResponseHeaders(status);
+
+  headers->AddHeader(kCORSHeader);
+
+  if (!mime_type_.empty()) {
+    std::string content_type_header(net::HttpRequestHeaders::kContentType);
+    content_type_header.append(": ");
+    content_type_header.append(mime_type_);
+    headers->AddHeader(content_type_header);
+  }
+
+  info->headers = headers;
+}
+
+int URLRequestStreamJob::GetResponseCode() const {
+  return status_code_;
+}
+
+void URLRequestStreamJob::OnData(std::vector<char> chunk) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  buffered_bytes_ += chunk.size();
+  chunks_.push_back(std::move(chunk));
+
+  if (pending_buf_) {
+    scoped_refptr<net::IOBuffer> buf = std::move(pending_buf_);
+    int buf_size = pending_buf_size_;
+    pending_buf_ = nullptr;
+    pending_buf_size_ = 0;
+    ReadRawDataComplete(CopyToBuffer(buf.get(), buf_size));
+    return;
+  }
+
+  if (!paused_ && buffered_bytes_ >= kStreamPauseThreshold) {
+    paused_ = true;
+    content::BrowserThread::PostTask(
+        content::BrowserThread::UI, FROM_HERE,
+        base::Bind(&internal::StreamSubscriber::Pause,
+                   base::Unretained(subscriber_.get())));
+  }
+}
+
+void URLRequestStreamJob::OnEnd() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  ended_ = true;
+  if (pending_buf_) {
+    pending_buf_ = nullptr;
+    pending_buf_size_ = 0;
+    ReadRawDataComplete(0);
+  }
+}
+
+void URLRequestStreamJob::OnError(int error) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  error_ = error < 0 ? error : net::ERR_FAILED;
+  if (pending_buf_) {
+    pending_buf_ = nullptr;
+    pending_buf_size_ = 0;
+    ReadRawDataComplete(error_);
+  }
+}
+
+int URLRequestStreamJob::CopyToBuffer(net::IOBuffer* buf, int buf_size) {
+  int copied = 0;
+  while (copied < buf_size && !chunks_.empty()) {
+    const std::vector<char>& chunk = chunks_.front();
+    size_t available = chunk.size() - read_offset_;
+    size_t to_copy =
+        std::min(available, static_cast<size_t>(buf_size - copied));
+    memcpy(buf->data() + copied, chunk.data() + read_offset_, to_copy);
+    copied += to_copy;
+    read_offset_ += to_copy;
+    if (read_offset_ == chunk.size()) {
+      chunks_.pop_front();
+      read_offset_ = 0;
+    }
+  }
+  buffered_bytes_ -= copied;
+
+  if (paused_ && buffered_bytes_ <= kStreamResumeThreshold) {
+    paused_ = false;
+    content::BrowserThread::PostTask(
+        content::BrowserThread::UI, FROM_HERE,
+        base::Bind(&internal::StreamSubscriber::Resume,
+                   base::Unretained(subscriber_.get())));
+  }
+  return copied;
+}
+
+}  // namespace atom
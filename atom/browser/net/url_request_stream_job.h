@@ -0,0 +1,123 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_NET_URL_REQUEST_STREAM_JOB_H_
+#define ATOM_BROWSER_NET_URL_REQUEST_STREAM_JOB_H_
+
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "atom/browser/net/js_asker.h"
+#include "base/memory/weak_ptr.h"
+#include "native_mate/arguments.h"
+#include "net/http/http_status_code.h"
+#include "net/url_request/url_request_job.h"
+
+namespace atom {
+
+class URLRequestStreamJob;
+
+namespace internal {
+
+// Lives on the UI thread; subscribes to a node Readable stream returned by
+// the JS protocol handler and forwards its chunks to the job on the IO
+// thread. The job pauses and resumes the stream to keep the amount of
+// buffered data bounded.
+class StreamSubscriber {
+ public:
+  StreamSubscriber(v8::Isolate* isolate,
+                   v8::Local<v8::Object> stream,
+                   base::WeakPtr<URLRequestStreamJob> job);
+  ~StreamSubscriber();
+
+  void Pause();
+  void Resume();
+
+ private:
+  void OnData(mate::Arguments* args);
+  void OnEnd(mate::Arguments* args);
+  void OnError(mate::Arguments* args);
+
+  void On(const char* event,
+          base::Callback<void(mate::Arguments*)> callback);  // NOLINT
+  void CallStreamMethod(const char* method);
+
+  v8::Isolate* isolate_;
+  v8::Global<v8::Object> stream_;
+  base::WeakPtr<URLRequestStreamJob> job_;
+
+  // Listener functions kept so they can be removed in the destructor.
+  std::vector<std::pair<std::string, v8::Global<v8::Value>>> listeners_;
+
+  base::WeakPtrFactory<StreamSubscriber> weak_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamSubscriber);
+};
+
+}  // namespace internal
+
+// A request job that streams its body from a node Readable stream provided
+// by the JS handler, so serving a large body does not require the whole
+// payload to be materialized in memory first. Chunks are buffered on the IO
+// thread up to a fixed budget; beyond it the stream is paused until the
+// consumer catches up.
+class URLRequestStreamJob : public JsAsker<net::URLRequestJob> {
+ public:
+  URLRequestStreamJob(net::URLRequest* request,
+                      net::NetworkDelegate* network_delegate);
+  ~URLRequestStreamJob() override;
+
+  // Called by the StreamSubscriber on the IO thread.
+  void OnData(std::vector<char> chunk);
+  void OnEnd();
+  void OnError(int error);
+
+  // JsAsker:
+  void BeforeStartInUI(v8::Isolate* isolate,
+                       v8::Local<v8::Value> value) override;
+  void StartAsync(std::unique_ptr<base::Value> options) override;
+
+  // URLRequestJob:
+  void Kill() override;
+  int ReadRawData(net::IOBuffer* buf, int buf_size) override;
+  void GetResponseInfo(net::HttpResponseInfo* info) override;
+  int GetResponseCode() const override;
+
+ private:
+  // Copies buffered chunks into |buf|, returning the number of bytes
+  // copied, and resumes the stream when the buffer has drained enough.
+  int CopyToBuffer(net::IOBuffer* buf, int buf_size);
+
+  std::string mime_type_;
+  std::string charset_;
+  net::HttpStatusCode status_code_;
+
+  // Chunks received from JS but not yet read by the consumer, in arrival
+  // order; |read_offset_| is the position inside the front chunk. IO thread
+  // only.
+  std::list<std::vector<char>> chunks_;
+  size_t read_offset_;
+  size_t buffered_bytes_;
+  bool ended_;
+  int error_;
+  bool paused_;
+
+  // A read that arrived while no data was buffered, completed from OnData.
+  scoped_refptr<net::IOBuffer> pending_buf_;
+  int pending_buf_size_;
+
+  // Created in BeforeStartInUI and deleted on the UI thread.
+  std::unique_ptr<internal::StreamSubscriber> subscriber_;
+
+  base::WeakPtrFactory<URLRequestStreamJob> weak_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(URLRequestStreamJob);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_NET_URL_REQUEST_STREAM_JOB_H_
@@ -0,0 +1,129 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/net/web_request_rules.h"
+
+#include <set>
+#include <utility>
+
+#include "net/base/net_errors.h"
+
+namespace atom {
+
+WebRequestRules::Rule::Rule()
+    : action(Action::kBlock), dynamic(false) {}
+
+WebRequestRules::Rule::Rule(Rule&& other) = default;
+
+WebRequestRules::Rule& WebRequestRules::Rule::operator=(Rule&& other) =
+    default;
+
+WebRequestRules::Rule::~Rule() {}
+
+WebRequestRules::WebRequestRules() {}
+
+WebRequestRules::~WebRequestRules() {}
+
+size_t WebRequestRules::Parse(const base::ListValue& rules) {
+  rules_.clear();
+  for (size_t i = 0; i < rules.GetSize(); ++i) {
+    const base::DictionaryValue* dict = nullptr;
+    if (!rules.GetDictionary(i, &dict))
+      continue;
+
+    Rule rule;
+    std::string action;
+    if (!dict->GetString("action", &action))
+      continue;
+    if (action == "block")
+      rule.action = Rule::Action::kBlock;
+    else if (action == "redirect")
+      rule.action = Rule::Action::kRedirect;
+    else if (action == "setRequestHeaders")
+      rule.action = Rule::Action::kSetRequestHeaders;
+    else
+      continue;
+
+    const base::ListValue* urls = nullptr;
+    std::set<URLPattern> patterns;
+    if (dict->GetList("urls", &urls)) {
+      for (size_t j = 0; j < urls->GetSize(); ++j) {
+        std::string spec;
+        URLPattern pattern(URLPattern::SCHEME_ALL);
+        if (urls->GetString(j, &spec) &&
+            pattern.Parse(spec) == URLPattern::PARSE_SUCCESS)
+          patterns.insert(pattern);
+      }
+    }
+    // A rule without a valid filter would match everything; require at
+    // least one pattern to avoid accidentally blocking all traffic.
+    if (patterns.empty())
+      continue;
+    rule.matcher.Compile(patterns);
+
+    if (rule.action == Rule::Action::kRedirect) {
+      std::string url;
+      if (!dict->GetString("redirectURL", &url))
+        continue;
+      rule.redirect_url = GURL(url);
+      if (!rule.redirect_url.is_valid())
+        continue;
+    } else if (rule.action == Rule::Action::kSetRequestHeaders) {
+      const base::DictionaryValue* headers = nullptr;
+      if (!dict->GetDictionary("requestHeaders", &headers))
+        continue;
+      for (base::DictionaryValue::Iterator it(*headers);
+           !it.IsAtEnd();
+           it.Advance()) {
+        std::string value;
+        if (it.value().GetAsString(&value))
+          rule.request_headers[it.key()] = value;
+      }
+    }
+
+    dict->GetBoolean("dynamic", &rule.dynamic);
+    rules_.push_back(std::move(rule));
+  }
+  return rules_.size();
+}
+
+int WebRequestRules::OnBeforeRequest(const GURL& url,
+                                     GURL* new_url,
+                                     bool* handled) const {
+  for (const Rule& rule : rules_) {
+    if (rule.action != Rule::Action::kBlock &&
+        rule.action != Rule::Action::kRedirect)
+      continue;
+    if (!rule.matcher.Matches(url))
+      continue;
+    // First match wins; a dynamic match defers to the JS listener.
+    if (rule.dynamic)
+      return net::OK;
+    *handled = true;
+    if (rule.action == Rule::Action::kBlock)
+      return net::ERR_BLOCKED_BY_CLIENT;
+    *new_url = rule.redirect_url;
+    return net::OK;
+  }
+  return net::OK;
+}
+
+void WebRequestRules::OnBeforeSendHeaders(const GURL& url,
+                                          net::HttpRequestHeaders* headers,
+                                          bool* handled) const {
+  for (const Rule& rule : rules_) {
+    if (rule.action != Rule::Action::kSetRequestHeaders)
+      continue;
+    if (!rule.matcher.Matches(url))
+      continue;
+    if (rule.dynamic)
+      return;
+    *handled = true;
+    for (const auto& header : rule.request_headers)
+      headers->SetHeader(header.first, header.second);
+    return;
+  }
+}
+
+}  // namespace atom
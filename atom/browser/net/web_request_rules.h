@@ -0,0 +1,77 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_NET_WEB_REQUEST_RULES_H_
+#define ATOM_BROWSER_NET_WEB_REQUEST_RULES_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "atom/browser/net/url_pattern_matcher.h"
+#include "base/macros.h"
+#include "base/values.h"
+#include "net/http/http_request_headers.h"
+#include "url/gurl.h"
+
+namespace atom {
+
+// Declarative webRequest rules evaluated synchronously on the IO thread.
+// Unlike the JS listeners, which cost a UI-thread round-trip per
+// intercepted request, a matching static rule is applied without leaving
+// the IO thread. Rules marked dynamic fall through to the JS listener, as
+// do requests no rule matches.
+class WebRequestRules {
+ public:
+  WebRequestRules();
+  ~WebRequestRules();
+
+  // Compiles |rules|, a list of dictionaries of the form
+  //   { urls: ['<pattern>', ...],
+  //     action: 'block' | 'redirect' | 'setRequestHeaders',
+  //     redirectURL: '...',          // for 'redirect'
+  //     requestHeaders: {...},       // for 'setRequestHeaders'
+  //     dynamic: false }
+  // Entries that fail to parse are skipped. Returns the number of rules
+  // compiled.
+  size_t Parse(const base::ListValue& rules);
+
+  // Evaluates block/redirect rules for |url|. When a static rule matches,
+  // sets |*handled| and returns the request's fate: net::OK with |*new_url|
+  // filled for a redirect, net::ERR_BLOCKED_BY_CLIENT for a block. When no
+  // rule matches, or the first match is dynamic, |*handled| stays false.
+  int OnBeforeRequest(const GURL& url, GURL* new_url, bool* handled) const;
+
+  // Applies setRequestHeaders rules for |url| to |headers|. Sets |*handled|
+  // when a static rule matched, meaning the JS listener can be skipped.
+  void OnBeforeSendHeaders(const GURL& url,
+                           net::HttpRequestHeaders* headers,
+                           bool* handled) const;
+
+ private:
+  struct Rule {
+    enum class Action { kBlock, kRedirect, kSetRequestHeaders };
+
+    Rule();
+    Rule(Rule&& other);
+    Rule& operator=(Rule&& other);
+    ~Rule();
+
+    Action action;
+    URLPatternMatcher matcher;
+    GURL redirect_url;
+    std::map<std::string, std::string> request_headers;
+    // Dynamic rules only select requests for the JS listener; their action
+    // field is ignored.
+    bool dynamic;
+  };
+
+  std::vector<Rule> rules_;
+
+  DISALLOW_COPY_AND_ASSIGN(WebRequestRules);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_NET_WEB_REQUEST_RULES_H_
@@ -0,0 +1,65 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/osr/osr_bitmap_pool.h"
+
+#include <utility>
+
+namespace atom {
+
+namespace {
+
+// Keep only a handful of retired framebuffers around; an offscreen view
+// has at most a viewport store and a popup store in flight at once.
+const size_t kMaxPooledBitmaps = 4;
+
+base::LazyInstance<OffScreenBitmapPool>::Leaky g_bitmap_pool =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+// static
+OffScreenBitmapPool* OffScreenBitmapPool::GetInstance() {
+  return g_bitmap_pool.Pointer();
+}
+
+OffScreenBitmapPool::OffScreenBitmapPool() {
+}
+
+OffScreenBitmapPool::~OffScreenBitmapPool() {
+}
+
+std::unique_ptr<SkBitmap> OffScreenBitmapPool::Acquire(int width,
+                                                       int height,
+                                                       bool opaque) {
+  {
+    base::AutoLock auto_lock(lock_);
+    for (auto iter = free_bitmaps_.begin(); iter != free_bitmaps_.end();
+         ++iter) {
+      SkBitmap* bitmap = iter->get();
+      if (bitmap->width() == width && bitmap->height() == height &&
+          bitmap->isOpaque() == opaque) {
+        std::unique_ptr<SkBitmap> result = std::move(*iter);
+        free_bitmaps_.erase(iter);
+        return result;
+      }
+    }
+  }
+
+  std::unique_ptr<SkBitmap> bitmap(new SkBitmap);
+  bitmap->allocN32Pixels(width, height, opaque);
+  return bitmap;
+}
+
+void OffScreenBitmapPool::Release(std::unique_ptr<SkBitmap> bitmap) {
+  if (!bitmap || bitmap->drawsNothing())
+    return;
+
+  base::AutoLock auto_lock(lock_);
+  free_bitmaps_.push_back(std::move(bitmap));
+  if (free_bitmaps_.size() > kMaxPooledBitmaps)
+    free_bitmaps_.pop_front();
+}
+
+}  // namespace atom
@@ -0,0 +1,48 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_OSR_OSR_BITMAP_POOL_H_
+#define ATOM_BROWSER_OSR_OSR_BITMAP_POOL_H_
+
+#include <list>
+#include <memory>
+
+#include "base/lazy_instance.h"
+#include "base/macros.h"
+#include "base/synchronization/lock.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+
+namespace atom {
+
+// Recycles N32 SkBitmap backing stores between offscreen rendering
+// consumers, so resizes and per-popup copies reuse recently freed pixel
+// memory instead of paying allocation and zero-fill for multi-megabyte
+// framebuffers every time.
+class OffScreenBitmapPool {
+ public:
+  static OffScreenBitmapPool* GetInstance();
+
+  // Returns a bitmap with the requested dimensions. The pixels are
+  // uninitialized (possibly stale) — callers must erase or overwrite them.
+  std::unique_ptr<SkBitmap> Acquire(int width, int height, bool opaque);
+
+  // Hands a bitmap's backing store back for reuse. Null or unallocated
+  // bitmaps are simply dropped.
+  void Release(std::unique_ptr<SkBitmap> bitmap);
+
+ private:
+  friend struct base::DefaultLazyInstanceTraits<OffScreenBitmapPool>;
+
+  OffScreenBitmapPool();
+  ~OffScreenBitmapPool();
+
+  base::Lock lock_;
+  std::list<std::unique_ptr<SkBitmap>> free_bitmaps_;
+
+  DISALLOW_COPY_AND_ASSIGN(OffScreenBitmapPool);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_OSR_OSR_BITMAP_POOL_H_
@@ -4,6 +4,10 @@
 
 #include "atom/browser/osr/osr_output_device.h"
 
+#include <utility>
+
+#include "atom/browser/osr/osr_bitmap_pool.h"
+#include "base/trace_event/trace_event.h"
 #include "third_party/skia/include/core/SkColor.h"
 #include "third_party/skia/include/core/SkRect.h"
 #include "third_party/skia/src/core/SkDevice.h"
@@ -28,10 +32,14 @@ void OffScreenOutputDevice::Resize(
   viewport_pixel_size_ = pixel_size;
 
   canvas_.reset();
-  bitmap_.reset(new SkBitmap);
-  bitmap_->allocN32Pixels(viewport_pixel_size_.width(),
-                          viewport_pixel_size_.height(),
-                          !transparent_);
+  // Recycle the outgoing backing store and reuse a pooled one when a
+  // matching size is available, sparing the alloc + zero-fill of a large
+  // framebuffer on every resize.
+  OffScreenBitmapPool::GetInstance()->Release(std::move(bitmap_));
+  bitmap_ = OffScreenBitmapPool::GetInstance()->Acquire(
+      viewport_pixel_size_.width(),
+      viewport_pixel_size_.height(),
+      !transparent_);
   if (bitmap_->drawsNothing()) {
     NOTREACHED();
     bitmap_.reset();
@@ -95,6 +103,10 @@ void OffScreenOutputDevice::OnPaint(const gfx::Rect& damage_rect) {
   if (rect.IsEmpty())
     return;
 
+  TRACE_EVENT2("electron", "OffScreenOutputDevice::OnPaint",
+               "width", rect.width(),
+               "height", rect.height());
+
   SkAutoLockPixels bitmap_pixels_lock(*bitmap_);
   callback_.Run(rect, *bitmap_);
 }
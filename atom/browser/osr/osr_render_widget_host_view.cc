@@ -5,8 +5,10 @@
 #include "atom/browser/osr/osr_render_widget_host_view.h"
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
+#include "atom/browser/osr/osr_bitmap_pool.h"
 #include "base/callback_helpers.h"
 #include "base/location.h"
 #include "base/memory/ptr_util.h"
@@ -41,6 +43,12 @@ namespace {
 const float kDefaultScaleFactor = 1.0;
 const int kFrameRetryLimit = 2;
 
+// Auto throttling: after this many begin-frame ticks without any damage
+// the begin-frame rate drops to the idle rate; damage or input restores
+// the configured rate.
+const int kIdleFramesBeforeThrottle = 30;
+const int kIdleFrameRate = 2;
+
 ui::MouseEvent UiMouseEventFromWebMouseEvent(blink::WebMouseEvent event) {
   ui::EventType type = ui::EventType::ET_UNKNOWN;
   switch (event.type()) {
@@ -327,6 +335,12 @@ OffScreenRenderWidgetHostView::OffScreenRenderWidgetHostView(
       parent_callback_(nullptr),
       frame_rate_(60),
       frame_rate_threshold_us_(0),
+      auto_throttle_(false),
+      throttled_(false),
+      frames_without_damage_(0),
+      flushing_input_(false),
+      has_pending_mouse_move_(false),
+      has_pending_wheel_event_(false),
       last_time_(base::Time::Now()),
       scale_factor_(kDefaultScaleFactor),
       size_(native_window->GetSize()),
@@ -409,6 +423,8 @@ void OffScreenRenderWidgetHostView::OnWindowClosed() {
 }
 
 void OffScreenRenderWidgetHostView::OnBeginFrameTimerTick() {
+  FlushCoalescedInputEvents();
+  UpdateAutoThrottle(false);
   const base::TimeTicks frame_time = base::TimeTicks::Now();
   const base::TimeDelta vsync_period =
       base::TimeDelta::FromMicroseconds(frame_rate_threshold_us_);
@@ -682,7 +698,7 @@ void OffScreenRenderWidgetHostView::Destroy() {
     } else {
       if (popup_host_view_)
         popup_host_view_->CancelWidget();
-      popup_bitmap_.reset();
+      OffScreenBitmapPool::GetInstance()->Release(std::move(popup_bitmap_));
       if (child_host_view_)
         child_host_view_->CancelWidget();
       for (auto guest_host_view : guest_host_views_)
@@ -878,7 +894,8 @@ void OffScreenRenderWidgetHostView::CancelWidget() {
   if (parent_host_view_) {
     if (parent_host_view_->popup_host_view_ == this) {
       parent_host_view_->set_popup_host_view(NULL);
-      parent_host_view_->popup_bitmap_.reset();
+      OffScreenBitmapPool::GetInstance()->Release(
+          std::move(parent_host_view_->popup_bitmap_));
     } else if (parent_host_view_->child_host_view_ == this) {
       parent_host_view_->set_child_host_view(NULL);
       parent_host_view_->Show();
@@ -975,6 +992,10 @@ void OffScreenRenderWidgetHostView::SetNeedsBeginFrames(
   SetupFrameRate(false);
 
   begin_frame_timer_->SetActive(needs_begin_frames);
+  if (!needs_begin_frames) {
+    // No more ticks to flush on; deliver anything still queued.
+    FlushCoalescedInputEvents();
+  }
 
   if (software_output_device_) {
     software_output_device_->SetActive(needs_begin_frames && painting_);
@@ -1012,6 +1033,7 @@ void OffScreenRenderWidgetHostView::OnPaint(
     const gfx::Rect& damage_rect, const SkBitmap& bitmap) {
   TRACE_EVENT0("electron", "OffScreenRenderWidgetHostView::OnPaint");
 
+  UpdateAutoThrottle(true);
   HoldResize();
 
   if (parent_callback_) {
@@ -1058,8 +1080,19 @@ void OffScreenRenderWidgetHostView::OnPaint(
 
 void OffScreenRenderWidgetHostView::OnPopupPaint(
     const gfx::Rect& damage_rect, const SkBitmap& bitmap) {
-  if (popup_host_view_ && popup_bitmap_.get())
-    bitmap.deepCopyTo(popup_bitmap_.get());
+  if (popup_host_view_ && popup_bitmap_.get()) {
+    // deepCopyTo reallocates the destination every paint; keep a pooled
+    // store of the right size and copy into it instead.
+    if (popup_bitmap_->width() != bitmap.width() ||
+        popup_bitmap_->height() != bitmap.height() ||
+        popup_bitmap_->drawsNothing()) {
+      popup_bitmap_ = OffScreenBitmapPool::GetInstance()->Acquire(
+          bitmap.width(), bitmap.height(), bitmap.isOpaque());
+    }
+    bitmap.copyPixelsTo(popup_bitmap_->getPixels(),
+                        popup_bitmap_->getSize(),
+                        popup_bitmap_->rowBytes());
+  }
   InvalidateBounds(popup_host_view_->popup_position_);
 }
 
@@ -1101,6 +1134,8 @@ void OffScreenRenderWidgetHostView::WasResized() {
 
 void OffScreenRenderWidgetHostView::ProcessKeyboardEvent(
     const content::NativeWebKeyboardEvent& event) {
+  UpdateAutoThrottle(true);
+  FlushCoalescedInputEvents();
   if (!render_widget_host_)
     return;
   render_widget_host_->ForwardKeyboardEvent(event);
@@ -1109,6 +1144,29 @@ void OffScreenRenderWidgetHostView::ProcessKeyboardEvent(
 void OffScreenRenderWidgetHostView::ProcessMouseEvent(
     const blink::WebMouseEvent& event,
     const ui::LatencyInfo& latency) {
+  UpdateAutoThrottle(true);
+
+  if (event.type() == blink::WebInputEvent::MouseMove && !flushing_input_ &&
+      begin_frame_timer_.get() && begin_frame_timer_->IsActive()) {
+    // Queue the move and deliver it on the next begin-frame tick,
+    // accumulating movement across coalesced events — the cadence a real
+    // window's event pipeline produces. High-rate synthetic movers
+    // (remote desktop) otherwise pay a conversion and dispatch per event.
+    if (has_pending_mouse_move_) {
+      int movement_x = pending_mouse_move_.movementX + event.movementX;
+      int movement_y = pending_mouse_move_.movementY + event.movementY;
+      pending_mouse_move_ = event;
+      pending_mouse_move_.movementX = movement_x;
+      pending_mouse_move_.movementY = movement_y;
+    } else {
+      pending_mouse_move_ = event;
+      has_pending_mouse_move_ = true;
+    }
+    return;
+  }
+  if (!flushing_input_)
+    FlushCoalescedInputEvents();
+
   for (auto proxy_view : proxy_views_) {
     gfx::Rect bounds = proxy_view->GetBounds();
     if (bounds.Contains(event.x, event.y)) {
@@ -1146,6 +1204,30 @@ void OffScreenRenderWidgetHostView::ProcessMouseEvent(
 void OffScreenRenderWidgetHostView::ProcessMouseWheelEvent(
     const blink::WebMouseWheelEvent& event,
     const ui::LatencyInfo& latency) {
+  UpdateAutoThrottle(true);
+
+  if (!flushing_input_ &&
+      begin_frame_timer_.get() && begin_frame_timer_->IsActive()) {
+    // Accumulate scroll deltas and flush once per begin-frame tick.
+    if (has_pending_wheel_event_) {
+      float delta_x = pending_wheel_event_.deltaX + event.deltaX;
+      float delta_y = pending_wheel_event_.deltaY + event.deltaY;
+      float ticks_x = pending_wheel_event_.wheelTicksX + event.wheelTicksX;
+      float ticks_y = pending_wheel_event_.wheelTicksY + event.wheelTicksY;
+      pending_wheel_event_ = event;
+      pending_wheel_event_.deltaX = delta_x;
+      pending_wheel_event_.deltaY = delta_y;
+      pending_wheel_event_.wheelTicksX = ticks_x;
+      pending_wheel_event_.wheelTicksY = ticks_y;
+    } else {
+      pending_wheel_event_ = event;
+      has_pending_wheel_event_ = true;
+    }
+    return;
+  }
+  if (!flushing_input_)
+    FlushCoalescedInputEvents();
+
   for (auto proxy_view : proxy_views_) {
     gfx::Rect bounds = proxy_view->GetBounds();
     if (bounds.Contains(event.x, event.y)) {
@@ -1223,6 +1305,65 @@ int OffScreenRenderWidgetHostView::GetFrameRate() const {
   return frame_rate_;
 }
 
+void OffScreenRenderWidgetHostView::SetFrameRateAutoThrottle(bool enabled) {
+  if (auto_throttle_ == enabled)
+    return;
+  auto_throttle_ = enabled;
+  frames_without_damage_ = 0;
+  if (!enabled && throttled_) {
+    throttled_ = false;
+    SetupFrameRate(true);
+  }
+
+  for (auto guest_host_view : guest_host_views_)
+    guest_host_view->SetFrameRateAutoThrottle(enabled);
+}
+
+bool OffScreenRenderWidgetHostView::IsFrameRateAutoThrottled() const {
+  return auto_throttle_;
+}
+
+void OffScreenRenderWidgetHostView::UpdateAutoThrottle(bool damaged) {
+  if (!auto_throttle_)
+    return;
+
+  if (damaged) {
+    frames_without_damage_ = 0;
+    if (throttled_) {
+      throttled_ = false;
+      // Restore the configured rate.
+      SetupFrameRate(true);
+    }
+    return;
+  }
+
+  if (throttled_ || ++frames_without_damage_ < kIdleFramesBeforeThrottle)
+    return;
+
+  throttled_ = true;
+  if (begin_frame_timer_.get()) {
+    begin_frame_timer_->SetFrameRateThresholdUs(
+        1000000 / kIdleFrameRate);
+  }
+}
+
+void OffScreenRenderWidgetHostView::FlushCoalescedInputEvents() {
+  if (flushing_input_ ||
+      (!has_pending_mouse_move_ && !has_pending_wheel_event_))
+    return;
+
+  flushing_input_ = true;
+  if (has_pending_mouse_move_) {
+    has_pending_mouse_move_ = false;
+    ProcessMouseEvent(pending_mouse_move_, ui::LatencyInfo());
+  }
+  if (has_pending_wheel_event_) {
+    has_pending_wheel_event_ = false;
+    ProcessMouseWheelEvent(pending_wheel_event_, ui::LatencyInfo());
+  }
+  flushing_input_ = false;
+}
+
 #if !defined(OS_MACOSX)
 ui::Compositor* OffScreenRenderWidgetHostView::GetCompositor() const {
   return compositor_.get();
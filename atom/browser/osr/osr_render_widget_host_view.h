@@ -244,6 +244,9 @@ class OffScreenRenderWidgetHostView
   void SetFrameRate(int frame_rate);
   int GetFrameRate() const;
 
+  void SetFrameRateAutoThrottle(bool enabled);
+  bool IsFrameRateAutoThrottled() const;
+
   ui::Compositor* GetCompositor() const;
   ui::Layer* GetRootLayer() const;
   content::DelegatedFrameHost* GetDelegatedFrameHost() const;
@@ -267,6 +270,14 @@ class OffScreenRenderWidgetHostView
 
  private:
   void SetupFrameRate(bool force);
+  // Counts begin-frame ticks that produced no damage and drops the
+  // begin-frame rate once the page looks idle; any damage or input ramps
+  // it back up to the configured rate.
+  void UpdateAutoThrottle(bool damaged);
+  // Delivers any queued mouse move / wheel event. Moves and wheels
+  // coalesce between begin-frame ticks, accumulating movement and scroll
+  // deltas, so high-rate synthetic input does not outpace painting.
+  void FlushCoalescedInputEvents();
   void ResizeRootLayer();
 
   cc::FrameSinkId AllocateFrameSinkId(bool is_guest_view_hack);
@@ -291,6 +302,16 @@ class OffScreenRenderWidgetHostView
   int frame_rate_;
   int frame_rate_threshold_us_;
 
+  bool auto_throttle_;
+  bool throttled_;
+  int frames_without_damage_;
+
+  bool flushing_input_;
+  bool has_pending_mouse_move_;
+  bool has_pending_wheel_event_;
+  blink::WebMouseEvent pending_mouse_move_;
+  blink::WebMouseWheelEvent pending_wheel_event_;
+
   base::Time last_time_;
 
   float scale_factor_;
@@ -4,8 +4,56 @@
 
 #include "atom/browser/osr/osr_view_proxy.h"
 
+#include <string.h>
+
 namespace atom {
 
+namespace {
+
+// Returns the smallest rect covering every pixel that differs between the
+// two equally sized N32 bitmaps, or an empty rect when they are identical.
+gfx::Rect ComputeDamage(const SkBitmap& old_bitmap,
+                        const SkBitmap& new_bitmap) {
+  const int width = new_bitmap.width();
+  const int height = new_bitmap.height();
+  const size_t row_size = width * sizeof(uint32_t);
+
+  int top = -1;
+  int bottom = -1;
+  for (int y = 0; y < height; ++y) {
+    if (memcmp(old_bitmap.getAddr32(0, y), new_bitmap.getAddr32(0, y),
+               row_size) != 0) {
+      if (top < 0)
+        top = y;
+      bottom = y;
+    }
+  }
+  if (top < 0)
+    return gfx::Rect();
+
+  int left = width - 1;
+  int right = 0;
+  for (int y = top; y <= bottom; ++y) {
+    const uint32_t* old_row = old_bitmap.getAddr32(0, y);
+    const uint32_t* new_row = new_bitmap.getAddr32(0, y);
+    for (int x = 0; x < left; ++x) {
+      if (old_row[x] != new_row[x]) {
+        left = x;
+        break;
+      }
+    }
+    for (int x = width - 1; x > right; --x) {
+      if (old_row[x] != new_row[x]) {
+        right = x;
+        break;
+      }
+    }
+  }
+  return gfx::Rect(left, top, right - left + 1, bottom - top + 1);
+}
+
+}  // namespace
+
 OffscreenViewProxy::OffscreenViewProxy(views::View* view)
     : view_(view), observer_(nullptr) {
   view_bitmap_.reset(new SkBitmap);
@@ -33,12 +81,28 @@ const SkBitmap* OffscreenViewProxy::GetBitmap() const {
 }
 
 void OffscreenViewProxy::SetBitmap(const SkBitmap& bitmap) {
-  if (view_bounds_.width() == bitmap.width() &&
-      view_bounds_.height() == bitmap.height() &&
-      observer_) {
-    view_bitmap_.reset(new SkBitmap(bitmap));
-    observer_->OnProxyViewPaint(view_bounds_);
+  if (view_bounds_.width() != bitmap.width() ||
+      view_bounds_.height() != bitmap.height() ||
+      !observer_) {
+    return;
   }
+
+  // Diff against the previous frame so an unchanged repaint does not
+  // invalidate anything, and a partial change only invalidates the region
+  // that actually differs.
+  gfx::Rect damage(view_bounds_);
+  if (view_bitmap_.get() && !view_bitmap_->drawsNothing() &&
+      view_bitmap_->width() == bitmap.width() &&
+      view_bitmap_->height() == bitmap.height()) {
+    gfx::Rect diff = ComputeDamage(*view_bitmap_, bitmap);
+    if (diff.IsEmpty())
+      return;
+    diff.Offset(view_bounds_.x(), view_bounds_.y());
+    damage = diff;
+  }
+
+  view_bitmap_.reset(new SkBitmap(bitmap));
+  observer_->OnProxyViewPaint(damage);
 }
 
 const gfx::Rect& OffscreenViewProxy::GetBounds() {
@@ -0,0 +1,138 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/print_to_pdf_scheduler.h"
+
+#include <vector>
+
+#include "base/bind.h"
+#include "base/stl_util.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace atom {
+
+namespace {
+
+// Dropping a new job when this many are already waiting; the bound exists
+// to fail fast instead of buffering an unbounded backlog.
+const size_t kMaxQueuedJobs = 256;
+
+}  // namespace
+
+// static
+PrintToPDFScheduler* PrintToPDFScheduler::GetInstance() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  static PrintToPDFScheduler* instance = new PrintToPDFScheduler;
+  return instance;
+}
+
+PrintToPDFScheduler::PrintToPDFScheduler() {
+}
+
+PrintToPDFScheduler::~PrintToPDFScheduler() {
+}
+
+void PrintToPDFScheduler::SetMaxConcurrency(int max_concurrency) {
+  if (max_concurrency < 1)
+    max_concurrency = 1;
+  max_concurrency_ = max_concurrency;
+  MaybeStartJobs();
+}
+
+void PrintToPDFScheduler::Schedule(void* owner,
+                                   Priority priority,
+                                   base::TimeDelta timeout,
+                                   const StartCallback& start,
+                                   const DropCallback& drop) {
+  if (jobs_.size() - static_cast<size_t>(running_count_) >= kMaxQueuedJobs) {
+    drop.Run("printToPDF job queue is full");
+    return;
+  }
+
+  uint32_t id = next_job_id_++;
+  Job job = {owner, false, start, drop};
+  jobs_[id] = job;
+  queues_[priority].push_back(id);
+
+  // The timeout covers both queue wait and run time, so a job that never
+  // completes cannot hold its run slot forever.
+  content::BrowserThread::PostDelayedTask(
+      content::BrowserThread::UI, FROM_HERE,
+      base::Bind(&PrintToPDFScheduler::OnJobTimeout, base::Unretained(this),
+                 id),
+      timeout);
+
+  MaybeStartJobs();
+}
+
+void PrintToPDFScheduler::CancelJobsFor(void* owner) {
+  std::vector<uint32_t> cancelled;
+  for (const auto& it : jobs_) {
+    if (it.second.owner == owner)
+      cancelled.push_back(it.first);
+  }
+
+  for (uint32_t id : cancelled) {
+    auto it = jobs_.find(id);
+    if (it->second.running)
+      --running_count_;
+    DropCallback drop = it->second.drop;
+    jobs_.erase(it);
+    drop.Run("printToPDF job was cancelled");
+  }
+
+  if (!cancelled.empty())
+    MaybeStartJobs();
+}
+
+void PrintToPDFScheduler::MaybeStartJobs() {
+  while (running_count_ < max_concurrency_) {
+    uint32_t id = 0;
+    for (auto& queue : queues_) {
+      // Skip ids whose jobs were dropped while queued.
+      while (!queue.empty() && !base::ContainsKey(jobs_, queue.front()))
+        queue.pop_front();
+      if (!queue.empty()) {
+        id = queue.front();
+        queue.pop_front();
+        break;
+      }
+    }
+    if (id == 0)
+      return;
+
+    Job& job = jobs_[id];
+    job.running = true;
+    ++running_count_;
+    job.start.Run(base::Bind(&PrintToPDFScheduler::OnJobDone,
+                             base::Unretained(this), id));
+  }
+}
+
+bool PrintToPDFScheduler::OnJobDone(uint32_t id) {
+  auto it = jobs_.find(id);
+  if (it == jobs_.end())
+    return false;
+
+  DCHECK(it->second.running);
+  --running_count_;
+  jobs_.erase(it);
+  MaybeStartJobs();
+  return true;
+}
+
+void PrintToPDFScheduler::OnJobTimeout(uint32_t id) {
+  auto it = jobs_.find(id);
+  if (it == jobs_.end())
+    return;
+
+  if (it->second.running)
+    --running_count_;
+  DropCallback drop = it->second.drop;
+  jobs_.erase(it);
+  drop.Run("printToPDF job timed out");
+  MaybeStartJobs();
+}
+
+}  // namespace atom
@@ -0,0 +1,87 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_PRINT_TO_PDF_SCHEDULER_H_
+#define ATOM_BROWSER_PRINT_TO_PDF_SCHEDULER_H_
+
+#include <deque>
+#include <map>
+#include <string>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/time/time.h"
+
+namespace atom {
+
+// Schedules printToPDF jobs across all WebContents on the UI thread. Jobs
+// wait in a bounded per-priority queue until a run slot is free, so firing
+// many printToPDF calls at once no longer thrashes the renderers; a per-job
+// timeout covers both queue wait and run time, and doubles as the safety
+// net for jobs whose WebContents never answers.
+class PrintToPDFScheduler {
+ public:
+  enum Priority {
+    PRIORITY_HIGH = 0,
+    PRIORITY_NORMAL,
+    PRIORITY_LOW,
+    PRIORITY_COUNT,
+  };
+
+  // Runs the job. The passed callback must be invoked when the job
+  // completes; it returns true if the job was still live, false if it had
+  // already been dropped (timed out or cancelled), in which case the
+  // result must be discarded.
+  using StartCallback = base::Callback<void(const base::Callback<bool()>&)>;
+
+  // Invoked with a human-readable reason when a job is dropped without
+  // running to completion.
+  using DropCallback = base::Callback<void(const std::string&)>;
+
+  static PrintToPDFScheduler* GetInstance();
+
+  // How many jobs may run at the same time.
+  void SetMaxConcurrency(int max_concurrency);
+
+  // Queues a job. |owner| identifies who scheduled it so CancelJobsFor can
+  // drop everything belonging to a destroyed WebContents. Drops the job
+  // immediately when the queue is full.
+  void Schedule(void* owner,
+                Priority priority,
+                base::TimeDelta timeout,
+                const StartCallback& start,
+                const DropCallback& drop);
+
+  // Drops all queued and running jobs scheduled by |owner|.
+  void CancelJobsFor(void* owner);
+
+ private:
+  struct Job {
+    void* owner;
+    bool running;
+    StartCallback start;
+    DropCallback drop;
+  };
+
+  PrintToPDFScheduler();
+  ~PrintToPDFScheduler();
+
+  void MaybeStartJobs();
+  bool OnJobDone(uint32_t id);
+  void OnJobTimeout(uint32_t id);
+
+  int max_concurrency_ = 4;
+  int running_count_ = 0;
+  uint32_t next_job_id_ = 1;
+  // Live jobs by id; dropped jobs leave stale ids in the queues, which
+  // MaybeStartJobs skips.
+  std::map<uint32_t, Job> jobs_;
+  std::deque<uint32_t> queues_[PRIORITY_COUNT];
+
+  DISALLOW_COPY_AND_ASSIGN(PrintToPDFScheduler);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_PRINT_TO_PDF_SCHEDULER_H_
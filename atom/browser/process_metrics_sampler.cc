@@ -0,0 +1,121 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/process_metrics_sampler.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/location.h"
+#include "base/sys_info.h"
+#include "base/threading/sequenced_worker_pool.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace atom {
+
+ProcessMetricsSampler::ProcessMetricsSampler()
+    : sampling_(false),
+      generation_(0) {
+  auto pool = content::BrowserThread::GetBlockingPool();
+  task_runner_ = pool->GetSequencedTaskRunnerWithShutdownBehavior(
+      pool->GetSequenceToken(), base::SequencedWorkerPool::SKIP_ON_SHUTDOWN);
+}
+
+ProcessMetricsSampler::~ProcessMetricsSampler() {
+}
+
+void ProcessMetricsSampler::AddProcess(
+    int type,
+    base::ProcessId pid,
+    std::unique_ptr<base::ProcessMetrics> metrics) {
+  task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&ProcessMetricsSampler::AddProcessOnSamplerSequence,
+                 base::Unretained(this), type, pid, base::Passed(&metrics)));
+}
+
+void ProcessMetricsSampler::RemoveProcess(base::ProcessId pid) {
+  task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&ProcessMetricsSampler::RemoveProcessOnSamplerSequence,
+                 base::Unretained(this), pid));
+}
+
+void ProcessMetricsSampler::Start(int interval_ms) {
+  int generation;
+  {
+    base::AutoLock auto_lock(lock_);
+    generation = ++generation_;
+  }
+  sampling_ = true;
+  task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&ProcessMetricsSampler::TakeSample,
+                 base::Unretained(this), interval_ms, generation));
+}
+
+void ProcessMetricsSampler::Stop() {
+  base::AutoLock auto_lock(lock_);
+  ++generation_;
+  sampling_ = false;
+}
+
+ProcessMetricsSampler::Snapshot ProcessMetricsSampler::GetLatestSnapshot() {
+  base::AutoLock auto_lock(lock_);
+  return latest_;
+}
+
+void ProcessMetricsSampler::AddProcessOnSamplerSequence(
+    int type,
+    base::ProcessId pid,
+    std::unique_ptr<base::ProcessMetrics> metrics) {
+  TrackedProcess& process = processes_[pid];
+  process.type = type;
+  process.metrics = std::move(metrics);
+}
+
+void ProcessMetricsSampler::RemoveProcessOnSamplerSequence(
+    base::ProcessId pid) {
+  processes_.erase(pid);
+}
+
+void ProcessMetricsSampler::TakeSample(int interval_ms, int generation) {
+  Snapshot snapshot;
+  snapshot.timestamp = base::Time::Now();
+  snapshot.samples.reserve(processes_.size());
+  int processor_count = base::SysInfo::NumberOfProcessors();
+
+  for (auto& it : processes_) {
+    ProcessSample sample;
+    sample.type = it.second.type;
+    sample.pid = it.first;
+    sample.percent_cpu_usage =
+        it.second.metrics->GetPlatformIndependentCPUUsage() / processor_count;
+    sample.idle_wakeups_per_second =
+        it.second.metrics->GetIdleWakeupsPerSecond();
+    sample.working_set_size = it.second.metrics->GetWorkingSetSize();
+    sample.peak_working_set_size =
+        it.second.metrics->GetPeakWorkingSetSize();
+    it.second.metrics->GetMemoryBytes(&sample.private_bytes,
+                                      &sample.shared_bytes);
+    snapshot.samples.push_back(sample);
+  }
+
+  {
+    base::AutoLock auto_lock(lock_);
+    // A Stop or a Start with a new interval invalidated this chain;
+    // drop the result and do not reschedule.
+    if (generation != generation_)
+      return;
+    latest_ = std::move(snapshot);
+  }
+
+  task_runner_->PostDelayedTask(
+      FROM_HERE,
+      base::Bind(&ProcessMetricsSampler::TakeSample,
+                 base::Unretained(this), interval_ms, generation),
+      base::TimeDelta::FromMilliseconds(interval_ms));
+}
+
+}  // namespace atom
@@ -0,0 +1,100 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_PROCESS_METRICS_SAMPLER_H_
+#define ATOM_BROWSER_PROCESS_METRICS_SAMPLER_H_
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/memory/ref_counted.h"
+#include "base/process/process_metrics.h"
+#include "base/sequenced_task_runner.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
+
+namespace atom {
+
+// Samples CPU and memory of the browser and all child processes on a
+// background sequence at a fixed interval, keeping the latest complete
+// snapshot available for immediate, non-blocking reads from the UI
+// thread. Querying process metrics involves a syscall per process, so
+// polling them synchronously from JavaScript janks the UI; the sampler
+// pays that cost off-thread instead.
+//
+// AddProcess/RemoveProcess/Start/Stop are called on the UI thread; the
+// sampler owns its own ProcessMetrics instances (CPU usage is computed
+// from successive queries on the same instance, so they cannot be
+// shared with the synchronous getAppMetrics path).
+class ProcessMetricsSampler {
+ public:
+  struct ProcessSample {
+    int type = 0;
+    base::ProcessId pid = 0;
+    double percent_cpu_usage = 0;
+    int idle_wakeups_per_second = 0;
+    size_t working_set_size = 0;
+    size_t peak_working_set_size = 0;
+    size_t private_bytes = 0;
+    size_t shared_bytes = 0;
+  };
+
+  struct Snapshot {
+    base::Time timestamp;
+    std::vector<ProcessSample> samples;
+  };
+
+  ProcessMetricsSampler();
+  ~ProcessMetricsSampler();
+
+  void AddProcess(int type,
+                  base::ProcessId pid,
+                  std::unique_ptr<base::ProcessMetrics> metrics);
+  void RemoveProcess(base::ProcessId pid);
+
+  // Begins periodic sampling; restarting with a new interval replaces
+  // the previous schedule.
+  void Start(int interval_ms);
+  void Stop();
+  bool IsSampling() const { return sampling_; }
+
+  // Returns a copy of the most recent snapshot. Never blocks on
+  // sampling; empty until the first sample completes.
+  Snapshot GetLatestSnapshot();
+
+ private:
+  struct TrackedProcess {
+    int type;
+    std::unique_ptr<base::ProcessMetrics> metrics;
+  };
+
+  // All run on |task_runner_|.
+  void AddProcessOnSamplerSequence(
+      int type,
+      base::ProcessId pid,
+      std::unique_ptr<base::ProcessMetrics> metrics);
+  void RemoveProcessOnSamplerSequence(base::ProcessId pid);
+  void TakeSample(int interval_ms, int generation);
+
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+
+  // Owned and accessed only on the sampler sequence.
+  std::map<base::ProcessId, TrackedProcess> processes_;
+
+  bool sampling_;  // UI thread.
+
+  base::Lock lock_;
+  Snapshot latest_;     // guarded by |lock_|.
+  // Bumped by Start/Stop; a sampling task whose generation no longer
+  // matches stops rescheduling itself.
+  int generation_;      // guarded by |lock_|.
+
+  DISALLOW_COPY_AND_ASSIGN(ProcessMetricsSampler);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_PROCESS_METRICS_SAMPLER_H_
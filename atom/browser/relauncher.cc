@@ -151,8 +151,6 @@ int RelauncherMain(const content::MainFunctionParams& main_parameters) {
     return 1;
   }
 
-  internal::RelauncherSynchronizeWithParent();
-
   // Figure out what to execute, what arguments to pass it, and whether to
   // start it in the background.
   bool in_relauncher_args = false;
@@ -177,6 +175,28 @@ int RelauncherMain(const content::MainFunctionParams& main_parameters) {
     return 1;
   }
 
+#if defined(OS_WIN)
+  // Pay the process-creation cost of the relaunched process while the parent
+  // is still alive: create it with its initial thread suspended, so that
+  // once the parent exits only a thread resume stands between the user and
+  // the new instance. The suspended process runs no code, so it cannot race
+  // the parent for single-instance state.
+  internal::PreStagedProcess prestaged;
+  bool prestaged_ok = internal::PreStageProgram(launch_argv, &prestaged);
+#endif
+
+  internal::RelauncherSynchronizeWithParent();
+
+#if defined(OS_WIN)
+  if (prestaged_ok) {
+    if (!internal::ActivateProgram(&prestaged)) {
+      LOG(ERROR) << "failed to activate program";
+      return 1;
+    }
+    return 0;
+  }
+#endif
+
   if (internal::LaunchProgram(relauncher_args, launch_argv) != 0) {
     LOG(ERROR) << "failed to launch program";
     return 1;
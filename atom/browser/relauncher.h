@@ -36,6 +36,7 @@
 
 #if defined(OS_WIN)
 #include "base/process/process_handle.h"
+#include "base/win/scoped_handle.h"
 #endif
 
 namespace content {
@@ -102,6 +103,25 @@ extern const CharType* kRelauncherArgSeparator;
 StringType GetWaitEventName(base::ProcessId pid);
 
 StringType ArgvToCommandLineString(const StringVector& argv);
+
+// A relaunched process created with its initial thread suspended while the
+// parent is still running, so the process-creation cost is paid before the
+// parent exits and activation is just a thread resume.
+struct PreStagedProcess {
+  PreStagedProcess();
+  ~PreStagedProcess();
+
+  base::win::ScopedHandle process;
+  base::win::ScopedHandle thread;
+};
+
+// Creates the relaunched process suspended. Returns false when creation
+// fails, in which case the caller should fall back to LaunchProgram after
+// the parent exits.
+bool PreStageProgram(const StringVector& argv, PreStagedProcess* process);
+
+// Resumes a pre-staged process once the parent has exited.
+bool ActivateProgram(PreStagedProcess* process);
 #endif
 
 // In the relauncher process, performs the necessary synchronization steps
@@ -123,6 +123,36 @@ int LaunchProgram(const StringVector& relauncher_args,
   return process.IsValid() ? 0 : 1;
 }
 
+PreStagedProcess::PreStagedProcess() {}
+
+PreStagedProcess::~PreStagedProcess() {}
+
+bool PreStageProgram(const StringVector& argv, PreStagedProcess* process) {
+  // CreateProcess may modify the command line buffer.
+  StringType command_line = ArgvToCommandLineString(argv);
+  std::vector<wchar_t> mutable_command_line(command_line.begin(),
+                                            command_line.end());
+  mutable_command_line.push_back(L'\0');
+
+  STARTUPINFOW startup_info = {};
+  startup_info.cb = sizeof(startup_info);
+  PROCESS_INFORMATION process_info = {};
+  if (!::CreateProcessW(nullptr, mutable_command_line.data(), nullptr, nullptr,
+                        FALSE, CREATE_SUSPENDED | CREATE_UNICODE_ENVIRONMENT,
+                        nullptr, nullptr, &startup_info, &process_info)) {
+    PLOG(ERROR) << "CreateProcessW";
+    return false;
+  }
+
+  process->process.Set(process_info.hProcess);
+  process->thread.Set(process_info.hThread);
+  return true;
+}
+
+bool ActivateProgram(PreStagedProcess* process) {
+  return ::ResumeThread(process->thread.Get()) != static_cast<DWORD>(-1);
+}
+
 }  // namespace internal
 
 }  // namespace relauncher
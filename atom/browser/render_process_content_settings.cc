@@ -0,0 +1,59 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/render_process_content_settings.h"
+
+#include <utility>
+
+#include "atom/common/api/api_messages.h"
+#include "base/lazy_instance.h"
+#include "content/public/browser/notification_service.h"
+#include "content/public/browser/notification_types.h"
+#include "content/public/browser/render_process_host.h"
+
+namespace atom {
+
+namespace {
+
+base::LazyInstance<RenderProcessContentSettings>::Leaky g_instance =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+// static
+RenderProcessContentSettings* RenderProcessContentSettings::GetInstance() {
+  return g_instance.Pointer();
+}
+
+RenderProcessContentSettings::RenderProcessContentSettings() {
+  registrar_.Add(this,
+                 content::NOTIFICATION_RENDERER_PROCESS_CREATED,
+                 content::NotificationService::AllBrowserContextsAndSources());
+}
+
+RenderProcessContentSettings::~RenderProcessContentSettings() {
+}
+
+void RenderProcessContentSettings::SetRules(
+    std::unique_ptr<base::DictionaryValue> rules) {
+  rules_ = std::move(rules);
+  for (auto iter = content::RenderProcessHost::AllHostsIterator();
+       !iter.IsAtEnd(); iter.Advance()) {
+    iter.GetCurrentValue()->Send(new AtomMsg_UpdateContentSettings(*rules_));
+  }
+}
+
+void RenderProcessContentSettings::Observe(
+    int type,
+    const content::NotificationSource& source,
+    const content::NotificationDetails& details) {
+  DCHECK_EQ(type, content::NOTIFICATION_RENDERER_PROCESS_CREATED);
+  if (!rules_)
+    return;
+  content::RenderProcessHost* process =
+      content::Source<content::RenderProcessHost>(source).ptr();
+  process->Send(new AtomMsg_UpdateContentSettings(*rules_));
+}
+
+}  // namespace atom
@@ -0,0 +1,48 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_RENDER_PROCESS_CONTENT_SETTINGS_H_
+#define ATOM_BROWSER_RENDER_PROCESS_CONTENT_SETTINGS_H_
+
+#include <memory>
+
+#include "base/lazy_instance.h"
+#include "base/values.h"
+#include "content/public/browser/notification_observer.h"
+#include "content/public/browser/notification_registrar.h"
+
+namespace atom {
+
+// Broadcasts the app's content-settings rules to all render processes and
+// replays them to processes created later, so renderers can answer
+// allowImage/allowScript style checks locally instead of asking the
+// browser per decision.
+class RenderProcessContentSettings : public content::NotificationObserver {
+ public:
+  static RenderProcessContentSettings* GetInstance();
+
+  // Replaces the rules and sends them to every live render process. An
+  // empty dictionary clears all rules.
+  void SetRules(std::unique_ptr<base::DictionaryValue> rules);
+
+ private:
+  friend struct base::DefaultLazyInstanceTraits<RenderProcessContentSettings>;
+
+  RenderProcessContentSettings();
+  ~RenderProcessContentSettings() override;
+
+  // content::NotificationObserver:
+  void Observe(int type,
+               const content::NotificationSource& source,
+               const content::NotificationDetails& details) override;
+
+  content::NotificationRegistrar registrar_;
+  std::unique_ptr<base::DictionaryValue> rules_;
+
+  DISALLOW_COPY_AND_ASSIGN(RenderProcessContentSettings);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_RENDER_PROCESS_CONTENT_SETTINGS_H_
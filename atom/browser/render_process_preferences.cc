@@ -5,6 +5,8 @@
 #include "atom/browser/render_process_preferences.h"
 
 #include "atom/common/api/api_messages.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "content/public/browser/notification_service.h"
 #include "content/public/browser/notification_types.h"
 #include "content/public/browser/render_process_host.h"
@@ -14,10 +16,16 @@ namespace atom {
 RenderProcessPreferences::RenderProcessPreferences(const Predicate& predicate)
     : predicate_(predicate),
       next_id_(0),
-      cache_needs_update_(true) {
+      version_(0),
+      broadcast_pending_(false),
+      cache_needs_update_(true),
+      weak_factory_(this) {
   registrar_.Add(this,
                  content::NOTIFICATION_RENDERER_PROCESS_CREATED,
                  content::NotificationService::AllBrowserContextsAndSources());
+  registrar_.Add(this,
+                 content::NOTIFICATION_RENDERER_PROCESS_CLOSED,
+                 content::NotificationService::AllBrowserContextsAndSources());
 }
 
 RenderProcessPreferences::~RenderProcessPreferences() {
@@ -26,28 +34,40 @@ RenderProcessPreferences::~RenderProcessPreferences() {
 int RenderProcessPreferences::AddEntry(const base::DictionaryValue& entry) {
   int id = ++next_id_;
   entries_[id] = entry.CreateDeepCopy();
+  entry_versions_[id] = ++version_;
   cache_needs_update_ = true;
+  ScheduleBroadcast();
   return id;
 }
 
 void RenderProcessPreferences::RemoveEntry(int id) {
+  if (entries_.erase(id) == 0)
+    return;
+  entry_versions_.erase(id);
+  removed_versions_[id] = ++version_;
   cache_needs_update_ = true;
-  entries_.erase(id);
+  ScheduleBroadcast();
 }
 
 void RenderProcessPreferences::Observe(
     int type,
     const content::NotificationSource& source,
     const content::NotificationDetails& details) {
-  DCHECK_EQ(type, content::NOTIFICATION_RENDERER_PROCESS_CREATED);
   content::RenderProcessHost* process =
       content::Source<content::RenderProcessHost>(source).ptr();
 
+  if (type == content::NOTIFICATION_RENDERER_PROCESS_CLOSED) {
+    process_versions_.erase(process->GetID());
+    return;
+  }
+
+  DCHECK_EQ(type, content::NOTIFICATION_RENDERER_PROCESS_CREATED);
   if (!predicate_.Run(process))
     return;
 
   UpdateCache();
   process->Send(new AtomMsg_UpdatePreferences(cached_entries_));
+  process_versions_[process->GetID()] = version_;
 }
 
 void RenderProcessPreferences::UpdateCache() {
@@ -56,8 +76,57 @@ void RenderProcessPreferences::UpdateCache() {
 
   cached_entries_.Clear();
   for (const auto& iter : entries_)
-    cached_entries_.Append(iter.second->CreateDeepCopy());
+    cached_entries_.SetWithoutPathExpansion(base::IntToString(iter.first),
+                                            iter.second->CreateDeepCopy());
   cache_needs_update_ = false;
 }
 
+void RenderProcessPreferences::ScheduleBroadcast() {
+  if (broadcast_pending_)
+    return;
+  broadcast_pending_ = true;
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE,
+      base::Bind(&RenderProcessPreferences::Broadcast,
+                 weak_factory_.GetWeakPtr()));
+}
+
+void RenderProcessPreferences::Broadcast() {
+  broadcast_pending_ = false;
+  for (auto iter = content::RenderProcessHost::AllHostsIterator();
+       !iter.IsAtEnd(); iter.Advance()) {
+    content::RenderProcessHost* process = iter.GetCurrentValue();
+    auto found = process_versions_.find(process->GetID());
+    // Processes the predicate rejected at creation never got the initial
+    // snapshot and are left alone.
+    if (found == process_versions_.end() || found->second == version_)
+      continue;
+
+    base::DictionaryValue added;
+    base::ListValue removed;
+    if (GetDelta(found->second, &added, &removed))
+      process->Send(new AtomMsg_UpdatePreferencesDelta(added, removed));
+    found->second = version_;
+  }
+  // Every tracked process is now current, so the removal tombstones can go;
+  // new processes always start from a full snapshot.
+  removed_versions_.clear();
+}
+
+bool RenderProcessPreferences::GetDelta(int since_version,
+                                        base::DictionaryValue* added,
+                                        base::ListValue* removed) const {
+  for (const auto& iter : entry_versions_) {
+    if (iter.second > since_version)
+      added->SetWithoutPathExpansion(
+          base::IntToString(iter.first),
+          entries_.at(iter.first)->CreateDeepCopy());
+  }
+  for (const auto& iter : removed_versions_) {
+    if (iter.second > since_version)
+      removed->AppendInteger(iter.first);
+  }
+  return !added->empty() || !removed->empty();
+}
+
 }  // namespace atom
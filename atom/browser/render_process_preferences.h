@@ -5,10 +5,12 @@
 #ifndef ATOM_BROWSER_RENDER_PROCESS_PREFERENCES_H_
 #define ATOM_BROWSER_RENDER_PROCESS_PREFERENCES_H_
 
+#include <map>
 #include <memory>
 #include <unordered_map>
 
 #include "base/callback.h"
+#include "base/memory/weak_ptr.h"
 #include "base/values.h"
 #include "content/public/browser/notification_observer.h"
 #include "content/public/browser/notification_registrar.h"
@@ -40,6 +42,17 @@ class RenderProcessPreferences : public content::NotificationObserver {
 
   void UpdateCache();
 
+  // Posts a task to broadcast pending changes to live render processes;
+  // successive updates arriving before it runs fold into one broadcast.
+  void ScheduleBroadcast();
+  void Broadcast();
+
+  // Fills |added| and |removed| with the changes made after |since_version|.
+  // Returns false when nothing changed.
+  bool GetDelta(int since_version,
+                base::DictionaryValue* added,
+                base::ListValue* removed) const;
+
   // Manages our notification registrations.
   content::NotificationRegistrar registrar_;
 
@@ -48,10 +61,24 @@ class RenderProcessPreferences : public content::NotificationObserver {
   int next_id_;
   std::unordered_map<int, std::unique_ptr<base::DictionaryValue>> entries_;
 
-  // We need to convert the |entries_| to ListValue for multiple times, this
-  // caches is only updated when we are sending messages.
+  // Every mutation bumps |version_|; per-entry versions record when an entry
+  // was added or removed so a delta can be computed for any process from the
+  // version it last received.
+  int version_;
+  std::map<int, int> entry_versions_;
+  std::map<int, int> removed_versions_;
+
+  // The version each render process was last brought up to.
+  std::map<int, int> process_versions_;
+
+  bool broadcast_pending_;
+
+  // We need to convert the |entries_| to a snapshot for every new process,
+  // this cache is only updated when we are sending messages.
   bool cache_needs_update_;
-  base::ListValue cached_entries_;
+  base::DictionaryValue cached_entries_;
+
+  base::WeakPtrFactory<RenderProcessPreferences> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(RenderProcessPreferences);
 };
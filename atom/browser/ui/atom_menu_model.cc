@@ -29,6 +29,11 @@ base::string16 AtomMenuModel::GetRoleAt(int index) {
     return base::string16();
 }
 
+void AtomMenuModel::SetLabel(int index, const base::string16& label) {
+  int command_id = GetCommandIdAt(index);
+  labels_[command_id] = label;
+}
+
 bool AtomMenuModel::GetAcceleratorAtWithParams(
     int index,
     bool use_default_accelerator,
@@ -40,6 +45,20 @@ bool AtomMenuModel::GetAcceleratorAtWithParams(
   return false;
 }
 
+base::string16 AtomMenuModel::GetLabelAt(int index) const {
+  int command_id = GetCommandIdAt(index);
+  const auto iter = labels_.find(command_id);
+  if (iter != labels_.end())
+    return iter->second;
+  return ui::SimpleMenuModel::GetLabelAt(index);
+}
+
+bool AtomMenuModel::IsItemDynamicAt(int index) const {
+  if (base::ContainsKey(labels_, GetCommandIdAt(index)))
+    return true;
+  return ui::SimpleMenuModel::IsItemDynamicAt(index);
+}
+
 void AtomMenuModel::MenuWillClose() {
   ui::SimpleMenuModel::MenuWillClose();
   for (Observer& observer : observers_)
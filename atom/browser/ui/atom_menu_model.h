@@ -48,11 +48,17 @@ class AtomMenuModel : public ui::SimpleMenuModel {
 
   void SetRole(int index, const base::string16& role);
   base::string16 GetRoleAt(int index);
+  // Overrides the label of the item at |index| in place. The item is then
+  // reported as dynamic so native menus re-read the label when showing,
+  // instead of requiring a rebuild of the whole menu.
+  void SetLabel(int index, const base::string16& label);
   bool GetAcceleratorAtWithParams(int index,
                                   bool use_default_accelerator,
                                   ui::Accelerator* accelerator) const;
 
   // ui::SimpleMenuModel:
+  base::string16 GetLabelAt(int index) const override;
+  bool IsItemDynamicAt(int index) const override;
   void MenuWillClose() override;
 
   using SimpleMenuModel::GetSubmenuModelAt;
@@ -62,6 +68,7 @@ class AtomMenuModel : public ui::SimpleMenuModel {
   Delegate* delegate_;  // weak ref.
 
   std::map<int, base::string16> roles_;  // command id -> role
+  std::map<int, base::string16> labels_;  // command id -> overridden label
   base::ObserverList<Observer> observers_;
 
   DISALLOW_COPY_AND_ASSIGN(AtomMenuModel);
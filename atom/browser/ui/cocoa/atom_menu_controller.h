@@ -8,6 +8,8 @@
 
 #import <Cocoa/Cocoa.h>
 
+#include <map>
+
 #include "base/callback.h"
 #include "base/mac/scoped_nsobject.h"
 #include "base/strings/string16.h"
@@ -29,6 +31,10 @@ class AtomMenuModel;
   BOOL isMenuOpen_;
   BOOL useDefaultAccelerator_;
   base::Callback<void()> closeCallback;
+
+  // Submenus whose construction has been deferred until they are first
+  // shown, mapped to the model they will be built from.
+  std::map<NSMenu*, atom::AtomMenuModel*> pendingModels_;
 }
 
 @property(nonatomic, assign) atom::AtomMenuModel* model;
@@ -56,6 +62,7 @@ class AtomMenuModel;
 // if extending the behavior.
 - (void)menuWillOpen:(NSMenu*)menu;
 - (void)menuDidClose:(NSMenu*)menu;
+- (void)menuNeedsUpdate:(NSMenu*)menu;
 
 @end
 
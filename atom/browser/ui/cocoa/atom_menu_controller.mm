@@ -65,6 +65,8 @@ Role kRolesMap[] = {
 
 - (void)dealloc {
   [menu_ setDelegate:nil];
+  for (const auto& pending : pendingModels_)
+    [pending.first setDelegate:nil];
 
   // Close the menu if it is still open. This could happen if a tab gets closed
   // while its context menu is still open.
@@ -84,6 +86,7 @@ Role kRolesMap[] = {
 
   model_ = model;
   [menu_ removeAllItems];
+  pendingModels_.clear();
 
   const int count = model->GetItemCount();
   for (int index = 0; index < count; index++) {
@@ -146,24 +149,35 @@ Role kRolesMap[] = {
 
   atom::AtomMenuModel::ItemType type = model->GetTypeAt(index);
   if (type == atom::AtomMenuModel::TYPE_SUBMENU) {
-    // Recursively build a submenu from the sub-model at this index.
     [item setTarget:nil];
     [item setAction:nil];
     atom::AtomMenuModel* submenuModel = static_cast<atom::AtomMenuModel*>(
         model->GetSubmenuModelAt(index));
-    NSMenu* submenu = [self menuFromModel:submenuModel];
-    [submenu setTitle:[item title]];
-    [item setSubmenu:submenu];
-
-    // Set submenu's role.
     base::string16 role = model->GetRoleAt(index);
-    if (role == base::ASCIIToUTF16("window") && [submenu numberOfItems])
-      [NSApp setWindowsMenu:submenu];
-    else if (role == base::ASCIIToUTF16("help"))
-      [NSApp setHelpMenu:submenu];
-
-    if (role == base::ASCIIToUTF16("services"))
-      [NSApp setServicesMenu:submenu];
+    if (role.empty()) {
+      // Defer building the submenu until it is about to be shown; deeply
+      // nested menus are expensive to convert eagerly and may never be
+      // opened. AppKit asks the delegate to fill it in menuNeedsUpdate:.
+      NSMenu* submenu =
+          [[[NSMenu alloc] initWithTitle:[item title]] autorelease];
+      [submenu setDelegate:self];
+      pendingModels_[submenu] = submenuModel;
+      [item setSubmenu:submenu];
+    } else {
+      // Submenus with a role are registered with NSApp when built, so they
+      // have to be converted up front.
+      NSMenu* submenu = [self menuFromModel:submenuModel];
+      [submenu setTitle:[item title]];
+      [item setSubmenu:submenu];
+
+      if (role == base::ASCIIToUTF16("window") && [submenu numberOfItems])
+        [NSApp setWindowsMenu:submenu];
+      else if (role == base::ASCIIToUTF16("help"))
+        [NSApp setHelpMenu:submenu];
+
+      if (role == base::ASCIIToUTF16("services"))
+        [NSApp setServicesMenu:submenu];
+    }
   } else {
     // The MenuModel works on indexes so we can't just set the command id as the
     // tag like we do in other menus. Also set the represented object to be
@@ -265,12 +279,39 @@ Role kRolesMap[] = {
   return isMenuOpen_;
 }
 
+// Build a lazily created submenu the first time AppKit is about to show it
+// (or needs it for key equivalent matching).
+- (void)menuNeedsUpdate:(NSMenu*)menu {
+  auto iter = pendingModels_.find(menu);
+  if (iter == pendingModels_.end())
+    return;
+
+  atom::AtomMenuModel* model = iter->second;
+  pendingModels_.erase(iter);
+
+  const int count = model->GetItemCount();
+  for (int index = 0; index < count; index++) {
+    if (model->GetTypeAt(index) == atom::AtomMenuModel::TYPE_SEPARATOR)
+      [self addSeparatorToMenu:menu atIndex:index];
+    else
+      [self addItemToMenu:menu atIndex:index fromModel:model];
+  }
+}
+
 - (void)menuWillOpen:(NSMenu*)menu {
+  // Submenus share this delegate; only the root menu drives the model's
+  // open state.
+  if (menu != menu_.get())
+    return;
+
   isMenuOpen_ = YES;
   model_->MenuWillShow();
 }
 
 - (void)menuDidClose:(NSMenu*)menu {
+  if (menu != menu_.get())
+    return;
+
   if (isMenuOpen_) {
     isMenuOpen_ = NO;
     model_->MenuWillClose();
@@ -11,6 +11,7 @@
 
 #include "base/callback_forward.h"
 #include "base/files/file_path.h"
+#include "build/build_config.h"
 
 namespace atom {
 class NativeWindow;
@@ -62,6 +63,13 @@ bool ShowSaveDialog(const DialogSettings& settings,
 void ShowSaveDialog(const DialogSettings& settings,
                     const SaveDialogCallback& callback);
 
+#if defined(OS_WIN)
+// Spins up the shared dialog thread and faults in the COM dialog machinery
+// ahead of time, so the first dialog presents without paying thread and COM
+// initialization. Called once at app idle.
+void PrewarmDialogs();
+#endif
+
 }  // namespace file_dialog
 
 #endif  // ATOM_BROWSER_UI_FILE_DIALOG_H_
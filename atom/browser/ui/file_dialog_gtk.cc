@@ -149,7 +149,7 @@ class FileChooserDialog {
   base::FilePath AddExtensionForFilename(const gchar* filename) const;
 
   atom::NativeWindowViews* parent_;
-  atom::UnresponsiveSuppressor unresponsive_suppressor_;
+  atom::UnresponsiveSuppressor unresponsive_suppressor_{"file-dialog"};
 
   GtkWidget* dialog_;
 
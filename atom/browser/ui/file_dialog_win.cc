@@ -109,7 +109,7 @@ class FileDialog {
   }
 
   bool Show(atom::NativeWindow* parent_window) {
-    atom::UnresponsiveSuppressor suppressor;
+    atom::UnresponsiveSuppressor suppressor("file-dialog");
     HWND window = parent_window ? static_cast<atom::NativeWindowViews*>(
         parent_window)->GetAcceleratedWidget() :
         NULL;
@@ -140,45 +140,61 @@ class FileDialog {
   DISALLOW_COPY_AND_ASSIGN(FileDialog);
 };
 
-struct RunState {
-  base::Thread* dialog_thread;
-  scoped_refptr<base::SingleThreadTaskRunner> ui_task_runner;
-};
-
-bool CreateDialogThread(RunState* run_state) {
-  std::unique_ptr<base::Thread> thread(
-      new base::Thread(ATOM_PRODUCT_NAME "FileDialogThread"));
-  thread->init_com_with_mta(false);
-  if (!thread->Start())
-    return false;
+// Returns the shared STA thread that dialogs run on. The thread is kept
+// alive between invocations so later dialogs skip the thread spawn and COM
+// initialization; it is created by the app-idle pre-warm or on first use,
+// and intentionally leaked at shutdown.
+base::Thread* GetDialogThread() {
+  static base::Thread* dialog_thread = nullptr;
+  if (!dialog_thread) {
+    std::unique_ptr<base::Thread> thread(
+        new base::Thread(ATOM_PRODUCT_NAME "FileDialogThread"));
+    thread->init_com_with_mta(false);
+    if (!thread->Start())
+      return nullptr;
+    dialog_thread = thread.release();
+  }
+  return dialog_thread;
+}
 
-  run_state->dialog_thread = thread.release();
-  run_state->ui_task_runner = base::ThreadTaskRunnerHandle::Get();
-  return true;
+// Runs on the dialog thread during pre-warm to fault in the COM dialog
+// machinery before the first real dialog is requested.
+void WarmUpDialogState() {
+  // Instantiating a file dialog loads the shell item factories, and
+  // CommDlgExtendedError maps comdlg32.dll, which the color chooser's
+  // ChooseColor also lives in.
+  CShellFileOpenDialog warm_dialog;
+  CommDlgExtendedError();
 }
 
-void RunOpenDialogInNewThread(const RunState& run_state,
-                              const DialogSettings& settings,
-                              const OpenDialogCallback& callback) {
+void RunOpenDialogOnDialogThread(
+    const scoped_refptr<base::SingleThreadTaskRunner>& ui_task_runner,
+    const DialogSettings& settings,
+    const OpenDialogCallback& callback) {
   std::vector<base::FilePath> paths;
   bool result = ShowOpenDialog(settings, &paths);
-  run_state.ui_task_runner->PostTask(FROM_HERE,
-                                      base::Bind(callback, result, paths));
-  run_state.ui_task_runner->DeleteSoon(FROM_HERE, run_state.dialog_thread);
+  ui_task_runner->PostTask(FROM_HERE, base::Bind(callback, result, paths));
 }
 
-void RunSaveDialogInNewThread(const RunState& run_state,
-                              const DialogSettings& settings,
-                              const SaveDialogCallback& callback) {
+void RunSaveDialogOnDialogThread(
+    const scoped_refptr<base::SingleThreadTaskRunner>& ui_task_runner,
+    const DialogSettings& settings,
+    const SaveDialogCallback& callback) {
   base::FilePath path;
   bool result = ShowSaveDialog(settings, &path);
-  run_state.ui_task_runner->PostTask(FROM_HERE,
-                                     base::Bind(callback, result, path));
-  run_state.ui_task_runner->DeleteSoon(FROM_HERE, run_state.dialog_thread);
+  ui_task_runner->PostTask(FROM_HERE, base::Bind(callback, result, path));
 }
 
 }  // namespace
 
+void PrewarmDialogs() {
+  base::Thread* dialog_thread = GetDialogThread();
+  if (dialog_thread) {
+    dialog_thread->task_runner()->PostTask(FROM_HERE,
+                                           base::Bind(&WarmUpDialogState));
+  }
+}
+
 bool ShowOpenDialog(const DialogSettings& settings,
                     std::vector<base::FilePath>* paths) {
   int options = FOS_FORCEFILESYSTEM | FOS_FILEMUSTEXIST;
@@ -227,15 +243,16 @@ bool ShowOpenDialog(const DialogSettings& settings,
 
 void ShowOpenDialog(const DialogSettings& settings,
                     const OpenDialogCallback& callback) {
-  RunState run_state;
-  if (!CreateDialogThread(&run_state)) {
+  base::Thread* dialog_thread = GetDialogThread();
+  if (!dialog_thread) {
     callback.Run(false, std::vector<base::FilePath>());
     return;
   }
 
-  run_state.dialog_thread->task_runner()->PostTask(
+  dialog_thread->task_runner()->PostTask(
       FROM_HERE,
-      base::Bind(&RunOpenDialogInNewThread, run_state, settings, callback));
+      base::Bind(&RunOpenDialogOnDialogThread,
+                 base::ThreadTaskRunnerHandle::Get(), settings, callback));
 }
 
 bool ShowSaveDialog(const DialogSettings& settings,
@@ -256,15 +273,16 @@ bool ShowSaveDialog(const DialogSettings& settings,
 
 void ShowSaveDialog(const DialogSettings& settings,
                     const SaveDialogCallback& callback) {
-  RunState run_state;
-  if (!CreateDialogThread(&run_state)) {
+  base::Thread* dialog_thread = GetDialogThread();
+  if (!dialog_thread) {
     callback.Run(false, base::FilePath());
     return;
   }
 
-  run_state.dialog_thread->task_runner()->PostTask(
+  dialog_thread->task_runner()->PostTask(
       FROM_HERE,
-      base::Bind(&RunSaveDialogInNewThread, run_state, settings, callback));
+      base::Bind(&RunSaveDialogOnDialogThread,
+                 base::ThreadTaskRunnerHandle::Get(), settings, callback));
 }
 
 }  // namespace file_dialog
@@ -172,7 +172,7 @@ class GtkMessageBox : public NativeWindowObserver {
   CHROMEGTK_CALLBACK_0(GtkMessageBox, void, OnCheckboxToggled);
 
  private:
-  atom::UnresponsiveSuppressor unresponsive_suppressor_;
+  atom::UnresponsiveSuppressor unresponsive_suppressor_{"message-box"};
 
   // The id to return when the dialog is closed without pressing buttons.
   int cancel_id_;
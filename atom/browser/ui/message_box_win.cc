@@ -238,7 +238,7 @@ int ShowMessageBox(NativeWindow* parent,
                    const std::string& message,
                    const std::string& detail,
                    const gfx::ImageSkia& icon) {
-  atom::UnresponsiveSuppressor suppressor;
+  atom::UnresponsiveSuppressor suppressor("message-box");
   return ShowTaskDialogUTF8(parent, type, buttons, default_id, cancel_id,
                             options, title, message, detail, "", nullptr, icon);
 }
@@ -274,7 +274,7 @@ void ShowMessageBox(NativeWindow* parent,
 }
 
 void ShowErrorBox(const base::string16& title, const base::string16& content) {
-  atom::UnresponsiveSuppressor suppressor;
+  atom::UnresponsiveSuppressor suppressor("message-box");
   ShowTaskDialogUTF16(nullptr, MESSAGE_BOX_TYPE_ERROR, {}, -1, 0, 0, L"Error",
                       title, content, L"", nullptr, gfx::ImageSkia());
 }
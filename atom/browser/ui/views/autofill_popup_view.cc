@@ -5,6 +5,7 @@
 #include "atom/browser/ui/views/autofill_popup_view.h"
 #include "base/bind.h"
 #include "base/i18n/rtl.h"
+#include "content/public/browser/browser_accessibility_state.h"
 #include "content/public/browser/render_view_host.h"
 #include "ui/events/keycodes/keyboard_codes.h"
 #include "ui/gfx/canvas.h"
@@ -129,7 +130,21 @@ void AutofillPopupView::OnSuggestionsChanged() {
 void AutofillPopupView::OnSelectedRowChanged(
     base::Optional<int> previous_row_selection,
     base::Optional<int> current_row_selection) {
-  SchedulePaint();
+  if (!popup_)
+    return;
+
+  if (view_proxy_.get()) {
+    // The offscreen proxy re-uploads the full bitmap, so partial damage
+    // doesn't buy anything there.
+    SchedulePaint();
+  } else {
+    // Only the rows whose selection state changed need repainting.
+    if (previous_row_selection)
+      SchedulePaintInRect(
+          popup_->GetRowBounds(previous_row_selection.value()));
+    if (current_row_selection)
+      SchedulePaintInRect(popup_->GetRowBounds(current_row_selection.value()));
+  }
 
   if (current_row_selection) {
     int selected = current_row_selection.value_or(-1);
@@ -199,6 +214,13 @@ void AutofillPopupView::CreateChildViews() {
 
   RemoveAllChildViews(true);
 
+  // The child views exist solely to mirror rows for accessibility; with
+  // large suggestion lists they dominate popup-open time, so only
+  // materialize them when a screen reader is actually active.
+  if (!content::BrowserAccessibilityState::GetInstance()
+           ->IsAccessibleBrowser())
+    return;
+
   for (int i = 0; i < popup_->GetLineCount(); ++i) {
     auto child_view = new AutofillPopupChildView(popup_->GetValueAt(i));
     child_view->set_drag_controller(this);
@@ -215,7 +237,7 @@ void AutofillPopupView::DoUpdateBoundsAndRedrawPopup() {
 }
 
 void AutofillPopupView::OnPaint(gfx::Canvas* canvas) {
-  if (!popup_ || popup_->GetLineCount() != child_count())
+  if (!popup_)
     return;
   gfx::Canvas* draw_canvas = canvas;
   SkBitmap bitmap;
@@ -231,8 +253,18 @@ void AutofillPopupView::OnPaint(gfx::Canvas* canvas) {
       ui::NativeTheme::kColorId_ResultsTableNormalBackground));
   OnPaintBorder(draw_canvas);
 
+  // Only draw the rows that intersect the damaged region, so a selection
+  // change repaints two rows instead of the whole list. Rows are laid out
+  // top to bottom, so we can stop at the first one past the clip.
+  gfx::Rect clip_rect;
+  draw_canvas->GetClipBounds(&clip_rect);
+
   for (int i = 0; i < popup_->GetLineCount(); ++i) {
     gfx::Rect line_rect = popup_->GetRowBounds(i);
+    if (line_rect.y() >= clip_rect.bottom())
+      break;
+    if (!clip_rect.Intersects(line_rect))
+      continue;
 
     DrawAutofillEntry(draw_canvas, i, line_rect);
   }
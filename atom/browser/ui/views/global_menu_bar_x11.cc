@@ -19,6 +19,7 @@
 
 #include "atom/browser/native_window_views.h"
 #include "atom/browser/ui/atom_menu_model.h"
+#include "base/bind.h"
 #include "base/logging.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
@@ -54,6 +55,15 @@ typedef DbusmenuMenuitem* (*dbusmenu_menuitem_property_set_int_func)(
     DbusmenuMenuitem* item,
     const char* property,
     int value);
+typedef const char* (*dbusmenu_menuitem_property_get_func)(
+    DbusmenuMenuitem* item,
+    const char* property);
+typedef bool (*dbusmenu_menuitem_property_get_bool_func)(
+    DbusmenuMenuitem* item,
+    const char* property);
+typedef int (*dbusmenu_menuitem_property_get_int_func)(
+    DbusmenuMenuitem* item,
+    const char* property);
 
 typedef struct _DbusmenuServer      DbusmenuServer;
 typedef DbusmenuServer* (*dbusmenu_server_new_func)(const char* object);
@@ -78,6 +88,9 @@ dbusmenu_menuitem_property_set_variant_func menuitem_property_set_variant =
     NULL;
 dbusmenu_menuitem_property_set_bool_func menuitem_property_set_bool = NULL;
 dbusmenu_menuitem_property_set_int_func menuitem_property_set_int = NULL;
+dbusmenu_menuitem_property_get_func menuitem_property_get = NULL;
+dbusmenu_menuitem_property_get_bool_func menuitem_property_get_bool = NULL;
+dbusmenu_menuitem_property_get_int_func menuitem_property_get_int = NULL;
 
 // DbusmenuServer methods:
 dbusmenu_server_new_func server_new = NULL;
@@ -98,6 +111,10 @@ const char kToggleRadio[] = "radio";
 const char kTypeSeparator[] = "separator";
 const char kDisplaySubmenu[] = "submenu";
 
+// How long to wait before exporting after a menu change; rapid successive
+// SetMenu calls collapse into one D-Bus update.
+const int kMenuUpdateDebounceMs = 50;
+
 void EnsureMethodsLoaded() {
   static bool attempted_load = false;
   if (attempted_load)
@@ -135,6 +152,15 @@ void EnsureMethodsLoaded() {
   menuitem_property_set_int =
       reinterpret_cast<dbusmenu_menuitem_property_set_int_func>(
           dlsym(dbusmenu_lib, "dbusmenu_menuitem_property_set_int"));
+  menuitem_property_get =
+      reinterpret_cast<dbusmenu_menuitem_property_get_func>(
+          dlsym(dbusmenu_lib, "dbusmenu_menuitem_property_get"));
+  menuitem_property_get_bool =
+      reinterpret_cast<dbusmenu_menuitem_property_get_bool_func>(
+          dlsym(dbusmenu_lib, "dbusmenu_menuitem_property_get_bool"));
+  menuitem_property_get_int =
+      reinterpret_cast<dbusmenu_menuitem_property_get_int_func>(
+          dlsym(dbusmenu_lib, "dbusmenu_menuitem_property_get_int"));
 
   // DbusmenuServer methods.
   server_new = reinterpret_cast<dbusmenu_server_new_func>(
@@ -170,7 +196,9 @@ void SetMenuItemID(DbusmenuMenuitem* item, int id) {
 GlobalMenuBarX11::GlobalMenuBarX11(NativeWindowViews* window)
     : window_(window),
       xid_(window_->GetNativeWindow()->GetHost()->GetAcceleratedWidget()),
-      server_(NULL) {
+      server_(NULL),
+      root_item_(NULL),
+      pending_model_(NULL) {
   EnsureMethodsLoaded();
   if (server_new)
     InitServer(xid_);
@@ -179,6 +207,8 @@ GlobalMenuBarX11::GlobalMenuBarX11(NativeWindowViews* window)
 }
 
 GlobalMenuBarX11::~GlobalMenuBarX11() {
+  if (root_item_)
+    g_object_unref(root_item_);
   if (IsServerStarted())
     g_object_unref(server_);
 
@@ -194,13 +224,42 @@ void GlobalMenuBarX11::SetMenu(AtomMenuModel* menu_model) {
   if (!IsServerStarted())
     return;
 
+  pending_model_ = menu_model;
+
+  // Export the first menu right away so the menu bar doesn't flash in
+  // late; changes to an already exported menu are debounced, since apps
+  // that toggle many items fire a burst of updates in one go.
+  if (!root_item_) {
+    ApplyPendingMenu();
+    return;
+  }
+
+  menu_update_timer_.Start(
+      FROM_HERE,
+      base::TimeDelta::FromMilliseconds(kMenuUpdateDebounceMs),
+      base::Bind(&GlobalMenuBarX11::ApplyPendingMenu, base::Unretained(this)));
+}
+
+void GlobalMenuBarX11::ApplyPendingMenu() {
+  AtomMenuModel* menu_model = pending_model_;
+  if (!menu_model || !IsServerStarted())
+    return;
+
+  // When the menu shape is unchanged, patch the exported items in place;
+  // only the properties that actually differ then go over the bus.
+  if (root_item_ && UpdateMenuFromModel(menu_model, root_item_))
+    return;
+
   DbusmenuMenuitem* root_item = menuitem_new();
   menuitem_property_set(root_item, kPropertyLabel, "Root");
   menuitem_property_set_bool(root_item, kPropertyVisible, true);
   BuildMenuFromModel(menu_model, root_item);
 
   server_set_root(server_, root_item);
-  g_object_unref(root_item);
+  if (root_item_)
+    g_object_unref(root_item_);
+  // Keep a reference so the next export can diff against it.
+  root_item_ = root_item;
 }
 
 bool GlobalMenuBarX11::IsServerStarted() const {
@@ -265,6 +324,85 @@ void GlobalMenuBarX11::BuildMenuFromModel(AtomMenuModel* model,
   }
 }
 
+bool GlobalMenuBarX11::UpdateMenuFromModel(AtomMenuModel* model,
+                                           DbusmenuMenuitem* parent) {
+  if (!menuitem_property_get || !menuitem_property_get_bool ||
+      !menuitem_property_get_int)
+    return false;
+
+  // The list is owned by |parent|; don't free it.
+  GList* children = menuitem_get_children(parent);
+  if (static_cast<int>(g_list_length(children)) != model->GetItemCount())
+    return false;
+
+  // First pass: make sure the shape still matches, since items can't
+  // change type in place without re-wiring their signal handlers.
+  int i = 0;
+  for (GList* it = children; it; it = it->next, ++i) {
+    DbusmenuMenuitem* item = static_cast<DbusmenuMenuitem*>(it->data);
+    AtomMenuModel::ItemType type = model->GetTypeAt(i);
+
+    bool was_separator = g_strcmp0(
+        menuitem_property_get(item, kPropertyType), kTypeSeparator) == 0;
+    if (was_separator != (type == AtomMenuModel::TYPE_SEPARATOR))
+      return false;
+
+    bool was_submenu = g_strcmp0(
+        menuitem_property_get(item, kPropertyChildrenDisplay),
+        kDisplaySubmenu) == 0;
+    if (was_submenu != (type == AtomMenuModel::TYPE_SUBMENU))
+      return false;
+
+    const char* toggle_type = menuitem_property_get(item, kPropertyToggleType);
+    const char* new_toggle_type = NULL;
+    if (type == AtomMenuModel::TYPE_CHECK)
+      new_toggle_type = kToggleCheck;
+    else if (type == AtomMenuModel::TYPE_RADIO)
+      new_toggle_type = kToggleRadio;
+    if (g_strcmp0(toggle_type, new_toggle_type) != 0)
+      return false;
+  }
+
+  // Second pass: write the properties that changed. dbusmenu only emits
+  // D-Bus signals for values that actually differ, so untouched items
+  // stay off the bus.
+  i = 0;
+  for (GList* it = children; it; it = it->next, ++i) {
+    DbusmenuMenuitem* item = static_cast<DbusmenuMenuitem*>(it->data);
+
+    bool visible = model->IsVisibleAt(i);
+    if (menuitem_property_get_bool(item, kPropertyVisible) != visible)
+      menuitem_property_set_bool(item, kPropertyVisible, visible);
+
+    AtomMenuModel::ItemType type = model->GetTypeAt(i);
+    if (type == AtomMenuModel::TYPE_SEPARATOR)
+      continue;
+
+    std::string label = ui::ConvertAcceleratorsFromWindowsStyle(
+        base::UTF16ToUTF8(model->GetLabelAt(i)));
+    if (g_strcmp0(menuitem_property_get(item, kPropertyLabel),
+                  label.c_str()) != 0)
+      menuitem_property_set(item, kPropertyLabel, label.c_str());
+
+    bool enabled = model->IsEnabledAt(i);
+    if (menuitem_property_get_bool(item, kPropertyEnabled) != enabled)
+      menuitem_property_set_bool(item, kPropertyEnabled, enabled);
+
+    // The model may be a new object with the same shape; submenus rebuilt
+    // in OnSubMenuShow must pick it up.
+    g_object_set_data(G_OBJECT(item), "model", model);
+
+    if (type == AtomMenuModel::TYPE_CHECK ||
+        type == AtomMenuModel::TYPE_RADIO) {
+      int checked = model->IsItemCheckedAt(i);
+      if (menuitem_property_get_int(item, kPropertyToggleState) != checked)
+        menuitem_property_set_int(item, kPropertyToggleState, checked);
+    }
+  }
+
+  return true;
+}
+
 void GlobalMenuBarX11::RegisterAccelerator(DbusmenuMenuitem* item,
                                            const ui::Accelerator& accelerator) {
   // A translation of libdbusmenu-gtk's menuitem_property_set_shortcut()
@@ -10,6 +10,7 @@
 #include "atom/browser/ui/atom_menu_model.h"
 #include "base/compiler_specific.h"
 #include "base/macros.h"
+#include "base/timer/timer.h"
 #include "ui/base/glib/glib_signal.h"
 #include "ui/gfx/native_widget_types.h"
 
@@ -54,9 +55,17 @@ class GlobalMenuBarX11 {
   // Creates a DbusmenuServer.
   void InitServer(gfx::AcceleratedWidget xid);
 
+  // Exports |pending_model_|, updating the current root in place when the
+  // structure is unchanged so only modified properties go over the bus.
+  void ApplyPendingMenu();
+
   // Create a menu from menu model.
   void BuildMenuFromModel(AtomMenuModel* model, DbusmenuMenuitem* parent);
 
+  // Updates the items under |parent| in place from |model|. Returns false
+  // if the structure diverged and the menu has to be rebuilt instead.
+  bool UpdateMenuFromModel(AtomMenuModel* model, DbusmenuMenuitem* parent);
+
   // Sets the accelerator for |item|.
   void RegisterAccelerator(DbusmenuMenuitem* item,
                            const ui::Accelerator& accelerator);
@@ -70,6 +79,14 @@ class GlobalMenuBarX11 {
 
   DbusmenuServer* server_;
 
+  // The exported root item, kept referenced so later exports can diff
+  // against it.
+  DbusmenuMenuitem* root_item_;
+
+  // Model waiting to be exported when the debounce timer fires.
+  AtomMenuModel* pending_model_;  // weak ref.
+  base::OneShotTimer menu_update_timer_;
+
   DISALLOW_COPY_AND_ASSIGN(GlobalMenuBarX11);
 };
 
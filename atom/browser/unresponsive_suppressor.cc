@@ -4,24 +4,66 @@
 
 #include "atom/browser/unresponsive_suppressor.h"
 
+#include <deque>
+
+#include "base/lazy_instance.h"
+#include "base/synchronization/lock.h"
+
 namespace atom {
 
 namespace {
 
 int g_suppress_level = 0;
 
+// How many finished suppression windows to keep for telemetry.
+const size_t kMaxSuppressionRecords = 64;
+
+// Suppressors are almost always created on the UI thread, but the Windows
+// file dialog runs its modal loop on a dedicated thread, so the record
+// log is guarded by a lock.
+struct SuppressionLog {
+  base::Lock lock;
+  std::deque<SuppressionRecord> records;
+};
+
+base::LazyInstance<SuppressionLog>::Leaky g_suppression_log =
+    LAZY_INSTANCE_INITIALIZER;
+
 }  // namespace
 
 bool IsUnresponsiveEventSuppressed() {
   return g_suppress_level > 0;
 }
 
-UnresponsiveSuppressor::UnresponsiveSuppressor() {
+std::vector<SuppressionRecord> GetRecentSuppressions() {
+  SuppressionLog* log = g_suppression_log.Pointer();
+  base::AutoLock auto_lock(log->lock);
+  return std::vector<SuppressionRecord>(log->records.begin(),
+                                        log->records.end());
+}
+
+UnresponsiveSuppressor::UnresponsiveSuppressor()
+    : UnresponsiveSuppressor("unspecified") {
+}
+
+UnresponsiveSuppressor::UnresponsiveSuppressor(const char* reason)
+    : reason_(reason), start_time_(base::TimeTicks::Now()) {
   g_suppress_level++;
 }
 
 UnresponsiveSuppressor::~UnresponsiveSuppressor() {
   g_suppress_level--;
+
+  SuppressionRecord record;
+  record.reason = reason_;
+  record.start_time = start_time_;
+  record.duration = base::TimeTicks::Now() - start_time_;
+
+  SuppressionLog* log = g_suppression_log.Pointer();
+  base::AutoLock auto_lock(log->lock);
+  log->records.push_back(record);
+  if (log->records.size() > kMaxSuppressionRecords)
+    log->records.pop_front();
 }
 
 }  // namespace atom
@@ -5,18 +5,44 @@
 #ifndef ATOM_BROWSER_UNRESPONSIVE_SUPPRESSOR_H_
 #define ATOM_BROWSER_UNRESPONSIVE_SUPPRESSOR_H_
 
+#include <string>
+#include <vector>
+
 #include "base/macros.h"
+#include "base/time/time.h"
 
 namespace atom {
 
 bool IsUnresponsiveEventSuppressed();
 
+// A finished suppression window, for telemetry. Lets apps tell "was busy
+// in a native modal" apart from a real hang when correlating with their
+// own responsiveness data.
+struct SuppressionRecord {
+  std::string reason;
+  base::TimeTicks start_time;
+  base::TimeDelta duration;
+};
+
+// Returns the most recent suppression windows, oldest first. Only windows
+// that have ended are included; an active suppression is visible through
+// IsUnresponsiveEventSuppressed() instead.
+std::vector<SuppressionRecord> GetRecentSuppressions();
+
+// Mutes unresponsive events for its lifetime; scoping it to a native
+// modal operation extends the suppression for exactly as long as that
+// operation runs. Suppressions nest. The reason tag ends up in the
+// record returned by GetRecentSuppressions().
 class UnresponsiveSuppressor {
  public:
   UnresponsiveSuppressor();
+  explicit UnresponsiveSuppressor(const char* reason);
   ~UnresponsiveSuppressor();
 
  private:
+  const char* reason_;
+  base::TimeTicks start_time_;
+
   DISALLOW_COPY_AND_ASSIGN(UnresponsiveSuppressor);
 };
 
@@ -32,6 +32,9 @@ namespace atom {
 // static
 std::vector<WebContentsPreferences*> WebContentsPreferences::instances_;
 
+// static
+std::map<int, WebContentsPreferences*> WebContentsPreferences::process_index_;
+
 WebContentsPreferences::WebContentsPreferences(
     content::WebContents* web_contents,
     const mate::Dictionary& web_preferences)
@@ -47,27 +50,56 @@ WebContentsPreferences::WebContentsPreferences(
   web_contents->SetUserData(UserDataKey(), this);
 
   instances_.push_back(this);
+  if (web_contents->GetRenderProcessHost()) {
+    process_index_[web_contents->GetRenderProcessHost()->GetID()] = this;
+  }
 }
 
 WebContentsPreferences::~WebContentsPreferences() {
   instances_.erase(
       std::remove(instances_.begin(), instances_.end(), this),
       instances_.end());
+  for (auto iter = process_index_.begin(); iter != process_index_.end();) {
+    if (iter->second == this)
+      iter = process_index_.erase(iter);
+    else
+      ++iter;
+  }
 }
 
 void WebContentsPreferences::Merge(const base::DictionaryValue& extend) {
   web_preferences_.MergeDictionary(&extend);
+  cached_switches_.reset();
 }
 
 // static
 content::WebContents* WebContentsPreferences::GetWebContentsFromProcessID(
     int process_id) {
-  for (WebContentsPreferences* preferences : instances_) {
-    content::WebContents* web_contents = preferences->web_contents_;
+  auto iter = process_index_.find(process_id);
+  if (iter != process_index_.end()) {
+    content::WebContents* web_contents = iter->second->web_contents_;
     if (web_contents->GetRenderProcessHost()->GetID() == process_id)
       return web_contents;
   }
-  return nullptr;
+
+  // Either no entry or the WebContents has swapped to another process since
+  // the index was built; rebuild it and look again.
+  RebuildProcessIndex();
+  iter = process_index_.find(process_id);
+  if (iter == process_index_.end())
+    return nullptr;
+  return iter->second->web_contents_;
+}
+
+// static
+void WebContentsPreferences::RebuildProcessIndex() {
+  process_index_.clear();
+  for (WebContentsPreferences* preferences : instances_) {
+    content::RenderProcessHost* host =
+        preferences->web_contents_->GetRenderProcessHost();
+    if (host)
+      process_index_[host->GetID()] = preferences;
+  }
 }
 
 // static
@@ -77,7 +109,41 @@ void WebContentsPreferences::AppendExtraCommandLineSwitches(
   if (!self)
     return;
 
-  base::DictionaryValue& web_preferences = self->web_preferences_;
+  // The bulk of the switches only depend on the stored preferences, so
+  // they are formatted once and copied per launch.
+  if (!self->cached_switches_)
+    self->RebuildCommandLineSwitches();
+  command_line->AppendArguments(*self->cached_switches_, false);
+
+  // --guest-instance-id, and with it the hidden-page switch, depend on the
+  // embedder window's current visibility, so they stay per launch.
+  int guest_instance_id = 0;
+  if (self->web_preferences_.GetInteger(options::kGuestInstanceID,
+                                        &guest_instance_id) &&
+      guest_instance_id) {
+    // Webview `document.visibilityState` tracks window visibility so we need
+    // to let it know if the window happens to be hidden right now.
+    auto manager = WebViewManager::GetWebViewManager(web_contents);
+    if (manager) {
+      auto embedder = manager->GetEmbedder(guest_instance_id);
+      if (embedder) {
+        auto window = NativeWindow::FromWebContents(embedder);
+        if (window) {
+          const bool visible = window->IsVisible() && !window->IsMinimized();
+          if (!visible) {
+            command_line->AppendSwitch(switches::kHiddenPage);
+          }
+        }
+      }
+    }
+  }
+}
+
+void WebContentsPreferences::RebuildCommandLineSwitches() {
+  cached_switches_.reset(
+      new base::CommandLine(base::CommandLine::NO_PROGRAM));
+  base::CommandLine* command_line = cached_switches_.get();
+  base::DictionaryValue& web_preferences = web_preferences_;
 
   bool b;
   // Check if plugins are enabled.
@@ -101,6 +167,10 @@ void WebContentsPreferences::AppendExtraCommandLineSwitches(
   if (web_preferences.GetBoolean(options::kNodeIntegrationInWorker, &b) && b)
     command_line->AppendSwitch(switches::kNodeIntegrationInWorker);
 
+  // Whether to defer node bootstrap until the page first uses node.
+  if (web_preferences.GetBoolean(options::kLazyNodeIntegration, &b) && b)
+    command_line->AppendSwitch(switches::kLazyNodeIntegration);
+
   // Check if webview tag creation is enabled, default to nodeIntegration value.
   // TODO(kevinsawicki): Default to false in 2.0
   bool webview_tag = node_integration;
@@ -111,7 +181,7 @@ void WebContentsPreferences::AppendExtraCommandLineSwitches(
   // If the `sandbox` option was passed to the BrowserWindow's webPreferences,
   // pass `--enable-sandbox` to the renderer so it won't have any node.js
   // integration.
-  if (IsSandboxed(web_contents))
+  if (IsSandboxed(web_contents_))
     command_line->AppendSwitch(switches::kEnableSandbox);
   if (web_preferences.GetBoolean("nativeWindowOpen", &b) && b)
     command_line->AppendSwitch(switches::kNativeWindowOpen);
@@ -185,24 +255,6 @@ void WebContentsPreferences::AppendExtraCommandLineSwitches(
                                 &disable_blink_features))
     command_line->AppendSwitchASCII(::switches::kDisableBlinkFeatures,
                                     disable_blink_features);
-
-  if (guest_instance_id) {
-    // Webview `document.visibilityState` tracks window visibility so we need
-    // to let it know if the window happens to be hidden right now.
-    auto manager = WebViewManager::GetWebViewManager(web_contents);
-    if (manager) {
-      auto embedder = manager->GetEmbedder(guest_instance_id);
-      if (embedder) {
-        auto window = NativeWindow::FromWebContents(embedder);
-        if (window) {
-          const bool visible = window->IsVisible() && !window->IsMinimized();
-          if (!visible) {
-            command_line->AppendSwitch(switches::kHiddenPage);
-          }
-        }
-      }
-    }
-  }
 }
 
 bool WebContentsPreferences::IsPreferenceEnabled(
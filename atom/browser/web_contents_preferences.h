@@ -5,6 +5,8 @@
 #ifndef ATOM_BROWSER_WEB_CONTENTS_PREFERENCES_H_
 #define ATOM_BROWSER_WEB_CONTENTS_PREFERENCES_H_
 
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -61,11 +63,28 @@ class WebContentsPreferences
  private:
   friend class content::WebContentsUserData<WebContentsPreferences>;
 
+  // Rebuilds |process_index_| from |instances_|, dropping stale entries.
+  static void RebuildProcessIndex();
+
+  // Rebuilds |cached_switches_| from |web_preferences_|.
+  void RebuildCommandLineSwitches();
+
   static std::vector<WebContentsPreferences*> instances_;
 
+  // Index of instances by the ID of their current render process, so lookups
+  // by process ID don't have to walk |instances_|. Entries can go stale when
+  // a WebContents swaps processes; lookups detect that and rebuild.
+  static std::map<int, WebContentsPreferences*> process_index_;
+
   content::WebContents* web_contents_;
   base::DictionaryValue web_preferences_;
 
+  // The renderer switches derived from |web_preferences_|, formatted once
+  // and copied into each renderer launch. Reset when the preferences
+  // change; null means it needs rebuilding. Switches that depend on
+  // runtime state (window visibility) are appended per launch instead.
+  std::unique_ptr<base::CommandLine> cached_switches_;
+
   // Get preferences value as integer possibly coercing it from a string
   bool GetInteger(const std::string& attributeName, int* intValue);
 
@@ -4,6 +4,7 @@
 
 #include "atom/browser/web_contents_zoom_controller.h"
 
+#include "atom/browser/host_zoom_index.h"
 #include "content/public/browser/navigation_details.h"
 #include "content/public/browser/navigation_entry.h"
 #include "content/public/browser/navigation_handle.h"
@@ -208,8 +209,10 @@ void WebContentsZoomController::ResetZoomModeOnNavigationIfNeeded(
   content::HostZoomMap* zoom_map =
       content::HostZoomMap::GetForWebContents(web_contents());
   zoom_level_ = zoom_map->GetDefaultZoomLevel();
-  double new_zoom_level = zoom_map->GetZoomLevelForHostAndScheme(
-      url.scheme(), net::GetHostOrSpecFromURL(url));
+  double new_zoom_level =
+      HostZoomIndex::GetForHostZoomMap(zoom_map)
+          ->Lookup(url.scheme(), net::GetHostOrSpecFromURL(url))
+          .level;
   for (Observer& observer : observers_)
     observer.OnZoomLevelChanged(web_contents(), new_zoom_level,
       false);
@@ -272,8 +275,10 @@ void WebContentsZoomController::SetZoomFactorOnNavigationIfNeeded(
   std::string scheme = url.scheme();
   double zoom_factor = GetDefaultZoomFactor();
   double zoom_level = content::ZoomFactorToZoomLevel(zoom_factor);
-  if (host_zoom_map_->HasZoomLevel(scheme, host)) {
-    zoom_level = host_zoom_map_->GetZoomLevelForHostAndScheme(scheme, host);
+  const HostZoomIndex::Entry& entry =
+      HostZoomIndex::GetForHostZoomMap(host_zoom_map_)->Lookup(scheme, host);
+  if (entry.has_host_level) {
+    zoom_level = entry.level;
   }
   if (content::ZoomValuesEqual(zoom_level, GetZoomLevel()))
     return;
@@ -4,6 +4,7 @@
 
 #include "atom/browser/web_dialog_helper.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -13,6 +14,8 @@
 #include "base/bind.h"
 #include "base/files/file_enumerator.h"
 #include "base/files/file_path.h"
+#include "base/lazy_instance.h"
+#include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "chrome/common/pref_names.h"
 #include "components/prefs/pref_service.h"
@@ -112,11 +115,18 @@ class FileSelectHelper : public base::RefCounted<FileSelectHelper>,
   content::FileChooserParams::Mode mode_;
 };
 
-file_dialog::Filters GetFileTypesFromAcceptType(
+// Parsed filter lists keyed by the joined accept attribute, so pickers
+// repeatedly activated with identical accept sets skip the MIME registry
+// lookups below. Only used on the UI thread.
+using FilterCache = std::map<base::string16, file_dialog::Filters>;
+base::LazyInstance<FilterCache>::Leaky g_filter_cache =
+    LAZY_INSTANCE_INITIALIZER;
+
+const size_t kMaxCachedFilterSets = 32;
+
+file_dialog::Filters ParseFileTypesFromAcceptType(
     const std::vector<base::string16>& accept_types) {
   file_dialog::Filters filters;
-  if (accept_types.empty())
-    return filters;
 
   std::vector<base::FilePath::StringType> extensions;
 
@@ -150,6 +160,41 @@ file_dialog::Filters GetFileTypesFromAcceptType(
   return filters;
 }
 
+file_dialog::Filters GetFileTypesFromAcceptType(
+    const std::vector<base::string16>& accept_types) {
+  if (accept_types.empty())
+    return file_dialog::Filters();
+
+  base::string16 key =
+      base::JoinString(accept_types, base::ASCIIToUTF16(","));
+  FilterCache* cache = g_filter_cache.Pointer();
+  auto iter = cache->find(key);
+  if (iter != cache->end())
+    return iter->second;
+
+  file_dialog::Filters filters = ParseFileTypesFromAcceptType(accept_types);
+  if (cache->size() >= kMaxCachedFilterSets)
+    cache->clear();
+  (*cache)[key] = filters;
+  return filters;
+}
+
+// GetExtensionsForMimeType lazily initializes the platform MIME mappings the
+// first time it runs; parsing the common wildcard types when the window is
+// created moves that cost off the first picker activation.
+void WarmFilterParsing() {
+  static bool warmed = false;
+  if (warmed)
+    return;
+  warmed = true;
+
+  std::vector<base::FilePath::StringType> extensions;
+  net::GetExtensionsForMimeType("image/*", &extensions);
+  net::GetExtensionsForMimeType("audio/*", &extensions);
+  net::GetExtensionsForMimeType("video/*", &extensions);
+  net::GetExtensionsForMimeType("text/*", &extensions);
+}
+
 }  // namespace
 
 namespace atom {
@@ -157,6 +202,7 @@ namespace atom {
 WebDialogHelper::WebDialogHelper(NativeWindow* window)
     : window_(window),
       weak_factory_(this) {
+  WarmFilterParsing();
 }
 
 WebDialogHelper::~WebDialogHelper() {
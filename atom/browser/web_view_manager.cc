@@ -4,6 +4,8 @@
 
 #include "atom/browser/web_view_manager.h"
 
+#include <algorithm>
+
 #include "atom/browser/atom_browser_context.h"
 #include "content/public/browser/render_process_host.h"
 #include "content/public/browser/web_contents.h"
@@ -21,25 +23,37 @@ void WebViewManager::AddGuest(int guest_instance_id,
                               content::WebContents* embedder,
                               content::WebContents* web_contents) {
   web_contents_embedder_map_[guest_instance_id] = { web_contents, embedder };
+  embedder_guests_map_[embedder].push_back(web_contents);
 
   // Map the element in embedder to guest.
   int owner_process_id = embedder->GetRenderProcessHost()->GetID();
   ElementInstanceKey key(owner_process_id, element_instance_id);
   element_instance_id_to_guest_map_[key] = guest_instance_id;
+  guest_to_element_map_.insert(std::make_pair(guest_instance_id, key));
 }
 
 void WebViewManager::RemoveGuest(int guest_instance_id) {
   if (!base::ContainsKey(web_contents_embedder_map_, guest_instance_id))
     return;
 
+  const auto& record = web_contents_embedder_map_[guest_instance_id];
+  auto embedder_iter = embedder_guests_map_.find(record.embedder);
+  if (embedder_iter != embedder_guests_map_.end()) {
+    auto& guests = embedder_iter->second;
+    guests.erase(
+        std::remove(guests.begin(), guests.end(), record.web_contents),
+        guests.end());
+    if (guests.empty())
+      embedder_guests_map_.erase(embedder_iter);
+  }
   web_contents_embedder_map_.erase(guest_instance_id);
 
   // Remove the record of element in embedder too.
-  for (const auto& element : element_instance_id_to_guest_map_)
-    if (element.second == guest_instance_id) {
-      element_instance_id_to_guest_map_.erase(element.first);
-      break;
-    }
+  auto element_iter = guest_to_element_map_.find(guest_instance_id);
+  if (element_iter != guest_to_element_map_.end()) {
+    element_instance_id_to_guest_map_.erase(element_iter->second);
+    guest_to_element_map_.erase(element_iter);
+  }
 }
 
 content::WebContents* WebViewManager::GetEmbedder(int guest_instance_id) {
@@ -63,11 +77,26 @@ content::WebContents* WebViewManager::GetGuestByInstanceID(
     return nullptr;
 }
 
+void WebViewManager::SetGuestsVisibility(content::WebContents* embedder,
+                                         bool visible) {
+  auto iter = embedder_guests_map_.find(embedder);
+  if (iter == embedder_guests_map_.end())
+    return;
+  for (content::WebContents* guest : iter->second) {
+    if (visible)
+      guest->WasShown();
+    else
+      guest->WasHidden();
+  }
+}
+
 bool WebViewManager::ForEachGuest(content::WebContents* embedder_web_contents,
                                   const GuestCallback& callback) {
-  for (auto& item : web_contents_embedder_map_)
-    if (item.second.embedder == embedder_web_contents &&
-        callback.Run(item.second.web_contents))
+  auto iter = embedder_guests_map_.find(embedder_web_contents);
+  if (iter == embedder_guests_map_.end())
+    return false;
+  for (content::WebContents* guest : iter->second)
+    if (callback.Run(guest))
       return true;
   return false;
 }
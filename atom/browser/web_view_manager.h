@@ -6,6 +6,7 @@
 #define ATOM_BROWSER_WEB_VIEW_MANAGER_H_
 
 #include <map>
+#include <vector>
 
 #include "content/public/browser/browser_plugin_guest_manager.h"
 
@@ -23,6 +24,10 @@ class WebViewManager : public content::BrowserPluginGuestManager {
   void RemoveGuest(int guest_instance_id);
   content::WebContents* GetEmbedder(int guest_instance_id);
 
+  // Shows or hides all guests attached to |embedder| in one call, using the
+  // per-embedder index instead of issuing a lookup per guest.
+  void SetGuestsVisibility(content::WebContents* embedder, bool visible);
+
   static WebViewManager* GetWebViewManager(content::WebContents* web_contents);
 
  protected:
@@ -62,6 +67,16 @@ class WebViewManager : public content::BrowserPluginGuestManager {
   // (embedder_process_id, element_instance_id) => guest_instance_id
   std::map<ElementInstanceKey, int> element_instance_id_to_guest_map_;
 
+  // guest_instance_id => element key, so RemoveGuest does not have to scan
+  // |element_instance_id_to_guest_map_|.
+  std::map<int, ElementInstanceKey> guest_to_element_map_;
+
+  // embedder => attached guests, built at attach time so routing events to
+  // an embedder's guests is an indexed walk instead of a scan over every
+  // guest in the process.
+  std::map<content::WebContents*, std::vector<content::WebContents*>>
+      embedder_guests_map_;
+
   DISALLOW_COPY_AND_ASSIGN(WebViewManager);
 };
 
@@ -28,20 +28,35 @@ WindowList* WindowList::GetInstance() {
 
 // static
 WindowList::WindowVector WindowList::GetWindows() {
+  return *GetInstance()->windows_;
+}
+
+// static
+std::shared_ptr<const WindowList::WindowVector>
+WindowList::GetWindowsSnapshot() {
   return GetInstance()->windows_;
 }
 
+// static
+int WindowList::GetVersion() {
+  return GetInstance()->version_;
+}
+
 // static
 bool WindowList::IsEmpty() {
-  return GetInstance()->windows_.empty();
+  return GetInstance()->windows_->empty();
 }
 
 // static
 void WindowList::AddWindow(NativeWindow* window) {
   DCHECK(window);
-  // Push |window| on the appropriate list instance.
-  WindowVector& windows = GetInstance()->windows_;
-  windows.push_back(window);
+  // Install a new snapshot with |window| appended; snapshots held by readers
+  // keep the old vector alive.
+  WindowList* instance = GetInstance();
+  auto windows = std::make_shared<WindowVector>(*instance->windows_);
+  windows->push_back(window);
+  instance->windows_ = std::move(windows);
+  ++instance->version_;
 
   for (WindowListObserver& observer : observers_.Get())
     observer.OnWindowAdded(window);
@@ -49,14 +64,17 @@ void WindowList::AddWindow(NativeWindow* window) {
 
 // static
 void WindowList::RemoveWindow(NativeWindow* window) {
-  WindowVector& windows = GetInstance()->windows_;
-  windows.erase(std::remove(windows.begin(), windows.end(), window),
-                windows.end());
+  WindowList* instance = GetInstance();
+  auto windows = std::make_shared<WindowVector>(*instance->windows_);
+  windows->erase(std::remove(windows->begin(), windows->end(), window),
+                 windows->end());
+  instance->windows_ = std::move(windows);
+  ++instance->version_;
 
   for (WindowListObserver& observer : observers_.Get())
     observer.OnWindowRemoved(window);
 
-  if (windows.empty()) {
+  if (instance->windows_->empty()) {
     for (WindowListObserver& observer : observers_.Get())
       observer.OnWindowAllClosed();
   }
@@ -80,20 +98,21 @@ void WindowList::RemoveObserver(WindowListObserver* observer) {
 
 // static
 void WindowList::CloseAllWindows() {
-  WindowVector windows = GetInstance()->windows_;
-  for (const auto& window : windows)
+  // The snapshot stays valid while Close() mutates the live list.
+  auto windows = GetWindowsSnapshot();
+  for (const auto& window : *windows)
     if (!window->IsClosed())
       window->Close();
 }
 
 // static
 void WindowList::DestroyAllWindows() {
-  WindowVector windows = GetInstance()->windows_;
-  for (const auto& window : windows)
+  auto windows = GetWindowsSnapshot();
+  for (const auto& window : *windows)
     window->CloseContents(nullptr);  // e.g. Destroy()
 }
 
-WindowList::WindowList() {
+WindowList::WindowList() : windows_(std::make_shared<WindowVector>()) {
 }
 
 WindowList::~WindowList() {
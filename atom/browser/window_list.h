@@ -5,6 +5,7 @@
 #ifndef ATOM_BROWSER_WINDOW_LIST_H_
 #define ATOM_BROWSER_WINDOW_LIST_H_
 
+#include <memory>
 #include <vector>
 
 #include "base/lazy_instance.h"
@@ -21,6 +22,16 @@ class WindowList {
   typedef std::vector<NativeWindow*> WindowVector;
 
   static WindowVector GetWindows();
+
+  // Returns an immutable snapshot of the window list. The underlying vector
+  // is never mutated - adding or removing a window installs a new snapshot -
+  // so holders can iterate it without a copy even while windows come and go.
+  static std::shared_ptr<const WindowVector> GetWindowsSnapshot();
+
+  // Incremented every time a window is added or removed. Callers polling the
+  // list can compare versions to skip work when nothing changed.
+  static int GetVersion();
+
   static bool IsEmpty();
 
   // Adds or removes |window| from the list it is associated with.
@@ -46,8 +57,12 @@ class WindowList {
   WindowList();
   ~WindowList();
 
-  // A vector of the windows in this list, in the order they were added.
-  WindowVector windows_;
+  // The current snapshot of windows in this list, in the order they were
+  // added. Replaced wholesale on every mutation, see GetWindowsSnapshot().
+  std::shared_ptr<const WindowVector> windows_;
+
+  // Bumped on every mutation of |windows_|.
+  int version_ = 0;
 
   // A list of observers which will be notified of every window addition and
   // removal across all WindowLists.
@@ -0,0 +1,34 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_WINDOW_STATE_H_
+#define ATOM_BROWSER_WINDOW_STATE_H_
+
+#include <stdint.h>
+
+#include "ui/gfx/geometry/rect.h"
+
+namespace atom {
+
+// Complete snapshot of a window's restorable state. Capturing and
+// applying it as one unit lets session restore set up a window with a
+// single layout pass instead of a cascade of individual setter calls.
+struct WindowState {
+  // Normal (unmaximized, windowed) bounds in screen coordinates.
+  gfx::Rect bounds;
+
+  // Display the bounds were captured on; -1 when unknown. If the
+  // display no longer exists on restore, the bounds are fitted to the
+  // nearest display instead of being applied blindly.
+  int64_t display_id = -1;
+
+  bool maximized = false;
+  bool minimized = false;
+  bool fullscreen = false;
+  bool always_on_top = false;
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_WINDOW_STATE_H_
@@ -5,6 +5,7 @@
 // Multiply-included file, no traditional include guard.
 
 #include "atom/common/draggable_region.h"
+#include "base/memory/shared_memory_handle.h"
 #include "base/strings/string16.h"
 #include "base/values.h"
 #include "content/public/common/common_param_traits.h"
@@ -26,6 +27,14 @@ IPC_MESSAGE_ROUTED2(AtomViewHostMsg_Message,
                     base::string16 /* channel */,
                     base::ListValue /* arguments */)
 
+// Same as AtomViewHostMsg_Message but the pickled argument list travels in
+// shared memory. Used automatically for payloads above a size threshold so
+// large buffers are not copied through the channel.
+IPC_MESSAGE_ROUTED3(AtomViewHostMsg_Message_Shm,
+                    base::string16 /* channel */,
+                    base::SharedMemoryHandle /* pickled arguments */,
+                    uint32_t /* payload size */)
+
 IPC_SYNC_MESSAGE_ROUTED2_1(AtomViewHostMsg_Message_Sync,
                            base::string16 /* channel */,
                            base::ListValue /* arguments */,
@@ -52,8 +61,19 @@ IPC_MESSAGE_ROUTED1(AtomAutofillFrameMsg_AcceptSuggestion,
 IPC_MESSAGE_ROUTED1(AtomViewHostMsg_UpdateDraggableRegions,
                     std::vector<atom::DraggableRegion> /* regions */)
 
-// Update renderer process preferences.
-IPC_MESSAGE_CONTROL1(AtomMsg_UpdatePreferences, base::ListValue)
+// Replace the renderer process preferences with a full snapshot of entries
+// keyed by entry id.
+IPC_MESSAGE_CONTROL1(AtomMsg_UpdatePreferences, base::DictionaryValue)
+
+// Apply a preferences delta: entries added or changed since the last update,
+// keyed by entry id, and the ids of removed entries.
+IPC_MESSAGE_CONTROL2(AtomMsg_UpdatePreferencesDelta,
+                     base::DictionaryValue /* added */,
+                     base::ListValue /* removed ids */)
+
+// Replace the renderer's content-settings rules. Keys are setting
+// categories; see ContentSettingsManager for the accepted shape.
+IPC_MESSAGE_CONTROL1(AtomMsg_UpdateContentSettings, base::DictionaryValue)
 
 // Sent by renderer to set the temporary zoom level.
 IPC_SYNC_MESSAGE_ROUTED1_1(AtomViewHostMsg_SetTemporaryZoomLevel,
@@ -35,10 +35,14 @@ class Archive : public mate::Wrappable<Archive> {
     mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
         .SetProperty("path", &Archive::GetPath)
         .SetMethod("getFileInfo", &Archive::GetFileInfo)
+        .SetMethod("getFileInfoBatch", &Archive::GetFileInfoBatch)
         .SetMethod("stat", &Archive::Stat)
+        .SetMethod("statBatch", &Archive::StatBatch)
         .SetMethod("readdir", &Archive::Readdir)
+        .SetMethod("readdirBatch", &Archive::ReaddirBatch)
         .SetMethod("realpath", &Archive::Realpath)
         .SetMethod("copyFileOut", &Archive::CopyFileOut)
+        .SetMethod("prefetch", &Archive::Prefetch)
         .SetMethod("getFd", &Archive::GetFD)
         .SetMethod("destroy", &Archive::Destroy);
   }
@@ -82,6 +86,33 @@ class Archive : public mate::Wrappable<Archive> {
     return dict.GetHandle();
   }
 
+  // Resolves many paths in a single binding crossing. The header is
+  // already in memory, so callers that stat thousands of paths pay one
+  // call instead of one per path.
+  v8::Local<v8::Value> GetFileInfoBatch(
+      v8::Isolate* isolate, const std::vector<base::FilePath>& paths) {
+    v8::Local<v8::Array> results = v8::Array::New(isolate, paths.size());
+    for (size_t i = 0; i < paths.size(); ++i)
+      results->Set(static_cast<uint32_t>(i), GetFileInfo(isolate, paths[i]));
+    return results;
+  }
+
+  v8::Local<v8::Value> StatBatch(v8::Isolate* isolate,
+                                 const std::vector<base::FilePath>& paths) {
+    v8::Local<v8::Array> results = v8::Array::New(isolate, paths.size());
+    for (size_t i = 0; i < paths.size(); ++i)
+      results->Set(static_cast<uint32_t>(i), Stat(isolate, paths[i]));
+    return results;
+  }
+
+  v8::Local<v8::Value> ReaddirBatch(
+      v8::Isolate* isolate, const std::vector<base::FilePath>& paths) {
+    v8::Local<v8::Array> results = v8::Array::New(isolate, paths.size());
+    for (size_t i = 0; i < paths.size(); ++i)
+      results->Set(static_cast<uint32_t>(i), Readdir(isolate, paths[i]));
+    return results;
+  }
+
   // Returns all files under a directory.
   v8::Local<v8::Value> Readdir(v8::Isolate* isolate,
                                 const base::FilePath& path) {
@@ -100,6 +131,13 @@ class Archive : public mate::Wrappable<Archive> {
     return mate::ConvertToV8(isolate, realpath);
   }
 
+  // Reads ahead a file, or all files under a directory, into the page cache.
+  bool Prefetch(const base::FilePath& path) {
+    if (!archive_)
+      return false;
+    return archive_->Prefetch(path);
+  }
+
   // Copy the file out into a temporary file and returns the new path.
   v8::Local<v8::Value> CopyFileOut(v8::Isolate* isolate,
                                     const base::FilePath& path) {
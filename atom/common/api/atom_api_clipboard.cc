@@ -4,9 +4,11 @@
 
 #include "atom/common/api/atom_api_clipboard.h"
 
+#include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/image_converter.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "ui/base/clipboard/scoped_clipboard_writer.h"
 
 #include "atom/common/node_includes.h"
@@ -15,6 +17,65 @@ namespace atom {
 
 namespace api {
 
+namespace {
+
+// Materializes only the formats that are actually on the clipboard.
+// Probing availability is cheap while each read is a full clipboard
+// round-trip (an OLE call per format on Windows).
+void ReadManyImpl(const std::vector<std::string>& formats,
+                  ui::ClipboardType type,
+                  const base::Callback<void(v8::Local<v8::Value>)>& callback) {
+  ui::Clipboard* clipboard = ui::Clipboard::GetForCurrentThread();
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  mate::Dictionary result = mate::Dictionary::CreateEmpty(isolate);
+  for (const std::string& format : formats) {
+    if (format == "text") {
+      if (clipboard->IsFormatAvailable(
+              ui::Clipboard::GetPlainTextWFormatType(), type)) {
+        base::string16 text;
+        clipboard->ReadText(type, &text);
+        result.Set(format, text);
+      }
+    } else if (format == "rtf") {
+      if (clipboard->IsFormatAvailable(
+              ui::Clipboard::GetRtfFormatType(), type)) {
+        std::string rtf;
+        clipboard->ReadRTF(type, &rtf);
+        result.Set(format, base::UTF8ToUTF16(rtf));
+      }
+    } else if (format == "html") {
+      if (clipboard->IsFormatAvailable(
+              ui::Clipboard::GetHtmlFormatType(), type)) {
+        base::string16 html;
+        std::string url;
+        uint32_t start;
+        uint32_t end;
+        clipboard->ReadHTML(type, &html, &url, &start, &end);
+        result.Set(format, html.substr(start, end - start));
+      }
+    } else if (format == "image") {
+      if (clipboard->IsFormatAvailable(
+              ui::Clipboard::GetBitmapFormatType(), type)) {
+        result.Set(format, gfx::Image::CreateFrom1xBitmap(
+            clipboard->ReadImage(type)));
+      }
+    } else {
+      ui::Clipboard::FormatType format_type(
+          ui::Clipboard::GetFormatType(format));
+      if (clipboard->IsFormatAvailable(format_type, type)) {
+        std::string data;
+        clipboard->ReadData(format_type, &data);
+        result.Set(format, data);
+      }
+    }
+  }
+  callback.Run(result.GetHandle());
+}
+
+}  // namespace
+
 ui::ClipboardType Clipboard::GetClipboardType(mate::Arguments* args) {
   std::string type;
   if (args->GetNext(&type) && type == "selection")
@@ -46,6 +107,21 @@ std::string Clipboard::Read(const std::string& format_string) {
   return data;
 }
 
+void Clipboard::ReadMany(const std::vector<std::string>& formats,
+                         mate::Arguments* args) {
+  ui::ClipboardType type = GetClipboardType(args);
+  base::Callback<void(v8::Local<v8::Value>)> callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError();
+    return;
+  }
+  // Deferred so a clipboard poll never runs inside the caller's critical
+  // path (e.g. an input event handler); all requested formats are then
+  // gathered in a single pass.
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::Bind(&ReadManyImpl, formats, type, callback));
+}
+
 v8::Local<v8::Value> Clipboard::ReadBuffer(const std::string& format_string,
                                            mate::Arguments* args) {
   std::string data = Read(format_string);
@@ -190,6 +266,7 @@ void Initialize(v8::Local<v8::Object> exports, v8::Local<v8::Value> unused,
   dict.SetMethod("availableFormats", &atom::api::Clipboard::AvailableFormats);
   dict.SetMethod("has", &atom::api::Clipboard::Has);
   dict.SetMethod("read", &atom::api::Clipboard::Read);
+  dict.SetMethod("readMany", &atom::api::Clipboard::ReadMany);
   dict.SetMethod("write", &atom::api::Clipboard::Write);
   dict.SetMethod("readText", &atom::api::Clipboard::ReadText);
   dict.SetMethod("writeText", &atom::api::Clipboard::WriteText);
@@ -25,6 +25,8 @@ class Clipboard {
   static void Clear(mate::Arguments* args);
 
   static std::string Read(const std::string& format_string);
+  static void ReadMany(const std::vector<std::string>& formats,
+                       mate::Arguments* args);
   static void Write(const mate::Dictionary& data, mate::Arguments* args);
 
   static base::string16 ReadText(mate::Arguments* args);
@@ -4,10 +4,12 @@
 
 #include "atom/common/api/atom_api_native_image.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "atom/common/asar/asar_util.h"
+#include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
 #include "atom/common/native_mate_converters/gfx_converter.h"
 #include "atom/common/native_mate_converters/gurl_converter.h"
@@ -15,8 +17,11 @@
 #include "base/files/file_util.h"
 #include "base/strings/pattern.h"
 #include "base/strings/string_util.h"
+#include "base/task_runner_util.h"
+#include "base/threading/worker_pool.h"
 #include "native_mate/object_template_builder.h"
 #include "net/base/data_url.h"
+#include "skia/ext/image_operations.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
 #include "ui/base/layout.h"
 #include "ui/base/webui/web_ui_util.h"
@@ -84,11 +89,79 @@ float GetScaleFactorFromOptions(mate::Arguments* args) {
   return scale_factor;
 }
 
+// Runs on the worker pool; the bitmap's pixel store is refcounted so it
+// crosses threads safely.
+std::unique_ptr<std::vector<unsigned char>> EncodeImageOnWorker(
+    const SkBitmap& bitmap, bool use_jpeg, int quality) {
+  std::unique_ptr<std::vector<unsigned char>> encoded(
+      new std::vector<unsigned char>);
+  if (use_jpeg) {
+    gfx::JPEG1xEncodedDataFromImage(gfx::Image::CreateFrom1xBitmap(bitmap),
+                                    quality, encoded.get());
+  } else {
+    gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false, encoded.get());
+  }
+  return encoded;
+}
+
+void RunEncodeCallback(
+    const base::Callback<void(v8::Local<v8::Value>)>& callback,
+    std::unique_ptr<std::vector<unsigned char>> encoded) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  if (encoded->empty()) {
+    callback.Run(v8::Null(isolate));
+    return;
+  }
+  callback.Run(node::Buffer::Copy(
+      isolate, reinterpret_cast<const char*>(encoded->data()),
+      encoded->size()).ToLocalChecked());
+}
+
+skia::ImageOperations::ResizeMethod ResizeMethodFromOptions(
+    const base::DictionaryValue& options) {
+  skia::ImageOperations::ResizeMethod method =
+      skia::ImageOperations::ResizeMethod::RESIZE_BEST;
+  std::string quality;
+  options.GetString("quality", &quality);
+  if (quality == "fast")
+    // Box filtering goes through skia's SIMD convolver and is the
+    // cheapest filter that still averages every source pixel.
+    method = skia::ImageOperations::ResizeMethod::RESIZE_BOX;
+  else if (quality == "good")
+    method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
+  else if (quality == "better")
+    method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+  return method;
+}
+
+SkBitmap ResizeOnWorker(const SkBitmap& bitmap,
+                        skia::ImageOperations::ResizeMethod method,
+                        const gfx::Size& size) {
+  return skia::ImageOperations::Resize(bitmap, method, size.width(),
+                                       size.height());
+}
+
+void RunResizeCallback(
+    const base::Callback<void(v8::Local<v8::Value>)>& callback,
+    const SkBitmap& resized) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  callback.Run(NativeImage::Create(
+      isolate, gfx::Image::CreateFrom1xBitmap(resized)).ToV8());
+}
+
+// Releases the persistent handle that pins a node::Buffer backing a
+// zero-copy image once skia drops the last reference to the pixels.
+void ReleasePinnedBuffer(void* addr, void* context) {
+  delete static_cast<v8::Global<v8::Value>*>(context);
+}
+
 bool AddImageSkiaRep(gfx::ImageSkia* image,
                      const unsigned char* data,
                      size_t size,
-                     int width,
-                     int height,
                      double scale_factor) {
   std::unique_ptr<SkBitmap> decoded(new SkBitmap());
 
@@ -97,17 +170,8 @@ bool AddImageSkiaRep(gfx::ImageSkia* image,
     // Try JPEG.
     decoded = gfx::JPEGCodec::Decode(data, size);
 
-  if (!decoded) {
-    // Try Bitmap
-    if (width > 0 && height > 0) {
-      decoded.reset(new SkBitmap);
-      decoded->allocN32Pixels(width, height, false);
-      decoded->setPixels(
-        const_cast<void*>(reinterpret_cast<const void*>(data)));
-    } else {
-      return false;
-    }
-  }
+  if (!decoded)
+    return false;
 
   image->AddRepresentation(gfx::ImageSkiaRep(*decoded, scale_factor));
   return true;
@@ -123,7 +187,7 @@ bool AddImageSkiaRep(gfx::ImageSkia* image,
   const unsigned char* data =
       reinterpret_cast<const unsigned char*>(file_contents.data());
   size_t size = file_contents.size();
-  return AddImageSkiaRep(image, data, size, 0, 0, scale_factor);
+  return AddImageSkiaRep(image, data, size, scale_factor);
 }
 
 bool PopulateImageSkiaRepsFromPath(gfx::ImageSkia* image,
@@ -276,6 +340,39 @@ v8::Local<v8::Value> NativeImage::ToPNG(mate::Arguments* args) {
   return node::Buffer::Copy(args->isolate(), data, size).ToLocalChecked();
 }
 
+void NativeImage::ToPNGAsync(mate::Arguments* args) {
+  float scale_factor = GetScaleFactorFromOptions(args);
+  base::Callback<void(v8::Local<v8::Value>)> callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError();
+    return;
+  }
+
+  // The bitmap only shares the refcounted pixel store, so the worker
+  // encodes without keeping this wrappable alive.
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(scale_factor).sk_bitmap();
+  base::PostTaskAndReplyWithResult(
+      base::WorkerPool::GetTaskRunner(true).get(), FROM_HERE,
+      base::Bind(&EncodeImageOnWorker, bitmap, false, 0),
+      base::Bind(&RunEncodeCallback, callback));
+}
+
+void NativeImage::ToJPEGAsync(int quality, mate::Arguments* args) {
+  base::Callback<void(v8::Local<v8::Value>)> callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError();
+    return;
+  }
+
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(1.0f).sk_bitmap();
+  base::PostTaskAndReplyWithResult(
+      base::WorkerPool::GetTaskRunner(true).get(), FROM_HERE,
+      base::Bind(&EncodeImageOnWorker, bitmap, true, quality),
+      base::Bind(&RunEncodeCallback, callback));
+}
+
 v8::Local<v8::Value> NativeImage::ToBitmap(mate::Arguments* args) {
   float scale_factor = GetScaleFactorFromOptions(args);
 
@@ -359,8 +456,7 @@ float NativeImage::GetAspectRatio() {
     return static_cast<float>(size.width()) / static_cast<float>(size.height());
 }
 
-mate::Handle<NativeImage> NativeImage::Resize(
-    v8::Isolate* isolate, const base::DictionaryValue& options) {
+gfx::Size NativeImage::GetResizeSize(const base::DictionaryValue& options) {
   gfx::Size size = GetSize();
   int width = size.width();
   int height = size.height();
@@ -378,21 +474,34 @@ mate::Handle<NativeImage> NativeImage::Resize(
     size = gfx::ScaleToRoundedSize(size, GetAspectRatio(), 1.f);
   }
 
-  skia::ImageOperations::ResizeMethod method =
-      skia::ImageOperations::ResizeMethod::RESIZE_BEST;
-  std::string quality;
-  options.GetString("quality", &quality);
-  if (quality == "good")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
-  else if (quality == "better")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+  return size;
+}
 
+mate::Handle<NativeImage> NativeImage::Resize(
+    v8::Isolate* isolate, const base::DictionaryValue& options) {
   gfx::ImageSkia resized = gfx::ImageSkiaOperations::CreateResizedImage(
-      image_.AsImageSkia(), method, size);
+      image_.AsImageSkia(), ResizeMethodFromOptions(options),
+      GetResizeSize(options));
   return mate::CreateHandle(isolate,
                             new NativeImage(isolate, gfx::Image(resized)));
 }
 
+void NativeImage::ResizeAsync(const base::DictionaryValue& options,
+                              mate::Arguments* args) {
+  base::Callback<void(v8::Local<v8::Value>)> callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError();
+    return;
+  }
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(1.0f).sk_bitmap();
+  base::PostTaskAndReplyWithResult(
+      base::WorkerPool::GetTaskRunner(true).get(), FROM_HERE,
+      base::Bind(&ResizeOnWorker, bitmap, ResizeMethodFromOptions(options),
+                 GetResizeSize(options)),
+      base::Bind(&RunResizeCallback, callback));
+}
+
 mate::Handle<NativeImage> NativeImage::Crop(v8::Isolate* isolate,
                                             const gfx::Rect& rect) {
   gfx::ImageSkia cropped = gfx::ImageSkiaOperations::ExtractSubset(
@@ -504,25 +613,47 @@ mate::Handle<NativeImage> NativeImage::CreateFromBuffer(
     mate::Arguments* args, v8::Local<v8::Value> buffer) {
   int width = 0;
   int height = 0;
+  int row_bytes = 0;
   double scale_factor = 1.;
 
   mate::Dictionary options;
   if (args->GetNext(&options)) {
     options.Get("width", &width);
     options.Get("height", &height);
+    options.Get("rowBytes", &row_bytes);
     options.Get("scaleFactor", &scale_factor);
   } else {
     // TODO(kevinsawicki): Remove in 2.0, deprecate before then with warnings
     args->GetNext(&scale_factor);
   }
 
+  unsigned char* data =
+      reinterpret_cast<unsigned char*>(node::Buffer::Data(buffer));
+  size_t length = node::Buffer::Length(buffer);
+
   gfx::ImageSkia image_skia;
-  AddImageSkiaRep(&image_skia,
-                  reinterpret_cast<unsigned char*>(node::Buffer::Data(buffer)),
-                  node::Buffer::Length(buffer),
-                  width,
-                  height,
-                  scale_factor);
+  if (AddImageSkiaRep(&image_skia, data, length, scale_factor))
+    return Create(args->isolate(), gfx::Image(image_skia));
+
+  if (width <= 0 || height <= 0)
+    return CreateEmpty(args->isolate());
+
+  // Raw bitmap: adopt the buffer's memory instead of copying it. A
+  // persistent handle pins the buffer until skia releases the pixels, so
+  // the bytes stay valid for as long as any copy of the image is alive.
+  if (row_bytes <= 0)
+    row_bytes = width * 4;
+  if (static_cast<size_t>(row_bytes) * height > length)
+    return CreateEmpty(args->isolate());
+
+  SkBitmap bitmap;
+  if (!bitmap.installPixels(SkImageInfo::MakeN32Premul(width, height),
+                            data, row_bytes, nullptr, &ReleasePinnedBuffer,
+                            new v8::Global<v8::Value>(args->isolate(),
+                                                      buffer))) {
+    return CreateEmpty(args->isolate());
+  }
+  image_skia.AddRepresentation(gfx::ImageSkiaRep(bitmap, scale_factor));
   return Create(args->isolate(), gfx::Image(image_skia));
 }
 
@@ -547,6 +678,8 @@ void NativeImage::BuildPrototype(
   mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetMethod("toPNG", &NativeImage::ToPNG)
       .SetMethod("toJPEG", &NativeImage::ToJPEG)
+      .SetMethod("toPNGAsync", &NativeImage::ToPNGAsync)
+      .SetMethod("toJPEGAsync", &NativeImage::ToJPEGAsync)
       .SetMethod("toBitmap", &NativeImage::ToBitmap)
       .SetMethod("getBitmap", &NativeImage::GetBitmap)
       .SetMethod("getNativeHandle", &NativeImage::GetNativeHandle)
@@ -556,6 +689,7 @@ void NativeImage::BuildPrototype(
       .SetMethod("setTemplateImage", &NativeImage::SetTemplateImage)
       .SetMethod("isTemplateImage", &NativeImage::IsTemplateImage)
       .SetMethod("resize", &NativeImage::Resize)
+      .SetMethod("resizeAsync", &NativeImage::ResizeAsync)
       .SetMethod("crop", &NativeImage::Crop)
       .SetMethod("getAspectRatio", &NativeImage::GetAspectRatio)
       .SetMethod("addRepresentation", &NativeImage::AddRepresentation)
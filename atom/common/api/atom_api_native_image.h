@@ -73,6 +73,8 @@ class NativeImage : public mate::Wrappable<NativeImage> {
  private:
   v8::Local<v8::Value> ToPNG(mate::Arguments* args);
   v8::Local<v8::Value> ToJPEG(v8::Isolate* isolate, int quality);
+  void ToPNGAsync(mate::Arguments* args);
+  void ToJPEGAsync(int quality, mate::Arguments* args);
   v8::Local<v8::Value> ToBitmap(mate::Arguments* args);
   v8::Local<v8::Value> GetBitmap(mate::Arguments* args);
   v8::Local<v8::Value> GetNativeHandle(
@@ -80,6 +82,9 @@ class NativeImage : public mate::Wrappable<NativeImage> {
     mate::Arguments* args);
   mate::Handle<NativeImage> Resize(v8::Isolate* isolate,
                                    const base::DictionaryValue& options);
+  void ResizeAsync(const base::DictionaryValue& options,
+                   mate::Arguments* args);
+  gfx::Size GetResizeSize(const base::DictionaryValue& options);
   mate::Handle<NativeImage> Crop(v8::Isolate* isolate,
                                  const gfx::Rect& rect);
   std::string ToDataURL(mate::Arguments* args);
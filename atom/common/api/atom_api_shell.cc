@@ -42,7 +42,7 @@ struct Converter<base::win::ShortcutOperation> {
 
 namespace {
 
-void OnOpenExternalFinished(
+void OnShellOperationFinished(
     v8::Isolate* isolate,
     const base::Callback<void(v8::Local<v8::Value>)>& callback,
     const std::string& error) {
@@ -52,6 +52,31 @@ void OnOpenExternalFinished(
     callback.Run(v8::String::NewFromUtf8(isolate, error.c_str()));
 }
 
+bool ShowItemInFolder(const base::FilePath& full_path,
+                      mate::Arguments* args) {
+  base::Callback<void(v8::Local<v8::Value>)> callback;
+  if (args->GetNext(&callback)) {
+    platform_util::ShowItemInFolder(
+        full_path,
+        base::Bind(&OnShellOperationFinished, args->isolate(), callback));
+    return true;
+  }
+
+  return platform_util::ShowItemInFolder(full_path);
+}
+
+bool OpenItem(const base::FilePath& full_path, mate::Arguments* args) {
+  base::Callback<void(v8::Local<v8::Value>)> callback;
+  if (args->GetNext(&callback)) {
+    platform_util::OpenItem(
+        full_path,
+        base::Bind(&OnShellOperationFinished, args->isolate(), callback));
+    return true;
+  }
+
+  return platform_util::OpenItem(full_path);
+}
+
 bool OpenExternal(
 #if defined(OS_WIN)
     const base::string16& url,
@@ -72,7 +97,7 @@ bool OpenExternal(
     if (args->GetNext(&callback)) {
       platform_util::OpenExternal(
           url, activate,
-          base::Bind(&OnOpenExternalFinished, args->isolate(), callback));
+          base::Bind(&OnShellOperationFinished, args->isolate(), callback));
       return true;
     }
   }
@@ -138,10 +163,11 @@ v8::Local<v8::Value> ReadShortcutLink(mate::Arguments* args,
 void Initialize(v8::Local<v8::Object> exports, v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context, void* priv) {
   mate::Dictionary dict(context->GetIsolate(), exports);
-  dict.SetMethod("showItemInFolder", &platform_util::ShowItemInFolder);
-  dict.SetMethod("openItem", &platform_util::OpenItem);
+  dict.SetMethod("showItemInFolder", &ShowItemInFolder);
+  dict.SetMethod("openItem", &OpenItem);
   dict.SetMethod("openExternal", &OpenExternal);
   dict.SetMethod("moveItemToTrash", &platform_util::MoveItemToTrash);
+  dict.SetMethod("moveItemsToTrash", &platform_util::MoveItemsToTrash);
   dict.SetMethod("beep", &platform_util::Beep);
 #if defined(OS_WIN)
   dict.SetMethod("writeShortcutLink", &WriteShortcutLink);
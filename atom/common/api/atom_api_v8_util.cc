@@ -10,6 +10,7 @@
 #include "atom/common/api/remote_object_freer.h"
 #include "atom/common/native_mate_converters/content_converter.h"
 #include "atom/common/native_mate_converters/gurl_converter.h"
+#include "atom/common/native_mate_converters/v8_value_serializer.h"
 #include "atom/common/node_includes.h"
 #include "base/hash.h"
 #include "native_mate/dictionary.h"
@@ -99,6 +100,28 @@ void RequestGarbageCollectionForTesting(v8::Isolate* isolate) {
     v8::Isolate::GarbageCollectionType::kFullGarbageCollection);
 }
 
+// Structured-clone serialization to a Buffer, for shipping deep object
+// graphs over IPC without going through base::Value.
+v8::Local<v8::Value> Serialize(v8::Isolate* isolate,
+                               v8::Local<v8::Value> value) {
+  std::vector<uint8_t> data;
+  if (!atom::SerializeV8Value(isolate, value, &data))
+    return v8::Local<v8::Value>();
+  return node::Buffer::Copy(isolate,
+                            reinterpret_cast<const char*>(data.data()),
+                            data.size()).ToLocalChecked();
+}
+
+v8::Local<v8::Value> Deserialize(v8::Isolate* isolate,
+                                 v8::Local<v8::Value> buffer) {
+  if (!node::Buffer::HasInstance(buffer))
+    return v8::Local<v8::Value>();
+  const uint8_t* data =
+      reinterpret_cast<const uint8_t*>(node::Buffer::Data(buffer));
+  std::vector<uint8_t> bytes(data, data + node::Buffer::Length(buffer));
+  return atom::DeserializeV8Value(isolate, bytes);
+}
+
 bool IsSameOrigin(const GURL& l, const GURL& r) {
   return url::Origin(l).IsSameOriginWith(url::Origin(r));
 }
@@ -119,6 +142,8 @@ void Initialize(v8::Local<v8::Object> exports, v8::Local<v8::Value> unused,
   dict.SetMethod("requestGarbageCollectionForTesting",
                  &RequestGarbageCollectionForTesting);
   dict.SetMethod("isSameOrigin", &IsSameOrigin);
+  dict.SetMethod("serialize", &Serialize);
+  dict.SetMethod("deserialize", &Deserialize);
 }
 
 }  // namespace
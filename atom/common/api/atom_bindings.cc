@@ -6,15 +6,27 @@
 
 #include <algorithm>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "atom/common/atom_version.h"
+#include "atom/common/event_loop_stats.h"
 #include "atom/common/chrome_version.h"
+#include "atom/common/native_mate_converters/file_path_converter.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/common/node_includes.h"
+#include "base/bind.h"
+#include "base/files/file.h"
+#include "base/files/file_path.h"
 #include "base/logging.h"
+#include "base/synchronization/condition_variable.h"
+#include "base/synchronization/lock.h"
 #include "base/sys_info.h"
+#include "base/threading/thread.h"
+#include "base/threading/thread_restrictions.h"
 #include "native_mate/dictionary.h"
+#include "v8/include/v8-profiler.h"
 
 namespace atom {
 
@@ -23,6 +35,39 @@ namespace {
 // Dummy class type that used for crashing the program.
 struct DummyClass { bool crash; };
 
+// Sampling every 128KB of allocation keeps the overhead negligible while
+// still catching slow leaks within a few minutes.
+const uint64_t kDefaultHeapSampleIntervalBytes = 128 * 1024;
+const int kDefaultHeapSampleStackDepth = 16;
+
+// Converts an allocation profile node into the samplingHeapProfile shape
+// the DevTools frontend understands, so dumps can be loaded there.
+v8::Local<v8::Value> ConvertAllocationNode(
+    v8::Isolate* isolate, v8::AllocationProfile::Node* node) {
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+
+  mate::Dictionary call_frame = mate::Dictionary::CreateEmpty(isolate);
+  call_frame.Set("functionName", node->name);
+  call_frame.Set("scriptId", node->script_id);
+  call_frame.Set("url", node->script_name);
+  call_frame.Set("lineNumber", node->line_number);
+  call_frame.Set("columnNumber", node->column_number);
+  dict.Set("callFrame", call_frame);
+
+  uint64_t self_size = 0;
+  for (const auto& allocation : node->allocations)
+    self_size += allocation.size * allocation.count;
+  dict.Set("selfSize", static_cast<double>(self_size));
+
+  std::vector<v8::Local<v8::Value>> children;
+  children.reserve(node->children.size());
+  for (auto* child : node->children)
+    children.push_back(ConvertAllocationNode(isolate, child));
+  dict.Set("children", children);
+
+  return dict.GetHandle();
+}
+
 // Called when there is a fatal error in V8, we just crash the process here so
 // we can get the stack trace.
 void FatalErrorCallback(const char* location, const char* message) {
@@ -30,6 +75,87 @@ void FatalErrorCallback(const char* location, const char* message) {
   AtomBindings::Crash();
 }
 
+// Large chunks keep the per-chunk callback overhead low; the size of a
+// snapshot is dominated by the JSON itself.
+const int kHeapSnapshotChunkSize = 128 * 1024;
+
+// Cap on snapshot bytes queued for the writer thread; beyond this the
+// serializer waits for the disk to catch up instead of buffering the
+// whole snapshot in memory.
+const size_t kMaxPendingSnapshotBytes = 8 * 1024 * 1024;
+
+// Streams heap snapshot JSON to |file| as v8 serializes it. v8 requires
+// serialization to run on the isolate's thread, so only the blocking file
+// writes move to a helper thread: chunks are handed over as they are
+// produced and the writer drains them while serialization continues.
+class HeapSnapshotFileStream : public v8::OutputStream {
+ public:
+  explicit HeapSnapshotFileStream(base::File file)
+      : file_(std::move(file)),
+        writer_thread_("HeapSnapshotWriter"),
+        pending_bytes_cv_(&lock_),
+        pending_bytes_(0),
+        failed_(false) {
+    writer_thread_.Start();
+  }
+
+  // Blocks until all queued chunks hit the disk, then reports whether
+  // every write succeeded.
+  bool Finish() {
+    writer_thread_.Stop();
+    base::AutoLock auto_lock(lock_);
+    return !failed_;
+  }
+
+  // v8::OutputStream:
+  int GetChunkSize() override { return kHeapSnapshotChunkSize; }
+
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    {
+      base::AutoLock auto_lock(lock_);
+      if (failed_)
+        return kAbort;
+      while (pending_bytes_ > kMaxPendingSnapshotBytes)
+        pending_bytes_cv_.Wait();
+      pending_bytes_ += size;
+    }
+    writer_thread_.task_runner()->PostTask(
+        FROM_HERE, base::Bind(&HeapSnapshotFileStream::WriteChunk,
+                              base::Unretained(this),
+                              std::string(data, size)));
+    return kContinue;
+  }
+
+  void EndOfStream() override {}
+
+ private:
+  void WriteChunk(const std::string& chunk) {
+    bool skip;
+    {
+      base::AutoLock auto_lock(lock_);
+      skip = failed_;
+    }
+    bool ok = skip ||
+        file_.WriteAtCurrentPos(chunk.data(), chunk.size()) ==
+            static_cast<int>(chunk.size());
+    base::AutoLock auto_lock(lock_);
+    if (!ok)
+      failed_ = true;
+    pending_bytes_ -= chunk.size();
+    pending_bytes_cv_.Signal();
+  }
+
+  base::File file_;
+  base::Thread writer_thread_;
+
+  base::Lock lock_;
+  base::ConditionVariable pending_bytes_cv_;
+  size_t pending_bytes_;
+  bool failed_;
+
+  DISALLOW_COPY_AND_ASSIGN(HeapSnapshotFileStream);
+};
+
 }  // namespace
 
 
@@ -56,6 +182,10 @@ void AtomBindings::BindTo(v8::Isolate* isolate,
   dict.SetMethod("getCPUUsage",
       base::Bind(&AtomBindings::GetCPUUsage, base::Unretained(this)));
   dict.SetMethod("getIOCounters", &GetIOCounters);
+  dict.SetMethod("getEventLoopStats", &GetEventLoopStats);
+  dict.SetMethod("startHeapSampling", &StartHeapSampling);
+  dict.SetMethod("stopHeapSampling", &StopHeapSampling);
+  dict.SetMethod("takeHeapSnapshot", &TakeHeapSnapshot);
 #if defined(OS_POSIX)
   dict.SetMethod("setFdLimit", &base::SetFdLimit);
 #endif
@@ -175,6 +305,96 @@ v8::Local<v8::Value> AtomBindings::GetSystemMemoryInfo(v8::Isolate* isolate,
   return dict.GetHandle();
 }
 
+// static
+v8::Local<v8::Value> AtomBindings::GetEventLoopStats(v8::Isolate* isolate) {
+  event_loop_stats::Snapshot snapshot = event_loop_stats::GetSnapshot();
+
+  mate::Dictionary latency = mate::Dictionary::CreateEmpty(isolate);
+  latency.Set("p50", snapshot.latency.p50_ms);
+  latency.Set("p90", snapshot.latency.p90_ms);
+  latency.Set("p99", snapshot.latency.p99_ms);
+  latency.Set("max", snapshot.latency.max_ms);
+  latency.Set("mean", snapshot.latency.mean_ms);
+
+  mate::Dictionary duration = mate::Dictionary::CreateEmpty(isolate);
+  duration.Set("p50", snapshot.duration.p50_ms);
+  duration.Set("p90", snapshot.duration.p90_ms);
+  duration.Set("p99", snapshot.duration.p99_ms);
+  duration.Set("max", snapshot.duration.max_ms);
+  duration.Set("mean", snapshot.duration.mean_ms);
+
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+  dict.Set("tickCount", static_cast<double>(snapshot.tick_count));
+  dict.Set("latency", latency);
+  dict.Set("duration", duration);
+  return dict.GetHandle();
+}
+
+// static
+void AtomBindings::StartHeapSampling(v8::Isolate* isolate,
+                                     mate::Arguments* args) {
+  double sample_interval =
+      static_cast<double>(kDefaultHeapSampleIntervalBytes);
+  int stack_depth = kDefaultHeapSampleStackDepth;
+  args->GetNext(&sample_interval);
+  args->GetNext(&stack_depth);
+
+  if (sample_interval < 1024 || stack_depth < 1) {
+    args->ThrowError("Sample interval must be at least 1024 bytes");
+    return;
+  }
+
+  isolate->GetHeapProfiler()->StartSamplingHeapProfiler(
+      static_cast<uint64_t>(sample_interval), stack_depth);
+}
+
+// static
+v8::Local<v8::Value> AtomBindings::StopHeapSampling(v8::Isolate* isolate,
+                                                    mate::Arguments* args) {
+  v8::HeapProfiler* profiler = isolate->GetHeapProfiler();
+  std::unique_ptr<v8::AllocationProfile> profile(
+      profiler->GetAllocationProfile());
+  if (!profile) {
+    args->ThrowError("Heap sampling has not been started");
+    return v8::Undefined(isolate);
+  }
+  profiler->StopSamplingHeapProfiler();
+
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+  dict.Set("head", ConvertAllocationNode(isolate, profile->GetRootNode()));
+  return dict.GetHandle();
+}
+
+// static
+void AtomBindings::TakeHeapSnapshot(v8::Isolate* isolate,
+                                    const base::FilePath& path,
+                                    mate::Arguments* args) {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  base::File file(path,
+                  base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
+  if (!file.IsValid()) {
+    args->ThrowError("Failed to open " + path.AsUTF8Unsafe() +
+                     " for writing");
+    return;
+  }
+
+  const v8::HeapSnapshot* snapshot =
+      isolate->GetHeapProfiler()->TakeHeapSnapshot();
+  if (!snapshot) {
+    args->ThrowError("Failed to take heap snapshot");
+    return;
+  }
+
+  HeapSnapshotFileStream stream(std::move(file));
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kJSON);
+  bool success = stream.Finish();
+  const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+
+  if (!success)
+    args->ThrowError("Failed to write heap snapshot to " +
+                     path.AsUTF8Unsafe());
+}
+
 v8::Local<v8::Value> AtomBindings::GetCPUUsage(v8::Isolate* isolate) {
   mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
   int processor_count = base::SysInfo::NumberOfProcessors();
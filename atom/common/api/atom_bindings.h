@@ -14,6 +14,10 @@
 #include "v8/include/v8.h"
 #include "vendor/node/deps/uv/include/uv.h"
 
+namespace base {
+class FilePath;
+}
+
 namespace node {
 class Environment;
 }
@@ -40,6 +44,12 @@ class AtomBindings {
       mate::Arguments* args);
   v8::Local<v8::Value> GetCPUUsage(v8::Isolate* isolate);
   static v8::Local<v8::Value> GetIOCounters(v8::Isolate* isolate);
+  static v8::Local<v8::Value> GetEventLoopStats(v8::Isolate* isolate);
+  static void StartHeapSampling(v8::Isolate* isolate, mate::Arguments* args);
+  static v8::Local<v8::Value> StopHeapSampling(v8::Isolate* isolate,
+      mate::Arguments* args);
+  static void TakeHeapSnapshot(v8::Isolate* isolate,
+      const base::FilePath& path, mate::Arguments* args);
 
  private:
   void ActivateUVLoop(v8::Isolate* isolate);
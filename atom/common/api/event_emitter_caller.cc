@@ -14,13 +14,22 @@ namespace internal {
 v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
                                         v8::Local<v8::Object> obj,
                                         const char* method,
-                                        ValueVector* args) {
+                                        size_t argc,
+                                        v8::Local<v8::Value>* argv) {
   // Perform microtask checkpoint after running JavaScript.
   v8::MicrotasksScope script_scope(isolate,
                                    v8::MicrotasksScope::kRunMicrotasks);
   // Use node::MakeCallback to call the callback, and it will also run pending
   // tasks in Node.js.
-  return node::MakeCallback(isolate, obj, method, args->size(), &args->front());
+  return node::MakeCallback(isolate, obj, method, argc, argv);
+}
+
+v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
+                                        v8::Local<v8::Object> obj,
+                                        const char* method,
+                                        ValueVector* args) {
+  return CallMethodWithArgs(isolate, obj, method, args->size(),
+                            &args->front());
 }
 
 }  // namespace internal
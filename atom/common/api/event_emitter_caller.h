@@ -7,6 +7,7 @@
 
 #include <vector>
 
+#include "base/macros.h"
 #include "native_mate/converter.h"
 
 namespace mate {
@@ -15,6 +16,12 @@ namespace internal {
 
 using ValueVector = std::vector<v8::Local<v8::Value>>;
 
+v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
+                                        v8::Local<v8::Object> obj,
+                                        const char* method,
+                                        size_t argc,
+                                        v8::Local<v8::Value>* argv);
+
 v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
                                         v8::Local<v8::Object> obj,
                                         const char* method,
@@ -29,8 +36,9 @@ v8::Local<v8::Value> EmitEvent(v8::Isolate* isolate,
                                v8::Local<v8::Object> obj,
                                const StringType& name,
                                const internal::ValueVector& args) {
-  internal::ValueVector concatenated_args = {StringToV8(isolate, name)};
+  internal::ValueVector concatenated_args;
   concatenated_args.reserve(1 + args.size());
+  concatenated_args.push_back(StringToV8(isolate, name));
   concatenated_args.insert(concatenated_args.end(), args.begin(), args.end());
   return internal::CallMethodWithArgs(isolate, obj, "emit", &concatenated_args);
 }
@@ -42,10 +50,15 @@ v8::Local<v8::Value> EmitEvent(v8::Isolate* isolate,
                                v8::Local<v8::Object> obj,
                                const StringType& name,
                                const Args&... args) {
-  internal::ValueVector converted_args = {
+  // The argument count is known at compile time, so the handles go in a
+  // stack array instead of a heap-allocated vector. Event emission happens
+  // dozens of times per navigation and this path must not allocate.
+  v8::Local<v8::Value> converted_args[] = {
       StringToV8(isolate, name), ConvertToV8(isolate, args)...,
   };
-  return internal::CallMethodWithArgs(isolate, obj, "emit", &converted_args);
+  return internal::CallMethodWithArgs(isolate, obj, "emit",
+                                      arraysize(converted_args),
+                                      converted_args);
 }
 
 // obj.custom_emit(args...)
@@ -54,11 +67,13 @@ v8::Local<v8::Value> CustomEmit(v8::Isolate* isolate,
                                 v8::Local<v8::Object> object,
                                 const char* custom_emit,
                                 const Args&... args) {
-  internal::ValueVector converted_args = {
+  // One extra slot keeps the array legal for zero-argument emissions; the
+  // real count is passed separately.
+  v8::Local<v8::Value> converted_args[sizeof...(args) + 1] = {
       ConvertToV8(isolate, args)...,
   };
   return internal::CallMethodWithArgs(isolate, object, custom_emit,
-                                      &converted_args);
+                                      sizeof...(args), converted_args);
 }
 
 }  // namespace mate
@@ -7,7 +7,12 @@
 namespace mate {
 
 Locker::Locker(v8::Isolate* isolate) {
-  if (IsBrowserProcess())
+  // The browser process keeps a v8::Locker alive on the main thread for
+  // the whole lifetime of the JavaScript environment, so when this thread
+  // already owns the lock a nested locker is pure overhead - skip it. A
+  // thread that does not own it (anything off the main thread) still
+  // takes the real lock.
+  if (IsBrowserProcess() && !v8::Locker::IsLocked(isolate))
     locker_.reset(new v8::Locker(isolate));
 }
 
@@ -5,11 +5,25 @@
 
 #include "atom/common/api/object_life_monitor.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "base/bind.h"
 #include "base/message_loop/message_loop.h"
 
 namespace atom {
 
+namespace {
+
+// Monitors whose objects were collected in the current GC cycle, waiting
+// for the bulk second-pass sweep.
+std::vector<ObjectLifeMonitor*>* GetReleasedMonitors() {
+  static auto* released = new std::vector<ObjectLifeMonitor*>;
+  return released;
+}
+
+}  // namespace
+
 ObjectLifeMonitor::ObjectLifeMonitor(v8::Isolate* isolate,
                                      v8::Local<v8::Object> target)
     : target_(isolate, target),
@@ -18,8 +32,14 @@ ObjectLifeMonitor::ObjectLifeMonitor(v8::Isolate* isolate,
 }
 
 ObjectLifeMonitor::~ObjectLifeMonitor() {
-  if (target_.IsEmpty())
+  if (target_.IsEmpty()) {
+    // The object was already collected. If the monitor is deleted before
+    // the sweep runs, it must not be swept again.
+    auto* released = GetReleasedMonitors();
+    released->erase(std::remove(released->begin(), released->end(), this),
+                    released->end());
     return;
+  }
   target_.ClearWeak();
   target_.Reset();
 }
@@ -27,16 +47,29 @@ ObjectLifeMonitor::~ObjectLifeMonitor() {
 // static
 void ObjectLifeMonitor::OnObjectGC(
     const v8::WeakCallbackInfo<ObjectLifeMonitor>& data) {
+  // v8 runs this once per handle during GC; keep it to resetting the
+  // handle and noting the monitor. All notification work happens in one
+  // second-pass sweep per GC cycle, registered by the first release of
+  // the cycle, after the GC itself is done.
   ObjectLifeMonitor* self = data.GetParameter();
   self->target_.Reset();
-  self->RunDestructor();
-  data.SetSecondPassCallback(Free);
+  auto* released = GetReleasedMonitors();
+  released->push_back(self);
+  if (released->size() == 1)
+    data.SetSecondPassCallback(SweepReleased);
 }
 
 // static
-void ObjectLifeMonitor::Free(
+void ObjectLifeMonitor::SweepReleased(
     const v8::WeakCallbackInfo<ObjectLifeMonitor>& data) {
-  delete data.GetParameter();
+  // Second-pass callbacks run after every first-pass callback of the
+  // cycle, so the list holds everything this GC released.
+  std::vector<ObjectLifeMonitor*> released;
+  released.swap(*GetReleasedMonitors());
+  for (ObjectLifeMonitor* monitor : released) {
+    monitor->RunDestructor();
+    delete monitor;
+  }
 }
 
 }  // namespace atom
@@ -20,7 +20,8 @@ class ObjectLifeMonitor {
 
  private:
   static void OnObjectGC(const v8::WeakCallbackInfo<ObjectLifeMonitor>& data);
-  static void Free(const v8::WeakCallbackInfo<ObjectLifeMonitor>& data);
+  static void SweepReleased(
+      const v8::WeakCallbackInfo<ObjectLifeMonitor>& data);
 
   v8::Global<v8::Object> target_;
 
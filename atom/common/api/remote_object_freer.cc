@@ -4,8 +4,14 @@
 
 #include "atom/common/api/remote_object_freer.h"
 
+#include <map>
+#include <vector>
+
 #include "atom/common/api/api_messages.h"
+#include "base/bind.h"
+#include "base/memory/ptr_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "base/values.h"
 #include "content/public/renderer/render_view.h"
 #include "third_party/WebKit/public/web/WebLocalFrame.h"
@@ -30,6 +36,49 @@ content::RenderView* GetCurrentRenderView() {
   return content::RenderView::FromWebView(view);
 }
 
+// Dereference notifications accumulated during a GC cycle, keyed by routing
+// id. A bulk GC of thousands of remote proxies flushes as one message per
+// view instead of one per object.
+std::map<int, std::vector<int>>* GetPendingDereferences() {
+  static std::map<int, std::vector<int>>* pending =
+      new std::map<int, std::vector<int>>;
+  return pending;
+}
+
+void FlushDereferences(int routing_id) {
+  auto* pending = GetPendingDereferences();
+  auto it = pending->find(routing_id);
+  if (it == pending->end())
+    return;
+  std::vector<int> ids = std::move(it->second);
+  pending->erase(it);
+
+  content::RenderView* render_view =
+      content::RenderView::FromRoutingID(routing_id);
+  if (!render_view)
+    return;
+
+  base::string16 channel = base::ASCIIToUTF16("ipc-message");
+  base::ListValue args;
+  args.AppendString("ELECTRON_BROWSER_DEREFERENCE");
+  auto id_list = base::MakeUnique<base::ListValue>();
+  for (int id : ids)
+    id_list->AppendInteger(id);
+  args.Append(std::move(id_list));
+  render_view->Send(
+      new AtomViewHostMsg_Message(routing_id, channel, args));
+}
+
+void ScheduleDereference(int routing_id, int object_id) {
+  auto* pending = GetPendingDereferences();
+  std::vector<int>& ids = (*pending)[routing_id];
+  if (ids.empty()) {
+    base::ThreadTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::Bind(&FlushDereferences, routing_id));
+  }
+  ids.push_back(object_id);
+}
+
 }  // namespace
 
 // static
@@ -53,17 +102,12 @@ RemoteObjectFreer::~RemoteObjectFreer() {
 }
 
 void RemoteObjectFreer::RunDestructor() {
-  content::RenderView* render_view =
-      content::RenderView::FromRoutingID(routing_id_);
-  if (!render_view)
+  if (routing_id_ == MSG_ROUTING_NONE)
     return;
 
-  base::string16 channel = base::ASCIIToUTF16("ipc-message");
-  base::ListValue args;
-  args.AppendString("ELECTRON_BROWSER_DEREFERENCE");
-  args.AppendInteger(object_id_);
-  render_view->Send(
-      new AtomViewHostMsg_Message(render_view->GetRoutingID(), channel, args));
+  // Coalesce with other objects released in the same GC cycle; the batch is
+  // flushed from the task queue once the GC is done.
+  ScheduleDereference(routing_id_, object_id_);
 }
 
 }  // namespace atom
@@ -4,22 +4,39 @@
 
 #include "atom/common/asar/archive.h"
 
+#include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atom/common/asar/scoped_temporary_file.h"
+#include "atom/common/crash_reporter/scoped_crash_key.h"
 #include "base/files/file.h"
 #include "base/files/file_util.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/base_paths.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
+#include "base/md5.h"
+#include "base/memory/ptr_util.h"
+#include "base/path_service.h"
 #include "base/pickle.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
+#include "crypto/sha2.h"
 
 #if defined(OS_WIN)
 #include "atom/node/osfhandle.h"
 #endif
 
+#if defined(OS_POSIX)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace asar {
 
 namespace {
@@ -109,6 +126,67 @@ bool FillFileInfoWithNode(Archive::FileInfo* info,
 
   node->GetBoolean("executable", &info->executable);
 
+  // Optional content hash for tamper detection, verified lazily on first
+  // read instead of hashing the whole archive at startup.
+  const base::DictionaryValue* integrity = nullptr;
+  if (node->GetDictionaryWithoutPathExpansion("integrity", &integrity)) {
+    std::string algorithm;
+    if (integrity->GetString("algorithm", &algorithm) &&
+        algorithm == "SHA256") {
+      integrity->GetString("hash", &info->integrity);
+    }
+  }
+
+  return true;
+}
+
+// Returns true when |data| matches the content hash carried by |info|.
+// Entries without a hash always pass.
+bool ContentHashMatches(const Archive::FileInfo& info,
+                        const base::FilePath& archive_path,
+                        const char* data,
+                        size_t size) {
+  if (info.integrity.empty())
+    return true;
+  std::string hash =
+      crypto::SHA256HashString(base::StringPiece(data, size));
+  if (base::ToLowerASCII(base::HexEncode(hash.data(), hash.size())) !=
+      base::ToLowerASCII(info.integrity)) {
+    LOG(ERROR) << "Integrity check failed for file at offset "
+               << info.offset << " in " << archive_path.value();
+    return false;
+  }
+  return true;
+}
+
+#if defined(OS_POSIX)
+// The extraction cache must never serve content another user could have
+// written, since cached entries may be loaded as native modules. The cache
+// lives under the per-user cache directory and is created 0700, but check
+// ownership and permissions anyway in case the path was pre-created.
+bool IsDirectoryOwnedByUser(const base::FilePath& path) {
+  struct stat st;
+  if (lstat(path.value().c_str(), &st) != 0)
+    return false;
+  return S_ISDIR(st.st_mode) && st.st_uid == geteuid() &&
+         (st.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+#endif
+
+// Returns the root directory of the persistent extraction cache, which must
+// be writable only by the current user.
+bool GetExtractCacheRoot(base::FilePath* root) {
+  base::FilePath cache_dir;
+  // Match brightray_paths.h: base::DIR_CACHE is not defined on Windows, the
+  // per-user application data directory takes its place there.
+#if defined(OS_POSIX)
+  if (!PathService::Get(base::DIR_CACHE, &cache_dir))
+    return false;
+#else
+  if (!PathService::Get(base::DIR_APP_DATA, &cache_dir))
+    return false;
+#endif
+  *root = cache_dir.Append(FILE_PATH_LITERAL("electron-asar-cache"));
   return true;
 }
 
@@ -125,7 +203,8 @@ Archive::Archive(const base::FilePath& path)
 #else
       fd_(-1),
 #endif
-      header_size_(0) {
+      header_size_(0),
+      mmap_failed_(false) {
 }
 
 Archive::~Archive() {
@@ -139,6 +218,8 @@ Archive::~Archive() {
 }
 
 bool Archive::Init() {
+  TRACE_EVENT1("electron", "Archive::Init", "path", path_.AsUTF8Unsafe());
+  crash_reporter::ScopedCrashKey asar_key("asar-path", path_.AsUTF8Unsafe());
   if (!file_.IsValid()) {
     if (file_.error_details() != base::File::FILE_ERROR_NOT_FOUND) {
       LOG(WARNING) << "Opening " << path_.value()
@@ -147,6 +228,10 @@ bool Archive::Init() {
     return false;
   }
 
+  base::File::Info archive_info;
+  if (file_.GetInfo(&archive_info))
+    last_modified_ = archive_info.last_modified;
+
   std::vector<char> buf;
   int len;
 
@@ -188,13 +273,78 @@ bool Archive::Init() {
 
   header_size_ = 8 + size;
   header_.reset(static_cast<base::DictionaryValue*>(value.release()));
+  BuildIndex();
   return true;
 }
 
+void Archive::BuildIndex() {
+  AddIndexEntries(std::string(), header_.get());
+  std::sort(index_.begin(), index_.end(),
+            [](const IndexEntry& a, const IndexEntry& b) {
+              return a.path < b.path;
+            });
+}
+
+void Archive::AddIndexEntries(const std::string& prefix,
+                              const base::DictionaryValue* node) {
+  const base::DictionaryValue* files = nullptr;
+  if (!node->GetDictionaryWithoutPathExpansion("files", &files))
+    return;
+
+  for (base::DictionaryValue::Iterator iter(*files); !iter.IsAtEnd();
+       iter.Advance()) {
+    const base::DictionaryValue* child = nullptr;
+    if (!iter.value().GetAsDictionary(&child))
+      continue;
+
+    IndexEntry entry;
+    entry.path = prefix.empty() ? iter.key() : prefix + "/" + iter.key();
+    if (child->GetStringWithoutPathExpansion("link", &entry.link)) {
+      entry.stats.is_file = false;
+      entry.stats.is_link = true;
+    } else if (child->HasKey("files")) {
+      entry.stats.is_file = false;
+      entry.stats.is_directory = true;
+      AddIndexEntries(entry.path, child);
+    } else {
+      FillFileInfoWithNode(&entry.stats, header_size_, child);
+    }
+    index_.push_back(std::move(entry));
+  }
+}
+
+const Archive::IndexEntry* Archive::FindIndexEntry(std::string path) const {
+#if defined(OS_WIN)
+  std::replace(path.begin(), path.end(), '\\', '/');
+#endif
+  auto iter = std::lower_bound(index_.begin(), index_.end(), path,
+                               [](const IndexEntry& entry,
+                                  const std::string& path) {
+                                 return entry.path < path;
+                               });
+  if (iter != index_.end() && iter->path == path)
+    return &*iter;
+  return nullptr;
+}
+
 bool Archive::GetFileInfo(const base::FilePath& path, FileInfo* info) {
   if (!header_)
     return false;
 
+  // Fast path: binary search over the flat index. Paths that cross a
+  // symlinked directory are not in the index and fall back to the header
+  // walk below.
+  const IndexEntry* entry = FindIndexEntry(path.AsUTF8Unsafe());
+  if (entry) {
+    if (!entry->link.empty())
+      return GetFileInfo(base::FilePath::FromUTF8Unsafe(entry->link), info);
+    if (entry->stats.is_file) {
+      *info = entry->stats;
+      return true;
+    }
+    return false;
+  }
+
   const base::DictionaryValue* node;
   if (!GetNodeFromPath(path.AsUTF8Unsafe(), header_.get(), &node))
     return false;
@@ -210,6 +360,12 @@ bool Archive::Stat(const base::FilePath& path, Stats* stats) {
   if (!header_)
     return false;
 
+  const IndexEntry* entry = FindIndexEntry(path.AsUTF8Unsafe());
+  if (entry) {
+    *stats = entry->stats;
+    return true;
+  }
+
   const base::DictionaryValue* node;
   if (!GetNodeFromPath(path.AsUTF8Unsafe(), header_.get(), &node))
     return false;
@@ -268,11 +424,53 @@ bool Archive::Realpath(const base::FilePath& path, base::FilePath* realpath) {
   return true;
 }
 
+bool Archive::Prefetch(const base::FilePath& path) {
+  if (!header_)
+    return false;
+
+  std::string prefix = path.AsUTF8Unsafe();
+#if defined(OS_WIN)
+  std::replace(prefix.begin(), prefix.end(), '\\', '/');
+#endif
+
+  // Find the first index entry at or under |prefix| and touch every packed
+  // file in the range, which pulls its pages into the page cache.
+  auto iter = std::lower_bound(index_.begin(), index_.end(), prefix,
+                               [](const IndexEntry& entry,
+                                  const std::string& path) {
+                                 return entry.path < path;
+                               });
+  bool found = false;
+  for (; iter != index_.end(); ++iter) {
+    if (iter->path != prefix &&
+        iter->path.compare(0, prefix.size() + 1, prefix + "/") != 0)
+      break;
+    found = true;
+    if (!iter->stats.is_file || iter->stats.unpacked)
+      continue;
+    const uint8_t* data = GetFileData(iter->stats);
+    if (!data)
+      continue;
+    // Read one byte per page to fault the range in.
+    const size_t kPageSize = 4096;
+    volatile uint8_t sink = 0;
+    for (size_t i = 0; i < iter->stats.size; i += kPageSize)
+      sink += data[i];
+    (void)sink;
+  }
+  return found;
+}
+
 bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
-  auto it = external_files_.find(path.value());
-  if (it != external_files_.end()) {
-    *out = it->second->path();
-    return true;
+  TRACE_EVENT1("electron", "Archive::CopyFileOut",
+               "path", path.AsUTF8Unsafe());
+  {
+    base::AutoLock auto_lock(lock_);
+    auto it = external_files_.find(path.value());
+    if (it != external_files_.end()) {
+      *out = it->second->path();
+      return true;
+    }
   }
 
   FileInfo info;
@@ -284,11 +482,28 @@ bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
     return true;
   }
 
+  // Prefer the persistent extraction cache so repeated launches skip the
+  // disk copy entirely.
+  if (ExtractToCache(path, info, out))
+    return true;
+
+  // Extract through an independent stream, so concurrent extractions do
+  // not hold the archive lock while copying.
+  base::File stream = OpenStream();
   std::unique_ptr<ScopedTemporaryFile> temp_file(new ScopedTemporaryFile);
   base::FilePath::StringType ext = path.Extension();
-  if (!temp_file->InitFromFile(&file_, ext, info.offset, info.size))
+  if (!temp_file->InitFromFile(&stream, ext, info.offset, info.size))
     return false;
 
+  // Verify what actually landed on disk, the extracted file is what gets
+  // loaded.
+  if (!info.integrity.empty()) {
+    std::string contents;
+    if (!base::ReadFileToString(temp_file->path(), &contents) ||
+        !VerifyIntegrity(info, contents.data(), contents.size()))
+      return false;
+  }
+
 #if defined(OS_POSIX)
   if (info.executable) {
     // chmod a+x temp_file;
@@ -296,11 +511,158 @@ bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
   }
 #endif
 
+  base::AutoLock auto_lock(lock_);
+  auto it = external_files_.find(path.value());
+  if (it != external_files_.end()) {
+    // Another thread won the race, use its extraction.
+    *out = it->second->path();
+    return true;
+  }
   *out = temp_file->path();
   external_files_[path.value()] = std::move(temp_file);
   return true;
 }
 
+const uint8_t* Archive::GetFileData(const FileInfo& info) {
+  TRACE_EVENT2("electron", "Archive::GetFileData",
+               "path", path_.AsUTF8Unsafe(),
+               "bytes", info.size);
+  if (info.unpacked)
+    return nullptr;
+
+  base::AutoLock auto_lock(lock_);
+  if (!mapping_ && !mmap_failed_) {
+    auto mapping = base::MakeUnique<base::MemoryMappedFile>();
+    if (mapping->Initialize(file_.Duplicate())) {
+      mapping_ = std::move(mapping);
+    } else {
+      // Mapping can fail on exotic file systems, fall back to normal reads.
+      LOG(WARNING) << "Failed to mmap " << path_.value();
+      mmap_failed_ = true;
+    }
+  }
+
+  if (!mapping_)
+    return nullptr;
+
+  // |offset| and |size| come from the untrusted JSON header, so check them
+  // in a form that cannot wrap around.
+  if (info.offset > mapping_->length() ||
+      info.size > mapping_->length() - info.offset)
+    return nullptr;
+
+  const uint8_t* data = mapping_->data() + info.offset;
+
+  if (!info.integrity.empty() && !verified_offsets_.count(info.offset)) {
+    if (!ContentHashMatches(info, path_,
+                            reinterpret_cast<const char*>(data), info.size))
+      return nullptr;
+    verified_offsets_.insert(info.offset);
+  }
+
+  return data;
+}
+
+bool Archive::VerifyIntegrity(const FileInfo& info,
+                              const char* data,
+                              size_t size) {
+  base::AutoLock auto_lock(lock_);
+  if (info.integrity.empty() || verified_offsets_.count(info.offset))
+    return true;
+  if (!ContentHashMatches(info, path_, data, size))
+    return false;
+  verified_offsets_.insert(info.offset);
+  return true;
+}
+
+bool Archive::ExtractToCache(const base::FilePath& path,
+                             const FileInfo& info,
+                             base::FilePath* out) {
+  base::File::Info archive_info;
+  if (!file_.GetInfo(&archive_info))
+    return false;
+
+  base::FilePath cache_root;
+  if (!GetExtractCacheRoot(&cache_root))
+    return false;
+
+  // Key the cache directory by the archive's path and mtime so a new app
+  // version naturally gets a fresh cache.
+  std::string key = base::MD5String(
+      path_.AsUTF8Unsafe() + "-" +
+      base::Int64ToString(archive_info.last_modified.ToInternalValue()));
+  base::FilePath dir = cache_root.AppendASCII(key);
+  if (!base::CreateDirectory(dir))
+    return false;
+
+#if defined(OS_POSIX)
+  if (!IsDirectoryOwnedByUser(dir))
+    return false;
+#endif
+
+  base::FilePath cached =
+      dir.AppendASCII(base::Uint64ToString(info.offset) + "-" +
+                      base::Uint64ToString(info.size))
+          .AddExtension(path.Extension());
+  int64_t cached_size;
+  if (base::GetFileSize(cached, &cached_size) &&
+      cached_size == static_cast<int64_t>(info.size)) {
+    // Do not trust a previous extraction blindly: when the entry carries a
+    // content hash, reverify the cached bytes before handing them out. The
+    // cached bytes can differ from the archive's, so this deliberately
+    // bypasses the per-offset verification memo.
+    std::string cached_contents;
+    if (info.integrity.empty() ||
+        (base::ReadFileToString(cached, &cached_contents) &&
+         ContentHashMatches(info, path_, cached_contents.data(),
+                            cached_contents.size()))) {
+      *out = cached;
+      return true;
+    }
+    // Stale or tampered cache entry; drop it and re-extract below.
+    base::DeleteFile(cached, false);
+  }
+
+  base::File stream = OpenStream();
+  if (!stream.IsValid())
+    return false;
+  std::vector<char> buf(info.size);
+  if (stream.Read(info.offset, buf.data(), buf.size()) !=
+      static_cast<int>(buf.size()))
+    return false;
+
+  if (!VerifyIntegrity(info, buf.data(), buf.size()))
+    return false;
+
+  // Write through a temporary name and rename, so a concurrent process
+  // never observes a partially extracted file.
+  base::FilePath tmp;
+  if (!base::CreateTemporaryFileInDir(dir, &tmp))
+    return false;
+  if (base::WriteFile(tmp, buf.data(), buf.size()) !=
+      static_cast<int>(buf.size())) {
+    base::DeleteFile(tmp, false);
+    return false;
+  }
+
+#if defined(OS_POSIX)
+  if (info.executable)
+    base::SetPosixFilePermissions(tmp, 0755);
+#endif
+
+  if (!base::ReplaceFile(tmp, cached, nullptr)) {
+    base::DeleteFile(tmp, false);
+    return false;
+  }
+
+  *out = cached;
+  return true;
+}
+
+base::File Archive::OpenStream() const {
+  return base::File(path_, base::File::FLAG_OPEN | base::File::FLAG_READ);
+}
+
 int Archive::GetFD() const {
   return fd_;
 }
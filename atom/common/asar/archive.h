@@ -6,14 +6,19 @@
 #define ATOM_COMMON_ASAR_ARCHIVE_H_
 
 #include <memory>
+#include <set>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "base/files/file.h"
 #include "base/files/file_path.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
 
 namespace base {
 class DictionaryValue;
+class MemoryMappedFile;
 }
 
 namespace asar {
@@ -21,7 +26,9 @@ namespace asar {
 class ScopedTemporaryFile;
 
 // This class represents an asar package, and provides methods to read
-// information from it.
+// information from it. An Archive is shared between threads once created,
+// the header is immutable after Init() and the mutable state is guarded by
+// a lock.
 class Archive {
  public:
   struct FileInfo {
@@ -30,6 +37,9 @@ class Archive {
     bool executable;
     uint32_t size;
     uint64_t offset;
+    // Hex-encoded SHA256 of the content when the header carries an
+    // "integrity" field, empty otherwise. Verified lazily on first read.
+    std::string integrity;
   };
 
   struct Stats : public FileInfo {
@@ -57,23 +67,88 @@ class Archive {
   // Fs.realpath(path).
   bool Realpath(const base::FilePath& path, base::FilePath* realpath);
 
+  // Reads ahead the content of |path|, or of every packed file under it
+  // when it is a directory, so that later reads are served from the page
+  // cache. Returns false when |path| does not exist in the archive.
+  bool Prefetch(const base::FilePath& path);
+
   // Copy the file into a temporary file, and return the new path.
   // For unpacked file, this method will return its real path.
   bool CopyFileOut(const base::FilePath& path, base::FilePath* out);
 
+  // Returns a pointer to the file's content inside a shared memory mapping
+  // of the whole archive, or nullptr for unpacked files or when mapping the
+  // archive failed. The mapping is created lazily on first use and is backed
+  // by the page cache, so it is shared with other processes reading the same
+  // archive.
+  const uint8_t* GetFileData(const FileInfo& info);
+
+  // Verifies |data| against the content hash carried by |info|, when there
+  // is one. Returns true when the entry has no hash or the hash matches;
+  // successful verifications are remembered so a file is hashed at most
+  // once per process.
+  bool VerifyIntegrity(const FileInfo& info, const char* data, size_t size);
+
+  // Opens an independent handle to the archive file. Callers that stream
+  // content out of the archive read through their own handle, so several
+  // in-flight reads do not serialize on the archive's descriptor.
+  base::File OpenStream() const;
+
   // Returns the file's fd.
   int GetFD() const;
 
   base::FilePath path() const { return path_; }
   base::DictionaryValue* header() const { return header_.get(); }
+  base::Time last_modified() const { return last_modified_; }
 
  private:
+  // An entry in the flat lookup index built from the header.
+  struct IndexEntry {
+    std::string path;  // Archive-relative path with '/' separators.
+    std::string link;  // Target path for links, empty otherwise.
+    Stats stats;
+  };
+
+  // Builds the flat index from the parsed header, sorted by path so that
+  // lookups become a binary search instead of a dictionary walk per path
+  // component.
+  void BuildIndex();
+  void AddIndexEntries(const std::string& prefix,
+                       const base::DictionaryValue* node);
+  const IndexEntry* FindIndexEntry(std::string path) const;
+
+  // Extracts |path| into a persistent on-disk cache keyed by the archive's
+  // mtime and the entry's offset/size, so repeated launches reuse previous
+  // extractions instead of copying the file again. The cache lives in the
+  // per-user cache directory and is refused when another user could write
+  // to it. Returns false when the cache is unusable, in which case the
+  // caller falls back to a temporary file.
+  bool ExtractToCache(const base::FilePath& path,
+                      const FileInfo& info,
+                      base::FilePath* out);
+
   base::FilePath path_;
   base::File file_;
+  base::Time last_modified_;
   int fd_;
   uint32_t header_size_;
   std::unique_ptr<base::DictionaryValue> header_;
 
+  // Flat lookup index over all entries, sorted by path. Immutable after
+  // Init().
+  std::vector<IndexEntry> index_;
+
+  // Guards the mutable state below, the Archive is used on multiple threads.
+  base::Lock lock_;
+
+  // Lazily created memory mapping of the whole archive.
+  bool mmap_failed_;
+  std::unique_ptr<base::MemoryMappedFile> mapping_;
+
+  // Offsets of entries whose content hash has been verified, so every file
+  // pays the hashing cost at most once per process.
+  std::set<uint64_t> verified_offsets_;
+
   // Cached external temporary files.
   std::unordered_map<base::FilePath::StringType,
                      std::unique_ptr<ScopedTemporaryFile>> external_files_;
@@ -4,45 +4,128 @@
 
 #include "atom/common/asar/asar_util.h"
 
+#include <list>
 #include <map>
 #include <string>
+#include <utility>
 
 #include "atom/common/asar/archive.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/lazy_instance.h"
 #include "base/stl_util.h"
-#include "base/threading/thread_local.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/synchronization/lock.h"
 
 namespace asar {
 
 namespace {
 
-// The global instance of ArchiveMap, will be destroyed on exit.
 typedef std::map<base::FilePath, std::shared_ptr<Archive>> ArchiveMap;
-base::LazyInstance<base::ThreadLocalPointer<ArchiveMap>>::Leaky
-    g_archive_map_tls = LAZY_INSTANCE_INITIALIZER;
+
+// The process-wide cache of opened archives, shared by all threads so the
+// header of an archive is parsed exactly once per process. The cache is
+// sharded by the hash of the archive path to reduce lock contention.
+const size_t kArchiveCacheShards = 8;
+
+struct ArchiveCacheShard {
+  base::Lock lock;
+  ArchiveMap archives;
+};
+
+struct ArchiveCache {
+  ArchiveCacheShard* GetShard(const base::FilePath& path) {
+    size_t hash = std::hash<base::FilePath::StringType>()(path.value());
+    return &shards[hash % kArchiveCacheShards];
+  }
+
+  ArchiveCacheShard shards[kArchiveCacheShards];
+};
+
+base::LazyInstance<ArchiveCache>::Leaky g_archive_cache =
+    LAZY_INSTANCE_INITIALIZER;
 
 const base::FilePath::CharType kAsarExtension[] = FILE_PATH_LITERAL(".asar");
 
+// A small LRU cache of hot file contents. A handful of small files (locale
+// data, small JS chunks) account for most archive reads in a session, so
+// keeping them in memory avoids hitting the disk for every re-request.
+const size_t kContentCacheMaxBytes = 4 * 1024 * 1024;
+const size_t kContentCacheMaxEntryBytes = 256 * 1024;
+
+struct ContentCache {
+  struct Entry {
+    std::string key;
+    std::string content;
+  };
+
+  base::Lock lock;
+  std::list<Entry> entries;  // Most recently used first.
+  std::map<std::string, std::list<Entry>::iterator> index;
+  size_t total_bytes = 0;
+};
+
+base::LazyInstance<ContentCache>::Leaky g_content_cache =
+    LAZY_INSTANCE_INITIALIZER;
+
+// Cache entries are keyed by (archive path, relative path, archive mtime)
+// so a replaced archive naturally invalidates its entries.
+std::string ContentCacheKey(const std::shared_ptr<Archive>& archive,
+                            const base::FilePath& relative_path) {
+  return archive->path().AsUTF8Unsafe() + '\0' +
+         relative_path.AsUTF8Unsafe() + '\0' +
+         base::Int64ToString(archive->last_modified().ToInternalValue());
+}
+
+bool GetCachedContent(const std::string& key, std::string* contents) {
+  ContentCache* cache = g_content_cache.Pointer();
+  base::AutoLock auto_lock(cache->lock);
+  auto it = cache->index.find(key);
+  if (it == cache->index.end())
+    return false;
+  cache->entries.splice(cache->entries.begin(), cache->entries, it->second);
+  *contents = it->second->content;
+  return true;
+}
+
+void PutCachedContent(const std::string& key, const std::string& contents) {
+  if (contents.size() > kContentCacheMaxEntryBytes)
+    return;
+  ContentCache* cache = g_content_cache.Pointer();
+  base::AutoLock auto_lock(cache->lock);
+  if (cache->index.find(key) != cache->index.end())
+    return;
+  cache->entries.push_front({key, contents});
+  cache->index[key] = cache->entries.begin();
+  cache->total_bytes += contents.size();
+  while (cache->total_bytes > kContentCacheMaxBytes) {
+    const ContentCache::Entry& victim = cache->entries.back();
+    cache->total_bytes -= victim.content.size();
+    cache->index.erase(victim.key);
+    cache->entries.pop_back();
+  }
+}
+
 }  // namespace
 
 std::shared_ptr<Archive> GetOrCreateAsarArchive(const base::FilePath& path) {
-  if (!g_archive_map_tls.Pointer()->Get())
-    g_archive_map_tls.Pointer()->Set(new ArchiveMap);
-  ArchiveMap& archive_map = *g_archive_map_tls.Pointer()->Get();
-  if (!ContainsKey(archive_map, path)) {
+  ArchiveCacheShard* shard = g_archive_cache.Pointer()->GetShard(path);
+  base::AutoLock auto_lock(shard->lock);
+  if (!ContainsKey(shard->archives, path)) {
     std::shared_ptr<Archive> archive(new Archive(path));
     if (!archive->Init())
       return nullptr;
-    archive_map[path] = archive;
+    shard->archives[path] = archive;
   }
-  return archive_map[path];
+  return shard->archives[path];
 }
 
 void ClearArchives() {
-  if (g_archive_map_tls.Pointer()->Get())
-    delete g_archive_map_tls.Pointer()->Get();
+  for (size_t i = 0; i < kArchiveCacheShards; ++i) {
+    ArchiveCacheShard* shard = &g_archive_cache.Pointer()->shards[i];
+    base::AutoLock auto_lock(shard->lock);
+    shard->archives.clear();
+  }
 }
 
 bool GetAsarArchivePath(const base::FilePath& full_path,
@@ -80,6 +163,10 @@ bool ReadFileToString(const base::FilePath& path, std::string* contents) {
   if (!archive->GetFileInfo(relative_path, &info))
     return false;
 
+  std::string cache_key = ContentCacheKey(archive, relative_path);
+  if (GetCachedContent(cache_key, contents))
+    return true;
+
   if (info.unpacked) {
     base::FilePath real_path;
     // For unpacked file it will return the real path instead of doing the copy.
@@ -87,13 +174,29 @@ bool ReadFileToString(const base::FilePath& path, std::string* contents) {
     return base::ReadFileToString(real_path, contents);
   }
 
+  // Read through the archive's memory mapping when possible, which avoids
+  // per-read syscalls and shares the page cache across processes.
+  const uint8_t* data = archive->GetFileData(info);
+  if (data) {
+    contents->assign(reinterpret_cast<const char*>(data), info.size);
+    PutCachedContent(cache_key, *contents);
+    return true;
+  }
+
   base::File src(asar_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
   if (!src.IsValid())
     return false;
 
   contents->resize(info.size);
-  return static_cast<int>(info.size) == src.Read(
-      info.offset, const_cast<char*>(contents->data()), contents->size());
+  if (static_cast<int>(info.size) != src.Read(
+      info.offset, const_cast<char*>(contents->data()), contents->size()))
+    return false;
+  // The mmap path verifies inside GetFileData; this fallback read must not
+  // skip the check.
+  if (!archive->VerifyIntegrity(info, contents->data(), contents->size()))
+    return false;
+  PutCachedContent(cache_key, *contents);
+  return true;
 }
 
 }  // namespace asar
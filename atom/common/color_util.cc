@@ -4,53 +4,91 @@
 
 #include "atom/common/color_util.h"
 
-#include <vector>
+namespace atom {
 
-#include "base/strings/string_number_conversions.h"
-#include "base/strings/string_util.h"
-#include "base/strings/stringprintf.h"
+namespace {
 
-namespace atom {
+const uint8_t kInvalidNibble = 0xFF;
+
+// Returns the value of hex digit |c|, or kInvalidNibble.
+uint8_t HexNibble(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return kInvalidNibble;
+}
+
+// Parses the two hex digits at |s|; returns false on a non-hex digit.
+bool HexByte(const char* s, uint8_t* out) {
+  uint8_t hi = HexNibble(s[0]);
+  uint8_t lo = HexNibble(s[1]);
+  if (hi == kInvalidNibble || lo == kInvalidNibble)
+    return false;
+  *out = (hi << 4) | lo;
+  return true;
+}
+
+// Expands the single hex digit at |s| to a byte, e.g. "A" -> 0xAA.
+bool HexShortByte(const char* s, uint8_t* out) {
+  uint8_t v = HexNibble(s[0]);
+  if (v == kInvalidNibble)
+    return false;
+  *out = v * 0x11;
+  return true;
+}
+
+}  // namespace
 
 SkColor ParseHexColor(const std::string& color_string) {
-  // Check the string for incorrect formatting.
+  // Accepts #RGB, #ARGB, #RRGGBB and #AARRGGBB; anything else is white.
+  // Digits are decoded in place, without intermediate strings.
   if (color_string.empty() || color_string[0] != '#')
     return SK_ColorWHITE;
 
-  // Prepend FF if alpha channel is not specified.
-  std::string source = color_string.substr(1);
-  if (source.size() == 3)
-    source.insert(0, "F");
-  else if (source.size() == 6)
-    source.insert(0, "FF");
-
-  // Convert the string from #FFF format to #FFFFFF format.
-  std::string formatted_color;
-  if (source.size() == 4) {
-    for (size_t i = 0; i < 4; ++i) {
-      formatted_color += source[i];
-      formatted_color += source[i];
-    }
-  } else if (source.size() == 8) {
-    formatted_color = source;
-  } else {
-    return SK_ColorWHITE;
-  }
+  const char* s = color_string.c_str() + 1;
+  size_t length = color_string.size() - 1;
 
-  // Convert the string to an integer and make sure it is in the correct value
-  // range.
-  std::vector<uint8_t> bytes;
-  if (!base::HexStringToBytes(formatted_color, &bytes))
+  uint8_t a = 0xFF, r, g, b;
+  bool valid;
+  switch (length) {
+    case 3:
+      valid = HexShortByte(s, &r) && HexShortByte(s + 1, &g) &&
+              HexShortByte(s + 2, &b);
+      break;
+    case 4:
+      valid = HexShortByte(s, &a) && HexShortByte(s + 1, &r) &&
+              HexShortByte(s + 2, &g) && HexShortByte(s + 3, &b);
+      break;
+    case 6:
+      valid = HexByte(s, &r) && HexByte(s + 2, &g) && HexByte(s + 4, &b);
+      break;
+    case 8:
+      valid = HexByte(s, &a) && HexByte(s + 2, &r) && HexByte(s + 4, &g) &&
+              HexByte(s + 6, &b);
+      break;
+    default:
+      valid = false;
+      break;
+  }
+  if (!valid)
     return SK_ColorWHITE;
 
-  return SkColorSetARGB(bytes[0], bytes[1], bytes[2], bytes[3]);
+  return SkColorSetARGB(a, r, g, b);
 }
 
 std::string ToRGBHex(SkColor color) {
-  return base::StringPrintf("#%02X%02X%02X",
-                            SkColorGetR(color),
-                            SkColorGetG(color),
-                            SkColorGetB(color));
+  static const char kHexChars[] = "0123456789ABCDEF";
+  std::string hex("#000000");
+  uint8_t channels[3] = {SkColorGetR(color), SkColorGetG(color),
+                         SkColorGetB(color)};
+  for (size_t i = 0; i < 3; ++i) {
+    hex[1 + i * 2] = kHexChars[channels[i] >> 4];
+    hex[2 + i * 2] = kHexChars[channels[i] & 0xF];
+  }
+  return hex;
 }
 
 }  // namespace atom
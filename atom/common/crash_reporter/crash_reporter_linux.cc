@@ -8,9 +8,15 @@
 #include <sys/time.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <functional>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "atom/common/crash_reporter/scoped_crash_key.h"
 #include "base/debug/crash_logging.h"
+#include "base/files/file_enumerator.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/linux_util.h"
@@ -34,6 +40,35 @@ static const size_t kDistroSize = 128;
 // no limit.
 static const off_t kMaxMinidumpFileSize = 1258291;
 
+// Limit on the number of minidumps kept on disk. Dumps pile up when uploads
+// are disabled or keep failing, and an unbounded crashes directory both
+// wastes disk and slows down the crash path, so drop the oldest ones beyond
+// this cap at startup.
+static const size_t kMaxQueuedDumps = 20;
+
+// Merges one scoped crash key into breakpad's storage. Runs in a
+// compromised context; NonAllocatingMap::SetKeyValue does not allocate.
+void AppendScopedCrashKey(const char* key, const char* value, void* context) {
+  static_cast<CrashKeyStorage*>(context)->SetKeyValue(key, value);
+}
+
+void PruneOldDumps(const base::FilePath& crashes_dir) {
+  std::vector<std::pair<base::Time, base::FilePath>> dumps;
+  base::FileEnumerator iter(crashes_dir, false, base::FileEnumerator::FILES,
+                            FILE_PATH_LITERAL("*.dmp"));
+  for (base::FilePath path = iter.Next(); !path.empty(); path = iter.Next())
+    dumps.push_back(std::make_pair(iter.GetInfo().GetLastModifiedTime(), path));
+
+  if (dumps.size() <= kMaxQueuedDumps)
+    return;
+
+  // Newest first; everything past the cap goes away.
+  std::sort(dumps.begin(), dumps.end(),
+            std::greater<std::pair<base::Time, base::FilePath>>());
+  for (size_t i = kMaxQueuedDumps; i < dumps.size(); ++i)
+    base::DeleteFile(dumps[i].second, false);
+}
+
 }  // namespace
 
 CrashReporterLinux::CrashReporterLinux()
@@ -91,6 +126,7 @@ bool CrashReporterLinux::GetUploadToServer() {
 
 void CrashReporterLinux::EnableCrashDumping(const base::FilePath& crashes_dir) {
   base::CreateDirectory(crashes_dir);
+  PruneOldDumps(crashes_dir);
 
   std::string log_file = crashes_dir.Append("uploads.log").value();
   strncpy(g_crash_log_path, log_file.c_str(), sizeof(g_crash_log_path));
@@ -122,6 +158,10 @@ bool CrashReporterLinux::CrashDone(const MinidumpDescriptor& minidump,
 
   DCHECK(!minidump.IsFD());
 
+  // Snapshot whatever scoped crash keys are in flight on other threads.
+  internal::VisitScopedCrashKeys(AppendScopedCrashKey,
+                                 self->crash_keys_.get());
+
   BreakpadInfo info = {0};
   info.filename = minidump.path();
   info.fd = minidump.fd();
@@ -48,6 +48,10 @@ class CrashReporterMac : public CrashReporter {
   void SetCrashKeyValue(const base::StringPiece& key,
                         const base::StringPiece& value);
 
+  // Mirrors scoped crash keys into the crashpad annotation dictionary as
+  // they are published and retired.
+  static void OnScopedCrashKeyChange(const char* key, const char* value);
+
   std::vector<UploadReportResult> GetUploadedReports(
       const base::FilePath& crashes_dir) override;
 
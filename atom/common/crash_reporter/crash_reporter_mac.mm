@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "atom/common/crash_reporter/scoped_crash_key.h"
 #include "base/files/file_util.h"
 #include "base/mac/bundle_locations.h"
 #include "base/mac/mac_util.h"
@@ -75,6 +76,16 @@ void CrashReporterMac::InitBreakpad(const std::string& product_name,
   for (const auto& upload_parameter: upload_parameters_) {
     SetCrashKeyValue(upload_parameter.first, upload_parameter.second);
   }
+
+  // Crashpad reads annotations from the dictionary at dump time and offers
+  // no client-side crash hook, so scoped crash keys have to be mirrored in
+  // as they change. Replay any that were published before init.
+  internal::SetScopedCrashKeyObserver(&OnScopedCrashKeyChange);
+  internal::VisitScopedCrashKeys(
+      [](const char* key, const char* value, void* context) {
+        OnScopedCrashKeyChange(key, value);
+      },
+      nullptr);
   if (is_browser_) {
     database_ =
         crashpad::CrashReportDatabase::Initialize(crashes_dir);
@@ -105,6 +116,18 @@ void CrashReporterMac::SetCrashKeyValue(const base::StringPiece& key,
   simple_string_dictionary_->SetKeyValue(key.data(), value.data());
 }
 
+// static
+void CrashReporterMac::OnScopedCrashKeyChange(const char* key,
+                                              const char* value) {
+  auto* dictionary = GetInstance()->simple_string_dictionary_.get();
+  if (!dictionary)
+    return;
+  if (value)
+    dictionary->SetKeyValue(key, value);
+  else
+    dictionary->RemoveKey(key);
+}
+
 void CrashReporterMac::SetExtraParameter(const std::string& key,
                                          const std::string& value) {
   if (simple_string_dictionary_)
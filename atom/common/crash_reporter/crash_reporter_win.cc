@@ -6,6 +6,7 @@
 
 #include <string>
 
+#include "atom/common/crash_reporter/scoped_crash_key.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
 #include "base/memory/singleton.h"
@@ -47,6 +48,35 @@ const wchar_t kPipeNameFormat[] = L"\\\\.\\pipe\\$1 Crash Service";
 const int kNameMaxLength = 64;
 const int kValueMaxLength = 64;
 
+// Bounded widening copy for breakpad's wchar_t entry buffers. Runs at crash
+// time, so no string conversion helpers that might allocate.
+void WidenTruncated(wchar_t* dest, size_t dest_size, const char* src) {
+  size_t i = 0;
+  for (; i < dest_size - 1 && src[i]; ++i)
+    dest[i] = static_cast<unsigned char>(src[i]);
+  dest[i] = L'\0';
+}
+
+struct ScopedKeyFillState {
+  google_breakpad::CustomInfoEntry* entries;
+  size_t index;
+  size_t count;
+};
+
+void FillScopedCrashKeyEntry(const char* key, const char* value,
+                             void* context) {
+  ScopedKeyFillState* state = static_cast<ScopedKeyFillState*>(context);
+  if (state->index >= state->count)
+    return;
+  wchar_t wide_key[kNameMaxLength];
+  wchar_t wide_value[kValueMaxLength];
+  WidenTruncated(wide_key, kNameMaxLength, key);
+  WidenTruncated(wide_value, kValueMaxLength, value);
+  state->entries[state->index].set_name(wide_key);
+  state->entries[state->index].set_value(wide_value);
+  ++state->index;
+}
+
 typedef NTSTATUS (WINAPI* NtTerminateProcessPtr)(HANDLE ProcessHandle,
                                                  NTSTATUS ExitStatus);
 char* g_real_terminate_process_stub = NULL;
@@ -139,7 +169,8 @@ void UnregisterNonABICompliantCodeRange(void* start) {
 
 CrashReporterWin::CrashReporterWin()
     : skip_system_crash_handler_(false),
-      code_range_registered_(false) {
+      code_range_registered_(false),
+      scoped_entries_start_(0) {
 }
 
 CrashReporterWin::~CrashReporterWin() {
@@ -218,6 +249,17 @@ int CrashReporterWin::CrashForException(EXCEPTION_POINTERS* info) {
 bool CrashReporterWin::FilterCallback(void* context,
                                       EXCEPTION_POINTERS* exinfo,
                                       MDRawAssertionInfo* assertion) {
+  // Copy any scoped crash keys into the reserved custom info entries before
+  // the dump is taken; the out-of-process crash service reads the entries
+  // from this process's memory.
+  CrashReporterWin* self = static_cast<CrashReporterWin*>(context);
+  if (self->scoped_entries_start_ < self->custom_info_entries_.size()) {
+    ScopedKeyFillState state = {
+        &self->custom_info_entries_[self->scoped_entries_start_],
+        0,
+        internal::kMaxScopedCrashKeys};
+    internal::VisitScopedCrashKeys(FillScopedCrashKeyEntry, &state);
+  }
   return true;
 }
 
@@ -241,7 +283,8 @@ google_breakpad::CustomClientInfo* CrashReporterWin::GetCustomInfo(
     const std::string& company_name,
     bool upload_to_server) {
   custom_info_entries_.clear();
-  custom_info_entries_.reserve(3 + upload_parameters_.size());
+  custom_info_entries_.reserve(3 + upload_parameters_.size() +
+                               internal::kMaxScopedCrashKeys);
 
   custom_info_entries_.push_back(google_breakpad::CustomInfoEntry(
       L"prod", L"Electron"));
@@ -268,6 +311,12 @@ google_breakpad::CustomClientInfo* CrashReporterWin::GetCustomInfo(
         google_breakpad::CustomInfoEntry(name.c_str(), value.c_str()));
   }
 
+  // Reserve blank entries for scoped crash keys; FilterCallback fills them
+  // in at crash time.
+  scoped_entries_start_ = custom_info_entries_.size();
+  for (size_t i = 0; i < internal::kMaxScopedCrashKeys; ++i)
+    custom_info_entries_.push_back(google_breakpad::CustomInfoEntry(L"", L""));
+
   custom_info_.entries = &custom_info_entries_.front();
   custom_info_.count = custom_info_entries_.size();
   return &custom_info_;
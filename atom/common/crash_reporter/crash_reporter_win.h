@@ -63,6 +63,9 @@ class CrashReporterWin : public CrashReporter {
   std::vector<google_breakpad::CustomInfoEntry> custom_info_entries_;
   google_breakpad::CustomClientInfo custom_info_;
 
+  // Index of the first entry reserved for scoped crash keys.
+  size_t scoped_entries_start_;
+
   bool skip_system_crash_handler_;
   bool code_range_registered_;
   std::unique_ptr<google_breakpad::ExceptionHandler> breakpad_;
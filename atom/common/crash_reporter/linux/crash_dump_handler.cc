@@ -693,6 +693,15 @@ void HandleCrashDump(const BreakpadInfo& info) {
 
     IGNORE_RET(sys_setsid());
 
+    // Fork a second time so the upload is babysat by an orphaned grandchild.
+    // The crashed process only reaps this short-lived intermediate below
+    // instead of staying around for the whole upload, which can take seconds
+    // on a slow link and delays anything waiting on the crashed process to
+    // exit (e.g. relaunch logic in the browser).
+    const pid_t grandchild = sys_fork();
+    if (grandchild != 0)
+      sys__exit(0);
+
     // Leave one end of a pipe in the upload process and watch for it getting
     // closed by the upload process exiting.
     int fds[2];
@@ -729,7 +738,8 @@ void HandleCrashDump(const BreakpadInfo& info) {
     sys__exit(0);
   }
 
-  // Main browser process.
+  // Main browser process. The helper exits as soon as it has forked the
+  // upload grandchild, so this wait returns promptly.
   if (child <= 0)
     return;
   (void) HANDLE_EINTR(sys_waitpid(child, NULL, 0));
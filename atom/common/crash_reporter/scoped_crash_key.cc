@@ -0,0 +1,104 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/crash_reporter/scoped_crash_key.h"
+
+#include "base/atomicops.h"
+
+namespace crash_reporter {
+
+namespace {
+
+using internal::kMaxScopedCrashKeys;
+using internal::kScopedCrashKeyNameSize;
+using internal::kScopedCrashKeyValueSize;
+
+// Slot life cycle: a writer claims a kFree slot with a compare-and-swap,
+// fills in the strings while the slot is kBusy, then publishes it. Readers
+// (the crash-time visitor) only look at kPublished slots, so they never see
+// a half-written entry.
+const base::subtle::Atomic32 kSlotFree = 0;
+const base::subtle::Atomic32 kSlotBusy = 1;
+const base::subtle::Atomic32 kSlotPublished = 2;
+
+struct CrashKeySlot {
+  base::subtle::Atomic32 state;
+  char key[kScopedCrashKeyNameSize];
+  char value[kScopedCrashKeyValueSize];
+};
+
+// Zero-initialized, so every slot starts out kSlotFree with NUL-terminated
+// buffers.
+CrashKeySlot g_slots[kMaxScopedCrashKeys];
+
+base::subtle::AtomicWord g_observer = 0;
+
+// Bounded copy that always NUL-terminates. The last byte of |dest| is only
+// ever written as NUL, so a concurrent crash-time reader may observe a
+// garbled value but never an unterminated one.
+void CopyTruncated(char* dest, size_t dest_size, const char* src) {
+  size_t i = 0;
+  for (; i < dest_size - 1 && src[i]; ++i)
+    dest[i] = src[i];
+  dest[i] = '\0';
+}
+
+void NotifyObserver(const char* key, const char* value) {
+  internal::ScopedCrashKeyObserver observer =
+      reinterpret_cast<internal::ScopedCrashKeyObserver>(
+          base::subtle::NoBarrier_Load(&g_observer));
+  if (observer)
+    observer(key, value);
+}
+
+}  // namespace
+
+ScopedCrashKey::ScopedCrashKey(const char* key, const char* value)
+    : slot_(-1) {
+  for (size_t i = 0; i < kMaxScopedCrashKeys; ++i) {
+    if (base::subtle::NoBarrier_CompareAndSwap(
+            &g_slots[i].state, kSlotFree, kSlotBusy) != kSlotFree)
+      continue;
+
+    CopyTruncated(g_slots[i].key, kScopedCrashKeyNameSize, key);
+    CopyTruncated(g_slots[i].value, kScopedCrashKeyValueSize, value);
+    base::subtle::Release_Store(&g_slots[i].state, kSlotPublished);
+    slot_ = static_cast<int>(i);
+    NotifyObserver(g_slots[i].key, g_slots[i].value);
+    return;
+  }
+  // All slots are taken; drop the annotation rather than block the caller.
+}
+
+ScopedCrashKey::ScopedCrashKey(const char* key, const std::string& value)
+    : ScopedCrashKey(key, value.c_str()) {
+}
+
+ScopedCrashKey::~ScopedCrashKey() {
+  if (slot_ < 0)
+    return;
+  // The slot is still owned here, so its key buffer is stable until the
+  // state is released below.
+  NotifyObserver(g_slots[slot_].key, nullptr);
+  base::subtle::Release_Store(&g_slots[slot_].state, kSlotFree);
+}
+
+namespace internal {
+
+void VisitScopedCrashKeys(ScopedCrashKeyVisitor visitor, void* context) {
+  for (size_t i = 0; i < kMaxScopedCrashKeys; ++i) {
+    if (base::subtle::Acquire_Load(&g_slots[i].state) != kSlotPublished)
+      continue;
+    visitor(g_slots[i].key, g_slots[i].value, context);
+  }
+}
+
+void SetScopedCrashKeyObserver(ScopedCrashKeyObserver observer) {
+  base::subtle::NoBarrier_Store(
+      &g_observer, reinterpret_cast<base::subtle::AtomicWord>(observer));
+}
+
+}  // namespace internal
+
+}  // namespace crash_reporter
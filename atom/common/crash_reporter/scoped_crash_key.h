@@ -0,0 +1,65 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_CRASH_REPORTER_SCOPED_CRASH_KEY_H_
+#define ATOM_COMMON_CRASH_REPORTER_SCOPED_CRASH_KEY_H_
+
+#include <stddef.h>
+
+#include <string>
+
+#include "base/macros.h"
+
+namespace crash_reporter {
+
+// Annotates crash reports with a key/value pair for the lifetime of the
+// object. Unlike SetExtraParameter this is cheap enough for hot paths (a
+// compare-and-swap plus two bounded string copies, no locks and no heap
+// allocation) and can be used from any thread, so it is suitable for state
+// like the IPC channel or asar archive being processed when a crash hits.
+//
+// Storage is a fixed number of slots; when all slots are in use the
+// annotation is silently dropped rather than blocking the caller. Keys and
+// values are truncated to the slot size.
+class ScopedCrashKey {
+ public:
+  ScopedCrashKey(const char* key, const char* value);
+  ScopedCrashKey(const char* key, const std::string& value);
+  ~ScopedCrashKey();
+
+ private:
+  // Index of the claimed slot, or -1 if none was free.
+  int slot_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedCrashKey);
+};
+
+namespace internal {
+
+const size_t kMaxScopedCrashKeys = 16;
+// Sizes include the terminating NUL; the value limit matches breakpad's
+// hardcoded entry size on Windows (see crash_reporter_win.cc).
+const size_t kScopedCrashKeyNameSize = 32;
+const size_t kScopedCrashKeyValueSize = 64;
+
+// Calls |visitor| for every scoped key currently published. Takes no locks
+// and does not allocate, so it is safe to call from a compromised context
+// at crash time.
+typedef void (*ScopedCrashKeyVisitor)(const char* key, const char* value,
+                                      void* context);
+void VisitScopedCrashKeys(ScopedCrashKeyVisitor visitor, void* context);
+
+// Observer invoked whenever a scoped key is published (|value| non-NULL) or
+// retired (|value| NULL). Used on platforms whose crash handler reads
+// annotations from a separate block that has to be kept in sync as keys
+// change (crashpad on macOS); the breakpad platforms instead snapshot the
+// slots at crash time via VisitScopedCrashKeys.
+typedef void (*ScopedCrashKeyObserver)(const char* key, const char* value);
+void SetScopedCrashKeyObserver(ScopedCrashKeyObserver observer);
+
+}  // namespace internal
+
+}  // namespace crash_reporter
+
+#endif  // ATOM_COMMON_CRASH_REPORTER_SCOPED_CRASH_KEY_H_
@@ -7,10 +7,15 @@
 #include <windows.h>
 
 #include <sddl.h>
+#include <algorithm>
 #include <fstream>  // NOLINT
+#include <functional>
 #include <map>
+#include <utility>
+#include <vector>
 
 #include "base/command_line.h"
+#include "base/files/file_enumerator.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
 #include "base/strings/string_number_conversions.h"
@@ -96,6 +101,31 @@ bool WriteReportIDToFile(const std::wstring& dump_path,
   return true;
 }
 
+// Limit on the number of minidumps kept in the client dump directory. Dumps
+// accumulate when uploads are disabled or keep failing; drop the oldest ones
+// (and their custom info files) beyond this cap before queuing a new one.
+const size_t kMaxQueuedDumps = 20;
+
+void PruneOldDumps(const base::FilePath& dumps_dir) {
+  std::vector<std::pair<base::Time, base::FilePath>> dumps;
+  base::FileEnumerator iter(dumps_dir, false, base::FileEnumerator::FILES,
+                            FILE_PATH_LITERAL("*.dmp"));
+  for (base::FilePath path = iter.Next(); !path.empty(); path = iter.Next())
+    dumps.push_back(std::make_pair(iter.GetInfo().GetLastModifiedTime(), path));
+
+  if (dumps.size() < kMaxQueuedDumps)
+    return;
+
+  // Newest first; everything past the cap goes away.
+  std::sort(dumps.begin(), dumps.end(),
+            std::greater<std::pair<base::Time, base::FilePath>>());
+  for (size_t i = kMaxQueuedDumps - 1; i < dumps.size(); ++i) {
+    base::DeleteFile(dumps[i].second, false);
+    base::DeleteFile(
+        dumps[i].second.ReplaceExtension(FILE_PATH_LITERAL(".txt")), false);
+  }
+}
+
 // The window procedure task is to handle when a) the user logs off.
 // b) the system shuts down or c) when the user closes the window.
 LRESULT __stdcall CrashSvcWndProc(HWND hwnd, UINT message,
@@ -378,6 +408,7 @@ void CrashService::OnClientDumpRequest(void* context,
   if (it != map.end()) {
     base::FilePath alternate_dump_location = base::FilePath(it->second);
     base::CreateDirectoryW(alternate_dump_location);
+    PruneOldDumps(alternate_dump_location);
     alternate_dump_location = alternate_dump_location.Append(
         dump_location.BaseName());
     base::Move(dump_location, alternate_dump_location);
@@ -0,0 +1,99 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/event_loop_stats.h"
+
+#include "base/lazy_instance.h"
+#include "base/synchronization/lock.h"
+
+namespace atom {
+
+namespace event_loop_stats {
+
+namespace {
+
+// Bucket i holds samples in [2^i, 2^(i+1)) microseconds; 32 buckets cover
+// ticks of up to about 70 minutes, far beyond anything observable.
+const int kBucketCount = 32;
+
+struct Histogram {
+  Histogram() : count(0), buckets() {}
+
+  void Record(base::TimeDelta sample) {
+    int64_t us = sample.InMicroseconds();
+    int bucket = 0;
+    while (bucket < kBucketCount - 1 && (us >> (bucket + 1)) > 0)
+      bucket++;
+    buckets[bucket]++;
+    count++;
+    total += sample;
+    if (sample > max)
+      max = sample;
+  }
+
+  // Returns the upper bucket bound the given fraction of samples falls
+  // under, in milliseconds.
+  double PercentileMs(double fraction) const {
+    if (count == 0)
+      return 0;
+    uint64_t threshold = static_cast<uint64_t>(fraction * count);
+    uint64_t seen = 0;
+    for (int i = 0; i < kBucketCount; ++i) {
+      seen += buckets[i];
+      if (seen > threshold)
+        return (1ll << (i + 1)) / 1000.0;
+    }
+    return max.InMillisecondsF();
+  }
+
+  void FillSnapshot(HistogramSnapshot* snapshot) const {
+    snapshot->p50_ms = PercentileMs(0.5);
+    snapshot->p90_ms = PercentileMs(0.9);
+    snapshot->p99_ms = PercentileMs(0.99);
+    snapshot->max_ms = max.InMillisecondsF();
+    if (count > 0)
+      snapshot->mean_ms = total.InMillisecondsF() / count;
+  }
+
+  uint64_t count;
+  uint64_t buckets[kBucketCount];
+  base::TimeDelta total;
+  base::TimeDelta max;
+};
+
+struct Stats {
+  Stats() : tick_count(0) {}
+
+  base::Lock lock;
+  uint64_t tick_count;
+  Histogram latency;
+  Histogram duration;
+};
+
+base::LazyInstance<Stats>::Leaky g_stats = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+void RecordTick(base::TimeDelta latency, base::TimeDelta duration) {
+  Stats* stats = g_stats.Pointer();
+  base::AutoLock auto_lock(stats->lock);
+  stats->tick_count++;
+  if (latency > base::TimeDelta())
+    stats->latency.Record(latency);
+  stats->duration.Record(duration);
+}
+
+Snapshot GetSnapshot() {
+  Stats* stats = g_stats.Pointer();
+  base::AutoLock auto_lock(stats->lock);
+  Snapshot snapshot;
+  snapshot.tick_count = stats->tick_count;
+  stats->latency.FillSnapshot(&snapshot.latency);
+  stats->duration.FillSnapshot(&snapshot.duration);
+  return snapshot;
+}
+
+}  // namespace event_loop_stats
+
+}  // namespace atom
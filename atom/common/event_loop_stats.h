@@ -0,0 +1,52 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_EVENT_LOOP_STATS_H_
+#define ATOM_COMMON_EVENT_LOOP_STATS_H_
+
+#include "base/time/time.h"
+
+namespace atom {
+
+// Latency statistics for the uv ticks NodeBindings runs on the main
+// thread, kept in fixed-size exponential histograms so recording is a
+// couple of increments per tick. Read from process.getEventLoopStats().
+namespace event_loop_stats {
+
+// Percentiles for one histogram, in milliseconds. Percentiles report the
+// upper bound of the bucket the sample fell into, so they overestimate
+// by at most a factor of two.
+struct HistogramSnapshot {
+  HistogramSnapshot()
+      : p50_ms(0), p90_ms(0), p99_ms(0), max_ms(0), mean_ms(0) {}
+
+  double p50_ms;
+  double p90_ms;
+  double p99_ms;
+  double max_ms;
+  double mean_ms;
+};
+
+struct Snapshot {
+  Snapshot() : tick_count(0) {}
+
+  uint64_t tick_count;
+  // Delay between a tick being scheduled and it actually starting.
+  HistogramSnapshot latency;
+  // Time each tick kept the main thread busy.
+  HistogramSnapshot duration;
+};
+
+// Records one uv tick. A zero |latency| means the tick was not triggered
+// by a cross-thread wakeup and contributes only to the duration
+// histogram.
+void RecordTick(base::TimeDelta latency, base::TimeDelta duration);
+
+Snapshot GetSnapshot();
+
+}  // namespace event_loop_stats
+
+}  // namespace atom
+
+#endif  // ATOM_COMMON_EVENT_LOOP_STATS_H_
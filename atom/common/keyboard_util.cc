@@ -2,9 +2,11 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <string>
 
 #include "atom/common/keyboard_util.h"
+#include "base/macros.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "third_party/WebKit/public/platform/WebInputEvent.h"
@@ -81,77 +83,79 @@ ui::KeyboardCode KeyboardCodeFromCharCode(base::char16 c, bool* shifted) {
   }
 }
 
-// Return key code represented by |str|.
-ui::KeyboardCode KeyboardCodeFromKeyIdentifier(const std::string& s,
-                                               bool* shifted) {
-  std::string str = base::ToLowerASCII(s);
-  if (str == "ctrl" || str == "control") {
-    return ui::VKEY_CONTROL;
-  } else if (str == "super" || str == "cmd" || str == "command" ||
-             str == "meta") {
-    return ui::VKEY_COMMAND;
-  } else if (str == "commandorcontrol" || str == "cmdorctrl") {
 #if defined(OS_MACOSX)
-    return ui::VKEY_COMMAND;
+const ui::KeyboardCode kCommandOrControl = ui::VKEY_COMMAND;
 #else
-    return ui::VKEY_CONTROL;
+const ui::KeyboardCode kCommandOrControl = ui::VKEY_CONTROL;
 #endif
-  } else if (str == "alt" || str == "option") {
-    return ui::VKEY_MENU;
-  } else if (str == "shift") {
-    return ui::VKEY_SHIFT;
-  } else if (str == "altgr") {
-    return ui::VKEY_ALTGR;
-  } else if (str == "plus") {
-    *shifted = true;
-    return ui::VKEY_OEM_PLUS;
-  } else if (str == "tab") {
-    return ui::VKEY_TAB;
-  } else if (str == "space") {
-    return ui::VKEY_SPACE;
-  } else if (str == "backspace") {
-    return ui::VKEY_BACK;
-  } else if (str == "delete") {
-    return ui::VKEY_DELETE;
-  } else if (str == "insert") {
-    return ui::VKEY_INSERT;
-  } else if (str == "enter" || str == "return") {
-    return ui::VKEY_RETURN;
-  } else if (str == "up") {
-    return ui::VKEY_UP;
-  } else if (str == "down") {
-    return ui::VKEY_DOWN;
-  } else if (str == "left") {
-    return ui::VKEY_LEFT;
-  } else if (str == "right") {
-    return ui::VKEY_RIGHT;
-  } else if (str == "home") {
-    return ui::VKEY_HOME;
-  } else if (str == "end") {
-    return ui::VKEY_END;
-  } else if (str == "pageup") {
-    return ui::VKEY_PRIOR;
-  } else if (str == "pagedown") {
-    return ui::VKEY_NEXT;
-  } else if (str == "esc" || str == "escape") {
-    return ui::VKEY_ESCAPE;
-  } else if (str == "volumemute") {
-    return ui::VKEY_VOLUME_MUTE;
-  } else if (str == "volumeup") {
-    return ui::VKEY_VOLUME_UP;
-  } else if (str == "volumedown") {
-    return ui::VKEY_VOLUME_DOWN;
-  } else if (str == "medianexttrack") {
-    return ui::VKEY_MEDIA_NEXT_TRACK;
-  } else if (str == "mediaprevioustrack") {
-    return ui::VKEY_MEDIA_PREV_TRACK;
-  } else if (str == "mediastop") {
-    return ui::VKEY_MEDIA_STOP;
-  } else if (str == "mediaplaypause") {
-    return ui::VKEY_MEDIA_PLAY_PAUSE;
-  } else if (str == "printscreen") {
-    return ui::VKEY_SNAPSHOT;
-  } else if (str.size() > 1 && str[0] == 'f') {
+
+struct KeyName {
+  const char* name;
+  ui::KeyboardCode code;
+  bool shifted;
+};
+
+// Key identifiers, sorted so lookups can binary search. Names are stored
+// lowercase and compared case-insensitively, so input needs no lowercased
+// copy.
+const KeyName kKeyNames[] = {
+  {"alt", ui::VKEY_MENU, false},
+  {"altgr", ui::VKEY_ALTGR, false},
+  {"backspace", ui::VKEY_BACK, false},
+  {"cmd", ui::VKEY_COMMAND, false},
+  {"cmdorctrl", kCommandOrControl, false},
+  {"command", ui::VKEY_COMMAND, false},
+  {"commandorcontrol", kCommandOrControl, false},
+  {"control", ui::VKEY_CONTROL, false},
+  {"ctrl", ui::VKEY_CONTROL, false},
+  {"delete", ui::VKEY_DELETE, false},
+  {"down", ui::VKEY_DOWN, false},
+  {"end", ui::VKEY_END, false},
+  {"enter", ui::VKEY_RETURN, false},
+  {"esc", ui::VKEY_ESCAPE, false},
+  {"escape", ui::VKEY_ESCAPE, false},
+  {"home", ui::VKEY_HOME, false},
+  {"insert", ui::VKEY_INSERT, false},
+  {"left", ui::VKEY_LEFT, false},
+  {"medianexttrack", ui::VKEY_MEDIA_NEXT_TRACK, false},
+  {"mediaplaypause", ui::VKEY_MEDIA_PLAY_PAUSE, false},
+  {"mediaprevioustrack", ui::VKEY_MEDIA_PREV_TRACK, false},
+  {"mediastop", ui::VKEY_MEDIA_STOP, false},
+  {"meta", ui::VKEY_COMMAND, false},
+  {"option", ui::VKEY_MENU, false},
+  {"pagedown", ui::VKEY_NEXT, false},
+  {"pageup", ui::VKEY_PRIOR, false},
+  {"plus", ui::VKEY_OEM_PLUS, true},
+  {"printscreen", ui::VKEY_SNAPSHOT, false},
+  {"return", ui::VKEY_RETURN, false},
+  {"right", ui::VKEY_RIGHT, false},
+  {"shift", ui::VKEY_SHIFT, false},
+  {"space", ui::VKEY_SPACE, false},
+  {"super", ui::VKEY_COMMAND, false},
+  {"tab", ui::VKEY_TAB, false},
+  {"up", ui::VKEY_UP, false},
+  {"volumedown", ui::VKEY_VOLUME_DOWN, false},
+  {"volumemute", ui::VKEY_VOLUME_MUTE, false},
+  {"volumeup", ui::VKEY_VOLUME_UP, false},
+};
+
+bool KeyNameLess(const KeyName& entry, const std::string& str) {
+  return base::CompareCaseInsensitiveASCII(entry.name, str) < 0;
+}
+
+// Return key code represented by |str|.
+ui::KeyboardCode KeyboardCodeFromKeyIdentifier(const std::string& str,
+                                               bool* shifted) {
+  const KeyName* end = kKeyNames + arraysize(kKeyNames);
+  const KeyName* entry = std::lower_bound(kKeyNames, end, str, KeyNameLess);
+  if (entry != end &&
+      base::CompareCaseInsensitiveASCII(entry->name, str) == 0) {
+    if (entry->shifted)
+      *shifted = true;
+    return entry->code;
+  }
+
+  if (str.size() > 1 && (str[0] == 'f' || str[0] == 'F')) {
     // F1 - F24.
     int n;
     if (base::StringToInt(str.c_str() + 1, &n) && n > 0 && n < 25) {
@@ -160,11 +164,11 @@ ui::KeyboardCode KeyboardCodeFromKeyIdentifier(const std::string& s,
       LOG(WARNING) << str << "is not available on keyboard";
       return ui::VKEY_UNKNOWN;
     }
-  } else {
-    if (str.size() > 2)
-      LOG(WARNING) << "Invalid accelerator token: " << str;
-    return ui::VKEY_UNKNOWN;
   }
+
+  if (str.size() > 2)
+    LOG(WARNING) << "Invalid accelerator token: " << str;
+  return ui::VKEY_UNKNOWN;
 }
 
 }  // namespace
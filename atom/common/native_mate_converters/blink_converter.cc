@@ -4,11 +4,14 @@
 
 #include "atom/common/native_mate_converters/blink_converter.h"
 
+#include <string.h>
+
 #include <algorithm>
 #include <string>
 #include <vector>
 
 #include "atom/common/keyboard_util.h"
+#include "atom/common/native_mate_converters/interned_string.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "content/public/browser/native_web_keyboard_event.h"
@@ -32,6 +35,73 @@ int VectorToBitArray(const std::vector<T>& vec) {
   return bits;
 }
 
+template<typename T>
+struct StringToConstant {
+  const char* name;
+  T value;
+};
+
+// The tables below are sorted by name, so a lookup is a binary search
+// instead of a chain of string comparisons. This runs once per field for
+// every sendInputEvent call.
+template<typename T, size_t N>
+bool FindConstant(const StringToConstant<T> (&table)[N],
+                  const std::string& name,
+                  T* out) {
+  const StringToConstant<T>* end = table + N;
+  const StringToConstant<T>* iter = std::lower_bound(
+      table, end, name,
+      [](const StringToConstant<T>& entry, const std::string& name) {
+        return strcmp(entry.name, name.c_str()) < 0;
+      });
+  if (iter == end || name != iter->name)
+    return false;
+  *out = iter->value;
+  return true;
+}
+
+const StringToConstant<blink::WebInputEvent::Type> kEventTypes[] = {
+    {"char", blink::WebInputEvent::Char},
+    {"contextmenu", blink::WebInputEvent::ContextMenu},
+    {"keydown", blink::WebInputEvent::RawKeyDown},
+    {"keyup", blink::WebInputEvent::KeyUp},
+    {"mousedown", blink::WebInputEvent::MouseDown},
+    {"mouseenter", blink::WebInputEvent::MouseEnter},
+    {"mouseleave", blink::WebInputEvent::MouseLeave},
+    {"mousemove", blink::WebInputEvent::MouseMove},
+    {"mouseup", blink::WebInputEvent::MouseUp},
+    {"mousewheel", blink::WebInputEvent::MouseWheel},
+    {"touchcancel", blink::WebInputEvent::TouchCancel},
+    {"touchend", blink::WebInputEvent::TouchEnd},
+    {"touchmove", blink::WebInputEvent::TouchMove},
+    {"touchstart", blink::WebInputEvent::TouchStart},
+};
+
+const StringToConstant<blink::WebMouseEvent::Button> kMouseButtons[] = {
+    {"left", blink::WebMouseEvent::Button::Left},
+    {"middle", blink::WebMouseEvent::Button::Middle},
+    {"right", blink::WebMouseEvent::Button::Right},
+};
+
+const StringToConstant<blink::WebInputEvent::Modifiers> kModifiers[] = {
+    {"alt", blink::WebInputEvent::AltKey},
+    {"capslock", blink::WebInputEvent::CapsLockOn},
+    {"cmd", blink::WebInputEvent::MetaKey},
+    {"command", blink::WebInputEvent::MetaKey},
+    {"control", blink::WebInputEvent::ControlKey},
+    {"ctrl", blink::WebInputEvent::ControlKey},
+    {"isautorepeat", blink::WebInputEvent::IsAutoRepeat},
+    {"iskeypad", blink::WebInputEvent::IsKeyPad},
+    {"left", blink::WebInputEvent::IsLeft},
+    {"leftbuttondown", blink::WebInputEvent::LeftButtonDown},
+    {"meta", blink::WebInputEvent::MetaKey},
+    {"middlebuttondown", blink::WebInputEvent::MiddleButtonDown},
+    {"numlock", blink::WebInputEvent::NumLockOn},
+    {"right", blink::WebInputEvent::IsRight},
+    {"rightbuttondown", blink::WebInputEvent::RightButtonDown},
+    {"shift", blink::WebInputEvent::ShiftKey},
+};
+
 }  // namespace
 
 namespace mate {
@@ -53,34 +123,7 @@ struct Converter<blink::WebInputEvent::Type> {
   static bool FromV8(v8::Isolate* isolate, v8::Handle<v8::Value> val,
                      blink::WebInputEvent::Type* out) {
     std::string type = base::ToLowerASCII(V8ToString(val));
-    if (type == "mousedown")
-      *out = blink::WebInputEvent::MouseDown;
-    else if (type == "mouseup")
-      *out = blink::WebInputEvent::MouseUp;
-    else if (type == "mousemove")
-      *out = blink::WebInputEvent::MouseMove;
-    else if (type == "mouseenter")
-      *out = blink::WebInputEvent::MouseEnter;
-    else if (type == "mouseleave")
-      *out = blink::WebInputEvent::MouseLeave;
-    else if (type == "contextmenu")
-      *out = blink::WebInputEvent::ContextMenu;
-    else if (type == "mousewheel")
-      *out = blink::WebInputEvent::MouseWheel;
-    else if (type == "keydown")
-      *out = blink::WebInputEvent::RawKeyDown;
-    else if (type == "keyup")
-      *out = blink::WebInputEvent::KeyUp;
-    else if (type == "char")
-      *out = blink::WebInputEvent::Char;
-    else if (type == "touchstart")
-      *out = blink::WebInputEvent::TouchStart;
-    else if (type == "touchmove")
-      *out = blink::WebInputEvent::TouchMove;
-    else if (type == "touchend")
-      *out = blink::WebInputEvent::TouchEnd;
-    else if (type == "touchcancel")
-      *out = blink::WebInputEvent::TouchCancel;
+    FindConstant(kEventTypes, type, out);
     return true;
   }
 };
@@ -90,15 +133,7 @@ struct Converter<blink::WebMouseEvent::Button> {
   static bool FromV8(v8::Isolate* isolate, v8::Handle<v8::Value> val,
                      blink::WebMouseEvent::Button* out) {
     std::string button = base::ToLowerASCII(V8ToString(val));
-    if (button == "left")
-      *out = blink::WebMouseEvent::Button::Left;
-    else if (button == "middle")
-      *out = blink::WebMouseEvent::Button::Middle;
-    else if (button == "right")
-      *out = blink::WebMouseEvent::Button::Right;
-    else
-      return false;
-    return true;
+    return FindConstant(kMouseButtons, button, out);
   }
 };
 
@@ -107,32 +142,7 @@ struct Converter<blink::WebInputEvent::Modifiers> {
   static bool FromV8(v8::Isolate* isolate, v8::Handle<v8::Value> val,
                      blink::WebInputEvent::Modifiers* out) {
     std::string modifier = base::ToLowerASCII(V8ToString(val));
-    if (modifier == "shift")
-      *out = blink::WebInputEvent::ShiftKey;
-    else if (modifier == "control" || modifier == "ctrl")
-      *out = blink::WebInputEvent::ControlKey;
-    else if (modifier == "alt")
-      *out = blink::WebInputEvent::AltKey;
-    else if (modifier == "meta" || modifier == "command" || modifier == "cmd")
-      *out = blink::WebInputEvent::MetaKey;
-    else if (modifier == "iskeypad")
-      *out = blink::WebInputEvent::IsKeyPad;
-    else if (modifier == "isautorepeat")
-      *out = blink::WebInputEvent::IsAutoRepeat;
-    else if (modifier == "leftbuttondown")
-      *out = blink::WebInputEvent::LeftButtonDown;
-    else if (modifier == "middlebuttondown")
-      *out = blink::WebInputEvent::MiddleButtonDown;
-    else if (modifier == "rightbuttondown")
-      *out = blink::WebInputEvent::RightButtonDown;
-    else if (modifier == "capslock")
-      *out = blink::WebInputEvent::CapsLockOn;
-    else if (modifier == "numlock")
-      *out = blink::WebInputEvent::NumLockOn;
-    else if (modifier == "left")
-      *out = blink::WebInputEvent::IsLeft;
-    else if (modifier == "right")
-      *out = blink::WebInputEvent::IsRight;
+    FindConstant(kModifiers, modifier, out);
     return true;
   }
 };
@@ -359,19 +369,19 @@ v8::Local<v8::Value> Converter<blink::WebContextMenuData::MediaType>::ToV8(
       v8::Isolate* isolate, const blink::WebContextMenuData::MediaType& in) {
   switch (in) {
     case blink::WebContextMenuData::MediaTypeImage:
-      return mate::StringToV8(isolate, "image");
+      return mate::InternedString(isolate, "image");
     case blink::WebContextMenuData::MediaTypeVideo:
-      return mate::StringToV8(isolate, "video");
+      return mate::InternedString(isolate, "video");
     case blink::WebContextMenuData::MediaTypeAudio:
-      return mate::StringToV8(isolate, "audio");
+      return mate::InternedString(isolate, "audio");
     case blink::WebContextMenuData::MediaTypeCanvas:
-      return mate::StringToV8(isolate, "canvas");
+      return mate::InternedString(isolate, "canvas");
     case blink::WebContextMenuData::MediaTypeFile:
-      return mate::StringToV8(isolate, "file");
+      return mate::InternedString(isolate, "file");
     case blink::WebContextMenuData::MediaTypePlugin:
-      return mate::StringToV8(isolate, "plugin");
+      return mate::InternedString(isolate, "plugin");
     default:
-      return mate::StringToV8(isolate, "none");
+      return mate::InternedString(isolate, "none");
   }
 }
 
@@ -381,13 +391,13 @@ v8::Local<v8::Value> Converter<blink::WebContextMenuData::InputFieldType>::ToV8(
       const blink::WebContextMenuData::InputFieldType& in) {
   switch (in) {
     case blink::WebContextMenuData::InputFieldTypePlainText:
-      return mate::StringToV8(isolate, "plainText");
+      return mate::InternedString(isolate, "plainText");
     case blink::WebContextMenuData::InputFieldTypePassword:
-      return mate::StringToV8(isolate, "password");
+      return mate::InternedString(isolate, "password");
     case blink::WebContextMenuData::InputFieldTypeOther:
-      return mate::StringToV8(isolate, "other");
+      return mate::InternedString(isolate, "other");
     default:
-      return mate::StringToV8(isolate, "none");
+      return mate::InternedString(isolate, "none");
   }
 }
 
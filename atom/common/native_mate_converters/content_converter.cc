@@ -12,6 +12,7 @@
 #include "atom/common/native_mate_converters/blink_converter.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/gurl_converter.h"
+#include "atom/common/native_mate_converters/interned_string.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/common/native_mate_converters/ui_base_types_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
@@ -81,16 +82,16 @@ v8::Local<v8::Value> Converter<content::MenuItem::Type>::ToV8(
     v8::Isolate* isolate, const content::MenuItem::Type& val) {
   switch (val) {
     case content::MenuItem::CHECKABLE_OPTION:
-      return StringToV8(isolate, "checkbox");
+      return InternedString(isolate, "checkbox");
     case content::MenuItem::GROUP:
-      return StringToV8(isolate, "radio");
+      return InternedString(isolate, "radio");
     case content::MenuItem::SEPARATOR:
-      return StringToV8(isolate, "separator");
+      return InternedString(isolate, "separator");
     case content::MenuItem::SUBMENU:
-      return StringToV8(isolate, "submenu");
+      return InternedString(isolate, "submenu");
     case content::MenuItem::OPTION:
     default:
-      return StringToV8(isolate, "normal");
+      return InternedString(isolate, "normal");
   }
 }
 
@@ -150,34 +151,34 @@ v8::Local<v8::Value> Converter<content::PermissionType>::ToV8(
   using PermissionType = atom::WebContentsPermissionHelper::PermissionType;
   switch (val) {
     case content::PermissionType::MIDI_SYSEX:
-      return StringToV8(isolate, "midiSysex");
+      return InternedString(isolate, "midiSysex");
     case content::PermissionType::PUSH_MESSAGING:
-      return StringToV8(isolate, "pushMessaging");
+      return InternedString(isolate, "pushMessaging");
     case content::PermissionType::NOTIFICATIONS:
-      return StringToV8(isolate, "notifications");
+      return InternedString(isolate, "notifications");
     case content::PermissionType::GEOLOCATION:
-      return StringToV8(isolate, "geolocation");
+      return InternedString(isolate, "geolocation");
     case content::PermissionType::AUDIO_CAPTURE:
     case content::PermissionType::VIDEO_CAPTURE:
-      return StringToV8(isolate, "media");
+      return InternedString(isolate, "media");
     case content::PermissionType::PROTECTED_MEDIA_IDENTIFIER:
-      return StringToV8(isolate, "mediaKeySystem");
+      return InternedString(isolate, "mediaKeySystem");
     case content::PermissionType::MIDI:
-      return StringToV8(isolate, "midi");
+      return InternedString(isolate, "midi");
     default:
       break;
   }
 
   if (val == static_cast<content::PermissionType>(PermissionType::POINTER_LOCK))
-    return StringToV8(isolate, "pointerLock");
+    return InternedString(isolate, "pointerLock");
   else if (val ==
            static_cast<content::PermissionType>(PermissionType::FULLSCREEN))
-    return StringToV8(isolate, "fullscreen");
+    return InternedString(isolate, "fullscreen");
   else if (val ==
            static_cast<content::PermissionType>(PermissionType::OPEN_EXTERNAL))
-    return StringToV8(isolate, "openExternal");
+    return InternedString(isolate, "openExternal");
 
-  return StringToV8(isolate, "unknown");
+  return InternedString(isolate, "unknown");
 }
 
 // static
@@ -0,0 +1,83 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_NATIVE_MATE_CONVERTERS_DICTIONARY_SCHEMA_H_
+#define ATOM_COMMON_NATIVE_MATE_CONVERTERS_DICTIONARY_SCHEMA_H_
+
+#include <map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/synchronization/lock.h"
+#include "native_mate/converter.h"
+#include "native_mate/dictionary.h"
+#include "v8/include/v8.h"
+
+namespace mate {
+
+// Declares a fixed set of dictionary keys for an API up front, so that the
+// v8::String for each key is created once per isolate instead of on every
+// lookup. Hot APIs that parse the same options dictionary on each call
+// declare their schema statically and look keys up by index:
+//
+//   static const mate::DictionarySchema kSchema({"userAgent", "referrer"});
+//   std::string user_agent;
+//   kSchema.Get(options, 0, &user_agent);
+class DictionarySchema {
+ public:
+  explicit DictionarySchema(std::initializer_list<const char*> keys)
+      : keys_(keys) {}
+
+  // Typed lookup of key |index|, using the interned key handle. Returns
+  // false when the key is absent or the value does not convert.
+  template <typename T>
+  bool Get(const mate::Dictionary& dict, size_t index, T* out) const {
+    v8::Isolate* isolate = dict.isolate();
+    v8::Local<v8::Value> value;
+    if (!GetRaw(isolate, dict.GetHandle(), index, &value))
+      return false;
+    return mate::ConvertFromV8(isolate, value, out);
+  }
+
+  // Returns the raw value of key |index| in |object|, or false when the
+  // property is absent or undefined.
+  bool GetRaw(v8::Isolate* isolate,
+              v8::Local<v8::Object> object,
+              size_t index,
+              v8::Local<v8::Value>* out) const {
+    v8::Local<v8::Value> value = object->Get(GetKey(isolate, index));
+    if (value.IsEmpty() || value->IsUndefined())
+      return false;
+    *out = value;
+    return true;
+  }
+
+  // Returns the interned v8::String for key |index| on |isolate|.
+  v8::Local<v8::String> GetKey(v8::Isolate* isolate, size_t index) const {
+    base::AutoLock auto_lock(lock_);
+    std::vector<v8::Eternal<v8::String>>& keys = per_isolate_[isolate];
+    if (keys.empty())
+      keys.resize(keys_.size());
+    if (keys[index].IsEmpty()) {
+      keys[index].Set(isolate, v8::String::NewFromUtf8(
+          isolate, keys_[index], v8::NewStringType::kInternalized)
+              .ToLocalChecked());
+    }
+    return keys[index].Get(isolate);
+  }
+
+ private:
+  const std::vector<const char*> keys_;
+
+  // Lazily populated per-isolate table of interned key handles.
+  mutable base::Lock lock_;
+  mutable std::map<v8::Isolate*, std::vector<v8::Eternal<v8::String>>>
+      per_isolate_;
+
+  DISALLOW_COPY_AND_ASSIGN(DictionarySchema);
+};
+
+}  // namespace mate
+
+#endif  // ATOM_COMMON_NATIVE_MATE_CONVERTERS_DICTIONARY_SCHEMA_H_
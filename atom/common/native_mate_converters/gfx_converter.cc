@@ -4,6 +4,7 @@
 
 #include "atom/common/native_mate_converters/gfx_converter.h"
 
+#include "atom/common/native_mate_converters/interned_string.h"
 #include "native_mate/dictionary.h"
 #include "ui/display/display.h"
 #include "ui/display/screen.h"
@@ -88,11 +89,11 @@ struct Converter<display::Display::TouchSupport> {
                                     const display::Display::TouchSupport& val) {
     switch (val) {
       case display::Display::TOUCH_SUPPORT_AVAILABLE:
-        return StringToV8(isolate, "available");
+        return InternedString(isolate, "available");
       case display::Display::TOUCH_SUPPORT_UNAVAILABLE:
-        return StringToV8(isolate, "unavailable");
+        return InternedString(isolate, "unavailable");
       default:
-        return StringToV8(isolate, "unknown");
+        return InternedString(isolate, "unknown");
     }
   }
 };
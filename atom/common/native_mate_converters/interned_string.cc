@@ -0,0 +1,50 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/native_mate_converters/interned_string.h"
+
+#include <map>
+#include <unordered_map>
+
+#include "base/lazy_instance.h"
+#include "base/synchronization/lock.h"
+
+namespace mate {
+
+namespace {
+
+// Lazily populated table of interned string handles, one map per isolate.
+// Keys are literal addresses: the compiler pools identical literals per
+// translation unit, so a hot call site always hits the same entry.
+struct InternedStringCache {
+  base::Lock lock;
+  std::map<v8::Isolate*, std::unordered_map<const char*, v8::Eternal<v8::String>>>
+      per_isolate;
+};
+
+base::LazyInstance<InternedStringCache>::Leaky g_interned_strings =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+v8::Local<v8::String> InternedString(v8::Isolate* isolate,
+                                     const char* literal) {
+  InternedStringCache& cache = g_interned_strings.Get();
+  base::AutoLock auto_lock(cache.lock);
+  v8::Eternal<v8::String>& handle = cache.per_isolate[isolate][literal];
+  if (handle.IsEmpty()) {
+    handle.Set(isolate, v8::String::NewFromUtf8(
+        isolate, literal, v8::NewStringType::kInternalized)
+            .ToLocalChecked());
+  }
+  return handle.Get(isolate);
+}
+
+void ReleaseInternedStrings(v8::Isolate* isolate) {
+  InternedStringCache& cache = g_interned_strings.Get();
+  base::AutoLock auto_lock(cache.lock);
+  cache.per_isolate.erase(isolate);
+}
+
+}  // namespace mate
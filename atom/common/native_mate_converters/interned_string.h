@@ -0,0 +1,27 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_NATIVE_MATE_CONVERTERS_INTERNED_STRING_H_
+#define ATOM_COMMON_NATIVE_MATE_CONVERTERS_INTERNED_STRING_H_
+
+#include "v8/include/v8.h"
+
+namespace mate {
+
+// Returns an interned v8::String for the C string |literal|. The handle is
+// cached per isolate and keyed by the literal's address, so each call site
+// pays the string allocation once per isolate instead of on every call.
+// |literal| must be a string literal (or otherwise outlive the process);
+// use StringToV8 for dynamically built strings.
+v8::Local<v8::String> InternedString(v8::Isolate* isolate,
+                                     const char* literal);
+
+// Drops all handles cached for |isolate|. Must be called when an isolate
+// is torn down (e.g. a web worker exits), otherwise its entries would
+// outlive it and accumulate across worker restarts.
+void ReleaseInternedStrings(v8::Isolate* isolate);
+
+}  // namespace mate
+
+#endif  // ATOM_COMMON_NATIVE_MATE_CONVERTERS_INTERNED_STRING_H_
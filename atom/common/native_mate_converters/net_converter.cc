@@ -4,11 +4,15 @@
 
 #include "atom/common/native_mate_converters/net_converter.h"
 
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atom/common/native_mate_converters/gurl_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
+#include "base/containers/mru_cache.h"
+#include "base/lazy_instance.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/values.h"
@@ -28,6 +32,48 @@ namespace mate {
 
 namespace {
 
+// Lowercased (name, value) pairs in wire order. A flat list avoids the
+// per-header dictionary lookups and list allocations of the old
+// DictionaryValue-based conversion.
+using HeaderPairs = std::vector<std::pair<std::string, std::string>>;
+
+// The same net::HttpResponseHeaders instance gets converted repeatedly —
+// once for each webRequest event, again for URLRequest's response event —
+// so enumerate it only once and reuse the snapshot. The headers object is
+// immutable and refcounted; the snapshot holds a reference, which also
+// guarantees a cache hit on the raw pointer refers to the same object.
+// Only ever touched from the JS thread, like all v8 conversions.
+const size_t kMaxHeaderSnapshots = 32;
+
+struct HeaderSnapshot {
+  scoped_refptr<net::HttpResponseHeaders> headers;
+  HeaderPairs pairs;
+};
+
+struct HeaderSnapshotCache {
+  HeaderSnapshotCache() : cache(kMaxHeaderSnapshots) {}
+  base::MRUCache<net::HttpResponseHeaders*, HeaderSnapshot> cache;
+};
+
+base::LazyInstance<HeaderSnapshotCache>::Leaky g_header_snapshots =
+    LAZY_INSTANCE_INITIALIZER;
+
+const HeaderPairs& GetHeaderSnapshot(net::HttpResponseHeaders* headers) {
+  auto& cache = g_header_snapshots.Get().cache;
+  auto cached = cache.Get(headers);
+  if (cached != cache.end())
+    return cached->second.pairs;
+
+  HeaderSnapshot snapshot;
+  snapshot.headers = headers;
+  size_t iter = 0;
+  std::string key;
+  std::string value;
+  while (headers->EnumerateHeaderLines(&iter, &key, &value))
+    snapshot.pairs.push_back(std::make_pair(base::ToLowerASCII(key), value));
+  return cache.Put(headers, std::move(snapshot))->second.pairs;
+}
+
 bool CertFromData(const std::string& data,
     scoped_refptr<net::X509Certificate>* out) {
   auto cert_list = net::X509Certificate::CreateCertificateListFromBytes(
@@ -144,25 +190,24 @@ v8::Local<v8::Value> Converter<net::CertPrincipal>::ToV8(
 v8::Local<v8::Value> Converter<net::HttpResponseHeaders*>::ToV8(
     v8::Isolate* isolate,
     net::HttpResponseHeaders* headers) {
-  base::DictionaryValue response_headers;
-  if (headers) {
-    size_t iter = 0;
-    std::string key;
-    std::string value;
-    while (headers->EnumerateHeaderLines(&iter, &key, &value)) {
-      key = base::ToLowerASCII(key);
-      if (response_headers.HasKey(key)) {
-        base::ListValue* values = nullptr;
-        if (response_headers.GetList(key, &values))
-          values->AppendString(value);
-      } else {
-        std::unique_ptr<base::ListValue> values(new base::ListValue());
-        values->AppendString(value);
-        response_headers.Set(key, std::move(values));
-      }
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+  if (!headers)
+    return dict.GetHandle();
+
+  // Build {name: [values...]} straight from the cached flat snapshot,
+  // skipping the intermediate base::DictionaryValue entirely.
+  std::map<std::string, v8::Local<v8::Array>> arrays;
+  for (const auto& pair : GetHeaderSnapshot(headers)) {
+    auto array = arrays.find(pair.first);
+    if (array == arrays.end()) {
+      v8::Local<v8::Array> values = v8::Array::New(isolate);
+      dict.Set(pair.first, values);
+      array = arrays.insert(std::make_pair(pair.first, values)).first;
     }
+    array->second->Set(array->second->Length(),
+                       StringToV8(isolate, pair.second));
   }
-  return ConvertToV8(isolate, response_headers);
+  return dict.GetHandle();
 }
 
 }  // namespace mate
@@ -171,15 +216,20 @@ namespace atom {
 
 void FillRequestDetails(base::DictionaryValue* details,
                         const net::URLRequest* request) {
-  details->SetString("method", request->method());
+  // These are hot on the IO thread; the WithoutPathExpansion setters skip
+  // the per-key path splitting since none of the keys contain dots.
+  details->SetStringWithoutPathExpansion("method", request->method());
   std::string url;
   if (!request->url_chain().empty()) url = request->url().spec();
   details->SetStringWithoutPathExpansion("url", url);
-  details->SetString("referrer", request->referrer());
-  std::unique_ptr<base::ListValue> list(new base::ListValue);
-  GetUploadData(list.get(), request);
-  if (!list->empty())
-    details->Set("uploadData", std::move(list));
+  details->SetStringWithoutPathExpansion("referrer", request->referrer());
+  // Don't allocate the list for the common body-less request.
+  if (request->get_upload()) {
+    std::unique_ptr<base::ListValue> list(new base::ListValue);
+    GetUploadData(list.get(), request);
+    if (!list->empty())
+      details->SetWithoutPathExpansion("uploadData", std::move(list));
+  }
 }
 
 void GetUploadData(base::ListValue* upload_data_list,
@@ -198,7 +248,7 @@ void GetUploadData(base::ListValue* upload_data_list,
       std::unique_ptr<base::Value> bytes(
           base::BinaryValue::CreateWithCopiedBuffer(bytes_reader->bytes(),
                                                     bytes_reader->length()));
-      upload_data_dict->Set("bytes", std::move(bytes));
+      upload_data_dict->SetWithoutPathExpansion("bytes", std::move(bytes));
     } else if (reader->AsFileReader()) {
       const net::UploadFileElementReader* file_reader =
           reader->AsFileReader();
@@ -207,7 +257,8 @@ void GetUploadData(base::ListValue* upload_data_list,
     } else {
       const storage::UploadBlobElementReader* blob_reader =
           static_cast<storage::UploadBlobElementReader*>(reader.get());
-      upload_data_dict->SetString("blobUUID", blob_reader->uuid());
+      upload_data_dict->SetStringWithoutPathExpansion("blobUUID",
+                                                      blob_reader->uuid());
     }
     upload_data_list->Append(std::move(upload_data_dict));
   }
@@ -10,6 +10,7 @@
 #include <utility>
 
 #include "base/logging.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
 #include "native_mate/dictionary.h"
 
@@ -150,6 +151,7 @@ void V8ValueConverter::SetDisableNode(bool val) {
 
 v8::Local<v8::Value> V8ValueConverter::ToV8Value(
     const base::Value* value, v8::Local<v8::Context> context) const {
+  TRACE_EVENT0("electron", "V8ValueConverter::ToV8Value");
   v8::Context::Scope context_scope(context);
   v8::EscapableHandleScope handle_scope(context->GetIsolate());
   return handle_scope.Escape(ToV8ValueImpl(context->GetIsolate(), value));
@@ -158,6 +160,7 @@ v8::Local<v8::Value> V8ValueConverter::ToV8Value(
 base::Value* V8ValueConverter::FromV8Value(
     v8::Local<v8::Value> val,
     v8::Local<v8::Context> context) const {
+  TRACE_EVENT0("electron", "V8ValueConverter::FromV8Value");
   v8::Context::Scope context_scope(context);
   v8::HandleScope handle_scope(context->GetIsolate());
   FromV8ValueState state;
@@ -367,6 +370,23 @@ base::Value* V8ValueConverter::FromV8ValueImpl(
     return FromNodeBuffer(val, state, isolate);
   }
 
+  // Carry raw binary data as a single blob. Without these checks typed
+  // arrays fall through to FromV8Object and get converted element by
+  // element as indexed properties.
+  if (val->IsArrayBuffer()) {
+    v8::ArrayBuffer::Contents contents = val.As<v8::ArrayBuffer>()->GetContents();
+    const char* data = static_cast<const char*>(contents.Data());
+    std::vector<char> buffer(data, data + contents.ByteLength());
+    return new base::Value(std::move(buffer));
+  }
+
+  if (val->IsArrayBufferView()) {
+    v8::Local<v8::ArrayBufferView> view = val.As<v8::ArrayBufferView>();
+    std::vector<char> buffer(view->ByteLength());
+    view->CopyContents(buffer.data(), buffer.size());
+    return new base::Value(std::move(buffer));
+  }
+
   if (val->IsObject()) {
     return FromV8Object(val->ToObject(), state, isolate);
   }
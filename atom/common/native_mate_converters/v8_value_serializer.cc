@@ -0,0 +1,60 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/native_mate_converters/v8_value_serializer.h"
+
+#include <stdlib.h>
+
+#include <utility>
+
+namespace atom {
+
+namespace {
+
+class SerializerDelegate : public v8::ValueSerializer::Delegate {
+ public:
+  explicit SerializerDelegate(v8::Isolate* isolate) : isolate_(isolate) {}
+
+  void ThrowDataCloneError(v8::Local<v8::String> message) override {
+    isolate_->ThrowException(v8::Exception::Error(message));
+  }
+
+ private:
+  v8::Isolate* isolate_;
+};
+
+}  // namespace
+
+bool SerializeV8Value(v8::Isolate* isolate,
+                      v8::Local<v8::Value> value,
+                      std::vector<uint8_t>* out) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  SerializerDelegate delegate(isolate);
+  v8::ValueSerializer serializer(isolate, &delegate);
+  serializer.WriteHeader();
+
+  bool ok = false;
+  if (!serializer.WriteValue(context, value).To(&ok) || !ok)
+    return false;
+
+  std::pair<uint8_t*, size_t> buffer = serializer.Release();
+  out->assign(buffer.first, buffer.first + buffer.second);
+  free(buffer.first);
+  return true;
+}
+
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        const std::vector<uint8_t>& data) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::ValueDeserializer deserializer(isolate, data.data(), data.size());
+  if (!deserializer.ReadHeader(context).FromMaybe(false))
+    return v8::Local<v8::Value>();
+
+  v8::Local<v8::Value> value;
+  if (!deserializer.ReadValue(context).ToLocal(&value))
+    return v8::Local<v8::Value>();
+  return value;
+}
+
+}  // namespace atom
@@ -0,0 +1,30 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_NATIVE_MATE_CONVERTERS_V8_VALUE_SERIALIZER_H_
+#define ATOM_COMMON_NATIVE_MATE_CONVERTERS_V8_VALUE_SERIALIZER_H_
+
+#include <vector>
+
+#include "v8/include/v8.h"
+
+namespace atom {
+
+// Serializes |value| with v8's structured clone algorithm into a contiguous
+// buffer. Unlike V8ValueConverter this writes the object graph directly,
+// without building an intermediate base::Value tree, so deep objects and
+// typed arrays serialize in one pass. Returns false when |value| is not
+// cloneable (e.g. contains functions).
+bool SerializeV8Value(v8::Isolate* isolate,
+                      v8::Local<v8::Value> value,
+                      std::vector<uint8_t>* out);
+
+// Reconstructs a value previously produced by SerializeV8Value. Returns an
+// empty handle on malformed input.
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        const std::vector<uint8_t>& data);
+
+}  // namespace atom
+
+#endif  // ATOM_COMMON_NATIVE_MATE_CONVERTERS_V8_VALUE_SERIALIZER_H_
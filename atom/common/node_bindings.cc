@@ -4,12 +4,14 @@
 
 #include "atom/common/node_bindings.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 #include "atom/common/api/event_emitter_caller.h"
 #include "atom/common/api/locker.h"
 #include "atom/common/atom_command_line.h"
+#include "atom/common/event_loop_stats.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
 #include "base/base_paths.h"
 #include "base/command_line.h"
@@ -18,6 +20,7 @@
 #include "base/path_service.h"
 #include "base/run_loop.h"
 #include "base/threading/thread_task_runner_handle.h"
+#include "base/time/time.h"
 #include "base/trace_event/trace_event.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/common/content_paths.h"
@@ -80,6 +83,12 @@ std::unique_ptr<const char*[]> StringVectorToArgArray(
   return array;
 }
 
+// After this many consecutive idle zero-timeout polls the embed thread
+// starts polling with a gradually growing timeout instead of zero, capped
+// at this many milliseconds.
+const int kIdlePollThreshold = 8;
+const int kMaxIdlePollMs = 16;
+
 base::FilePath GetResourcesPath(bool is_browser) {
   auto command_line = base::CommandLine::ForCurrentProcess();
   base::FilePath exec_path(command_line->GetProgram());
@@ -102,6 +111,7 @@ NodeBindings::NodeBindings(BrowserEnvironment browser_env)
     : browser_env_(browser_env),
       uv_loop_(browser_env == WORKER ? uv_loop_new() : uv_default_loop()),
       embed_closed_(false),
+      uv_loop_has_pending_immediates_(false),
       uv_env_(nullptr),
       weak_factory_(this) {
 }
@@ -234,6 +244,16 @@ void NodeBindings::UvRunOnce() {
   if (!env)
     return;
 
+  base::TimeTicks tick_start = base::TimeTicks::Now();
+  base::TimeDelta latency;
+  {
+    base::AutoLock auto_lock(wakeup_time_lock_);
+    if (!wakeup_requested_time_.is_null()) {
+      latency = tick_start - wakeup_requested_time_;
+      wakeup_requested_time_ = base::TimeTicks();
+    }
+  }
+
   // Use Locker in browser process.
   mate::Locker locker(env->isolate());
   v8::HandleScope handle_scope(env->isolate());
@@ -257,12 +277,29 @@ void NodeBindings::UvRunOnce() {
   if (r == 0)
     base::RunLoop().QuitWhenIdle();  // Quit from uv.
 
+  event_loop_stats::RecordTick(latency,
+                               base::TimeTicks::Now() - tick_start);
+
+  // A zero backend timeout right after a tick is not necessarily an idle
+  // spin: node keeps an idle handle active while setImmediate callbacks
+  // are queued. Publish that so the embed thread does not back off while
+  // the loop is chunking productive work across iterations.
+  uv_loop_has_pending_immediates_ = uv_is_active(
+      reinterpret_cast<uv_handle_t*>(env->immediate_idle_handle()));
+
   // Tell the worker thread to continue polling.
   uv_sem_post(&embed_sem_);
 }
 
 void NodeBindings::WakeupMainThread() {
   DCHECK(task_runner_);
+  {
+    // Only remember the oldest pending wakeup, the latency of interest is
+    // from the first request to the tick that serves it.
+    base::AutoLock auto_lock(wakeup_time_lock_);
+    if (wakeup_requested_time_.is_null())
+      wakeup_requested_time_ = base::TimeTicks::Now();
+  }
   task_runner_->PostTask(FROM_HERE, base::Bind(&NodeBindings::UvRunOnce,
                                                weak_factory_.GetWeakPtr()));
 }
@@ -274,6 +311,7 @@ void NodeBindings::WakeupEmbedThread() {
 // static
 void NodeBindings::EmbedThreadRunner(void *arg) {
   NodeBindings* self = static_cast<NodeBindings*>(arg);
+  int zero_timeout_polls = 0;
 
   while (true) {
     // Wait for the main loop to deal with events.
@@ -281,12 +319,36 @@ void NodeBindings::EmbedThreadRunner(void *arg) {
     if (self->embed_closed_)
       break;
 
+    // The platform pollers sleep for exactly the backend timeout, so a
+    // loop that only holds long-range timers already wakes up just before
+    // the nearest deadline. What does generate idle wakeups is libuv
+    // reporting a zero timeout over and over for a handle that stays
+    // pending without becoming actionable: the embed thread and the main
+    // thread then ping-pong at full speed. A zero timeout is not idle
+    // when the preceding tick left immediates queued (a recursive
+    // setImmediate loop is productive work chunked across iterations) or
+    // when the poll actually reports readiness, so both reset the
+    // counter. Genuinely idle spins are slowed down by widening the poll
+    // timeout gradually instead of sleeping; uv_async_send from
+    // WakeupEmbedThread makes the backend fd readable, so new work still
+    // interrupts the wait immediately.
+    int timeout = uv_backend_timeout(self->uv_loop_);
+    if (timeout != 0 || self->uv_loop_has_pending_immediates_) {
+      zero_timeout_polls = 0;
+    } else if (++zero_timeout_polls > kIdlePollThreshold) {
+      timeout = std::min(zero_timeout_polls - kIdlePollThreshold,
+                         kMaxIdlePollMs);
+    }
+    if (self->embed_closed_)
+      break;
+
     // Wait for something to happen in uv loop.
     // Note that the PollEvents() is implemented by derived classes, so when
     // this class is being destructed the PollEvents() would not be available
     // anymore. Because of it we must make sure we only invoke PollEvents()
     // when this class is alive.
-    self->PollEvents();
+    if (self->PollEvents(timeout))
+      zero_timeout_polls = 0;
     if (self->embed_closed_)
       break;
 
@@ -8,6 +8,8 @@
 #include "base/macros.h"
 #include "base/memory/weak_ptr.h"
 #include "base/single_thread_task_runner.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
 #include "v8/include/v8.h"
 #include "vendor/node/deps/uv/include/uv.h"
 
@@ -57,8 +59,10 @@ class NodeBindings {
  protected:
   explicit NodeBindings(BrowserEnvironment browser_env);
 
-  // Called to poll events in new thread.
-  virtual void PollEvents() = 0;
+  // Called to poll events in new thread. Waits at most |timeout_ms|
+  // milliseconds (-1 means wait indefinitely) and returns whether the poll
+  // reported ready events instead of timing out.
+  virtual bool PollEvents(int timeout_ms) = 0;
 
   // Run the libuv loop for once.
   void UvRunOnce();
@@ -85,6 +89,13 @@ class NodeBindings {
   // Whether the libuv loop has ended.
   bool embed_closed_;
 
+  // Whether the last uv tick left setImmediate callbacks queued, in which
+  // case the next zero backend timeout means productive work chunked
+  // across iterations rather than an idle spin. Written on the main
+  // thread before posting |embed_sem_|, read on the embed thread after
+  // waiting on it.
+  bool uv_loop_has_pending_immediates_;
+
   // Dummy handle to make uv's loop not quit.
   uv_async_t dummy_uv_handle_;
 
@@ -97,6 +108,12 @@ class NodeBindings {
   // Environment that to wrap the uv loop.
   node::Environment* uv_env_;
 
+  // When the embed thread last asked for a tick, so UvRunOnce can report
+  // the scheduling latency. Written on the embed thread, consumed on the
+  // main thread.
+  base::Lock wakeup_time_lock_;
+  base::TimeTicks wakeup_requested_time_;
+
   base::WeakPtrFactory<NodeBindings> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(NodeBindings);
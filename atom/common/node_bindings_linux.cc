@@ -38,15 +38,14 @@ void NodeBindingsLinux::OnWatcherQueueChanged(uv_loop_t* loop) {
   self->WakeupEmbedThread();
 }
 
-void NodeBindingsLinux::PollEvents() {
-  int timeout = uv_backend_timeout(uv_loop_);
-
+bool NodeBindingsLinux::PollEvents(int timeout_ms) {
   // Wait for new libuv events.
   int r;
   do {
     struct epoll_event ev;
-    r = epoll_wait(epoll_, &ev, 1, timeout);
+    r = epoll_wait(epoll_, &ev, 1, timeout_ms);
   } while (r == -1 && errno == EINTR);
+  return r > 0;
 }
 
 // static
@@ -21,7 +21,7 @@ class NodeBindingsLinux : public NodeBindings {
   // Called when uv's watcher queue changes.
   static void OnWatcherQueueChanged(uv_loop_t* loop);
 
-  void PollEvents() override;
+  bool PollEvents(int timeout_ms) override;
 
   // Epoll to poll for uv's backend fd.
   int epoll_;
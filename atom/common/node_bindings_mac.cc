@@ -38,12 +38,11 @@ void NodeBindingsMac::OnWatcherQueueChanged(uv_loop_t* loop) {
   self->WakeupEmbedThread();
 }
 
-void NodeBindingsMac::PollEvents() {
+bool NodeBindingsMac::PollEvents(int timeout_ms) {
   struct timeval tv;
-  int timeout = uv_backend_timeout(uv_loop_);
-  if (timeout != -1) {
-    tv.tv_sec = timeout / 1000;
-    tv.tv_usec = (timeout % 1000) * 1000;
+  if (timeout_ms != -1) {
+    tv.tv_sec = timeout_ms / 1000;
+    tv.tv_usec = (timeout_ms % 1000) * 1000;
   }
 
   fd_set readset;
@@ -55,8 +54,9 @@ void NodeBindingsMac::PollEvents() {
   int r;
   do {
     r = select(fd + 1, &readset, nullptr, nullptr,
-               timeout == -1 ? nullptr : &tv);
+               timeout_ms == -1 ? nullptr : &tv);
   } while (r == -1 && errno == EINTR);
+  return r > 0;
 }
 
 // static
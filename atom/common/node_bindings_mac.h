@@ -21,7 +21,7 @@ class NodeBindingsMac : public NodeBindings {
   // Called when uv's watcher queue changes.
   static void OnWatcherQueueChanged(uv_loop_t* loop);
 
-  void PollEvents() override;
+  bool PollEvents(int timeout_ms) override;
 
   DISALLOW_COPY_AND_ASSIGN(NodeBindingsMac);
 };
@@ -21,27 +21,28 @@ NodeBindingsWin::NodeBindingsWin(BrowserEnvironment browser_env)
 NodeBindingsWin::~NodeBindingsWin() {
 }
 
-void NodeBindingsWin::PollEvents() {
-  // If there are other kinds of events pending, uv_backend_timeout will
-  // instruct us not to wait.
-  DWORD bytes, timeout;
+bool NodeBindingsWin::PollEvents(int timeout_ms) {
+  DWORD bytes;
   ULONG_PTR key;
   OVERLAPPED* overlapped;
 
-  timeout = uv_backend_timeout(uv_loop_);
-
   GetQueuedCompletionStatus(uv_loop_->iocp,
                             &bytes,
                             &key,
                             &overlapped,
-                            timeout);
+                            timeout_ms == -1
+                                ? INFINITE
+                                : static_cast<DWORD>(timeout_ms));
+
+  if (overlapped == NULL)
+    return false;  // Timed out, nothing was dequeued.
 
   // Give the event back so libuv can deal with it.
-  if (overlapped != NULL)
-    PostQueuedCompletionStatus(uv_loop_->iocp,
-                               bytes,
-                               key,
-                               overlapped);
+  PostQueuedCompletionStatus(uv_loop_->iocp,
+                             bytes,
+                             key,
+                             overlapped);
+  return true;
 }
 
 // static
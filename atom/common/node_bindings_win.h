@@ -16,7 +16,7 @@ class NodeBindingsWin : public NodeBindings {
   virtual ~NodeBindingsWin();
 
  private:
-  void PollEvents() override;
+  bool PollEvents(int timeout_ms) override;
 
   DISALLOW_COPY_AND_ASSIGN(NodeBindingsWin);
 };
@@ -57,6 +57,10 @@ const char kTabbingIdentifier[] = "tabbingIdentifier";
 // The menu bar is hidden unless "Alt" is pressed.
 const char kAutoHideMenuBar[] = "autoHideMenuBar";
 
+// Interval in milliseconds for coalescing move/resize events, 0 emits an
+// event for every bounds change.
+const char kBoundsEventCoalescing[] = "boundsEventCoalescing";
+
 // Enable window to be resized larger than screen.
 const char kEnableLargerThanScreen[] = "enableLargerThanScreen";
 
@@ -128,6 +132,11 @@ const char kDisableBlinkFeatures[] = "disableBlinkFeatures";
 // Enable the node integration in WebWorker.
 const char kNodeIntegrationInWorker[] = "nodeIntegrationInWorker";
 
+// Defer creating the node environment until the page first touches a
+// node global, so windows that never use node skip the bootstrap cost.
+// Note that the preload script also only runs on first touch.
+const char kLazyNodeIntegration[] = "lazyNodeIntegration";
+
 // Enable the web view tag.
 const char kWebviewTag[] = "webviewTag";
 
@@ -181,6 +190,9 @@ const char kWebviewTag[]       = "webview-tag";
 // Command switch passed to renderer process to control nodeIntegration.
 const char kNodeIntegrationInWorker[]  = "node-integration-in-worker";
 
+// Create the node environment lazily on first use of a node global.
+const char kLazyNodeIntegration[] = "lazy-node-integration";
+
 // Widevine options
 // Path to Widevine CDM binaries.
 const char kWidevineCdmPath[] = "widevine-cdm-path";
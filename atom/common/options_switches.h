@@ -38,6 +38,7 @@ extern const char kZoomToPageWidth[];
 extern const char kTitleBarStyle[];
 extern const char kTabbingIdentifier[];
 extern const char kAutoHideMenuBar[];
+extern const char kBoundsEventCoalescing[];
 extern const char kEnableLargerThanScreen[];
 extern const char kDarkTheme[];
 extern const char kTransparent[];
@@ -64,6 +65,7 @@ extern const char kScrollBounce[];
 extern const char kBlinkFeatures[];
 extern const char kDisableBlinkFeatures[];
 extern const char kNodeIntegrationInWorker[];
+extern const char kLazyNodeIntegration[];
 extern const char kWebviewTag[];
 
 }   // namespace options
@@ -95,6 +97,7 @@ extern const char kScrollBounce[];
 extern const char kHiddenPage[];
 extern const char kNativeWindowOpen[];
 extern const char kNodeIntegrationInWorker[];
+extern const char kLazyNodeIntegration[];
 extern const char kWebviewTag[];
 
 extern const char kWidevineCdmPath[];
@@ -6,6 +6,7 @@
 #define ATOM_COMMON_PLATFORM_UTIL_H_
 
 #include <string>
+#include <vector>
 
 #include "base/callback_forward.h"
 #include "build/build_config.h"
@@ -28,10 +29,21 @@ typedef base::Callback<void(const std::string&)> OpenExternalCallback;
 // Must be called from the UI thread.
 bool ShowItemInFolder(const base::FilePath& full_path);
 
+// The asynchronous version of ShowItemInFolder. On Windows the blocking
+// shell call runs on a dedicated worker thread, and |callback| receives an
+// empty string on success, or an error string when the call failed or timed
+// out (e.g. on an unreachable network path).
+void ShowItemInFolder(const base::FilePath& full_path,
+                      const OpenExternalCallback& callback);
+
 // Open the given file in the desktop's default manner.
 // Must be called from the UI thread.
 bool OpenItem(const base::FilePath& full_path);
 
+// The asynchronous version of OpenItem.
+void OpenItem(const base::FilePath& full_path,
+              const OpenExternalCallback& callback);
+
 // Open the given external protocol URL in the desktop's default manner.
 // (For example, mailto: URLs in the default mail user agent.)
 bool OpenExternal(
@@ -55,6 +67,11 @@ void OpenExternal(
 // Move a file to trash.
 bool MoveItemToTrash(const base::FilePath& full_path);
 
+// Move several files to trash as one platform operation, paying the shell
+// setup cost (and on Linux, the helper process spawn) once for the whole
+// batch. Returns false when any item could not be trashed.
+bool MoveItemsToTrash(const std::vector<base::FilePath>& full_paths);
+
 void Beep();
 
 }  // namespace platform_util
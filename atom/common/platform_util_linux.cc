@@ -78,10 +78,24 @@ bool ShowItemInFolder(const base::FilePath& full_path) {
   return XDGOpen(dir.value(), true);
 }
 
+void ShowItemInFolder(const base::FilePath& full_path,
+                      const OpenExternalCallback& callback) {
+  // TODO(gabriel): Implement async open if callback is specified
+  callback.Run(ShowItemInFolder(full_path)
+                   ? ""
+                   : "Failed to show item in folder");
+}
+
 bool OpenItem(const base::FilePath& full_path) {
   return XDGOpen(full_path.value(), true);
 }
 
+void OpenItem(const base::FilePath& full_path,
+              const OpenExternalCallback& callback) {
+  // TODO(gabriel): Implement async open if callback is specified
+  callback.Run(OpenItem(full_path) ? "" : "Failed to open item");
+}
+
 bool OpenExternal(const GURL& url, bool activate) {
   // Don't wait for exit, since we don't want to wait for the browser/email
   // client window to close before returning
@@ -98,6 +112,13 @@ void OpenExternal(const GURL& url, bool activate,
 }
 
 bool MoveItemToTrash(const base::FilePath& full_path) {
+  return MoveItemsToTrash(std::vector<base::FilePath>(1, full_path));
+}
+
+bool MoveItemsToTrash(const std::vector<base::FilePath>& full_paths) {
+  if (full_paths.empty())
+    return true;
+
   std::string trash;
   if (getenv(ELECTRON_TRASH) != NULL) {
     trash = getenv(ELECTRON_TRASH);
@@ -116,23 +137,29 @@ bool MoveItemToTrash(const base::FilePath& full_path) {
     }
   }
 
+  // All of the helpers accept multiple paths, so the whole batch is one
+  // process spawn.
   std::vector<std::string> argv;
 
   if (trash.compare("kioclient5") == 0 || trash.compare("kioclient") == 0) {
     argv.push_back(trash);
     argv.push_back("move");
-    argv.push_back(full_path.value());
+    for (const base::FilePath& full_path : full_paths)
+      argv.push_back(full_path.value());
     argv.push_back("trash:/");
   } else if (trash.compare("trash-cli") == 0) {
     argv.push_back("trash-put");
-    argv.push_back(full_path.value());
+    for (const base::FilePath& full_path : full_paths)
+      argv.push_back(full_path.value());
   } else if (trash.compare("gio") == 0) {
     argv.push_back("gio");
     argv.push_back("trash");
-    argv.push_back(full_path.value());
+    for (const base::FilePath& full_path : full_paths)
+      argv.push_back(full_path.value());
   } else {
     argv.push_back(ELECTRON_DEFAULT_TRASH);
-    argv.push_back(full_path.value());
+    for (const base::FilePath& full_path : full_paths)
+      argv.push_back(full_path.value());
   }
   return XDGUtilV(argv, true);
 }
@@ -117,6 +117,15 @@ bool ShowItemInFolder(const base::FilePath& path) {
   return true;
 }
 
+void ShowItemInFolder(const base::FilePath& full_path,
+                      const OpenExternalCallback& callback) {
+  // NSWorkspace must be used from the main thread, so there is nothing to
+  // move off of it; run synchronously and report the result.
+  callback.Run(ShowItemInFolder(full_path)
+                   ? ""
+                   : "Failed to show item in folder");
+}
+
 // This function opens a file.  This doesn't use LaunchServices or NSWorkspace
 // because of two bugs:
 //  1. Incorrect app activation with com.apple.quarantine:
@@ -213,6 +222,13 @@ bool OpenItem(const base::FilePath& full_path) {
   return status == noErr;
 }
 
+void OpenItem(const base::FilePath& full_path,
+              const OpenExternalCallback& callback) {
+  // The AppleEvent is sent without waiting for a reply, so the synchronous
+  // version doesn't block; run it directly.
+  callback.Run(OpenItem(full_path) ? "" : "Failed to open item");
+}
+
 bool OpenExternal(const GURL& url, bool activate) {
   DCHECK([NSThread isMainThread]);
   NSURL* ns_url = net::NSURLWithGURL(url);
@@ -250,6 +266,15 @@ bool MoveItemToTrash(const base::FilePath& full_path) {
   return status;
 }
 
+bool MoveItemsToTrash(const std::vector<base::FilePath>& full_paths) {
+  // NSFileManager has no batch form of trashItemAtURL, but looping here
+  // still crosses the API boundary once per batch instead of once per call.
+  bool all_succeeded = true;
+  for (const base::FilePath& full_path : full_paths)
+    all_succeeded &= MoveItemToTrash(full_path);
+  return all_succeeded;
+}
+
 void Beep() {
   NSBeep();
 }
@@ -18,8 +18,13 @@
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
+#include "base/memory/ref_counted.h"
+#include "base/single_thread_task_runner.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/thread.h"
+#include "base/threading/thread_task_runner_handle.h"
+#include "base/time/time.h"
 #include "base/win/registry.h"
 #include "base/win/scoped_co_mem.h"
 #include "base/win/scoped_com_initializer.h"
@@ -30,6 +35,64 @@
 
 namespace {
 
+// How long an asynchronous shell operation may take before its callback is
+// failed. The shell call itself cannot be aborted - it keeps running on the
+// worker thread - but the app stops waiting for it.
+const int kShellOperationTimeoutSeconds = 20;
+
+// Returns the task runner of the dedicated thread for blocking shell calls,
+// creating the thread on first use. The thread is intentionally leaked.
+scoped_refptr<base::SingleThreadTaskRunner> GetShellTaskRunner() {
+  static base::Thread* thread = nullptr;
+  if (!thread) {
+    thread = new base::Thread("ShellOperations");
+    thread->Start();
+  }
+  return thread->task_runner();
+}
+
+// Runs |callback| at most once, whichever of the worker reply and the
+// timeout gets here first; both arrive on the originating thread.
+void RunShellOperationCallback(
+    scoped_refptr<base::RefCountedData<bool>> responded,
+    const platform_util::OpenExternalCallback& callback,
+    const std::string& error) {
+  if (responded->data)
+    return;
+  responded->data = true;
+  callback.Run(error);
+}
+
+// Performs |operation| on the shell thread and posts the result back.
+void RunShellOperationOnWorker(
+    const base::Callback<bool()>& operation,
+    const std::string& error_message,
+    scoped_refptr<base::SingleThreadTaskRunner> reply_runner,
+    const base::Callback<void(const std::string&)>& reply) {
+  base::win::ScopedCOMInitializer com_initializer;
+  bool success = operation.Run();
+  reply_runner->PostTask(FROM_HERE,
+                         base::Bind(reply, success ? "" : error_message));
+}
+
+// Posts |operation| to the shell thread; |callback| receives |error_message|
+// on failure, or a timeout error when nothing came back in time.
+void RunShellOperation(const base::Callback<bool()>& operation,
+                       const std::string& error_message,
+                       const platform_util::OpenExternalCallback& callback) {
+  auto responded = make_scoped_refptr(new base::RefCountedData<bool>(false));
+  base::Callback<void(const std::string&)> reply =
+      base::Bind(&RunShellOperationCallback, responded, callback);
+  GetShellTaskRunner()->PostTask(
+      FROM_HERE,
+      base::Bind(&RunShellOperationOnWorker, operation, error_message,
+                 base::ThreadTaskRunnerHandle::Get(), reply));
+  base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(
+      FROM_HERE,
+      base::Bind(reply, "Operation timed out"),
+      base::TimeDelta::FromSeconds(kShellOperationTimeoutSeconds));
+}
+
 // Old ShellExecute crashes the process when the command for a given scheme
 // is empty. This function tells if it is.
 bool ValidateShellCommandForScheme(const std::string& scheme) {
@@ -292,6 +355,15 @@ bool ShowItemInFolder(const base::FilePath& full_path) {
   }
 }
 
+void ShowItemInFolder(const base::FilePath& full_path,
+                      const OpenExternalCallback& callback) {
+  RunShellOperation(
+      base::Bind(
+          static_cast<bool (*)(const base::FilePath&)>(&ShowItemInFolder),
+          full_path),
+      "Failed to show item in folder", callback);
+}
+
 bool OpenItem(const base::FilePath& full_path) {
   if (base::DirectoryExists(full_path))
     return ui::win::OpenFolderViaShell(full_path);
@@ -299,6 +371,14 @@ bool OpenItem(const base::FilePath& full_path) {
     return ui::win::OpenFileViaShell(full_path);
 }
 
+void OpenItem(const base::FilePath& full_path,
+              const OpenExternalCallback& callback) {
+  RunShellOperation(
+      base::Bind(static_cast<bool (*)(const base::FilePath&)>(&OpenItem),
+                 full_path),
+      "Failed to open item", callback);
+}
+
 bool OpenExternal(const base::string16& url, bool activate) {
   // Quote the input scheme to be sure that the command does not have
   // parameters unexpected by the external program. This url should already
@@ -323,6 +403,13 @@ void OpenExternal(const base::string16& url, bool activate,
 }
 
 bool MoveItemToTrash(const base::FilePath& path) {
+  return MoveItemsToTrash(std::vector<base::FilePath>(1, path));
+}
+
+bool MoveItemsToTrash(const std::vector<base::FilePath>& full_paths) {
+  if (full_paths.empty())
+    return true;
+
   base::win::ScopedCOMInitializer com_initializer;
   if (!com_initializer.succeeded())
     return false;
@@ -354,22 +441,27 @@ bool MoveItemToTrash(const base::FilePath& path) {
       return false;
   }
 
-  // Create an IShellItem from the supplied source path.
-  base::win::ScopedComPtr<IShellItem> delete_item;
-  if (FAILED(SHCreateItemFromParsingName(path.value().c_str(),
-                                         NULL,
-                                         IID_PPV_ARGS(delete_item.Receive()))))
-    return false;
-
   base::win::ScopedComPtr<IFileOperationProgressSink> delete_sink(
       new DeleteFileProgressSink);
   if (!delete_sink)
     return false;
 
-  // Processes the queued command DeleteItem. This will trigger
-  // the DeleteFileProgressSink to check for Recycle Bin.
-  return SUCCEEDED(pfo->DeleteItem(delete_item.get(), delete_sink.get())) &&
-         SUCCEEDED(pfo->PerformOperations());
+  // Queue one DeleteItem per path; the whole batch is then committed with a
+  // single PerformOperations call.
+  for (const base::FilePath& path : full_paths) {
+    base::win::ScopedComPtr<IShellItem> delete_item;
+    if (FAILED(SHCreateItemFromParsingName(
+            path.value().c_str(),
+            NULL,
+            IID_PPV_ARGS(delete_item.Receive()))))
+      return false;
+
+    // This will trigger the DeleteFileProgressSink to check for Recycle Bin.
+    if (FAILED(pfo->DeleteItem(delete_item.get(), delete_sink.get())))
+      return false;
+  }
+
+  return SUCCEEDED(pfo->PerformOperations());
 }
 
 void Beep() {
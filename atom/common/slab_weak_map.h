@@ -0,0 +1,153 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_SLAB_WEAK_MAP_H_
+#define ATOM_COMMON_SLAB_WEAK_MAP_H_
+
+#include <memory>
+#include <vector>
+
+#include "base/logging.h"
+#include "base/macros.h"
+#include "v8/include/v8.h"
+
+namespace atom {
+
+// Like KeyWeakMap, but it allocates the integer keys itself from a slab:
+// an ID packs a slot index and a generation counter, so resolving one is
+// a bounds check plus a compare instead of a hash lookup. The generation
+// makes IDs of reused slots unique, so a stale ID from a collected object
+// can never resolve to a newer one. Slots freed by GC are put back on the
+// free list in batch on the next Add() rather than one by one inside the
+// weak callbacks, keeping the per-object GC work constant.
+class SlabWeakMap {
+ public:
+  SlabWeakMap() : free_head_(-1) {}
+
+  virtual ~SlabWeakMap() {
+    for (auto& slot : slots_) {
+      if (slot->id != 0)
+        slot->handle.ClearWeak();
+    }
+  }
+
+  // Stores |object| and returns the ID it can be looked up with. IDs are
+  // positive and never zero.
+  int32_t Add(v8::Isolate* isolate, v8::Local<v8::Object> object) {
+    Reclaim();
+
+    int32_t index;
+    if (free_head_ >= 0) {
+      index = free_head_;
+      free_head_ = slots_[index]->next_free;
+    } else {
+      index = static_cast<int32_t>(slots_.size());
+      CHECK_LE(index, kIndexMask) << "SlabWeakMap is full";
+      slots_.push_back(std::unique_ptr<Slot>(new Slot));
+      slots_[index]->index = index;
+      slots_[index]->generation = 0;
+      slots_[index]->self = this;
+    }
+
+    Slot* slot = slots_[index].get();
+    // Generations run 1..kMaxGeneration and wrap, so an ID is never zero
+    // and stays a positive int32.
+    slot->generation = slot->generation % kMaxGeneration + 1;
+    slot->id = (slot->generation << kIndexBits) | index;
+    slot->handle.Reset(isolate, object);
+    slot->handle.SetWeak(slot, OnObjectGC, v8::WeakCallbackType::kParameter);
+    return slot->id;
+  }
+
+  // Gets the object by its |id|.
+  v8::MaybeLocal<v8::Object> Get(v8::Isolate* isolate, int32_t id) {
+    Slot* slot = Resolve(id);
+    if (!slot)
+      return v8::MaybeLocal<v8::Object>();
+    return v8::Local<v8::Object>::New(isolate, slot->handle);
+  }
+
+  // Whether there still is an object with |id|.
+  bool Has(int32_t id) const { return Resolve(id) != nullptr; }
+
+  // Returns all stored objects.
+  std::vector<v8::Local<v8::Object>> Values(v8::Isolate* isolate) const {
+    std::vector<v8::Local<v8::Object>> values;
+    for (const auto& slot : slots_) {
+      if (slot->id != 0)
+        values.emplace_back(v8::Local<v8::Object>::New(isolate, slot->handle));
+    }
+    return values;
+  }
+
+  // Removes the object with |id|.
+  void Remove(int32_t id) {
+    Slot* slot = Resolve(id);
+    if (!slot)
+      return;
+
+    slot->handle.ClearWeak();
+    slot->handle.Reset();
+    slot->id = 0;
+    slot->next_free = free_head_;
+    free_head_ = slot->index;
+  }
+
+ private:
+  // A live object count beyond the index space would mean over a million
+  // tracked wrappers; the remaining bits (minus the sign bit) hold the
+  // generation.
+  static const int kIndexBits = 20;
+  static const int32_t kIndexMask = (1 << kIndexBits) - 1;
+  static const int32_t kMaxGeneration = (1 << (31 - kIndexBits)) - 1;
+
+  struct Slot {
+    int32_t id = 0;  // 0 when the slot is empty.
+    int32_t index = 0;
+    int32_t generation = 0;
+    int32_t next_free = -1;
+    v8::Global<v8::Object> handle;
+    SlabWeakMap* self = nullptr;
+  };
+
+  Slot* Resolve(int32_t id) const {
+    int32_t index = id & kIndexMask;
+    if (id == 0 || static_cast<size_t>(index) >= slots_.size())
+      return nullptr;
+    Slot* slot = slots_[index].get();
+    return slot->id == id ? slot : nullptr;
+  }
+
+  // Moves slots emptied by GC onto the free list.
+  void Reclaim() {
+    for (int32_t index : pending_free_) {
+      slots_[index]->next_free = free_head_;
+      free_head_ = index;
+    }
+    pending_free_.clear();
+  }
+
+  static void OnObjectGC(const v8::WeakCallbackInfo<Slot>& data) {
+    Slot* slot = data.GetParameter();
+    slot->handle.Reset();
+    slot->id = 0;
+    slot->self->pending_free_.push_back(slot->index);
+  }
+
+  // Slots are heap allocated so the weak callback parameters stay valid
+  // when the vector grows.
+  std::vector<std::unique_ptr<Slot>> slots_;
+
+  // Head of the list of reusable slots, linked through |next_free|.
+  int32_t free_head_;
+
+  // Slots emptied by GC since the last Add().
+  std::vector<int32_t> pending_free_;
+
+  DISALLOW_COPY_AND_ASSIGN(SlabWeakMap);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_COMMON_SLAB_WEAK_MAP_H_
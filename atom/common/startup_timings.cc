@@ -0,0 +1,52 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/startup_timings.h"
+
+#include "base/lazy_instance.h"
+#include "base/synchronization/lock.h"
+
+namespace atom {
+
+namespace startup_timings {
+
+const char kMainDelegateCreated[] = "mainDelegateCreated";
+const char kNodeEnvironmentCreated[] = "nodeEnvironmentCreated";
+const char kBrowserScriptLoaded[] = "browserScriptLoaded";
+const char kWindowCreated[] = "windowCreated";
+const char kFirstPaint[] = "firstPaint";
+
+namespace {
+
+struct Timings {
+  base::Lock lock;
+  std::vector<std::pair<std::string, base::Time>> milestones;
+};
+
+base::LazyInstance<Timings>::Leaky g_timings = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+void Record(const char* milestone) {
+  // Take the time before the lock, the wait must not count.
+  base::Time now = base::Time::Now();
+
+  Timings* timings = g_timings.Pointer();
+  base::AutoLock auto_lock(timings->lock);
+  for (const auto& recorded : timings->milestones) {
+    if (recorded.first == milestone)
+      return;
+  }
+  timings->milestones.push_back(std::make_pair(milestone, now));
+}
+
+std::vector<std::pair<std::string, base::Time>> GetAll() {
+  Timings* timings = g_timings.Pointer();
+  base::AutoLock auto_lock(timings->lock);
+  return timings->milestones;
+}
+
+}  // namespace startup_timings
+
+}  // namespace atom
@@ -0,0 +1,40 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_STARTUP_TIMINGS_H_
+#define ATOM_COMMON_STARTUP_TIMINGS_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/time/time.h"
+
+namespace atom {
+
+// Records coarse startup milestones from C++, so apps can track launch
+// regressions without instrumenting JavaScript, which misses everything
+// that happens before the first script runs. Recording is cheap and
+// thread safe; reading happens from app.getStartupTimings().
+namespace startup_timings {
+
+// Milestone names, also the keys reported to JavaScript.
+extern const char kMainDelegateCreated[];
+extern const char kNodeEnvironmentCreated[];
+extern const char kBrowserScriptLoaded[];
+extern const char kWindowCreated[];
+extern const char kFirstPaint[];
+
+// Records |milestone| at the current time. Only the first record of each
+// milestone is kept, so per-window milestones report the first window.
+void Record(const char* milestone);
+
+// Returns the recorded milestones in recording order.
+std::vector<std::pair<std::string, base::Time>> GetAll();
+
+}  // namespace startup_timings
+
+}  // namespace atom
+
+#endif  // ATOM_COMMON_STARTUP_TIMINGS_H_
@@ -40,6 +40,10 @@ int close(int fd) {
   return _close(fd);
 }
 
+intptr_t get_osfhandle(int fd) {
+  return _get_osfhandle(fd);
+}
+
 void ReferenceSymbols() {
   // Following symbols are used by electron.exe but got stripped by compiler,
   // by using the symbols we can force compiler to keep the objects in node.dll,
@@ -21,6 +21,12 @@ namespace node {
 __declspec(dllexport) int open_osfhandle(intptr_t osfhandle, int flags);
 __declspec(dllexport) int close(int fd);
 
+// Translates a fd created in node.dll (e.g. by fs.open) back to the
+// underlying OS handle, so code in electron.exe can hand the already-open
+// file to Chromium without reopening it. The returned handle is still owned
+// by node.dll's CRT; duplicate it before storing it anywhere.
+__declspec(dllexport) intptr_t get_osfhandle(int fd);
+
 // A trick to force referencing symbols.
 __declspec(dllexport) void ReferenceSymbols();
 
@@ -3,11 +3,22 @@
 // found in the LICENSE file.
 
 #include "atom/renderer/api/atom_api_renderer_ipc.h"
+
+#include <string.h>
+
+#include <memory>
+
 #include "atom/common/api/api_messages.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
 #include "atom/common/node_includes.h"
+#include "base/memory/shared_memory.h"
+#include "base/pickle.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/utf_string_conversions.h"
+#include "base/trace_event/trace_event.h"
 #include "content/public/renderer/render_view.h"
+#include "ipc/ipc_message_utils.h"
 #include "native_mate/dictionary.h"
 #include "third_party/WebKit/public/web/WebLocalFrame.h"
 #include "third_party/WebKit/public/web/WebView.h"
@@ -20,6 +31,69 @@ namespace atom {
 
 namespace api {
 
+namespace {
+
+// Payloads at least this large are shipped in shared memory instead of
+// being copied through the channel.
+const size_t kSharedMemoryThreshold = 256 * 1024;
+
+// Cheap lower-bound estimate of a value's payload size. Only binary blobs
+// and strings are counted, they are what makes messages large in practice.
+size_t EstimatePayloadSize(const base::Value& value) {
+  switch (value.GetType()) {
+    case base::Value::Type::BINARY:
+      return static_cast<const base::BinaryValue&>(value).GetSize();
+    case base::Value::Type::STRING: {
+      base::StringPiece str;
+      value.GetAsString(&str);
+      return str.size();
+    }
+    case base::Value::Type::LIST: {
+      const base::ListValue* list = nullptr;
+      value.GetAsList(&list);
+      size_t size = 0;
+      for (const auto& child : *list)
+        size += EstimatePayloadSize(*child);
+      return size;
+    }
+    case base::Value::Type::DICTIONARY: {
+      const base::DictionaryValue* dict = nullptr;
+      value.GetAsDictionary(&dict);
+      size_t size = 0;
+      for (base::DictionaryValue::Iterator iter(*dict); !iter.IsAtEnd();
+           iter.Advance())
+        size += EstimatePayloadSize(iter.value());
+      return size;
+    }
+    default:
+      return 0;
+  }
+}
+
+// Ships large argument lists in shared memory, with only the handle going
+// over the channel. Returns false when the payload is small enough for the
+// normal message.
+bool SendViaSharedMemory(RenderView* render_view,
+                         const base::string16& channel,
+                         const base::ListValue& arguments) {
+  if (EstimatePayloadSize(arguments) < kSharedMemoryThreshold)
+    return false;
+
+  base::Pickle pickle;
+  IPC::WriteParam(&pickle, arguments);
+
+  std::unique_ptr<base::SharedMemory> shm(new base::SharedMemory);
+  if (!shm->CreateAndMapAnonymous(pickle.size()))
+    return false;
+  memcpy(shm->memory(), pickle.data(), pickle.size());
+
+  return render_view->Send(new AtomViewHostMsg_Message_Shm(
+      render_view->GetRoutingID(), channel, shm->handle().Duplicate(),
+      static_cast<uint32_t>(pickle.size())));
+}
+
+}  // namespace
+
 RenderView* GetCurrentRenderView() {
   WebLocalFrame* frame = WebLocalFrame::frameForCurrentContext();
   if (!frame)
@@ -35,10 +109,15 @@ RenderView* GetCurrentRenderView() {
 void Send(mate::Arguments* args,
           const base::string16& channel,
           const base::ListValue& arguments) {
+  TRACE_EVENT1("electron", "RendererIpc::Send",
+               "channel", base::UTF16ToUTF8(channel));
   RenderView* render_view = GetCurrentRenderView();
   if (render_view == nullptr)
     return;
 
+  if (SendViaSharedMemory(render_view, channel, arguments))
+    return;
+
   bool success = render_view->Send(new AtomViewHostMsg_Message(
       render_view->GetRoutingID(), channel, arguments));
 
@@ -49,6 +128,8 @@ void Send(mate::Arguments* args,
 base::string16 SendSync(mate::Arguments* args,
                         const base::string16& channel,
                         const base::ListValue& arguments) {
+  TRACE_EVENT1("electron", "RendererIpc::SendSync",
+               "channel", base::UTF16ToUTF8(channel));
   base::string16 json;
 
   RenderView* render_view = GetCurrentRenderView();
@@ -5,9 +5,12 @@
 #include "atom/renderer/api/atom_api_spell_check_client.h"
 
 #include <algorithm>
+#include <set>
 #include <vector>
 
+#include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
+#include "base/bind.h"
 #include "base/logging.h"
 #include "native_mate/converter.h"
 #include "native_mate/dictionary.h"
@@ -21,6 +24,10 @@ namespace api {
 
 namespace {
 
+// Bounds the word-result cache; generous for even very large compose
+// fields while keeping lookups cheap.
+const size_t kMaxCachedWords = 1024;
+
 bool HasWordCharacters(const base::string16& text, int index) {
   const base::char16* data = text.data();
   int length = text.length();
@@ -40,13 +47,15 @@ SpellCheckClient::SpellCheckClient(const std::string& language,
                                    bool auto_spell_correct_turned_on,
                                    v8::Isolate* isolate,
                                    v8::Local<v8::Object> provider)
-    : isolate_(isolate),
+    : cache_(kMaxCachedWords),
+      isolate_(isolate),
       provider_(isolate, provider) {
   character_attributes_.SetDefaultLanguage(language);
 
   // Persistent the method.
   mate::Dictionary dict(isolate, provider);
   dict.Get("spellCheck", &spell_check_);
+  dict.Get("spellCheckWords", &spell_check_words_);
 }
 
 SpellCheckClient::~SpellCheckClient() {}
@@ -73,6 +82,13 @@ void SpellCheckClient::requestCheckingOfText(
     return;
   }
 
+  // When the provider implements the batched protocol, send the whole run
+  // of text at once instead of one synchronous call per word.
+  if (!spell_check_words_.IsEmpty()) {
+    SpellCheckTextAsync(text, completionCallback);
+    return;
+  }
+
   std::vector<blink::WebTextCheckingResult> results;
   SpellCheckText(text, false, &results);
   completionCallback->didFinishCheckingText(results);
@@ -129,7 +145,97 @@ void SpellCheckClient::SpellCheckText(
   }
 }
 
+void SpellCheckClient::SpellCheckTextAsync(
+    const base::string16& text,
+    blink::WebTextCheckingCompletion* completion) {
+  if (!text_iterator_.IsInitialized() &&
+      !text_iterator_.Initialize(&character_attributes_, true)) {
+    VLOG(1) << "Failed to initialize SpellcheckWordIterator";
+    completion->didCancelCheckingText();
+    return;
+  }
+
+  std::vector<WordWithPosition> words;
+  std::vector<base::string16> words_to_check;
+  std::set<base::string16> seen;
+  base::string16 word;
+  int word_start;
+  int word_length;
+  text_iterator_.SetText(text.c_str(), text.size());
+  while (text_iterator_.GetNextWord(&word, &word_start, &word_length)) {
+    words.push_back(WordWithPosition(word, word_start, word_length));
+    if (seen.insert(word).second && cache_.Get(word) == cache_.end())
+      words_to_check.push_back(word);
+
+    // Also query the components of concatenated words, so contraction
+    // handling resolves from the cache once results arrive.
+    if (!contraction_iterator_.IsInitialized() &&
+        !contraction_iterator_.Initialize(&character_attributes_, false))
+      continue;
+    contraction_iterator_.SetText(word.c_str(), word.length());
+    base::string16 component;
+    int component_start;
+    int component_length;
+    while (contraction_iterator_.GetNextWord(&component, &component_start,
+                                             &component_length)) {
+      if (component != word && seen.insert(component).second &&
+          cache_.Get(component) == cache_.end())
+        words_to_check.push_back(component);
+    }
+  }
+
+  auto callback = base::Bind(&SpellCheckClient::OnSpellCheckDone,
+                             base::Unretained(this),
+                             words_to_check,
+                             words,
+                             completion);
+  if (words_to_check.empty()) {
+    // Every word was answered from the cache.
+    callback.Run(std::vector<base::string16>());
+    return;
+  }
+
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Value> args[] = {
+      mate::ConvertToV8(isolate_, words_to_check),
+      mate::ConvertToV8(isolate_, callback),
+  };
+  spell_check_words_.NewHandle()->Call(
+      provider_.NewHandle(), arraysize(args), args);
+}
+
+void SpellCheckClient::OnSpellCheckDone(
+    const std::vector<base::string16>& checked_words,
+    const std::vector<WordWithPosition>& words,
+    blink::WebTextCheckingCompletion* completion,
+    const std::vector<base::string16>& misspelled_words) {
+  std::set<base::string16> misspelled(misspelled_words.begin(),
+                                      misspelled_words.end());
+  for (const base::string16& checked_word : checked_words)
+    cache_.Put(checked_word, misspelled.find(checked_word) == misspelled.end());
+
+  // Every word now has a cached result, so this resolves without calling
+  // back into the provider.
+  std::vector<blink::WebTextCheckingResult> results;
+  for (const WordWithPosition& word : words) {
+    if (SpellCheckWord(word.text))
+      continue;
+    if (IsValidContraction(word.text))
+      continue;
+
+    blink::WebTextCheckingResult result;
+    result.location = word.start;
+    result.length = word.length;
+    results.push_back(result);
+  }
+  completion->didFinishCheckingText(results);
+}
+
 bool SpellCheckClient::SpellCheckWord(const base::string16& word_to_check) {
+  auto cached = cache_.Get(word_to_check);
+  if (cached != cache_.end())
+    return cached->second;
+
   if (spell_check_.IsEmpty())
     return true;
 
@@ -138,10 +244,12 @@ bool SpellCheckClient::SpellCheckWord(const base::string16& word_to_check) {
   v8::Local<v8::Value> result = spell_check_.NewHandle()->Call(
       provider_.NewHandle(), 1, &word);
 
-  if (result->IsBoolean())
-    return result->BooleanValue();
-  else
+  if (!result->IsBoolean())
     return true;
+
+  bool correct = result->BooleanValue();
+  cache_.Put(word_to_check, correct);
+  return correct;
 }
 
 // Returns whether or not the given string is a valid contraction.
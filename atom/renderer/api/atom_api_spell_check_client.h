@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "base/callback.h"
+#include "base/containers/mru_cache.h"
 #include "chrome/renderer/spellchecker/spellcheck_worditerator.h"
 #include "native_mate/scoped_persistent.h"
 #include "third_party/WebKit/public/web/WebSpellCheckClient.h"
@@ -30,6 +31,15 @@ class SpellCheckClient : public blink::WebSpellCheckClient {
   virtual ~SpellCheckClient();
 
  private:
+  // A word extracted from checked text, with its position in the text.
+  struct WordWithPosition {
+    WordWithPosition(const base::string16& text, int start, int length)
+        : text(text), start(start), length(length) {}
+    base::string16 text;
+    int start;
+    int length;
+  };
+
   // blink::WebSpellCheckClient:
   void checkSpelling(
       const blink::WebString& text,
@@ -49,6 +59,18 @@ class SpellCheckClient : public blink::WebSpellCheckClient {
                       bool stop_at_first_result,
                       std::vector<blink::WebTextCheckingResult>* results);
 
+  // Check a whole run of text with one call into the JS provider's
+  // spellCheckWords method, finishing |completion| when results arrive.
+  void SpellCheckTextAsync(const base::string16& text,
+                           blink::WebTextCheckingCompletion* completion);
+
+  // Invoked by the JS provider with the misspelled subset of
+  // |checked_words|; caches the results and resolves |words|.
+  void OnSpellCheckDone(const std::vector<base::string16>& checked_words,
+                        const std::vector<WordWithPosition>& words,
+                        blink::WebTextCheckingCompletion* completion,
+                        const std::vector<base::string16>& misspelled_words);
+
   // Call JavaScript to check spelling a word.
   bool SpellCheckWord(const base::string16& word_to_check);
 
@@ -75,9 +97,14 @@ class SpellCheckClient : public blink::WebSpellCheckClient {
 
   bool auto_spell_correct_turned_on_;
 
+  // Results for recently checked words, so rechecking unchanged text never
+  // reaches the JS provider.
+  base::MRUCache<base::string16, bool> cache_;
+
   v8::Isolate* isolate_;
   mate::ScopedPersistent<v8::Object> provider_;
   mate::ScopedPersistent<v8::Function> spell_check_;
+  mate::ScopedPersistent<v8::Function> spell_check_words_;
 
   DISALLOW_COPY_AND_ASSIGN(SpellCheckClient);
 };
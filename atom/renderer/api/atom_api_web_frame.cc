@@ -11,12 +11,20 @@
 #include "atom/common/native_mate_converters/gfx_converter.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/renderer/api/atom_api_spell_check_client.h"
+#include "base/bind.h"
 #include "base/memory/memory_pressure_listener.h"
+#include "base/memory/weak_ptr.h"
+#include "base/threading/thread_task_runner_handle.h"
+#include "base/time/time.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_view.h"
 #include "native_mate/dictionary.h"
 #include "native_mate/object_template_builder.h"
+#include "third_party/WebKit/public/platform/Platform.h"
 #include "third_party/WebKit/public/platform/WebCache.h"
+#include "third_party/WebKit/public/platform/WebScheduler.h"
+#include "third_party/WebKit/public/platform/WebThread.h"
+#include "third_party/WebKit/public/platform/WebTraceLocation.h"
 #include "third_party/WebKit/public/web/WebDocument.h"
 #include "third_party/WebKit/public/web/WebFrameWidget.h"
 #include "third_party/WebKit/public/web/WebInputMethodController.h"
@@ -58,6 +66,75 @@ class ScriptExecutionCallback : public blink::WebScriptExecutionCallback {
   DISALLOW_COPY_AND_ASSIGN(ScriptExecutionCallback);
 };
 
+// Runs an injected script when the main thread goes idle, or when the
+// deadline expires, whichever comes first. The frame is looked up by
+// routing id at execution time so a destroyed frame just drops the script.
+// Owned by the blink scheduler, which deletes it after run().
+class IdleScriptExecution : public blink::WebThread::IdleTask {
+ public:
+  IdleScriptExecution(
+      int routing_id,
+      const base::string16& code,
+      bool has_user_gesture,
+      const ScriptExecutionCallback::CompletionCallback& callback)
+      : routing_id_(routing_id),
+        code_(code),
+        has_user_gesture_(has_user_gesture),
+        callback_(callback),
+        executed_(false),
+        weak_ptr_factory_(this) {}
+  ~IdleScriptExecution() override {}
+
+  void Schedule(double deadline_ms) {
+    if (deadline_ms > 0) {
+      // If the main thread stays busy past the deadline, run anyway so
+      // the script is not starved forever.
+      base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(
+          FROM_HERE,
+          base::Bind(&IdleScriptExecution::Execute,
+                     weak_ptr_factory_.GetWeakPtr()),
+          base::TimeDelta::FromMillisecondsD(deadline_ms));
+    }
+    blink::WebTraceLocation location(__FUNCTION__, __FILE__);
+    blink::Platform::current()->currentThread()->scheduler()->postIdleTask(
+        location, this);
+  }
+
+  // blink::WebThread::IdleTask:
+  void run(double deadline_seconds) override {
+    Execute();
+  }
+
+ private:
+  void Execute() {
+    if (executed_)
+      return;
+    executed_ = true;
+
+    content::RenderFrame* render_frame =
+        content::RenderFrame::FromRoutingID(routing_id_);
+    if (!render_frame)
+      return;
+
+    std::unique_ptr<blink::WebScriptExecutionCallback> callback(
+        new ScriptExecutionCallback(callback_));
+    render_frame->GetWebFrame()->requestExecuteScriptAndReturnValue(
+        blink::WebScriptSource(blink::WebString::fromUTF16(code_)),
+        has_user_gesture_,
+        callback.release());
+  }
+
+  int routing_id_;
+  base::string16 code_;
+  bool has_user_gesture_;
+  ScriptExecutionCallback::CompletionCallback callback_;
+  bool executed_;
+
+  base::WeakPtrFactory<IdleScriptExecution> weak_ptr_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(IdleScriptExecution);
+};
+
 }  // namespace
 
 WebFrame::WebFrame(v8::Isolate* isolate)
@@ -215,8 +292,30 @@ void WebFrame::ExecuteJavaScript(const base::string16& code,
                                  mate::Arguments* args) {
   bool has_user_gesture = false;
   args->GetNext(&has_user_gesture);
+  std::string timing("immediate");
+  double deadline = 0;
   ScriptExecutionCallback::CompletionCallback completion_callback;
-  args->GetNext(&completion_callback);
+  if (!args->GetNext(&completion_callback)) {
+    // Not a callback, so it may be scheduling options followed by an
+    // optional callback.
+    mate::Dictionary options;
+    if (args->GetNext(&options)) {
+      options.Get("timing", &timing);
+      options.Get("deadline", &deadline);
+      args->GetNext(&completion_callback);
+    }
+  }
+
+  if (timing == "idle") {
+    int routing_id =
+        content::RenderFrame::FromWebFrame(web_frame_)->GetRoutingID();
+    // Deleted by the blink scheduler after it runs.
+    IdleScriptExecution* execution = new IdleScriptExecution(
+        routing_id, code, has_user_gesture, completion_callback);
+    execution->Schedule(deadline);
+    return;
+  }
+
   std::unique_ptr<blink::WebScriptExecutionCallback> callback(
       new ScriptExecutionCallback(completion_callback));
   web_frame_->requestExecuteScriptAndReturnValue(
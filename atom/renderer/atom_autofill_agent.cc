@@ -7,6 +7,8 @@
 #include <vector>
 
 #include "atom/common/api/api_messages.h"
+#include "base/i18n/case_conversion.h"
+#include "base/strings/string_util.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_view.h"
 #include "third_party/WebKit/public/platform/WebKeyboardEvent.h"
@@ -24,18 +26,6 @@ namespace {
 const size_t kMaxDataLength = 1024;
 const size_t kMaxListSize = 512;
 
-void GetDataListSuggestions(const blink::WebInputElement& element,
-    std::vector<base::string16>* values,
-    std::vector<base::string16>* labels) {
-  for (const auto& option : element.filteredDataListOptions()) {
-    values->push_back(option.value().utf16());
-    if (option.value() != option.label())
-      labels->push_back(option.label().utf16());
-    else
-      labels->push_back(base::string16());
-  }
-}
-
 void TrimStringVectorForIPC(std::vector<base::string16>* strings) {
   // Limit the size of the vector.
   if (strings->size() > kMaxListSize)
@@ -70,11 +60,13 @@ void AutofillAgent::DidChangeScrollOffset() {
 void AutofillAgent::FocusedNodeChanged(const blink::WebNode&) {
   focused_node_was_last_clicked_ = false;
   was_focused_before_now_ = false;
+  data_list_cache_.element.reset();
   HidePopup();
 }
 
 void AutofillAgent::textFieldDidEndEditing(
     const blink::WebInputElement&) {
+  data_list_cache_.element.reset();
   HidePopup();
 }
 
@@ -117,6 +109,8 @@ void AutofillAgent::openTextDataListChooser(
 
 void AutofillAgent::dataListOptionsChanged(
     const blink::WebInputElement& element) {
+  data_list_cache_.element.reset();
+
   if (!element.focused())
     return;
 
@@ -130,6 +124,12 @@ AutofillAgent::ShowSuggestionsOptions::ShowSuggestionsOptions()
       requires_caret_at_end(false) {
 }
 
+AutofillAgent::DataListCache::DataListCache() {
+}
+
+AutofillAgent::DataListCache::~DataListCache() {
+}
+
 void AutofillAgent::ShowSuggestions(
     const blink::WebFormControlElement& element,
     const ShowSuggestionsOptions& options) {
@@ -191,6 +191,51 @@ bool AutofillAgent::IsUserGesture() const {
   return blink::WebUserGestureIndicator::isProcessingUserGesture();
 }
 
+void AutofillAgent::GetDataListSuggestions(
+    const blink::WebInputElement& element,
+    std::vector<base::string16>* values,
+    std::vector<base::string16>* labels) {
+  const base::string16 editing_value = element.editingValue().utf16();
+
+  // The cached model stays usable while the edited value keeps extending
+  // |base_value|: blink's filtering only ever narrows the option set as the
+  // value grows, so the narrowed set is a subset of what was extracted.
+  // Deleting below |base_value|, switching fields or a datalist mutation
+  // (dataListOptionsChanged()) all force a fresh extraction.
+  if (element != data_list_cache_.element ||
+      !base::StartsWith(editing_value, data_list_cache_.base_value,
+                        base::CompareCase::SENSITIVE)) {
+    data_list_cache_.element = element;
+    data_list_cache_.base_value = editing_value;
+    data_list_cache_.values.clear();
+    data_list_cache_.labels.clear();
+    for (const auto& option : element.filteredDataListOptions()) {
+      data_list_cache_.values.push_back(option.value().utf16());
+      if (option.value() != option.label())
+        data_list_cache_.labels.push_back(option.label().utf16());
+      else
+        data_list_cache_.labels.push_back(base::string16());
+    }
+  }
+
+  if (editing_value == data_list_cache_.base_value) {
+    *values = data_list_cache_.values;
+    *labels = data_list_cache_.labels;
+    return;
+  }
+
+  // Narrow the cached set in memory, mirroring blink's case-insensitive
+  // substring match, instead of walking the datalist DOM again.
+  const base::string16 needle = base::i18n::ToLower(editing_value);
+  for (size_t i = 0; i < data_list_cache_.values.size(); ++i) {
+    if (base::i18n::ToLower(data_list_cache_.values[i]).find(needle) !=
+        base::string16::npos) {
+      values->push_back(data_list_cache_.values[i]);
+      labels->push_back(data_list_cache_.labels[i]);
+    }
+  }
+}
+
 void AutofillAgent::HidePopup() {
   Send(new AtomAutofillFrameHostMsg_HidePopup(render_frame()->GetRoutingID()));
 }
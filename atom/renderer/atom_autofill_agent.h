@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "base/strings/string16.h"
 #include "content/public/renderer/render_frame_observer.h"
 #include "content/public/renderer/render_view_observer.h"
 #include "third_party/WebKit/public/web/WebAutofillClient.h"
@@ -49,6 +50,21 @@ class AutofillAgent : public content::RenderFrameObserver,
     bool requires_caret_at_end;
   };
 
+  // Cached <datalist> model for the field being edited. Extracting the
+  // options walks the datalist DOM and converts every option string, so on
+  // large lists paying that per keystroke is expensive. The model is
+  // extracted once and narrowed in memory for as long as the edited value
+  // keeps extending the value it was extracted for; blink reports datalist
+  // mutations through dataListOptionsChanged(), which drops the model.
+  struct DataListCache {
+    DataListCache();
+    ~DataListCache();
+    blink::WebInputElement element;
+    base::string16 base_value;
+    std::vector<base::string16> values;
+    std::vector<base::string16> labels;
+  };
+
   bool OnMessageReceived(const IPC::Message& message) override;
 
   // blink::WebAutofillClient:
@@ -61,6 +77,9 @@ class AutofillAgent : public content::RenderFrameObserver,
   void dataListOptionsChanged(const blink::WebInputElement&) override;
 
   bool IsUserGesture() const;
+  void GetDataListSuggestions(const blink::WebInputElement& element,
+                              std::vector<base::string16>* values,
+                              std::vector<base::string16>* labels);
   void HidePopup();
   void ShowPopup(const blink::WebFormControlElement&,
                  const std::vector<base::string16>&,
@@ -81,6 +100,8 @@ class AutofillAgent : public content::RenderFrameObserver,
   // already focused, or if it caused the focus to change.
   bool was_focused_before_now_;
 
+  DataListCache data_list_cache_;
+
   base::WeakPtrFactory<AutofillAgent> weak_ptr_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(AutofillAgent);
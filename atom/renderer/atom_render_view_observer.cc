@@ -5,6 +5,7 @@
 #include "atom/renderer/atom_render_view_observer.h"
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // Put this before event_emitter_caller.h to have string16 support.
@@ -35,6 +36,22 @@ namespace atom {
 
 namespace {
 
+// Returns the interned v8 handle for |channel|. Dispatch happens once per
+// incoming message, so the conversion result is cached in a hash map keyed
+// by the channel name; steady-state dispatch is a hash lookup instead of a
+// fresh v8 string allocation. Renderer messages arrive on the main thread
+// only.
+v8::Local<v8::String> GetInternedChannel(v8::Isolate* isolate,
+                                         const base::string16& channel) {
+  static std::unordered_map<base::string16, v8::Eternal<v8::String>>*
+      channels = new std::unordered_map<base::string16,
+                                        v8::Eternal<v8::String>>;
+  v8::Eternal<v8::String>& eternal = (*channels)[channel];
+  if (eternal.IsEmpty())
+    eternal.Set(isolate, mate::StringToV8(isolate, channel));
+  return eternal.Get(isolate);
+}
+
 bool GetIPCObject(v8::Isolate* isolate,
                   v8::Local<v8::Context> context,
                   v8::Local<v8::Object>* ipc) {
@@ -109,7 +126,9 @@ void AtomRenderViewObserver::EmitIPCEvent(blink::WebFrame* frame,
     mate::Dictionary event = mate::Dictionary::CreateEmpty(isolate);
     event.Set("sender", ipc);
     args_vector.insert(args_vector.begin(), event.GetHandle());
-    mate::EmitEvent(isolate, ipc, channel, args_vector);
+    args_vector.insert(args_vector.begin(),
+                       GetInternedChannel(isolate, channel));
+    mate::internal::CallMethodWithArgs(isolate, ipc, "emit", &args_vector);
   }
 }
 
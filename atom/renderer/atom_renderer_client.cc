@@ -35,6 +35,11 @@ bool IsDevToolsExtension(content::RenderFrame* render_frame) {
       .SchemeIs("chrome-extension");
 }
 
+// Globals whose first access triggers node bootstrap in lazy mode.
+const char* const kLazyNodeGlobals[] = {
+  "process", "require", "module", "Buffer",
+};
+
 }  // namespace
 
 AtomRendererClient::AtomRendererClient()
@@ -90,6 +95,25 @@ void AtomRendererClient::DidCreateScriptContext(
   if (!render_frame->IsMainFrame() && !IsDevToolsExtension(render_frame))
     return;
 
+  // With lazy node integration the bootstrap is postponed until the page
+  // first touches a node global; pages that never do skip it entirely.
+  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
+          switches::kLazyNodeIntegration)) {
+    v8::Isolate* isolate = context->GetIsolate();
+    v8::Local<v8::Object> global = context->Global();
+    for (auto* name : kLazyNodeGlobals) {
+      global->SetAccessor(context, mate::StringToV8(isolate, name),
+                          &AtomRendererClient::LazyNodeGetter, nullptr,
+                          v8::External::New(isolate, this));
+    }
+    return;
+  }
+
+  SetupNodeEnvironment(context);
+}
+
+void AtomRendererClient::SetupNodeEnvironment(
+    v8::Handle<v8::Context> context) {
   // Prepare the node bindings.
   if (!node_integration_initialized_) {
     node_integration_initialized_ = true;
@@ -116,6 +140,29 @@ void AtomRendererClient::DidCreateScriptContext(
   }
 }
 
+// static
+void AtomRendererClient::LazyNodeGetter(
+    v8::Local<v8::Name> name,
+    const v8::PropertyCallbackInfo<v8::Value>& info) {
+  AtomRendererClient* self = static_cast<AtomRendererClient*>(
+      info.Data().As<v8::External>()->Value());
+  v8::Isolate* isolate = info.GetIsolate();
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Object> global = context->Global();
+
+  // Remove the triggers first so the bootstrap can define the real
+  // globals without re-entering this getter.
+  for (auto* trigger : kLazyNodeGlobals) {
+    global->Delete(context, mate::StringToV8(isolate, trigger)).IsJust();
+  }
+
+  self->SetupNodeEnvironment(context);
+
+  v8::Local<v8::Value> value;
+  if (global->Get(context, name).ToLocal(&value))
+    info.GetReturnValue().Set(value);
+}
+
 void AtomRendererClient::WillReleaseScriptContext(
     v8::Handle<v8::Context> context, content::RenderFrame* render_frame) {
   // Only allow node integration for the main frame, unless it is a devtools
@@ -124,8 +171,11 @@ void AtomRendererClient::WillReleaseScriptContext(
     return;
 
   node::Environment* env = node::Environment::GetCurrent(context);
-  if (env)
-    mate::EmitEvent(env->isolate(), env->process_object(), "exit");
+  // With lazy node integration the environment may never have been
+  // created for this context.
+  if (!env)
+    return;
+  mate::EmitEvent(env->isolate(), env->process_object(), "exit");
 
   // The main frame may be replaced.
   if (env == node_bindings_->uv_env())
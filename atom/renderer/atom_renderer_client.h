@@ -35,6 +35,16 @@ class AtomRendererClient : public RendererClientBase {
   bool isolated_world() override { return isolated_world_; }
 
  private:
+  // Creates and loads the node environment for |context|. Called either
+  // directly from DidCreateScriptContext, or on first access of a node
+  // global when lazy node integration is enabled.
+  void SetupNodeEnvironment(v8::Handle<v8::Context> context);
+
+  // Property getter installed for node globals in lazy mode; bootstraps
+  // node and then resolves to the real value.
+  static void LazyNodeGetter(v8::Local<v8::Name> name,
+                             const v8::PropertyCallbackInfo<v8::Value>& info);
+
   enum NodeIntegration {
     ALL,
     EXCEPT_IFRAME,
@@ -5,6 +5,7 @@
 #include "atom/renderer/atom_sandboxed_renderer_client.h"
 
 #include <string>
+#include <vector>
 
 #include "atom/common/api/api_messages.h"
 #include "atom/common/api/atom_bindings.h"
@@ -38,6 +39,42 @@ namespace {
 const std::string kIpcKey = "ipcNative";
 const std::string kModuleCacheKey = "native-module-cache";
 
+// Code cache blob for the preload bundle, shared by every frame in this
+// process. The bundle is identical for all of them, so the first compile
+// produces the blob and later contexts deserialize it instead of parsing
+// the whole bundle again. Leaked intentionally; lives as long as the
+// process.
+std::vector<uint8_t>* g_preload_bundle_code_cache = nullptr;
+
+// Compiles the preload bundle wrapper, producing or consuming the shared
+// code cache as appropriate.
+v8::Local<v8::Script> CompilePreloadBundle(v8::Local<v8::Context> context,
+                                           v8::Local<v8::String> source_text) {
+  if (g_preload_bundle_code_cache) {
+    // Source takes ownership of the CachedData object, but not of the
+    // underlying buffer.
+    auto* cached_data = new v8::ScriptCompiler::CachedData(
+        g_preload_bundle_code_cache->data(),
+        g_preload_bundle_code_cache->size(),
+        v8::ScriptCompiler::CachedData::BufferNotOwned);
+    v8::ScriptCompiler::Source source(source_text, cached_data);
+    return v8::ScriptCompiler::Compile(context, &source,
+                                       v8::ScriptCompiler::kConsumeCodeCache)
+        .ToLocalChecked();
+  }
+
+  v8::ScriptCompiler::Source source(source_text);
+  auto script = v8::ScriptCompiler::Compile(
+      context, &source, v8::ScriptCompiler::kProduceCodeCache)
+      .ToLocalChecked();
+  const auto* cached_data = source.GetCachedData();
+  if (cached_data && cached_data->length > 0) {
+    g_preload_bundle_code_cache = new std::vector<uint8_t>(
+        cached_data->data, cached_data->data + cached_data->length);
+  }
+  return script;
+}
+
 
 v8::Local<v8::Object> GetModuleCache(v8::Isolate* isolate) {
   mate::Dictionary global(isolate, isolate->GetCurrentContext()->Global());
@@ -168,9 +205,10 @@ void AtomSandboxedRendererClient::DidCreateScriptContext(
   ss << preload_bundle_native << "\n";
   ss << "})";
   std::string preload_wrapper = ss.str();
-  // Compile the wrapper and run it to get the function object
-  auto script = v8::Script::Compile(
-      mate::ConvertToV8(isolate, preload_wrapper)->ToString());
+  // Compile the wrapper and run it to get the function object, reusing
+  // the process-wide code cache when a frame compiled it before.
+  auto script = CompilePreloadBundle(
+      context, mate::ConvertToV8(isolate, preload_wrapper)->ToString());
   auto func = v8::Handle<v8::Function>::Cast(
       script->Run(context).ToLocalChecked());
   // Create and initialize the binding object
@@ -0,0 +1,93 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/renderer/content_settings_manager.h"
+
+#include <utility>
+
+#include "atom/common/api/api_messages.h"
+#include "base/logging.h"
+#include "content/public/renderer/render_thread.h"
+#include "url/gurl.h"
+
+namespace atom {
+
+namespace {
+
+ContentSettingsManager* g_content_settings_manager = nullptr;
+
+}  // namespace
+
+ContentSettingsManager::CategoryRules::CategoryRules()
+    : default_allow(true) {}
+
+ContentSettingsManager::CategoryRules::CategoryRules(
+    const CategoryRules& other) = default;
+
+ContentSettingsManager::CategoryRules::~CategoryRules() {}
+
+ContentSettingsManager::ContentSettingsManager() {
+  DCHECK(!g_content_settings_manager);
+  g_content_settings_manager = this;
+  content::RenderThread::Get()->AddObserver(this);
+}
+
+ContentSettingsManager::~ContentSettingsManager() {
+  g_content_settings_manager = nullptr;
+}
+
+// static
+ContentSettingsManager* ContentSettingsManager::Get() {
+  return g_content_settings_manager;
+}
+
+bool ContentSettingsManager::IsAllowed(const std::string& category,
+                                       const GURL& origin) const {
+  auto iter = rules_.find(category);
+  if (iter == rules_.end())
+    return true;
+
+  const CategoryRules& rules = iter->second;
+  bool is_exception = rules.exceptions.count(origin.GetOrigin().spec()) > 0;
+  return rules.default_allow != is_exception;
+}
+
+bool ContentSettingsManager::OnControlMessageReceived(
+    const IPC::Message& message) {
+  bool handled = true;
+  IPC_BEGIN_MESSAGE_MAP(ContentSettingsManager, message)
+    IPC_MESSAGE_HANDLER(AtomMsg_UpdateContentSettings,
+                        OnUpdateContentSettings)
+    IPC_MESSAGE_UNHANDLED(handled = false)
+  IPC_END_MESSAGE_MAP()
+  return handled;
+}
+
+void ContentSettingsManager::OnUpdateContentSettings(
+    const base::DictionaryValue& settings) {
+  rules_.clear();
+  for (base::DictionaryValue::Iterator iter(settings); !iter.IsAtEnd();
+       iter.Advance()) {
+    const base::DictionaryValue* rule = nullptr;
+    if (!iter.value().GetAsDictionary(&rule))
+      continue;
+
+    CategoryRules compiled;
+    std::string default_decision;
+    if (rule->GetString("default", &default_decision))
+      compiled.default_allow = default_decision != "block";
+
+    const base::ListValue* exceptions = nullptr;
+    if (rule->GetList("exceptions", &exceptions)) {
+      for (size_t i = 0; i < exceptions->GetSize(); ++i) {
+        std::string origin;
+        if (exceptions->GetString(i, &origin))
+          compiled.exceptions.insert(GURL(origin).GetOrigin().spec());
+      }
+    }
+    rules_[iter.key()] = std::move(compiled);
+  }
+}
+
+}  // namespace atom
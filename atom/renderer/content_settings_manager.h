@@ -0,0 +1,58 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_RENDERER_CONTENT_SETTINGS_MANAGER_H_
+#define ATOM_RENDERER_CONTENT_SETTINGS_MANAGER_H_
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "base/values.h"
+#include "content/public/renderer/render_thread_observer.h"
+
+class GURL;
+
+namespace atom {
+
+// Holds the app's content-settings rules compiled into read-only lookup
+// tables, updated by the browser via AtomMsg_UpdateContentSettings. With
+// the rules local, blink's per-resource checks (allowImage, allowScript,
+// ...) are hash lookups instead of IPC to the browser.
+class ContentSettingsManager : public content::RenderThreadObserver {
+ public:
+  ContentSettingsManager();
+  ~ContentSettingsManager() override;
+
+  // May be null before the render thread is up.
+  static ContentSettingsManager* Get();
+
+  // Returns whether |category| ("images", "scripts", ...) is allowed for
+  // |origin|. Allowed when no rule matches or no rules were received.
+  bool IsAllowed(const std::string& category, const GURL& origin) const;
+
+ private:
+  struct CategoryRules {
+    CategoryRules();
+    CategoryRules(const CategoryRules& other);
+    ~CategoryRules();
+
+    bool default_allow;
+    // Origins decided opposite to the default.
+    std::unordered_set<std::string> exceptions;
+  };
+
+  // content::RenderThreadObserver:
+  bool OnControlMessageReceived(const IPC::Message& message) override;
+
+  void OnUpdateContentSettings(const base::DictionaryValue& settings);
+
+  std::unordered_map<std::string, CategoryRules> rules_;
+
+  DISALLOW_COPY_AND_ASSIGN(ContentSettingsManager);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_RENDERER_CONTENT_SETTINGS_MANAGER_H_
@@ -4,13 +4,26 @@
 
 #include "atom/renderer/content_settings_observer.h"
 
+#include "atom/renderer/content_settings_manager.h"
 #include "content/public/renderer/render_frame.h"
 #include "third_party/WebKit/public/platform/URLConversion.h"
 #include "third_party/WebKit/public/platform/WebSecurityOrigin.h"
 #include "third_party/WebKit/public/web/WebLocalFrame.h"
+#include "url/gurl.h"
 
 namespace atom {
 
+namespace {
+
+// The rule tables live in the renderer, so each decision is a local hash
+// lookup. Everything is allowed before any rules arrive.
+bool IsAllowedByRules(const char* category, const GURL& origin) {
+  ContentSettingsManager* manager = ContentSettingsManager::Get();
+  return !manager || manager->IsAllowed(category, origin);
+}
+
+}  // namespace
+
 ContentSettingsObserver::ContentSettingsObserver(
     content::RenderFrame* render_frame)
     : content::RenderFrameObserver(render_frame) {
@@ -31,7 +44,7 @@ bool ContentSettingsObserver::allowDatabase(
   auto origin = blink::WebStringToGURL(frame->getSecurityOrigin().toString());
   if (!origin.IsStandard())
     return false;
-  return true;
+  return IsAllowedByRules("databases", origin);
 }
 
 bool ContentSettingsObserver::allowStorage(bool local) {
@@ -42,7 +55,7 @@ bool ContentSettingsObserver::allowStorage(bool local) {
   auto origin = blink::WebStringToGURL(frame->getSecurityOrigin().toString());
   if (!origin.IsStandard())
     return false;
-  return true;
+  return IsAllowedByRules("storage", origin);
 }
 
 bool ContentSettingsObserver::allowIndexedDB(
@@ -55,7 +68,30 @@ bool ContentSettingsObserver::allowIndexedDB(
   auto origin = blink::WebStringToGURL(frame->getSecurityOrigin().toString());
   if (!origin.IsStandard())
     return false;
-  return true;
+  return IsAllowedByRules("indexedDB", origin);
+}
+
+bool ContentSettingsObserver::allowImage(bool enabled_per_settings,
+                                         const blink::WebURL& image_url) {
+  if (!enabled_per_settings)
+    return false;
+  return IsAllowedByRules("images", GURL(image_url));
+}
+
+bool ContentSettingsObserver::allowScript(bool enabled_per_settings) {
+  if (!enabled_per_settings)
+    return false;
+  blink::WebFrame* frame = render_frame()->GetWebFrame();
+  auto origin = blink::WebStringToGURL(frame->getSecurityOrigin().toString());
+  return IsAllowedByRules("scripts", origin);
+}
+
+bool ContentSettingsObserver::allowScriptFromSource(
+    bool enabled_per_settings,
+    const blink::WebURL& script_url) {
+  if (!enabled_per_settings)
+    return false;
+  return IsAllowedByRules("scripts", GURL(script_url));
 }
 
 void ContentSettingsObserver::OnDestruct() {
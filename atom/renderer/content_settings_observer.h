@@ -24,6 +24,11 @@ class ContentSettingsObserver : public content::RenderFrameObserver,
   bool allowStorage(bool local) override;
   bool allowIndexedDB(const blink::WebString& name,
                       const blink::WebSecurityOrigin& security_origin) override;
+  bool allowImage(bool enabled_per_settings,
+                  const blink::WebURL& image_url) override;
+  bool allowScript(bool enabled_per_settings) override;
+  bool allowScriptFromSource(bool enabled_per_settings,
+                             const blink::WebURL& script_url) override;
 
  private:
   // content::RenderFrameObserver implementation.
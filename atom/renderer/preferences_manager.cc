@@ -5,10 +5,28 @@
 #include "atom/renderer/preferences_manager.h"
 
 #include "atom/common/api/api_messages.h"
+#include "base/strings/string_number_conversions.h"
 #include "content/public/renderer/render_thread.h"
 
 namespace atom {
 
+namespace {
+
+void InsertEntries(
+    const base::DictionaryValue& preferences,
+    std::map<int, std::unique_ptr<base::DictionaryValue>>* entries) {
+  for (base::DictionaryValue::Iterator iter(preferences); !iter.IsAtEnd();
+       iter.Advance()) {
+    int id;
+    const base::DictionaryValue* entry = nullptr;
+    if (base::StringToInt(iter.key(), &id) &&
+        iter.value().GetAsDictionary(&entry))
+      (*entries)[id] = entry->CreateDeepCopy();
+  }
+}
+
+}  // namespace
+
 PreferencesManager::PreferencesManager() {
   content::RenderThread::Get()->AddObserver(this);
 }
@@ -21,14 +39,36 @@ bool PreferencesManager::OnControlMessageReceived(
   bool handled = true;
   IPC_BEGIN_MESSAGE_MAP(PreferencesManager, message)
     IPC_MESSAGE_HANDLER(AtomMsg_UpdatePreferences, OnUpdatePreferences)
+    IPC_MESSAGE_HANDLER(AtomMsg_UpdatePreferencesDelta,
+                        OnUpdatePreferencesDelta)
     IPC_MESSAGE_UNHANDLED(handled = false)
   IPC_END_MESSAGE_MAP()
   return handled;
 }
 
 void PreferencesManager::OnUpdatePreferences(
-    const base::ListValue& preferences) {
-  preferences_ = preferences.CreateDeepCopy();
+    const base::DictionaryValue& preferences) {
+  entries_.clear();
+  InsertEntries(preferences, &entries_);
+  RebuildPreferences();
+}
+
+void PreferencesManager::OnUpdatePreferencesDelta(
+    const base::DictionaryValue& added,
+    const base::ListValue& removed) {
+  for (size_t i = 0; i < removed.GetSize(); ++i) {
+    int id;
+    if (removed.GetInteger(i, &id))
+      entries_.erase(id);
+  }
+  InsertEntries(added, &entries_);
+  RebuildPreferences();
+}
+
+void PreferencesManager::RebuildPreferences() {
+  preferences_.reset(new base::ListValue);
+  for (const auto& iter : entries_)
+    preferences_->Append(iter.second->CreateDeepCopy());
 }
 
 }  // namespace atom
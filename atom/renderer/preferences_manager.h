@@ -5,6 +5,7 @@
 #ifndef ATOM_RENDERER_PREFERENCES_MANAGER_H_
 #define ATOM_RENDERER_PREFERENCES_MANAGER_H_
 
+#include <map>
 #include <memory>
 
 #include "base/values.h"
@@ -23,7 +24,14 @@ class PreferencesManager : public content::RenderThreadObserver {
   // content::RenderThreadObserver:
   bool OnControlMessageReceived(const IPC::Message& message) override;
 
-  void OnUpdatePreferences(const base::ListValue& preferences);
+  void OnUpdatePreferences(const base::DictionaryValue& preferences);
+  void OnUpdatePreferencesDelta(const base::DictionaryValue& added,
+                                const base::ListValue& removed);
+
+  void RebuildPreferences();
+
+  // Entries keyed by the browser-side entry id so deltas can be applied.
+  std::map<int, std::unique_ptr<base::DictionaryValue>> entries_;
 
   std::unique_ptr<base::ListValue> preferences_;
 
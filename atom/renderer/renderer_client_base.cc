@@ -13,6 +13,7 @@
 #include "atom/common/options_switches.h"
 #include "atom/renderer/atom_autofill_agent.h"
 #include "atom/renderer/atom_render_frame_observer.h"
+#include "atom/renderer/content_settings_manager.h"
 #include "atom/renderer/content_settings_observer.h"
 #include "atom/renderer/guest_view_container.h"
 #include "atom/renderer/preferences_manager.h"
@@ -95,6 +96,7 @@ void RendererClientBase::RenderThreadStarted() {
         WTF::String::fromUTF8(scheme.data(), scheme.length()));
 
   preferences_manager_.reset(new PreferencesManager);
+  content_settings_manager_.reset(new ContentSettingsManager);
 
 #if defined(OS_WIN)
   // Set ApplicationUserModelID in renderer process.
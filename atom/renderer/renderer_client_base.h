@@ -12,6 +12,7 @@
 
 namespace atom {
 
+class ContentSettingsManager;
 class PreferencesManager;
 
 class RendererClientBase : public content::ContentRendererClient {
@@ -51,6 +52,7 @@ class RendererClientBase : public content::ContentRendererClient {
 
  private:
   std::unique_ptr<PreferencesManager> preferences_manager_;
+  std::unique_ptr<ContentSettingsManager> content_settings_manager_;
 };
 
 }  // namespace atom
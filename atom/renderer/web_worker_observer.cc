@@ -7,6 +7,7 @@
 #include "atom/common/api/atom_bindings.h"
 #include "atom/common/api/event_emitter_caller.h"
 #include "atom/common/asar/asar_util.h"
+#include "atom/common/native_mate_converters/interned_string.h"
 #include "atom/common/node_bindings.h"
 #include "base/lazy_instance.h"
 #include "base/threading/thread_local.h"
@@ -67,6 +68,10 @@ void WebWorkerObserver::ContextWillDestroy(v8::Local<v8::Context> context) {
   if (env)
     mate::EmitEvent(env->isolate(), env->process_object(), "exit");
 
+  // The worker's isolate goes away with this context; drop the interned
+  // string handles cached for it.
+  mate::ReleaseInternedStrings(context->GetIsolate());
+
   delete this;
 }
 
@@ -25,6 +25,7 @@ class BrowserClient : public content::ContentBrowserClient {
   ~BrowserClient();
 
   BrowserMainParts* browser_main_parts() { return browser_main_parts_; }
+  NetLog* net_log() { return &net_log_; }
 
   NotificationPresenter* GetNotificationPresenter();
 
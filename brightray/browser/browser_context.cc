@@ -13,6 +13,7 @@
 #include "brightray/browser/media/media_device_id_salt.h"
 #include "brightray/browser/network_delegate.h"
 #include "brightray/browser/special_storage_policy.h"
+#include "brightray/browser/write_coalescing_pref_store.h"
 #include "brightray/browser/zoom_level_delegate.h"
 #include "brightray/common/application_info.h"
 #include "components/prefs/json_pref_store.h"
@@ -109,9 +110,15 @@ BrowserContext::~BrowserContext() {
 void BrowserContext::InitPrefs() {
   auto prefs_path = GetPath().Append(FILE_PATH_LITERAL("Preferences"));
   PrefServiceFactory prefs_factory;
-  prefs_factory.SetUserPrefsFile(prefs_path,
-      JsonPrefStore::GetTaskRunnerForFile(
-          prefs_path, BrowserThread::GetBlockingPool()).get());
+  // The coalescing store batches pref changes and writes them from the
+  // blocking pool, so high-churn prefs (window state during move or
+  // resize) do not serialize the prefs file on the UI thread per
+  // change. The file format is unchanged from JsonPrefStore.
+  prefs_factory.set_user_prefs(make_scoped_refptr(
+      new WriteCoalescingPrefStore(
+          prefs_path,
+          JsonPrefStore::GetTaskRunnerForFile(
+              prefs_path, BrowserThread::GetBlockingPool()))));
 
   auto registry = make_scoped_refptr(new PrefRegistrySimple);
   RegisterInternalPrefs(registry.get());
@@ -9,16 +9,23 @@
 #include <algorithm>
 #include <iterator>
 #include <set>
+#include <utility>
 
 #include "base/bind.h"
+#include "base/files/file.h"
 #include "base/files/file_enumerator.h"
 #include "base/files/file_util.h"
-#include "base/files/file_util_proxy.h"
+#include "base/files/memory_mapped_file.h"
 #include "base/lazy_instance.h"
 #include "base/logging.h"
+#include "base/path_service.h"
+#include "base/pickle.h"
 #include "base/stl_util.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/sys_info.h"
+#include "base/threading/sequenced_worker_pool.h"
+#include "brightray/browser/brightray_paths.h"
 #include "content/public/browser/browser_thread.h"
 
 using base::Bind;
@@ -58,6 +65,10 @@ bool IsAsciiUpper(Char c) {
   return c >= 'A' && c <= 'Z';
 }
 
+// Version of the on-disk index format; bump when the layout changes so
+// stale caches are discarded instead of misparsed.
+const uint32_t kIndexCacheVersion = 1;
+
 class Index {
  public:
   Index();
@@ -69,10 +80,22 @@ class Index {
   void PrintStats();
   void NormalizeVectors();
 
+  // Loads the persisted index on first call; later calls are no-ops.
+  // The recorded per-file mtimes make the normal indexing walk skip
+  // every unchanged file, so reopening DevTools on an unchanged
+  // workspace only pays the directory walk.
+  void EnsureLoadedFromDisk();
+
+  // Persists the index under the user cache dir. Called after indexing
+  // completes, when the vectors are normalized.
+  void SaveToDisk();
+
  private:
   ~Index();
 
   FileId GetFileId(const FilePath& file_path);
+  void Reset();
+  bool ReadFromPickle(const base::Pickle& pickle);
 
   typedef map<FilePath, FileId> FileIdsMap;
   FileIdsMap file_ids_;
@@ -82,6 +105,7 @@ class Index {
   typedef map<FilePath, Time> IndexedFilesMap;
   IndexedFilesMap index_times_;
   vector<bool> is_normalized_;
+  bool load_attempted_;
 
   DISALLOW_COPY_AND_ASSIGN(Index);
 };
@@ -139,7 +163,14 @@ Trigram TrigramAtIndex(const vector<TrigramChar>& trigram_chars, size_t index) {
   return trigram;
 }
 
-Index::Index() : last_file_id_(0) {
+FilePath IndexCachePath() {
+  FilePath cache_dir;
+  if (!PathService::Get(DIR_USER_CACHE, &cache_dir))
+    return FilePath();
+  return cache_dir.Append(FILE_PATH_LITERAL("DevToolsTrigramIndex"));
+}
+
+Index::Index() : last_file_id_(0), load_attempted_(false) {
   index_.resize(kTrigramCount);
   is_normalized_.resize(kTrigramCount);
   std::fill(is_normalized_.begin(), is_normalized_.end(), true);
@@ -147,6 +178,121 @@ Index::Index() : last_file_id_(0) {
 
 Index::~Index() {}
 
+void Index::Reset() {
+  file_ids_.clear();
+  index_times_.clear();
+  last_file_id_ = 0;
+  index_.assign(kTrigramCount, vector<FileId>());
+  is_normalized_.assign(kTrigramCount, true);
+}
+
+void Index::EnsureLoadedFromDisk() {
+  DCHECK_CURRENTLY_ON(BrowserThread::FILE);
+  if (load_attempted_)
+    return;
+  load_attempted_ = true;
+
+  FilePath cache_path = IndexCachePath();
+  if (cache_path.empty())
+    return;
+  base::MemoryMappedFile file;
+  if (!file.Initialize(cache_path))
+    return;
+  base::Pickle pickle(reinterpret_cast<const char*>(file.data()),
+                      static_cast<int>(file.length()));
+  if (!ReadFromPickle(pickle)) {
+    // A truncated or incompatible cache; start over from scratch.
+    Reset();
+  }
+}
+
+bool Index::ReadFromPickle(const base::Pickle& pickle) {
+  base::PickleIterator it(pickle);
+  uint32_t version = 0;
+  if (!it.ReadUInt32(&version) || version != kIndexCacheVersion)
+    return false;
+
+  uint32_t file_count = 0;
+  if (!it.ReadUInt32(&file_count))
+    return false;
+  for (uint32_t i = 0; i < file_count; ++i) {
+    string path_str;
+    uint32_t file_id = 0;
+    int64_t time_internal = 0;
+    if (!it.ReadString(&path_str) || !it.ReadUInt32(&file_id) ||
+        !it.ReadInt64(&time_internal)) {
+      return false;
+    }
+    FilePath file_path = FilePath::FromUTF8Unsafe(path_str);
+    file_ids_[file_path] = static_cast<FileId>(file_id);
+    last_file_id_ = std::max(last_file_id_, static_cast<FileId>(file_id));
+    if (time_internal)
+      index_times_[file_path] = Time::FromInternalValue(time_internal);
+  }
+
+  uint32_t trigram_count = 0;
+  if (!it.ReadUInt32(&trigram_count))
+    return false;
+  for (uint32_t i = 0; i < trigram_count; ++i) {
+    uint32_t trigram = 0;
+    uint32_t id_count = 0;
+    if (!it.ReadUInt32(&trigram) || trigram >= kTrigramCount ||
+        !it.ReadUInt32(&id_count)) {
+      return false;
+    }
+    vector<FileId>& ids = index_[trigram];
+    ids.reserve(id_count);
+    for (uint32_t j = 0; j < id_count; ++j) {
+      uint16_t file_id = 0;
+      if (!it.ReadUInt16(&file_id))
+        return false;
+      ids.push_back(file_id);
+    }
+  }
+  return true;
+}
+
+void Index::SaveToDisk() {
+  DCHECK_CURRENTLY_ON(BrowserThread::FILE);
+  FilePath cache_path = IndexCachePath();
+  if (cache_path.empty())
+    return;
+
+  base::Pickle pickle;
+  pickle.WriteUInt32(kIndexCacheVersion);
+  pickle.WriteUInt32(static_cast<uint32_t>(file_ids_.size()));
+  for (FileIdsMap::const_iterator it = file_ids_.begin();
+       it != file_ids_.end(); ++it) {
+    pickle.WriteString(it->first.AsUTF8Unsafe());
+    pickle.WriteUInt32(it->second);
+    IndexedFilesMap::const_iterator time_it = index_times_.find(it->first);
+    pickle.WriteInt64(time_it == index_times_.end()
+                          ? 0
+                          : time_it->second.ToInternalValue());
+  }
+
+  uint32_t trigram_count = 0;
+  for (size_t i = 0; i < kTrigramCount; ++i) {
+    if (!index_[i].empty())
+      ++trigram_count;
+  }
+  pickle.WriteUInt32(trigram_count);
+  for (size_t i = 0; i < kTrigramCount; ++i) {
+    if (index_[i].empty())
+      continue;
+    pickle.WriteUInt32(static_cast<uint32_t>(i));
+    pickle.WriteUInt32(static_cast<uint32_t>(index_[i].size()));
+    for (size_t j = 0; j < index_[i].size(); ++j)
+      pickle.WriteUInt16(index_[i][j]);
+  }
+
+  if (base::WriteFile(cache_path, static_cast<const char*>(pickle.data()),
+                      static_cast<int>(pickle.size())) < 0) {
+    LOG(WARNING) << "Failed to persist DevTools trigram index to "
+                 << cache_path.value();
+  }
+}
+
 Time Index::LastModifiedTimeForFile(const FilePath& file_path) {
   DCHECK_CURRENTLY_ON(BrowserThread::FILE);
   Time last_modified_time;
@@ -256,6 +402,50 @@ void Index::PrintStats() {
 
 typedef Callback<void(bool, const vector<bool>&)> IndexerCallback;
 
+// Reads |file_path| synchronously and collects its unique trigrams into
+// |trigrams|. Returns false when the file could not be read; binary
+// files succeed with an empty trigram list, matching how the index has
+// always recorded them. Runs on a blocking pool worker thread.
+bool ExtractTrigramsForFile(const FilePath& file_path,
+                            vector<Trigram>* trigrams) {
+  base::File file(file_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (!file.IsValid())
+    return false;
+
+  vector<bool> trigrams_set(kTrigramCount);
+  std::unique_ptr<char[]> buffer(new char[kMaxReadLength]);
+  int64_t offset = 0;
+  for (;;) {
+    int bytes_read = file.Read(offset, buffer.get(), kMaxReadLength);
+    if (bytes_read < 0)
+      return false;
+    if (bytes_read < 3)
+      break;
+
+    size_t size = static_cast<size_t>(bytes_read);
+    vector<TrigramChar> trigram_chars;
+    trigram_chars.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+      TrigramChar trigram_char = TrigramCharForChar(buffer[i]);
+      if (trigram_char == kBinaryTrigramChar) {
+        trigrams->clear();
+        return true;
+      }
+      trigram_chars.push_back(trigram_char);
+    }
+    for (size_t i = 0; i + 2 < size; ++i) {
+      Trigram trigram = TrigramAtIndex(trigram_chars, i);
+      if (trigram != kUndefinedTrigram && !trigrams_set[trigram]) {
+        trigrams_set[trigram] = true;
+        trigrams->push_back(trigram);
+      }
+    }
+    // Overlap reads by two bytes so trigrams spanning chunks are seen.
+    offset += bytes_read - 2;
+  }
+  return true;
+}
+
 }  // namespace
 
 DevToolsFileSystemIndexer::FileSystemIndexingJob::FileSystemIndexingJob(
@@ -267,12 +457,7 @@ DevToolsFileSystemIndexer::FileSystemIndexingJob::FileSystemIndexingJob(
       total_work_callback_(total_work_callback),
       worked_callback_(worked_callback),
       done_callback_(done_callback),
-      current_file_(
-          BrowserThread::GetTaskRunnerForThread(BrowserThread::FILE).get()),
-      files_indexed_(0),
-      stopped_(false) {
-  current_trigrams_set_.resize(kTrigramCount);
-  current_trigrams_.reserve(kTrigramCount);
+      outstanding_shards_(0) {
 }
 
 DevToolsFileSystemIndexer::FileSystemIndexingJob::~FileSystemIndexingJob() {}
@@ -287,20 +472,16 @@ void DevToolsFileSystemIndexer::FileSystemIndexingJob::Start() {
 
 void DevToolsFileSystemIndexer::FileSystemIndexingJob::Stop() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  BrowserThread::PostTask(BrowserThread::FILE,
-                          FROM_HERE,
-                          Bind(&FileSystemIndexingJob::StopOnFileThread, this));
-}
-
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::StopOnFileThread() {
-  stopped_ = true;
+  stopped_.Set();
 }
 
 void DevToolsFileSystemIndexer::FileSystemIndexingJob::CollectFilesToIndex() {
   DCHECK_CURRENTLY_ON(BrowserThread::FILE);
-  if (stopped_)
+  if (stopped_.IsSet())
     return;
   if (!file_enumerator_) {
+    // Pick up the persisted index so unchanged files are skipped below.
+    g_trigram_index.Get().EnsureLoadedFromDisk();
     file_enumerator_.reset(
         new FileEnumerator(file_system_path_, true, FileEnumerator::FILES));
   }
@@ -310,8 +491,7 @@ void DevToolsFileSystemIndexer::FileSystemIndexingJob::CollectFilesToIndex() {
         BrowserThread::UI,
         FROM_HERE,
         Bind(total_work_callback_, file_path_times_.size()));
-    indexing_it_ = file_path_times_.begin();
-    IndexFiles();
+    DispatchShards();
     return;
   }
   Time saved_last_modified_time =
@@ -327,118 +507,94 @@ void DevToolsFileSystemIndexer::FileSystemIndexingJob::CollectFilesToIndex() {
       Bind(&FileSystemIndexingJob::CollectFilesToIndex, this));
 }
 
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::IndexFiles() {
+void DevToolsFileSystemIndexer::FileSystemIndexingJob::DispatchShards() {
   DCHECK_CURRENTLY_ON(BrowserThread::FILE);
-  if (stopped_)
+  if (stopped_.IsSet())
     return;
-  if (indexing_it_ == file_path_times_.end()) {
-    g_trigram_index.Get().NormalizeVectors();
+  if (file_path_times_.empty()) {
     BrowserThread::PostTask(BrowserThread::UI, FROM_HERE, done_callback_);
     return;
   }
-  FilePath file_path = indexing_it_->first;
-  current_file_.CreateOrOpen(
-        file_path,
-        base::File::FLAG_OPEN | base::File::FLAG_READ,
-        Bind(&FileSystemIndexingJob::StartFileIndexing, this));
-}
 
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::StartFileIndexing(
-    base::File::Error error) {
-  if (!current_file_.IsValid()) {
-    FinishFileIndexing(false);
-    return;
+  // Warm the lazily built trigram translation table before workers use
+  // it concurrently.
+  TrigramCharForChar(0);
+
+  size_t shard_count = std::min(
+      file_path_times_.size(),
+      static_cast<size_t>(
+          std::max(1, base::SysInfo::NumberOfProcessors())));
+  vector<vector<FilePath>> shards(shard_count);
+  size_t next_shard = 0;
+  for (FilePathTimesMap::const_iterator it = file_path_times_.begin();
+       it != file_path_times_.end(); ++it) {
+    shards[next_shard++ % shard_count].push_back(it->first);
   }
-  current_file_offset_ = 0;
-  current_trigrams_.clear();
-  std::fill(current_trigrams_set_.begin(), current_trigrams_set_.end(), false);
-  ReadFromFile();
-}
 
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::ReadFromFile() {
-  if (stopped_) {
-    CloseFile();
-    return;
+  outstanding_shards_ = static_cast<int>(shard_count);
+  base::SequencedWorkerPool* pool = BrowserThread::GetBlockingPool();
+  for (size_t i = 0; i < shards.size(); ++i) {
+    pool->PostWorkerTaskWithShutdownBehavior(
+        FROM_HERE,
+        Bind(&FileSystemIndexingJob::IndexShardOnWorker, this, shards[i]),
+        base::SequencedWorkerPool::CONTINUE_ON_SHUTDOWN);
   }
-  current_file_.Read(current_file_offset_, kMaxReadLength,
-                     Bind(&FileSystemIndexingJob::OnRead, this));
 }
 
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::OnRead(
-    base::File::Error error,
-    const char* data,
-    int bytes_read) {
-  if (error != base::File::FILE_OK) {
-    FinishFileIndexing(false);
-    return;
-  }
-
-  if (!bytes_read || bytes_read < 3) {
-    FinishFileIndexing(true);
-    return;
-  }
-
-  size_t size = static_cast<size_t>(bytes_read);
-  vector<TrigramChar> trigram_chars;
-  trigram_chars.reserve(size);
-  for (size_t i = 0; i < size; ++i) {
-    TrigramChar trigram_char = TrigramCharForChar(data[i]);
-    if (trigram_char == kBinaryTrigramChar) {
-      current_trigrams_.clear();
-      FinishFileIndexing(true);
-      return;
+void DevToolsFileSystemIndexer::FileSystemIndexingJob::IndexShardOnWorker(
+    const vector<FilePath>& shard) {
+  std::unique_ptr<ShardResults> results(new ShardResults);
+  results->reserve(shard.size());
+
+  int files_since_report = 0;
+  TimeTicks last_report_time = TimeTicks::Now();
+  for (size_t i = 0; i < shard.size(); ++i) {
+    if (stopped_.IsSet())
+      break;
+    vector<Trigram> trigrams;
+    if (ExtractTrigramsForFile(shard[i], &trigrams))
+      results->push_back(std::make_pair(shard[i], std::move(trigrams)));
+
+    ++files_since_report;
+    TimeTicks now = TimeTicks::Now();
+    if ((now - last_report_time).InMilliseconds() >=
+        kMinTimeoutBetweenWorkedNotification) {
+      BrowserThread::PostTask(BrowserThread::UI, FROM_HERE,
+                              Bind(worked_callback_, files_since_report));
+      files_since_report = 0;
+      last_report_time = now;
     }
-    trigram_chars.push_back(trigram_char);
   }
-
-  for (size_t i = 0; i + 2 < size; ++i) {
-    Trigram trigram = TrigramAtIndex(trigram_chars, i);
-    if ((trigram != kUndefinedTrigram) && !current_trigrams_set_[trigram]) {
-      current_trigrams_set_[trigram] = true;
-      current_trigrams_.push_back(trigram);
-    }
+  if (files_since_report > 0) {
+    BrowserThread::PostTask(BrowserThread::UI, FROM_HERE,
+                            Bind(worked_callback_, files_since_report));
   }
-  current_file_offset_ += bytes_read - 2;
-  ReadFromFile();
+
+  BrowserThread::PostTask(
+      BrowserThread::FILE,
+      FROM_HERE,
+      Bind(&FileSystemIndexingJob::MergeShardResults, this,
+           base::Passed(&results)));
 }
 
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::FinishFileIndexing(
-    bool success) {
+void DevToolsFileSystemIndexer::FileSystemIndexingJob::MergeShardResults(
+    std::unique_ptr<ShardResults> results) {
   DCHECK_CURRENTLY_ON(BrowserThread::FILE);
-  CloseFile();
-  if (success) {
-    FilePath file_path = indexing_it_->first;
+  --outstanding_shards_;
+  if (stopped_.IsSet())
+    return;
+
+  for (size_t i = 0; i < results->size(); ++i) {
+    const FilePath& file_path = (*results)[i].first;
     g_trigram_index.Get().SetTrigramsForFile(
-        file_path, current_trigrams_, file_path_times_[file_path]);
+        file_path, (*results)[i].second, file_path_times_[file_path]);
   }
-  ReportWorked();
-  ++indexing_it_;
-  IndexFiles();
-}
-
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::CloseFile() {
-  if (current_file_.IsValid())
-    current_file_.Close(Bind(&FileSystemIndexingJob::CloseCallback, this));
-}
-
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::CloseCallback(
-    base::File::Error error) {}
 
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::ReportWorked() {
-  TimeTicks current_time = TimeTicks::Now();
-  bool should_send_worked_nitification = true;
-  if (!last_worked_notification_time_.is_null()) {
-    TimeDelta delta = current_time - last_worked_notification_time_;
-    if (delta.InMilliseconds() < kMinTimeoutBetweenWorkedNotification)
-      should_send_worked_nitification = false;
-  }
-  ++files_indexed_;
-  if (should_send_worked_nitification) {
-    last_worked_notification_time_ = current_time;
-    BrowserThread::PostTask(
-        BrowserThread::UI, FROM_HERE, Bind(worked_callback_, files_indexed_));
-    files_indexed_ = 0;
-  }
+  if (outstanding_shards_ > 0)
+    return;
+  g_trigram_index.Get().NormalizeVectors();
+  g_trigram_index.Get().SaveToDisk();
+  BrowserThread::PostTask(BrowserThread::UI, FROM_HERE, done_callback_);
 }
 
 DevToolsFileSystemIndexer::DevToolsFileSystemIndexer() {
@@ -481,6 +637,7 @@ void DevToolsFileSystemIndexer::SearchInPathOnFileThread(
     const string& query,
     const SearchCallback& callback) {
   DCHECK_CURRENTLY_ON(BrowserThread::FILE);
+  g_trigram_index.Get().EnsureLoadedFromDisk();
   vector<FilePath> file_paths = g_trigram_index.Get().Search(query);
   vector<string> result;
   FilePath path = FilePath::FromUTF8Unsafe(file_system_path);
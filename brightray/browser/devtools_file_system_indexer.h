@@ -10,12 +10,14 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/callback.h"
-#include "base/files/file_proxy.h"
 #include "base/macros.h"
 #include "base/memory/ref_counted.h"
+#include "base/synchronization/atomic_flag.h"
+#include "base/time/time.h"
 
 namespace base {
 class FilePath;
@@ -37,12 +39,13 @@ class DevToolsFileSystemIndexer
   typedef base::Callback<void()> DoneCallback;
   typedef base::Callback<void(const std::vector<std::string>&)> SearchCallback;
 
-  class FileSystemIndexingJob : public base::RefCounted<FileSystemIndexingJob> {
+  class FileSystemIndexingJob
+      : public base::RefCountedThreadSafe<FileSystemIndexingJob> {
    public:
     void Stop();
 
    private:
-    friend class base::RefCounted<FileSystemIndexingJob>;
+    friend class base::RefCountedThreadSafe<FileSystemIndexingJob>;
     friend class DevToolsFileSystemIndexer;
     FileSystemIndexingJob(const base::FilePath& file_system_path,
                           const TotalWorkCallback& total_work_callback,
@@ -50,19 +53,20 @@ class DevToolsFileSystemIndexer
                           const DoneCallback& done_callback);
     virtual ~FileSystemIndexingJob();
 
+    typedef int32_t Trigram;
+    // Per-shard extraction output: the unique trigrams of each
+    // successfully read file.
+    typedef std::vector<std::pair<base::FilePath, std::vector<Trigram>>>
+        ShardResults;
+
     void Start();
-    void StopOnFileThread();
     void CollectFilesToIndex();
-    void IndexFiles();
-    void StartFileIndexing(base::File::Error error);
-    void ReadFromFile();
-    void OnRead(base::File::Error error,
-                const char* data,
-                int bytes_read);
-    void FinishFileIndexing(bool success);
-    void CloseFile();
-    void CloseCallback(base::File::Error error);
-    void ReportWorked();
+    // Splits the collected files across blocking pool workers. Each
+    // shard extracts trigrams independently; results are merged into
+    // the global index on the FILE thread as shards complete.
+    void DispatchShards();
+    void IndexShardOnWorker(const std::vector<base::FilePath>& shard);
+    void MergeShardResults(std::unique_ptr<ShardResults> results);
 
     base::FilePath file_system_path_;
     TotalWorkCallback total_work_callback_;
@@ -71,16 +75,9 @@ class DevToolsFileSystemIndexer
     std::unique_ptr<base::FileEnumerator> file_enumerator_;
     typedef std::map<base::FilePath, base::Time> FilePathTimesMap;
     FilePathTimesMap file_path_times_;
-    FilePathTimesMap::const_iterator indexing_it_;
-    base::FileProxy current_file_;
-    int64_t current_file_offset_;
-    typedef int32_t Trigram;
-    std::vector<Trigram> current_trigrams_;
-    // The index in this vector is the trigram id.
-    std::vector<bool> current_trigrams_set_;
-    base::TimeTicks last_worked_notification_time_;
-    int files_indexed_;
-    bool stopped_;
+    // Number of shards still extracting; accessed on the FILE thread.
+    int outstanding_shards_;
+    base::AtomicFlag stopped_;
   };
 
   DevToolsFileSystemIndexer();
@@ -4,8 +4,10 @@
 
 #include "brightray/browser/devtools_ui.h"
 
+#include <map>
 #include <string>
 
+#include "base/lazy_instance.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
@@ -21,6 +23,16 @@ namespace {
 const char kChromeUIDevToolsHost[] = "devtools";
 const char kChromeUIDevToolsBundledPath[] = "bundled";
 
+// Resolved bundled resources, keyed by path. GetFrontendResource() does a
+// linear scan over the frontend resource table and opening DevTools
+// requests a few hundred files, so each resolved resource is memoized
+// together with its RefCountedStaticMemory wrapper. The bytes live in the
+// mapped resource pak, so serving from the index stays zero-copy. Only
+// touched on the IO thread, and the resources are immutable.
+base::LazyInstance<
+    std::map<std::string, scoped_refptr<base::RefCountedStaticMemory>>>::Leaky
+    g_bundled_resource_index = LAZY_INSTANCE_INITIALIZER;
+
 std::string PathWithoutParams(const std::string& path) {
   return GURL(std::string("chrome-devtools://devtools/") + path)
       .path().substr(1);
@@ -98,6 +110,14 @@ class BundledDataSource : public content::URLDataSource {
   void StartBundledDataRequest(const std::string& path,
                                const GotDataCallback& callback) {
     std::string filename = PathWithoutParams(path);
+
+    auto& index = g_bundled_resource_index.Get();
+    auto iter = index.find(filename);
+    if (iter != index.end()) {
+      callback.Run(iter->second.get());
+      return;
+    }
+
     base::StringPiece resource =
         content::DevToolsFrontendHost::GetFrontendResource(filename);
 
@@ -107,6 +127,7 @@ class BundledDataSource : public content::URLDataSource {
            "--debug-devtools.";
     scoped_refptr<base::RefCountedStaticMemory> bytes(
         new base::RefCountedStaticMemory(resource.data(), resource.length()));
+    index[filename] = bytes;
     callback.Run(bytes.get());
   }
 
@@ -38,6 +38,9 @@ class InspectableWebContents {
   virtual InspectableWebContentsDelegate* GetDelegate() const = 0;
 
   virtual void SetDockState(const std::string& state) = 0;
+  // Loads the devtools frontend in a hidden WebContents without showing it,
+  // so a later ShowDevTools is nearly instant.
+  virtual void PreloadDevTools() = 0;
   virtual void ShowDevTools() = 0;
   virtual void CloseDevTools() = 0;
   virtual bool IsDevToolsViewShowing() = 0;
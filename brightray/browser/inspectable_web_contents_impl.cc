@@ -11,6 +11,8 @@
 #include "base/strings/pattern.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task_runner_util.h"
+#include "base/threading/sequenced_worker_pool.h"
 #include "base/values.h"
 #include "brightray/browser/browser_client.h"
 #include "brightray/browser/browser_context.h"
@@ -63,6 +65,12 @@ const char kTitleFormat[] = "Developer Tools - %s";
 
 const size_t kMaxMessageChunkSize = IPC::Channel::kMaximumMessageSize / 4;
 
+// Runs on a blocking pool sequence; JSON decoding is the expensive part
+// of frontend message handling and needs no UI-thread state.
+std::unique_ptr<base::Value> ParseDevToolsMessage(const std::string& message) {
+  return base::JSONReader::Read(message);
+}
+
 void RectToDictionary(const gfx::Rect& bounds, base::DictionaryValue* dict) {
   dict->SetInteger("x", bounds.x());
   dict->SetInteger("y", bounds.y());
@@ -200,6 +208,7 @@ void InspectableWebContentsImpl::RegisterPrefs(PrefRegistrySimple* registry) {
 InspectableWebContentsImpl::InspectableWebContentsImpl(
     content::WebContents* web_contents)
     : frontend_loaded_(false),
+      preload_only_(false),
       can_dock_(true),
       delegate_(nullptr),
       web_contents_(web_contents),
@@ -282,35 +291,59 @@ void InspectableWebContentsImpl::SetDockState(const std::string& state) {
   }
 }
 
+void InspectableWebContentsImpl::PreloadDevTools() {
+  // Load the frontend in a hidden WebContents ahead of time, so a later
+  // ShowDevTools only has to attach the view instead of paying for the
+  // whole frontend load while the user waits.
+  if (devtools_web_contents_)
+    return;
+  preload_only_ = true;
+  CreateDevToolsWebContents();
+}
+
 void InspectableWebContentsImpl::ShowDevTools() {
   // Show devtools only after it has done loading, this is to make sure the
   // SetIsDocked is called *BEFORE* ShowDevTools.
   if (!devtools_web_contents_) {
-    embedder_message_dispatcher_.reset(
-        DevToolsEmbedderMessageDispatcher::CreateForDevToolsFrontend(this));
+    CreateDevToolsWebContents();
+  } else if (frontend_loaded_) {
+    bool was_preloaded = preload_only_;
+    preload_only_ = false;
+    view_->ShowDevTools();
+    // A preloaded frontend skipped the opened notification in LoadCompleted.
+    if (was_preloaded && view_->GetDelegate())
+      view_->GetDelegate()->DevToolsOpened();
+  } else {
+    // The frontend is still loading (e.g. a preload is in flight);
+    // LoadCompleted will show the view.
+    preload_only_ = false;
+  }
+}
 
-    content::WebContents::CreateParams create_params(
-        web_contents_->GetBrowserContext());
-    devtools_web_contents_.reset(content::WebContents::Create(create_params));
+void InspectableWebContentsImpl::CreateDevToolsWebContents() {
+  embedder_message_dispatcher_.reset(
+      DevToolsEmbedderMessageDispatcher::CreateForDevToolsFrontend(this));
 
-    Observe(devtools_web_contents_.get());
-    devtools_web_contents_->SetDelegate(this);
+  content::WebContents::CreateParams create_params(
+      web_contents_->GetBrowserContext());
+  devtools_web_contents_.reset(content::WebContents::Create(create_params));
 
-    AttachTo(content::DevToolsAgentHost::GetOrCreateFor(web_contents_.get()));
+  Observe(devtools_web_contents_.get());
+  devtools_web_contents_->SetDelegate(this);
 
-    devtools_web_contents_->GetController().LoadURL(
-        GetDevToolsURL(can_dock_),
-        content::Referrer(),
-        ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
-        std::string());
-  } else {
-    view_->ShowDevTools();
-  }
+  AttachTo(content::DevToolsAgentHost::GetOrCreateFor(web_contents_.get()));
+
+  devtools_web_contents_->GetController().LoadURL(
+      GetDevToolsURL(can_dock_),
+      content::Referrer(),
+      ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
+      std::string());
 }
 
 void InspectableWebContentsImpl::CloseDevTools() {
   if (devtools_web_contents_) {
     frontend_loaded_ = false;
+    preload_only_ = false;
     view_->CloseDevTools();
     devtools_web_contents_.reset();
     web_contents_->Focus();
@@ -394,7 +427,8 @@ void InspectableWebContentsImpl::CloseWindow() {
 
 void InspectableWebContentsImpl::LoadCompleted() {
   frontend_loaded_ = true;
-  view_->ShowDevTools();
+  if (!preload_only_)
+    view_->ShowDevTools();
 
   // If the devtools can dock, "SetIsDocked" will be called by devtools itself.
   if (!can_dock_) {
@@ -412,7 +446,7 @@ void InspectableWebContentsImpl::LoadCompleted() {
     devtools_web_contents_->GetMainFrame()->ExecuteJavaScript(javascript);
   }
 
-  if (view_->GetDelegate())
+  if (!preload_only_ && view_->GetDelegate())
     view_->GetDelegate()->DevToolsOpened();
 }
 
@@ -596,22 +630,67 @@ void InspectableWebContentsImpl::ClearPreferences() {
 
 void InspectableWebContentsImpl::HandleMessageFromDevToolsFrontend(
     const std::string& message) {
-  std::string method;
-  base::ListValue empty_params;
-  base::ListValue* params = &empty_params;
+  // Parse on a sequenced worker so heavy frontend traffic (profiling
+  // sessions send thousands of messages per second) does not spend UI
+  // thread time on JSON decoding. The sequence plus the UI task queue
+  // keeps dispatch order identical to arrival order.
+  if (!frontend_message_parse_runner_) {
+    frontend_message_parse_runner_ =
+        content::BrowserThread::GetBlockingPool()
+            ->GetSequencedTaskRunnerWithShutdownBehavior(
+                content::BrowserThread::GetBlockingPool()->GetSequenceToken(),
+                base::SequencedWorkerPool::SKIP_ON_SHUTDOWN);
+  }
+  base::PostTaskAndReplyWithResult(
+      frontend_message_parse_runner_.get(), FROM_HERE,
+      base::Bind(&ParseDevToolsMessage, message),
+      base::Bind(&InspectableWebContentsImpl::DispatchParsedDevToolsMessage,
+                 weak_factory_.GetWeakPtr()));
+}
+
+void InspectableWebContentsImpl::DispatchParsedDevToolsMessage(
+    std::unique_ptr<base::Value> parsed) {
+  if (!parsed) {
+    LOG(ERROR) << "Invalid message was sent to embedder";
+    return;
+  }
+
+  // Batch framing: an array holds several embedder messages that were
+  // parsed in one go; dispatch them in order.
+  base::ListValue* batch = nullptr;
+  if (parsed->GetAsList(&batch)) {
+    for (size_t i = 0; i < batch->GetSize(); ++i) {
+      const base::DictionaryValue* message = nullptr;
+      if (batch->GetDictionary(i, &message))
+        DispatchSingleDevToolsMessage(*message);
+      else
+        LOG(ERROR) << "Invalid message in embedder batch";
+    }
+    return;
+  }
 
   base::DictionaryValue* dict = nullptr;
-  std::unique_ptr<base::Value> parsed_message(base::JSONReader::Read(message));
-  if (!parsed_message ||
-      !parsed_message->GetAsDictionary(&dict) ||
-      !dict->GetString(kFrontendHostMethod, &method) ||
-      (dict->HasKey(kFrontendHostParams) &&
-          !dict->GetList(kFrontendHostParams, &params))) {
-    LOG(ERROR) << "Invalid message was sent to embedder: " << message;
+  if (!parsed->GetAsDictionary(&dict)) {
+    LOG(ERROR) << "Invalid message was sent to embedder";
+    return;
+  }
+  DispatchSingleDevToolsMessage(*dict);
+}
+
+void InspectableWebContentsImpl::DispatchSingleDevToolsMessage(
+    const base::DictionaryValue& message) {
+  std::string method;
+  const base::ListValue empty_params;
+  const base::ListValue* params = &empty_params;
+
+  if (!message.GetString(kFrontendHostMethod, &method) ||
+      (message.HasKey(kFrontendHostParams) &&
+          !message.GetList(kFrontendHostParams, &params))) {
+    LOG(ERROR) << "Invalid message was sent to embedder";
     return;
   }
   int id = 0;
-  dict->GetInteger(kFrontendHostId, &id);
+  message.GetInteger(kFrontendHostId, &id);
   embedder_message_dispatcher_->Dispatch(
       base::Bind(&InspectableWebContentsImpl::SendMessageAck,
                  weak_factory_.GetWeakPtr(),
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "base/sequenced_task_runner.h"
 #include "brightray/browser/devtools_contents_resizing_strategy.h"
 #include "brightray/browser/devtools_embedder_message_dispatcher.h"
 #include "brightray/browser/inspectable_web_contents.h"
@@ -49,6 +50,7 @@ class InspectableWebContentsImpl :
   void SetDelegate(InspectableWebContentsDelegate* delegate) override;
   InspectableWebContentsDelegate* GetDelegate() const override;
   void SetDockState(const std::string& state) override;
+  void PreloadDevTools() override;
   void ShowDevTools() override;
   void CloseDevTools() override;
   bool IsDevToolsViewShowing() override;
@@ -117,6 +119,12 @@ class InspectableWebContentsImpl :
   // content::DevToolsFrontendHostDelegate:
   void HandleMessageFromDevToolsFrontend(const std::string& message);
 
+  // Runs on the UI thread once |message| has been parsed off-thread.
+  // Accepts either a single embedder message object or an array of them
+  // (batch framing: parsed once, dispatched in order).
+  void DispatchParsedDevToolsMessage(std::unique_ptr<base::Value> parsed);
+  void DispatchSingleDevToolsMessage(const base::DictionaryValue& message);
+
   // content::DevToolsAgentHostClient:
   void DispatchProtocolMessage(content::DevToolsAgentHost* agent_host,
                                const std::string& message) override;
@@ -169,7 +177,13 @@ class InspectableWebContentsImpl :
   void SendMessageAck(int request_id,
                       const base::Value* arg1);
 
+  // Creates the devtools WebContents and starts loading the frontend.
+  void CreateDevToolsWebContents();
+
   bool frontend_loaded_;
+  // True while the frontend is being loaded for PreloadDevTools, i.e. it
+  // should stay hidden once loaded until ShowDevTools is called.
+  bool preload_only_;
   scoped_refptr<content::DevToolsAgentHost> agent_host_;
   std::unique_ptr<content::DevToolsFrontendHost> frontend_host_;
   std::unique_ptr<DevToolsEmbedderMessageDispatcher>
@@ -182,6 +196,10 @@ class InspectableWebContentsImpl :
 
   using PendingRequestsMap = std::map<const net::URLFetcher*, DispatchCallback>;
   PendingRequestsMap pending_requests_;
+
+  // Sequenced runner that parses frontend JSON off the UI thread while
+  // preserving message order.
+  scoped_refptr<base::SequencedTaskRunner> frontend_message_parse_runner_;
   InspectableWebContentsDelegate* delegate_;  // weak references.
 
   PrefService* pref_service_;  // weak reference.
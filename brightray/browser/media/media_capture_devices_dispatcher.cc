@@ -4,6 +4,7 @@
 
 #include "brightray/browser/media/media_capture_devices_dispatcher.h"
 
+#include "base/bind.h"
 #include "base/logging.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/media_capture_devices.h"
@@ -41,7 +42,9 @@ MediaCaptureDevicesDispatcher* MediaCaptureDevicesDispatcher::GetInstance() {
 }
 
 MediaCaptureDevicesDispatcher::MediaCaptureDevicesDispatcher()
-    : is_device_enumeration_disabled_(false) {
+    : is_device_enumeration_disabled_(false),
+      audio_devices_cached_(false),
+      video_devices_cached_(false) {
   // MediaCaptureDevicesDispatcher is a singleton. It should be created on
   // UI thread.
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
@@ -54,7 +57,10 @@ MediaCaptureDevicesDispatcher::GetAudioCaptureDevices() {
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
   if (is_device_enumeration_disabled_)
     return EmptyDevices();
-  return content::MediaCaptureDevices::GetInstance()->GetAudioCaptureDevices();
+  // First read before any change notification; snapshot the current list.
+  if (!audio_devices_cached_)
+    UpdateAudioDevicesOnUIThread();
+  return cached_audio_devices_;
 }
 
 const MediaStreamDevices&
@@ -62,7 +68,23 @@ MediaCaptureDevicesDispatcher::GetVideoCaptureDevices() {
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
   if (is_device_enumeration_disabled_)
     return EmptyDevices();
-  return content::MediaCaptureDevices::GetInstance()->GetVideoCaptureDevices();
+  if (!video_devices_cached_)
+    UpdateVideoDevicesOnUIThread();
+  return cached_video_devices_;
+}
+
+void MediaCaptureDevicesDispatcher::UpdateAudioDevicesOnUIThread() {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  cached_audio_devices_ =
+      content::MediaCaptureDevices::GetInstance()->GetAudioCaptureDevices();
+  audio_devices_cached_ = true;
+}
+
+void MediaCaptureDevicesDispatcher::UpdateVideoDevicesOnUIThread() {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  cached_video_devices_ =
+      content::MediaCaptureDevices::GetInstance()->GetVideoCaptureDevices();
+  video_devices_cached_ = true;
 }
 
 void MediaCaptureDevicesDispatcher::GetDefaultDevices(
@@ -128,9 +150,17 @@ void MediaCaptureDevicesDispatcher::DisableDeviceEnumerationForTesting() {
 }
 
 void MediaCaptureDevicesDispatcher::OnAudioCaptureDevicesChanged() {
+  BrowserThread::PostTask(
+      BrowserThread::UI, FROM_HERE,
+      base::Bind(&MediaCaptureDevicesDispatcher::UpdateAudioDevicesOnUIThread,
+                 base::Unretained(this)));
 }
 
 void MediaCaptureDevicesDispatcher::OnVideoCaptureDevicesChanged() {
+  BrowserThread::PostTask(
+      BrowserThread::UI, FROM_HERE,
+      base::Bind(&MediaCaptureDevicesDispatcher::UpdateVideoDevicesOnUIThread,
+                 base::Unretained(this)));
 }
 
 void MediaCaptureDevicesDispatcher::OnMediaRequestStateChanged(
@@ -73,9 +73,22 @@ class MediaCaptureDevicesDispatcher : public content::MediaObserver {
   MediaCaptureDevicesDispatcher();
   virtual ~MediaCaptureDevicesDispatcher();
 
+  // Refresh the cached snapshots from the content layer; bounced to the UI
+  // thread since the change notifications arrive on the IO thread.
+  void UpdateAudioDevicesOnUIThread();
+  void UpdateVideoDevicesOnUIThread();
+
   // Flag used by unittests to disable device enumeration.
   bool is_device_enumeration_disabled_;
 
+  // Snapshots of the device lists, refreshed only on device-change
+  // notifications so the permission/selection path reads them without
+  // going back to the content layer.
+  bool audio_devices_cached_;
+  bool video_devices_cached_;
+  content::MediaStreamDevices cached_audio_devices_;
+  content::MediaStreamDevices cached_video_devices_;
+
   DISALLOW_COPY_AND_ASSIGN(MediaCaptureDevicesDispatcher);
 };
 
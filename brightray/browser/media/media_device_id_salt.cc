@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 #include "brightray/browser/media/media_device_id_salt.h"
 
+#include "base/bind.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/browser_thread.h"
@@ -21,11 +22,14 @@ const char kMediaDeviceIdSalt[] = "brightray.media.device_id_salt";
 MediaDeviceIDSalt::MediaDeviceIDSalt(PrefService* pref_service) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
-  media_device_id_salt_.Init(kMediaDeviceIdSalt, pref_service);
+  media_device_id_salt_.Init(
+      kMediaDeviceIdSalt, pref_service,
+      base::Bind(&MediaDeviceIDSalt::OnSaltChanged, base::Unretained(this)));
   if (media_device_id_salt_.GetValue().empty()) {
     media_device_id_salt_.SetValue(
         content::ResourceContext::CreateRandomMediaDeviceIDSalt());
   }
+  OnSaltChanged();
 }
 
 MediaDeviceIDSalt::~MediaDeviceIDSalt() {
@@ -34,8 +38,14 @@ MediaDeviceIDSalt::~MediaDeviceIDSalt() {
 }
 
 std::string MediaDeviceIDSalt::GetSalt() {
+  base::AutoLock auto_lock(lock_);
+  return cached_salt_;
+}
+
+void MediaDeviceIDSalt::OnSaltChanged() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  return media_device_id_salt_.GetValue();
+  base::AutoLock auto_lock(lock_);
+  cached_salt_ = media_device_id_salt_.GetValue();
 }
 
 // static
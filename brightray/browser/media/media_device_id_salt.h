@@ -8,6 +8,7 @@
 #include <string>
 
 #include "base/macros.h"
+#include "base/synchronization/lock.h"
 #include "components/prefs/pref_member.h"
 
 class PrefRegistrySimple;
@@ -29,8 +30,19 @@ class MediaDeviceIDSalt {
   static void Reset(PrefService* pref_service);
 
  private:
+  // Refreshes |cached_salt_| from the pref. Called on the UI thread when
+  // the pref changes, e.g. through Reset().
+  void OnSaltChanged();
+
   StringPrefMember media_device_id_salt_;
 
+  // Cached salt value so that GetSalt(), which runs on the IO thread once
+  // per device enumeration, is a plain read instead of a trip through the
+  // pref machinery. Guarded by |lock_| since updates happen on the UI
+  // thread.
+  mutable base::Lock lock_;
+  std::string cached_salt_;
+
   DISALLOW_COPY_AND_ASSIGN(MediaDeviceIDSalt);
 };
 
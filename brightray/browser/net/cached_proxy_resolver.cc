@@ -0,0 +1,173 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "brightray/browser/net/cached_proxy_resolver.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/strings/string_number_conversions.h"
+#include "net/base/net_errors.h"
+#include "url/gurl.h"
+
+namespace brightray {
+
+namespace {
+
+// How long a cached PAC result stays valid. Enterprise PAC scripts are
+// effectively static per host, so a few minutes trims most executions
+// without pinning decisions for too long.
+const int kCacheEntryTTLMinutes = 5;
+
+// Upper bound on cached hosts; the whole cache is dropped when reached,
+// which just means the next request per host runs the script again.
+const size_t kMaxCacheEntries = 1000;
+
+std::string CacheKey(const GURL& url) {
+  return url.host() + ":" + base::IntToString(url.EffectiveIntPort());
+}
+
+}  // namespace
+
+// CachedProxyResolverState implementation:
+
+CachedProxyResolverState::CachedProxyResolverState() {
+}
+
+CachedProxyResolverState::~CachedProxyResolverState() {
+}
+
+void CachedProxyResolverState::SetBypassRules(
+    const net::ProxyBypassRules& rules) {
+  bypass_rules_ = rules;
+}
+
+bool CachedProxyResolverState::MatchesBypassRules(const GURL& url) const {
+  return bypass_rules_.Matches(url);
+}
+
+bool CachedProxyResolverState::GetCachedResult(
+    const GURL& url, net::ProxyInfo* results) const {
+  std::map<std::string, CacheEntry>::iterator iter =
+      cache_.find(CacheKey(url));
+  if (iter == cache_.end())
+    return false;
+  if (base::TimeTicks::Now() > iter->second.expiry) {
+    cache_.erase(iter);
+    return false;
+  }
+  results->Use(iter->second.proxy_info);
+  return true;
+}
+
+void CachedProxyResolverState::CacheResult(const GURL& url,
+                                           const net::ProxyInfo& results) {
+  if (cache_.size() >= kMaxCacheEntries)
+    cache_.clear();
+  CacheEntry& entry = cache_[CacheKey(url)];
+  entry.proxy_info.Use(results);
+  entry.expiry = base::TimeTicks::Now() +
+      base::TimeDelta::FromMinutes(kCacheEntryTTLMinutes);
+}
+
+void CachedProxyResolverState::ClearCache() {
+  cache_.clear();
+}
+
+// CachedProxyResolver implementation:
+
+CachedProxyResolver::CachedProxyResolver(
+    std::unique_ptr<net::ProxyResolver> resolver,
+    scoped_refptr<CachedProxyResolverState> state)
+    : resolver_(std::move(resolver)),
+      state_(state) {
+}
+
+CachedProxyResolver::~CachedProxyResolver() {
+}
+
+int CachedProxyResolver::GetProxyForURL(
+    const GURL& url,
+    net::ProxyInfo* results,
+    const net::CompletionCallback& callback,
+    std::unique_ptr<Request>* request,
+    const net::NetLogWithSource& net_log) {
+  // Bypassed hosts go direct without ever running the PAC script.
+  if (state_->MatchesBypassRules(url)) {
+    results->UseDirect();
+    return net::OK;
+  }
+
+  if (state_->GetCachedResult(url, results))
+    return net::OK;
+
+  // base::Unretained is safe: pending requests die with |resolver_|,
+  // which this object owns.
+  int result = resolver_->GetProxyForURL(
+      url, results,
+      base::Bind(&CachedProxyResolver::OnResolveCompleted,
+                 base::Unretained(this), url, results, callback),
+      request, net_log);
+  if (result == net::OK)
+    state_->CacheResult(url, *results);
+  return result;
+}
+
+void CachedProxyResolver::OnResolveCompleted(
+    const GURL& url,
+    net::ProxyInfo* results,
+    const net::CompletionCallback& callback,
+    int result) {
+  if (result == net::OK)
+    state_->CacheResult(url, *results);
+  callback.Run(result);
+}
+
+// CachedProxyResolverFactory implementation:
+
+CachedProxyResolverFactory::CachedProxyResolverFactory(
+    std::unique_ptr<net::ProxyResolverFactory> factory,
+    scoped_refptr<CachedProxyResolverState> state)
+    : net::ProxyResolverFactory(factory->expects_pac_bytes()),
+      factory_(std::move(factory)),
+      state_(state) {
+}
+
+CachedProxyResolverFactory::~CachedProxyResolverFactory() {
+}
+
+int CachedProxyResolverFactory::CreateProxyResolver(
+    const scoped_refptr<net::ProxyResolverScriptData>& pac_script,
+    std::unique_ptr<net::ProxyResolver>* resolver,
+    const net::CompletionCallback& callback,
+    std::unique_ptr<Request>* request) {
+  // A new script invalidates every cached decision from the old one.
+  state_->ClearCache();
+
+  std::unique_ptr<net::ProxyResolver>* inner_resolver =
+      new std::unique_ptr<net::ProxyResolver>;
+  int result = factory_->CreateProxyResolver(
+      pac_script, inner_resolver,
+      base::Bind(&CachedProxyResolverFactory::OnResolverCreated,
+                 base::Unretained(this), base::Owned(inner_resolver),
+                 resolver, callback),
+      request);
+  if (result == net::OK)
+    resolver->reset(
+        new CachedProxyResolver(std::move(*inner_resolver), state_));
+  return result;
+}
+
+void CachedProxyResolverFactory::OnResolverCreated(
+    std::unique_ptr<net::ProxyResolver>* inner_resolver,
+    std::unique_ptr<net::ProxyResolver>* resolver,
+    const net::CompletionCallback& callback,
+    int result) {
+  if (result == net::OK)
+    resolver->reset(
+        new CachedProxyResolver(std::move(*inner_resolver), state_));
+  callback.Run(result);
+}
+
+}  // namespace brightray
@@ -0,0 +1,128 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef BRIGHTRAY_BROWSER_NET_CACHED_PROXY_RESOLVER_H_
+#define BRIGHTRAY_BROWSER_NET_CACHED_PROXY_RESOLVER_H_
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "base/macros.h"
+#include "base/memory/ref_counted.h"
+#include "base/time/time.h"
+#include "net/base/completion_callback.h"
+#include "net/proxy/proxy_bypass_rules.h"
+#include "net/proxy/proxy_info.h"
+#include "net/proxy/proxy_resolver.h"
+#include "net/proxy/proxy_resolver_factory.h"
+
+namespace brightray {
+
+// State shared between the context getter and the proxy resolvers it
+// creates: a compiled bypass-rule set and a host-keyed cache of PAC
+// results with a TTL. It outlives individual resolvers, which are torn
+// down and recreated whenever the PAC script changes, so session.setProxy
+// can update the bypass rules without a resolver in hand. All access
+// happens on the IO thread.
+class CachedProxyResolverState
+    : public base::RefCountedThreadSafe<CachedProxyResolverState> {
+ public:
+  CachedProxyResolverState();
+
+  // Replaces the bypass rules consulted before PAC execution.
+  void SetBypassRules(const net::ProxyBypassRules& rules);
+
+  // Returns true if |url| matches the bypass rules and should go direct
+  // without running the PAC script.
+  bool MatchesBypassRules(const GURL& url) const;
+
+  // Returns true and fills |results| if a non-expired cached result
+  // exists for |url|'s host.
+  bool GetCachedResult(const GURL& url, net::ProxyInfo* results) const;
+
+  // Caches |results| for |url|'s host.
+  void CacheResult(const GURL& url, const net::ProxyInfo& results);
+
+  // Drops all cached results. Called when a new PAC script is compiled,
+  // since results from the previous script must not be reused.
+  void ClearCache();
+
+ private:
+  friend class base::RefCountedThreadSafe<CachedProxyResolverState>;
+
+  struct CacheEntry {
+    net::ProxyInfo proxy_info;
+    base::TimeTicks expiry;
+  };
+
+  ~CachedProxyResolverState();
+
+  net::ProxyBypassRules bypass_rules_;
+  mutable std::map<std::string, CacheEntry> cache_;
+
+  DISALLOW_COPY_AND_ASSIGN(CachedProxyResolverState);
+};
+
+// A proxy resolver that consults the shared bypass rules and result cache
+// before handing the request to the wrapped (PAC) resolver. PAC scripts
+// are effectively static per host in most setups, so repeated requests to
+// the same host become pure lookups instead of script executions.
+class CachedProxyResolver : public net::ProxyResolver {
+ public:
+  CachedProxyResolver(std::unique_ptr<net::ProxyResolver> resolver,
+                      scoped_refptr<CachedProxyResolverState> state);
+  ~CachedProxyResolver() override;
+
+  // net::ProxyResolver:
+  int GetProxyForURL(const GURL& url,
+                     net::ProxyInfo* results,
+                     const net::CompletionCallback& callback,
+                     std::unique_ptr<Request>* request,
+                     const net::NetLogWithSource& net_log) override;
+
+ private:
+  void OnResolveCompleted(const GURL& url,
+                          net::ProxyInfo* results,
+                          const net::CompletionCallback& callback,
+                          int result);
+
+  std::unique_ptr<net::ProxyResolver> resolver_;
+  scoped_refptr<CachedProxyResolverState> state_;
+
+  DISALLOW_COPY_AND_ASSIGN(CachedProxyResolver);
+};
+
+// Decorates the resolvers created by the wrapped factory with
+// CachedProxyResolver, and resets the shared cache whenever a new PAC
+// script is compiled.
+class CachedProxyResolverFactory : public net::ProxyResolverFactory {
+ public:
+  CachedProxyResolverFactory(
+      std::unique_ptr<net::ProxyResolverFactory> factory,
+      scoped_refptr<CachedProxyResolverState> state);
+  ~CachedProxyResolverFactory() override;
+
+  // net::ProxyResolverFactory:
+  int CreateProxyResolver(
+      const scoped_refptr<net::ProxyResolverScriptData>& pac_script,
+      std::unique_ptr<net::ProxyResolver>* resolver,
+      const net::CompletionCallback& callback,
+      std::unique_ptr<Request>* request) override;
+
+ private:
+  void OnResolverCreated(std::unique_ptr<net::ProxyResolver>* inner_resolver,
+                         std::unique_ptr<net::ProxyResolver>* resolver,
+                         const net::CompletionCallback& callback,
+                         int result);
+
+  std::unique_ptr<net::ProxyResolverFactory> factory_;
+  scoped_refptr<CachedProxyResolverState> state_;
+
+  DISALLOW_COPY_AND_ASSIGN(CachedProxyResolverFactory);
+};
+
+}  // namespace brightray
+
+#endif  // BRIGHTRAY_BROWSER_NET_CACHED_PROXY_RESOLVER_H_
@@ -5,6 +5,7 @@
 #include "brightray/browser/net/devtools_network_interceptor.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
 #include "base/time/time.h"
@@ -29,7 +30,8 @@ base::TimeDelta CalculateTickLength(double throughput) {
 
 }  // namespace
 
-DevToolsNetworkInterceptor::ThrottleRecord::ThrottleRecord() {
+DevToolsNetworkInterceptor::ThrottleRecord::ThrottleRecord()
+    : finish_grant(0) {
 }
 
 DevToolsNetworkInterceptor::ThrottleRecord::ThrottleRecord(
@@ -38,10 +40,16 @@ DevToolsNetworkInterceptor::ThrottleRecord::ThrottleRecord(
 DevToolsNetworkInterceptor::ThrottleRecord::~ThrottleRecord() {
 }
 
+DevToolsNetworkInterceptor::TokenBucket::TokenBucket()
+    : last_tick(0),
+      granted_bytes(0) {
+}
+
+DevToolsNetworkInterceptor::TokenBucket::~TokenBucket() {
+}
+
 DevToolsNetworkInterceptor::DevToolsNetworkInterceptor()
     : conditions_(new DevToolsNetworkConditions(false)),
-      download_last_tick_(0),
-      upload_last_tick_(0),
       weak_ptr_factory_(this) {
 }
 
@@ -69,16 +77,18 @@ void DevToolsNetworkInterceptor::UpdateConditions(
     std::unique_ptr<DevToolsNetworkConditions> conditions) {
   DCHECK(conditions);
   base::TimeTicks now = base::TimeTicks::Now();
-  if (conditions_->IsThrottling())
-    UpdateThrottled(now);
+  if (conditions_->IsThrottling()) {
+    MaterializeBucket(&download_, now);
+    MaterializeBucket(&upload_, now);
+  }
 
   conditions_ = std::move(conditions);
 
   bool offline = conditions_->offline();
   if (offline || !conditions_->IsThrottling()) {
     timer_.Stop();
-    FinishRecords(&download_, offline);
-    FinishRecords(&upload_, offline);
+    FinishRecords(&download_.records, offline);
+    FinishRecords(&upload_.records, offline);
     FinishRecords(&suspended_, offline);
     return;
   }
@@ -88,12 +98,9 @@ void DevToolsNetworkInterceptor::UpdateConditions(
          conditions_->upload_throughput() != 0);
   offset_ = now;
 
-  download_last_tick_ = 0;
-  download_tick_length_ = CalculateTickLength(
-      conditions_->download_throughput());
-
-  upload_last_tick_ = 0;
-  upload_tick_length_ = CalculateTickLength(conditions_->upload_throughput());
+  ResetBucket(&download_,
+              CalculateTickLength(conditions_->download_throughput()));
+  ResetBucket(&upload_, CalculateTickLength(conditions_->upload_throughput()));
 
   latency_length_ = base::TimeDelta();
   double latency = conditions_->latency();
@@ -102,37 +109,56 @@ void DevToolsNetworkInterceptor::UpdateConditions(
   ArmTimer(now);
 }
 
-uint64_t DevToolsNetworkInterceptor::UpdateThrottledRecords(
-    base::TimeTicks now,
-    ThrottleRecords* records,
-    uint64_t last_tick,
-    base::TimeDelta tick_length) {
-  if (tick_length.is_zero()) {
-    DCHECK(records->empty());
-    return last_tick;
+void DevToolsNetworkInterceptor::AdvanceBucket(TokenBucket* bucket,
+                                               base::TimeTicks now) {
+  if (bucket->tick_length.is_zero()) {
+    DCHECK(bucket->records.empty());
+    return;
   }
 
-  int64_t new_tick = (now - offset_) / tick_length;
-  int64_t ticks = new_tick - last_tick;
+  int64_t new_tick = (now - offset_) / bucket->tick_length;
+  int64_t ticks = new_tick - bucket->last_tick;
+  bucket->last_tick = new_tick;
+
+  // Ticks that elapse while the bucket is empty grant nothing.
+  if (bucket->records.empty())
+    return;
+  bucket->granted_bytes +=
+      static_cast<double>(ticks * kPacketSize) / bucket->records.size();
+}
+
+void DevToolsNetworkInterceptor::MaterializeBucket(TokenBucket* bucket,
+                                                   base::TimeTicks now) {
+  AdvanceBucket(bucket, now);
+  for (ThrottleRecord& record : bucket->records)
+    record.bytes = RemainingBytes(*bucket, record);
+}
 
-  int64_t length = records->size();
-  if (!length)
-    return new_tick;
+void DevToolsNetworkInterceptor::ResetBucket(TokenBucket* bucket,
+                                             base::TimeDelta tick_length) {
+  bucket->tick_length = tick_length;
+  bucket->last_tick = 0;
+  bucket->granted_bytes = 0;
+  for (ThrottleRecord& record : bucket->records)
+    record.finish_grant = static_cast<double>(record.bytes);
+}
 
-  int64_t shift = ticks % length;
-  for (int64_t i = 0; i < length; ++i) {
-    (*records)[i].bytes -=
-        (ticks / length) * kPacketSize + (i < shift ? kPacketSize : 0);
-  }
-  std::rotate(records->begin(), records->begin() + shift, records->end());
-  return new_tick;
+void DevToolsNetworkInterceptor::InsertRecord(TokenBucket* bucket,
+                                              const ThrottleRecord& record) {
+  bucket->records.push_back(record);
+  bucket->records.back().finish_grant =
+      bucket->granted_bytes + static_cast<double>(record.bytes);
+}
+
+int64_t DevToolsNetworkInterceptor::RemainingBytes(
+    const TokenBucket& bucket, const ThrottleRecord& record) const {
+  return static_cast<int64_t>(
+      std::ceil(record.finish_grant - bucket.granted_bytes));
 }
 
 void DevToolsNetworkInterceptor::UpdateThrottled(base::TimeTicks now) {
-  download_last_tick_ = UpdateThrottledRecords(
-      now, &download_, download_last_tick_, download_tick_length_);
-  upload_last_tick_ = UpdateThrottledRecords(
-      now, &upload_, upload_last_tick_, upload_tick_length_);
+  AdvanceBucket(&download_, now);
+  AdvanceBucket(&upload_, now);
   UpdateSuspended(now);
 }
 
@@ -143,9 +169,9 @@ void DevToolsNetworkInterceptor::UpdateSuspended(base::TimeTicks now) {
   for (const ThrottleRecord& record : suspended_) {
     if (record.send_end <= activation_baseline) {
       if (record.is_upload)
-        upload_.push_back(record);
+        InsertRecord(&upload_, record);
       else
-        download_.push_back(record);
+        InsertRecord(&download_, record);
     } else {
       suspended.push_back(record);
     }
@@ -154,15 +180,17 @@ void DevToolsNetworkInterceptor::UpdateSuspended(base::TimeTicks now) {
 }
 
 void DevToolsNetworkInterceptor::CollectFinished(
-    ThrottleRecords* records, ThrottleRecords* finished) {
+    TokenBucket* bucket, ThrottleRecords* finished) {
   ThrottleRecords active;
-  for (const ThrottleRecord& record : *records) {
-    if (record.bytes < 0)
+  for (const ThrottleRecord& record : bucket->records) {
+    if (record.finish_grant <= bucket->granted_bytes) {
       finished->push_back(record);
-    else
+      finished->back().bytes = RemainingBytes(*bucket, record);
+    } else {
       active.push_back(record);
+    }
   }
-  records->swap(active);
+  bucket->records.swap(active);
 }
 
 void DevToolsNetworkInterceptor::OnTimer() {
@@ -179,35 +207,40 @@ void DevToolsNetworkInterceptor::OnTimer() {
 }
 
 base::TimeTicks DevToolsNetworkInterceptor::CalculateDesiredTime(
-    const ThrottleRecords& records,
-    uint64_t last_tick,
-    base::TimeDelta tick_length) {
-  int64_t min_ticks_left = 0x10000L;
-  size_t count = records.size();
-  for (size_t i = 0; i < count; ++i) {
-    int64_t packets_left = (records[i].bytes + kPacketSize - 1) / kPacketSize;
-    int64_t ticks_left = (i + 1) + count * (packets_left - 1);
-    if (i == 0 || ticks_left < min_ticks_left)
-      min_ticks_left = ticks_left;
+    const TokenBucket& bucket) {
+  if (bucket.tick_length.is_zero())
+    return offset_;
+  if (bucket.records.empty())
+    return offset_ + bucket.tick_length * (bucket.last_tick + 0x10000L);
+
+  double min_finish = bucket.records[0].finish_grant;
+  for (const ThrottleRecord& record : bucket.records) {
+    if (record.finish_grant < min_finish)
+      min_finish = record.finish_grant;
   }
-  return offset_ + tick_length * (last_tick + min_ticks_left);
+  // Convert the per-record share back into wall-clock ticks; with |count|
+  // active records each tick grants kPacketSize / count to every record.
+  double share_left = min_finish - bucket.granted_bytes;
+  int64_t ticks_left = static_cast<int64_t>(
+      std::ceil(share_left * bucket.records.size() / kPacketSize));
+  if (ticks_left < 1)
+    ticks_left = 1;
+  return offset_ + bucket.tick_length * (bucket.last_tick + ticks_left);
 }
 
 void DevToolsNetworkInterceptor::ArmTimer(base::TimeTicks now) {
   size_t suspend_count = suspended_.size();
-  if (download_.empty() && upload_.empty() && !suspend_count) {
+  if (download_.records.empty() && upload_.records.empty() && !suspend_count) {
     timer_.Stop();
     return;
   }
 
-  base::TimeTicks desired_time = CalculateDesiredTime(
-      download_, download_last_tick_, download_tick_length_);
+  base::TimeTicks desired_time = CalculateDesiredTime(download_);
   if (desired_time == offset_) {
-    FinishRecords(&download_, false);
+    FinishRecords(&download_.records, false);
   }
 
-  base::TimeTicks upload_time = CalculateDesiredTime(
-      upload_, upload_last_tick_, upload_tick_length_);
+  base::TimeTicks upload_time = CalculateDesiredTime(upload_);
   if (upload_time != offset_ && upload_time < desired_time)
     desired_time = upload_time;
 
@@ -259,10 +292,7 @@ int DevToolsNetworkInterceptor::StartThrottle(
     suspended_.push_back(record);
     UpdateSuspended(now);
   } else {
-    if (is_upload)
-      upload_.push_back(record);
-    else
-      download_.push_back(record);
+    InsertRecord(is_upload ? &upload_ : &download_, record);
   }
   ArmTimer(now);
 
@@ -271,8 +301,11 @@ int DevToolsNetworkInterceptor::StartThrottle(
 
 void DevToolsNetworkInterceptor::StopThrottle(
     const ThrottleCallback& callback) {
-  RemoveRecord(&download_, callback);
-  RemoveRecord(&upload_, callback);
+  // Account for the time the departing record was still sharing the bucket,
+  // so the remaining records' shares stay accurate.
+  UpdateThrottled(base::TimeTicks::Now());
+  RemoveRecord(&download_.records, callback);
+  RemoveRecord(&upload_.records, callback);
   RemoveRecord(&suspended_, callback);
 }
 
@@ -57,25 +57,46 @@ class DevToolsNetworkInterceptor {
     int64_t send_end;
     bool is_upload;
     ThrottleCallback callback;
+    // Value of the owning bucket's |granted_bytes| at which this record is
+    // done; fixed at insertion so per-tick accounting never touches it.
+    double finish_grant;
   };
 
   using ThrottleRecords = std::vector<ThrottleRecord>;
 
+  // All records of one direction share a bucket; the fair per-record grant
+  // is tracked as a single counter, so advancing time is O(1) regardless of
+  // how many transactions are throttled.
+  struct TokenBucket {
+    TokenBucket();
+    ~TokenBucket();
+
+    ThrottleRecords records;
+    base::TimeDelta tick_length;
+    uint64_t last_tick;
+    // Cumulative bytes granted to each active record so far.
+    double granted_bytes;
+  };
+
   void FinishRecords(ThrottleRecords* records, bool offline);
 
-  uint64_t UpdateThrottledRecords(base::TimeTicks now,
-                                  ThrottleRecords* records,
-                                  uint64_t last_tick,
-                                  base::TimeDelta tick_length);
+  // Advances the bucket's grant counter up to |now|.
+  void AdvanceBucket(TokenBucket* bucket, base::TimeTicks now);
+  // Folds the current grant back into each record's |bytes| so the bucket
+  // can be re-initialized for new conditions.
+  void MaterializeBucket(TokenBucket* bucket, base::TimeTicks now);
+  void ResetBucket(TokenBucket* bucket, base::TimeDelta tick_length);
+  void InsertRecord(TokenBucket* bucket, const ThrottleRecord& record);
+  int64_t RemainingBytes(const TokenBucket& bucket,
+                         const ThrottleRecord& record) const;
+
   void UpdateThrottled(base::TimeTicks now);
   void UpdateSuspended(base::TimeTicks now);
 
-  void CollectFinished(ThrottleRecords* records, ThrottleRecords* finished);
+  void CollectFinished(TokenBucket* bucket, ThrottleRecords* finished);
   void OnTimer();
 
-  base::TimeTicks CalculateDesiredTime(const ThrottleRecords& records,
-                                       uint64_t last_tick,
-                                       base::TimeDelta tick_length);
+  base::TimeTicks CalculateDesiredTime(const TokenBucket& bucket);
   void ArmTimer(base::TimeTicks now);
 
   void RemoveRecord(ThrottleRecords* records, const ThrottleCallback& callback);
@@ -86,16 +107,12 @@ class DevToolsNetworkInterceptor {
   ThrottleRecords suspended_;
 
   // Throttables waiting for certain amount of transfer to be "accounted".
-  ThrottleRecords download_;
-  ThrottleRecords upload_;
+  TokenBucket download_;
+  TokenBucket upload_;
 
   base::OneShotTimer timer_;
   base::TimeTicks offset_;
-  base::TimeDelta download_tick_length_;
-  base::TimeDelta upload_tick_length_;
   base::TimeDelta latency_length_;
-  uint64_t download_last_tick_;
-  uint64_t upload_last_tick_;
 
   base::WeakPtrFactory<DevToolsNetworkInterceptor> weak_ptr_factory_;
 
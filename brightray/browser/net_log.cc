@@ -4,8 +4,12 @@
 
 #include "brightray/browser/net_log.h"
 
+#include <utility>
+
 #include "base/command_line.h"
 #include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/json/json_writer.h"
 #include "base/values.h"
 #include "content/public/common/content_switches.h"
 #include "net/log/net_log_util.h"
@@ -14,6 +18,11 @@ namespace brightray {
 
 namespace {
 
+// Number of preallocated event slots in the in-memory ring buffer. At
+// roughly 0.5KB of serialized JSON per event this caps the buffer at a
+// few megabytes.
+const size_t kRingBufferEventCount = 4096;
+
 std::unique_ptr<base::DictionaryValue> GetConstants() {
   std::unique_ptr<base::DictionaryValue> constants = net::GetNetConstants();
 
@@ -29,10 +38,46 @@ std::unique_ptr<base::DictionaryValue> GetConstants() {
 
 }  // namespace
 
+NetLog::RingBufferObserver::RingBufferObserver()
+    : slots_(kRingBufferEventCount), next_slot_(0), count_(0) {
+}
+
+NetLog::RingBufferObserver::~RingBufferObserver() {
+}
+
+void NetLog::RingBufferObserver::OnAddEntry(const net::NetLogEntry& entry) {
+  // Serialize outside the lock; only the slot swap is synchronized.
+  std::unique_ptr<base::Value> value(entry.ToValue());
+  std::string json;
+  if (!value || !base::JSONWriter::Write(*value, &json))
+    return;
+
+  base::AutoLock auto_lock(lock_);
+  slots_[next_slot_].swap(json);
+  next_slot_ = (next_slot_ + 1) % slots_.size();
+  if (count_ < slots_.size())
+    ++count_;
+}
+
+std::vector<std::string> NetLog::RingBufferObserver::Snapshot() {
+  base::AutoLock auto_lock(lock_);
+  std::vector<std::string> events;
+  events.reserve(count_);
+  size_t start = (next_slot_ + slots_.size() - count_) % slots_.size();
+  for (size_t i = 0; i < count_; ++i)
+    events.push_back(slots_[(start + i) % slots_.size()]);
+  return events;
+}
+
 NetLog::NetLog() {
+  // The ring buffer captures from process start so a dump can be taken
+  // retroactively without having enabled file logging at launch.
+  AddObserver(&ring_buffer_observer_,
+              net::NetLogCaptureMode::Default());
 }
 
 NetLog::~NetLog() {
+  RemoveObserver(&ring_buffer_observer_);
 }
 
 void NetLog::StartLogging(net::URLRequestContext* url_request_context) {
@@ -61,4 +106,26 @@ void NetLog::StartLogging(net::URLRequestContext* url_request_context) {
                                          url_request_context);
 }
 
+bool NetLog::DumpRingBuffer(const base::FilePath& path) {
+  std::string constants_json;
+  base::JSONWriter::Write(*GetConstants(), &constants_json);
+
+  std::vector<std::string> events = ring_buffer_observer_.Snapshot();
+
+  // Same shape as the files WriteToFileNetLogObserver produces, so the
+  // dump loads directly in the net-internals viewer.
+  std::string output = "{\"constants\": " + constants_json + ",\n";
+  output += "\"events\": [\n";
+  for (size_t i = 0; i < events.size(); ++i) {
+    output += events[i];
+    if (i + 1 < events.size())
+      output += ",";
+    output += "\n";
+  }
+  output += "]}\n";
+
+  int size = static_cast<int>(output.size());
+  return base::WriteFile(path, output.data(), size) == size;
+}
+
 }  // namespace brightray
@@ -5,10 +5,18 @@
 #ifndef BRIGHTRAY_BROWSER_NET_LOG_H_
 #define BRIGHTRAY_BROWSER_NET_LOG_H_
 
+#include <string>
+#include <vector>
+
 #include "base/files/scoped_file.h"
+#include "base/synchronization/lock.h"
 #include "net/log/net_log.h"
 #include "net/log/write_to_file_net_log_observer.h"
 
+namespace base {
+class FilePath;
+}
+
 namespace brightray {
 
 class NetLog : public net::NetLog {
@@ -18,7 +26,37 @@ class NetLog : public net::NetLog {
 
   void StartLogging(net::URLRequestContext* url_request_context);
 
+  // Writes the events currently held by the always-on ring buffer to
+  // |path| as a regular net-log JSON file, oldest event first. Performs
+  // blocking file I/O; call it from a thread that allows it. Returns
+  // false if the file could not be written.
+  bool DumpRingBuffer(const base::FilePath& path);
+
  private:
+  // Always-on observer that keeps the most recent events as serialized
+  // JSON in a fixed number of slots, overwriting the oldest. Memory use
+  // is bounded and there is no file I/O until a dump is requested.
+  class RingBufferObserver : public net::NetLog::ThreadSafeObserver {
+   public:
+    RingBufferObserver();
+    ~RingBufferObserver() override;
+
+    // net::NetLog::ThreadSafeObserver:
+    void OnAddEntry(const net::NetLogEntry& entry) override;
+
+    // Returns a copy of the buffered events in arrival order.
+    std::vector<std::string> Snapshot();
+
+   private:
+    base::Lock lock_;
+    std::vector<std::string> slots_;
+    size_t next_slot_;
+    size_t count_;
+
+    DISALLOW_COPY_AND_ASSIGN(RingBufferObserver);
+  };
+
+  RingBufferObserver ring_buffer_observer_;
   base::ScopedFILE log_file_;
   net::WriteToFileNetLogObserver write_to_file_observer_;
 
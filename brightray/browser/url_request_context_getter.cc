@@ -6,12 +6,15 @@
 
 #include <algorithm>
 
+#include "base/bind.h"
 #include "base/command_line.h"
 #include "base/memory/ptr_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/threading/sequenced_worker_pool.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "base/threading/worker_pool.h"
+#include "brightray/browser/net/cached_proxy_resolver.h"
 #include "brightray/browser/net/devtools_network_controller_handle.h"
 #include "brightray/browser/net/devtools_network_transaction_factory.h"
 #include "brightray/browser/net_log.h"
@@ -34,11 +37,12 @@
 #include "net/http/http_server_properties_impl.h"
 #include "net/log/net_log.h"
 #include "net/proxy/dhcp_proxy_script_fetcher_factory.h"
+#include "net/proxy/network_delegate_error_observer.h"
 #include "net/proxy/proxy_config.h"
 #include "net/proxy/proxy_config_service.h"
+#include "net/proxy/proxy_resolver_v8_tracing_wrapper.h"
 #include "net/proxy/proxy_script_fetcher_impl.h"
 #include "net/proxy/proxy_service.h"
-#include "net/proxy/proxy_service_v8.h"
 #include "net/ssl/channel_id_service.h"
 #include "net/ssl/default_channel_id_store.h"
 #include "net/ssl/ssl_config_service_defaults.h"
@@ -166,6 +170,16 @@ net::HostResolver* URLRequestContextGetter::host_resolver() {
   return url_request_context_->host_resolver();
 }
 
+void URLRequestContextGetter::SetProxyBypassRules(
+    const net::ProxyBypassRules& rules) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+  if (!proxy_resolver_state_)
+    return;
+  proxy_resolver_state_->SetBypassRules(rules);
+  // Old results may have been computed for hosts the new rules bypass.
+  proxy_resolver_state_->ClearCache();
+}
+
 net::URLRequestContext* URLRequestContextGetter::GetURLRequestContext() {
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
 
@@ -239,14 +253,25 @@ net::URLRequestContext* URLRequestContextGetter::GetURLRequestContext() {
       storage_->set_proxy_service(net::ProxyService::CreateFixed(
           proxy_config));
     } else {
-      storage_->set_proxy_service(
-          net::CreateProxyServiceUsingV8ProxyResolver(
-              std::move(proxy_config_service_),
-              new net::ProxyScriptFetcherImpl(url_request_context_.get()),
-              dhcp_factory.Create(url_request_context_.get()),
-              host_resolver.get(),
-              nullptr,
-              url_request_context_->network_delegate()));
+      // Same wiring as net::CreateProxyServiceUsingV8ProxyResolver, with
+      // the V8 resolver factory wrapped so that bypass rules and a
+      // host-keyed result cache are consulted before PAC execution.
+      proxy_resolver_state_ = new CachedProxyResolverState;
+      std::unique_ptr<net::ProxyService> proxy_service(new net::ProxyService(
+          std::move(proxy_config_service_),
+          base::MakeUnique<CachedProxyResolverFactory>(
+              base::MakeUnique<net::ProxyResolverFactoryV8TracingWrapper>(
+                  host_resolver.get(),
+                  nullptr,
+                  base::Bind(&net::NetworkDelegateErrorObserver::Create,
+                             url_request_context_->network_delegate(),
+                             base::ThreadTaskRunnerHandle::Get())),
+              proxy_resolver_state_),
+          nullptr));
+      proxy_service->SetProxyScriptFetchers(
+          new net::ProxyScriptFetcherImpl(url_request_context_.get()),
+          dhcp_factory.Create(url_request_context_.get()));
+      storage_->set_proxy_service(std::move(proxy_service));
     }
 
     std::vector<std::string> schemes;
@@ -26,6 +26,7 @@ class HostMappingRules;
 class HostResolver;
 class HttpAuthPreferences;
 class NetworkDelegate;
+class ProxyBypassRules;
 class ProxyConfigService;
 class URLRequestContextStorage;
 class URLRequestJobFactory;
@@ -33,6 +34,7 @@ class URLRequestJobFactory;
 
 namespace brightray {
 
+class CachedProxyResolverState;
 class DevToolsNetworkControllerHandle;
 class MediaDeviceIDSalt;
 class NetLog;
@@ -86,6 +88,10 @@ class URLRequestContextGetter : public net::URLRequestContextGetter {
     return delegate_->GetMediaDeviceIDSalt();
   }
 
+  // Replaces the bypass rules checked before PAC execution and drops
+  // cached PAC results. Must be called on the IO thread.
+  void SetProxyBypassRules(const net::ProxyBypassRules& rules);
+
  private:
   Delegate* delegate_;
 
@@ -99,6 +105,7 @@ class URLRequestContextGetter : public net::URLRequestContextGetter {
   std::string user_agent_;
 
   std::unique_ptr<net::ProxyConfigService> proxy_config_service_;
+  scoped_refptr<CachedProxyResolverState> proxy_resolver_state_;
   std::unique_ptr<net::NetworkDelegate> network_delegate_;
   std::unique_ptr<net::URLRequestContextStorage> storage_;
   std::unique_ptr<net::URLRequestContext> url_request_context_;
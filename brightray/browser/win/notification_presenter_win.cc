@@ -36,6 +36,15 @@ bool SaveIconToPath(const SkBitmap& bitmap, const base::FilePath& path) {
   return base::WriteFile(path, data, size) == size;
 }
 
+// Hash the raw pixels; much cheaper than a PNG encode and identifies the
+// icon regardless of which origin posted it.
+std::string HashBitmapContent(const SkBitmap& bitmap) {
+  SkAutoLockPixels pixels_lock(bitmap);
+  base::MD5Digest digest;
+  base::MD5Sum(bitmap.getPixels(), bitmap.getSize(), &digest);
+  return base::MD5DigestToBase16(digest);
+}
+
 }  // namespace
 
 // static
@@ -64,12 +73,20 @@ bool NotificationPresenterWin::Init() {
 
 base::string16 NotificationPresenterWin::SaveIconToFilesystem(
     const SkBitmap& icon, const GURL& origin) {
-  std::string filename = base::MD5String(origin.spec()) + ".png";
+  if (icon.drawsNothing())
+    return base::UTF8ToUTF16(origin.spec());
+
+  // Key the file by icon content instead of origin, so the same avatar
+  // posted repeatedly reuses one file and a changed icon from the same
+  // origin is never served stale.
+  std::string filename = HashBitmapContent(icon) + ".png";
   base::FilePath path = temp_dir_.GetPath().Append(base::UTF8ToUTF16(filename));
-  if (base::PathExists(path))
+  if (saved_icons_.find(filename) != saved_icons_.end())
     return path.value();
-  if (SaveIconToPath(icon, path))
+  if (base::PathExists(path) || SaveIconToPath(icon, path)) {
+    saved_icons_.insert(filename);
     return path.value();
+  }
   return base::UTF8ToUTF16(origin.spec());
 }
 
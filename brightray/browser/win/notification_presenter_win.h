@@ -23,6 +23,9 @@
 #ifndef BRIGHTRAY_BROWSER_WIN_NOTIFICATION_PRESENTER_WIN_H_
 #define BRIGHTRAY_BROWSER_WIN_NOTIFICATION_PRESENTER_WIN_H_
 
+#include <set>
+#include <string>
+
 #include "base/files/scoped_temp_dir.h"
 #include "base/strings/string16.h"
 #include "brightray/browser/notification_presenter.h"
@@ -47,6 +50,10 @@ class NotificationPresenterWin : public NotificationPresenter {
 
   base::ScopedTempDir temp_dir_;
 
+  // Content hashes of icons already written to |temp_dir_|; hits skip the
+  // PNG encode and all filesystem access entirely.
+  std::set<std::string> saved_icons_;
+
   DISALLOW_COPY_AND_ASSIGN(NotificationPresenterWin);
 };
 
@@ -9,6 +9,9 @@
 #include "brightray/browser/win/windows_toast_notification.h"
 
 #include <shlobj.h>
+#include <winstring.h>
+
+#include <utility>
 
 #include "base/strings/utf_string_conversions.h"
 #include "brightray/browser/notification_delegate.h"
@@ -50,6 +53,13 @@ ComPtr<ABI::Windows::UI::Notifications::IToastNotificationManagerStatics>
 ComPtr<ABI::Windows::UI::Notifications::IToastNotifier>
     WindowsToastNotification::toast_notifier_;
 
+// static
+ComPtr<ABI::Windows::UI::Notifications::IToastNotificationFactory>
+    WindowsToastNotification::toast_factory_;
+
+// static
+std::map<int, std::wstring> WindowsToastNotification::template_cache_;
+
 // static
 bool WindowsToastNotification::Initialize() {
   // Just initialize, don't care if it fails or already initialized.
@@ -67,8 +77,17 @@ bool WindowsToastNotification::Initialize() {
   if (!GetAppUserModelId(&app_id))
     return false;
 
+  if (FAILED(
+          toast_manager_->CreateToastNotifierWithId(app_id, &toast_notifier_)))
+    return false;
+
+  // Resolve the toast factory once instead of per notification.
+  ScopedHString toast_str(
+      RuntimeClass_Windows_UI_Notifications_ToastNotification);
+  if (!toast_str.success())
+    return false;
   return SUCCEEDED(
-      toast_manager_->CreateToastNotifierWithId(app_id, &toast_notifier_));
+      Windows::Foundation::GetActivationFactory(toast_str, &toast_factory_));
 }
 
 WindowsToastNotification::WindowsToastNotification(
@@ -96,29 +115,13 @@ void WindowsToastNotification::Show(const base::string16& title,
   std::wstring icon_path = presenter_win->SaveIconToFilesystem(icon, icon_url);
 
   ComPtr<IXmlDocument> toast_xml;
-  if (FAILED(GetToastXml(toast_manager_.Get(), title, msg, icon_path, silent,
-                         &toast_xml))) {
+  if (!GetToastXml(title, msg, icon_path, silent, &toast_xml)) {
     NotificationFailed();
     return;
   }
 
-  ScopedHString toast_str(
-      RuntimeClass_Windows_UI_Notifications_ToastNotification);
-  if (!toast_str.success()) {
-    NotificationFailed();
-    return;
-  }
-
-  ComPtr<ABI::Windows::UI::Notifications::IToastNotificationFactory>
-      toast_factory;
-  if (FAILED(Windows::Foundation::GetActivationFactory(toast_str,
-                                                       &toast_factory))) {
-    NotificationFailed();
-    return;
-  }
-
-  if (FAILED(toast_factory->CreateToastNotification(toast_xml.Get(),
-                                                    &toast_notification_))) {
+  if (FAILED(toast_factory_->CreateToastNotification(toast_xml.Get(),
+                                                     &toast_notification_))) {
     NotificationFailed();
     return;
   }
@@ -141,14 +144,11 @@ void WindowsToastNotification::Dismiss() {
   toast_notifier_->Hide(toast_notification_.Get());
 }
 
-bool WindowsToastNotification::GetToastXml(
-    ABI::Windows::UI::Notifications::IToastNotificationManagerStatics*
-        toastManager,
-    const std::wstring& title,
-    const std::wstring& msg,
-    const std::wstring& icon_path,
-    bool silent,
-    IXmlDocument** toast_xml) {
+bool WindowsToastNotification::GetToastXml(const std::wstring& title,
+                                           const std::wstring& msg,
+                                           const std::wstring& icon_path,
+                                           bool silent,
+                                           IXmlDocument** toast_xml) {
   ABI::Windows::UI::Notifications::ToastTemplateType template_type;
   if (title.empty() || msg.empty()) {
     // Single line toast.
@@ -157,7 +157,7 @@ bool WindowsToastNotification::GetToastXml(
             ? ABI::Windows::UI::Notifications::ToastTemplateType_ToastText01
             : ABI::Windows::UI::Notifications::
                   ToastTemplateType_ToastImageAndText01;
-    if (FAILED(toast_manager_->GetTemplateContent(template_type, toast_xml)))
+    if (!GetTemplateDocument(template_type, silent, toast_xml))
       return false;
     if (!SetXmlText(*toast_xml, title.empty() ? msg : title))
       return false;
@@ -168,18 +168,12 @@ bool WindowsToastNotification::GetToastXml(
             ? ABI::Windows::UI::Notifications::ToastTemplateType_ToastText02
             : ABI::Windows::UI::Notifications::
                   ToastTemplateType_ToastImageAndText02;
-    if (FAILED(toastManager->GetTemplateContent(template_type, toast_xml)))
+    if (!GetTemplateDocument(template_type, silent, toast_xml))
       return false;
     if (!SetXmlText(*toast_xml, title, msg))
       return false;
   }
 
-  // Configure the toast's notification sound
-  if (silent) {
-    if (FAILED(SetXmlAudioSilent(*toast_xml)))
-      return false;
-  }
-
   // Configure the toast's image
   if (!icon_path.empty())
     return SetXmlImage(*toast_xml, icon_path);
@@ -187,6 +181,74 @@ bool WindowsToastNotification::GetToastXml(
   return true;
 }
 
+bool WindowsToastNotification::GetTemplateDocument(
+    ABI::Windows::UI::Notifications::ToastTemplateType template_type,
+    bool silent,
+    IXmlDocument** doc) {
+  int key = (static_cast<int>(template_type) << 1) | (silent ? 1 : 0);
+  auto cached = template_cache_.find(key);
+  if (cached == template_cache_.end()) {
+    ComPtr<IXmlDocument> fresh;
+    if (FAILED(toast_manager_->GetTemplateContent(template_type, &fresh)))
+      return false;
+    // The notification sound is part of the template shape, so the silent
+    // audio element only has to be built once per shape.
+    if (silent && !SetXmlAudioSilent(fresh.Get()))
+      return false;
+    std::wstring xml;
+    if (!SerializeXml(fresh.Get(), &xml))
+      return false;
+    cached = template_cache_.emplace(key, std::move(xml)).first;
+  }
+  return LoadTemplateXml(cached->second, doc);
+}
+
+// static
+bool WindowsToastNotification::SerializeXml(IXmlDocument* doc,
+                                            std::wstring* xml) {
+  ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNodeSerializer> serializer;
+  if (FAILED(ComPtr<IXmlDocument>(doc).As(&serializer)))
+    return false;
+
+  HSTRING str;
+  if (FAILED(serializer->GetXml(&str)))
+    return false;
+
+  UINT32 length;
+  const wchar_t* buffer = WindowsGetStringRawBuffer(str, &length);
+  xml->assign(buffer, length);
+  WindowsDeleteString(str);
+  return true;
+}
+
+// static
+bool WindowsToastNotification::LoadTemplateXml(const std::wstring& xml,
+                                               IXmlDocument** doc) {
+  ScopedHString doc_class(RuntimeClass_Windows_Data_Xml_Dom_XmlDocument);
+  if (!doc_class.success())
+    return false;
+
+  ComPtr<IInspectable> inspectable;
+  if (FAILED(Windows::Foundation::ActivateInstance(doc_class, &inspectable)))
+    return false;
+
+  ComPtr<ABI::Windows::Data::Xml::Dom::IXmlDocumentIO> doc_io;
+  if (FAILED(inspectable.As(&doc_io)))
+    return false;
+
+  ScopedHString xml_str(xml);
+  if (!xml_str.success())
+    return false;
+  if (FAILED(doc_io->LoadXml(xml_str)))
+    return false;
+
+  ComPtr<IXmlDocument> out;
+  if (FAILED(doc_io.As(&out)))
+    return false;
+  *doc = out.Detach();
+  return true;
+}
+
 bool WindowsToastNotification::SetXmlAudioSilent(IXmlDocument* doc) {
   ScopedHString tag(L"toast");
   if (!tag.success())
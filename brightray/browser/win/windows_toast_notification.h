@@ -12,6 +12,7 @@
 #include <windows.h>
 #include <windows.ui.notifications.h>
 #include <wrl/implements.h>
+#include <map>
 #include <string>
 
 #include "brightray/browser/notification.h"
@@ -63,14 +64,22 @@ class WindowsToastNotification : public Notification {
  private:
   friend class ToastEventHandler;
 
-  bool GetToastXml(
-      ABI::Windows::UI::Notifications::IToastNotificationManagerStatics*
-          toastManager,
-      const std::wstring& title,
-      const std::wstring& msg,
-      const std::wstring& icon_path,
-      const bool silent,
-      ABI::Windows::Data::Xml::Dom::IXmlDocument** toastXml);
+  bool GetToastXml(const std::wstring& title,
+                   const std::wstring& msg,
+                   const std::wstring& icon_path,
+                   const bool silent,
+                   ABI::Windows::Data::Xml::Dom::IXmlDocument** toastXml);
+  // Returns a fresh document for the template shape, serving it from
+  // |template_cache_| when the shape has been built before.
+  bool GetTemplateDocument(
+      ABI::Windows::UI::Notifications::ToastTemplateType template_type,
+      bool silent,
+      ABI::Windows::Data::Xml::Dom::IXmlDocument** doc);
+  static bool SerializeXml(ABI::Windows::Data::Xml::Dom::IXmlDocument* doc,
+                           std::wstring* xml);
+  static bool LoadTemplateXml(
+      const std::wstring& xml,
+      ABI::Windows::Data::Xml::Dom::IXmlDocument** doc);
   bool SetXmlAudioSilent(ABI::Windows::Data::Xml::Dom::IXmlDocument* doc);
   bool SetXmlText(ABI::Windows::Data::Xml::Dom::IXmlDocument* doc,
                   const std::wstring& text);
@@ -96,6 +105,13 @@ class WindowsToastNotification : public Notification {
       toast_manager_;
   static ComPtr<ABI::Windows::UI::Notifications::IToastNotifier>
       toast_notifier_;
+  static ComPtr<ABI::Windows::UI::Notifications::IToastNotificationFactory>
+      toast_factory_;
+
+  // Serialized template skeletons keyed by template type and the silent
+  // flag; rebuilding the silent-audio DOM per toast is what made bursts of
+  // notifications expensive.
+  static std::map<int, std::wstring> template_cache_;
 
   EventRegistrationToken activated_token_;
   EventRegistrationToken dismissed_token_;
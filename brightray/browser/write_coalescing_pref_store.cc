@@ -0,0 +1,208 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "brightray/browser/write_coalescing_pref_store.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
+#include "base/json/json_file_value_serializer.h"
+#include "base/json/json_string_value_serializer.h"
+#include "base/location.h"
+#include "base/logging.h"
+
+namespace brightray {
+
+namespace {
+
+// How long a batch of pref changes may accumulate before it is written
+// out. Long enough to absorb a window drag, short enough that little is
+// lost if the process dies.
+const int kFlushDelayMs = 2000;
+
+// Serializes |prefs| and writes them to |path|. Runs on the file task
+// runner; |prefs| is the batch's private copy.
+void WritePrefsToDisk(const base::FilePath& path,
+                      std::unique_ptr<base::DictionaryValue> prefs) {
+  std::string serialized;
+  JSONStringValueSerializer serializer(&serialized);
+  serializer.set_pretty_print(true);
+  if (!serializer.Serialize(*prefs))
+    return;
+  base::ImportantFileWriter::WriteFileAtomically(path, serialized);
+}
+
+}  // namespace
+
+WriteCoalescingPrefStore::WriteCoalescingPrefStore(
+    const base::FilePath& pref_filename,
+    const scoped_refptr<base::SequencedTaskRunner>& file_task_runner)
+    : path_(pref_filename),
+      file_task_runner_(file_task_runner),
+      prefs_(new base::DictionaryValue),
+      read_only_(false),
+      read_error_(PREF_READ_ERROR_NONE),
+      initialized_(false) {
+}
+
+WriteCoalescingPrefStore::~WriteCoalescingPrefStore() {
+  if (!dirty_keys_.empty())
+    FlushToDisk();
+}
+
+bool WriteCoalescingPrefStore::GetValue(const std::string& key,
+                                        const base::Value** result) const {
+  return prefs_->Get(key, result);
+}
+
+void WriteCoalescingPrefStore::AddObserver(PrefStore::Observer* observer) {
+  observers_.AddObserver(observer);
+}
+
+void WriteCoalescingPrefStore::RemoveObserver(PrefStore::Observer* observer) {
+  observers_.RemoveObserver(observer);
+}
+
+bool WriteCoalescingPrefStore::HasObservers() const {
+  return observers_.might_have_observers();
+}
+
+bool WriteCoalescingPrefStore::IsInitializationComplete() const {
+  return initialized_;
+}
+
+void WriteCoalescingPrefStore::SetValue(const std::string& key,
+                                        std::unique_ptr<base::Value> value,
+                                        uint32_t flags) {
+  DCHECK(value);
+  base::Value* old_value = nullptr;
+  prefs_->Get(key, &old_value);
+  if (old_value && value->Equals(old_value))
+    return;
+  prefs_->Set(key, std::move(value));
+  ReportValueChanged(key, flags);
+}
+
+void WriteCoalescingPrefStore::SetValueSilently(
+    const std::string& key,
+    std::unique_ptr<base::Value> value,
+    uint32_t flags) {
+  DCHECK(value);
+  prefs_->Set(key, std::move(value));
+  ScheduleWrite(key);
+}
+
+void WriteCoalescingPrefStore::RemoveValue(const std::string& key,
+                                           uint32_t flags) {
+  if (prefs_->RemovePath(key, nullptr))
+    ReportValueChanged(key, flags);
+}
+
+bool WriteCoalescingPrefStore::GetMutableValue(const std::string& key,
+                                               base::Value** result) {
+  return prefs_->Get(key, result);
+}
+
+void WriteCoalescingPrefStore::ReportValueChanged(const std::string& key,
+                                                  uint32_t flags) {
+  for (PrefStore::Observer& observer : observers_)
+    observer.OnPrefValueChanged(key);
+  ScheduleWrite(key);
+}
+
+bool WriteCoalescingPrefStore::ReadOnly() const {
+  return read_only_;
+}
+
+PersistentPrefStore::PrefReadError WriteCoalescingPrefStore::GetReadError()
+    const {
+  return read_error_;
+}
+
+PersistentPrefStore::PrefReadError WriteCoalescingPrefStore::ReadPrefs() {
+  initialized_ = true;
+
+  if (!base::PathExists(path_)) {
+    read_error_ = PREF_READ_ERROR_NO_FILE;
+    return read_error_;
+  }
+
+  JSONFileValueDeserializer deserializer(path_);
+  std::string error_msg;
+  std::unique_ptr<base::Value> value =
+      deserializer.Deserialize(nullptr, &error_msg);
+  if (!value) {
+    LOG(ERROR) << "Failed to parse " << path_.value() << ": " << error_msg;
+    read_error_ = PREF_READ_ERROR_JSON_PARSE;
+    // Keep the defaults; the broken file is overwritten on next flush.
+    read_only_ = false;
+    return read_error_;
+  }
+  if (!value->IsType(base::Value::Type::DICTIONARY)) {
+    read_error_ = PREF_READ_ERROR_JSON_TYPE;
+    return read_error_;
+  }
+
+  prefs_.reset(static_cast<base::DictionaryValue*>(value.release()));
+  read_error_ = PREF_READ_ERROR_NONE;
+  return read_error_;
+}
+
+void WriteCoalescingPrefStore::ReadPrefsAsync(
+    ReadErrorDelegate* error_delegate) {
+  // Preferences are read once at startup before anything queries them;
+  // reading synchronously here keeps the store single-threaded apart
+  // from the posted writes.
+  std::unique_ptr<ReadErrorDelegate> delegate(error_delegate);
+  PrefReadError error = ReadPrefs();
+  if (delegate && error != PREF_READ_ERROR_NONE)
+    delegate->OnError(error);
+  for (PrefStore::Observer& observer : observers_)
+    observer.OnInitializationCompleted(true);
+}
+
+void WriteCoalescingPrefStore::CommitPendingWrite() {
+  if (dirty_keys_.empty())
+    return;
+  flush_timer_.Stop();
+  FlushToDisk();
+}
+
+void WriteCoalescingPrefStore::SchedulePendingLossyWrites() {
+  // Lossy prefs are not tracked separately; they ride along with the
+  // next coalesced flush.
+}
+
+void WriteCoalescingPrefStore::ClearMutableValues() {
+  prefs_->Clear();
+  ScheduleWrite(std::string());
+}
+
+void WriteCoalescingPrefStore::ScheduleWrite(const std::string& key) {
+  if (read_only_)
+    return;
+  dirty_keys_.insert(key);
+  // The timer is not restarted on subsequent changes, so write latency
+  // is bounded by kFlushDelayMs even under continuous churn.
+  if (!flush_timer_.IsRunning()) {
+    flush_timer_.Start(FROM_HERE,
+                       base::TimeDelta::FromMilliseconds(kFlushDelayMs),
+                       base::Bind(&WriteCoalescingPrefStore::FlushToDisk,
+                                  base::Unretained(this)));
+  }
+}
+
+void WriteCoalescingPrefStore::FlushToDisk() {
+  dirty_keys_.clear();
+  // Copying the dictionary is considerably cheaper than serializing it
+  // and lets the JSON encoding and disk write run off the UI thread.
+  file_task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&WritePrefsToDisk, path_,
+                 base::Passed(prefs_->CreateDeepCopy())));
+}
+
+}  // namespace brightray
@@ -0,0 +1,97 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef BRIGHTRAY_BROWSER_WRITE_COALESCING_PREF_STORE_H_
+#define BRIGHTRAY_BROWSER_WRITE_COALESCING_PREF_STORE_H_
+
+#include <memory>
+#include <set>
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/macros.h"
+#include "base/memory/ref_counted.h"
+#include "base/observer_list.h"
+#include "base/sequenced_task_runner.h"
+#include "base/timer/timer.h"
+#include "base/values.h"
+#include "components/prefs/persistent_pref_store.h"
+
+namespace brightray {
+
+// A PersistentPrefStore that keeps prefs in memory and flushes them to
+// disk in coalesced batches. Pref writes only mark keys dirty and arm a
+// short timer; when it fires the dictionary is copied once and the
+// serialization and file write happen on |file_task_runner_|, so a
+// burst of changes (window-state prefs during a move or resize) costs
+// one off-thread write instead of repeated JSON serialization on the UI
+// thread. The on-disk format stays JsonPrefStore's JSON, so existing
+// Preferences files load unchanged.
+class WriteCoalescingPrefStore : public PersistentPrefStore {
+ public:
+  WriteCoalescingPrefStore(
+      const base::FilePath& pref_filename,
+      const scoped_refptr<base::SequencedTaskRunner>& file_task_runner);
+
+  // PrefStore:
+  bool GetValue(const std::string& key,
+                const base::Value** result) const override;
+  void AddObserver(PrefStore::Observer* observer) override;
+  void RemoveObserver(PrefStore::Observer* observer) override;
+  bool HasObservers() const override;
+  bool IsInitializationComplete() const override;
+
+  // WriteablePrefStore:
+  void SetValue(const std::string& key,
+                std::unique_ptr<base::Value> value,
+                uint32_t flags) override;
+  void SetValueSilently(const std::string& key,
+                        std::unique_ptr<base::Value> value,
+                        uint32_t flags) override;
+  void RemoveValue(const std::string& key, uint32_t flags) override;
+  bool GetMutableValue(const std::string& key, base::Value** result) override;
+  void ReportValueChanged(const std::string& key, uint32_t flags) override;
+
+  // PersistentPrefStore:
+  bool ReadOnly() const override;
+  PrefReadError GetReadError() const override;
+  PrefReadError ReadPrefs() override;
+  void ReadPrefsAsync(ReadErrorDelegate* error_delegate) override;
+  void CommitPendingWrite() override;
+  void SchedulePendingLossyWrites() override;
+  void ClearMutableValues() override;
+
+ private:
+  ~WriteCoalescingPrefStore() override;
+
+  // Marks |key| dirty and arms the flush timer if it is not already
+  // running, so a burst of changes results in a single write.
+  void ScheduleWrite(const std::string& key);
+
+  // Copies the current prefs and posts serialization plus the file
+  // write to |file_task_runner_|.
+  void FlushToDisk();
+
+  const base::FilePath path_;
+  const scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
+
+  std::unique_ptr<base::DictionaryValue> prefs_;
+  bool read_only_;
+  PrefReadError read_error_;
+  bool initialized_;
+
+  // Keys changed since the last flush. Cleared when the batch is
+  // posted; used only to decide whether a flush is needed, since a JSON
+  // file cannot be patched in place and is rewritten whole.
+  std::set<std::string> dirty_keys_;
+  base::OneShotTimer flush_timer_;
+
+  base::ObserverList<PrefStore::Observer, true> observers_;
+
+  DISALLOW_COPY_AND_ASSIGN(WriteCoalescingPrefStore);
+};
+
+}  // namespace brightray
+
+#endif  // BRIGHTRAY_BROWSER_WRITE_COALESCING_PREF_STORE_H_
@@ -106,6 +106,33 @@ bool GlobalShortcutListener::IsShortcutHandlingSuspended() const {
   return shortcut_handling_suspended_;
 }
 
+void GlobalShortcutListener::RegisterFastCallback(
+    const ui::Accelerator& accelerator, const base::Closure& callback) {
+  base::AutoLock lock(fast_callbacks_lock_);
+  fast_callbacks_[accelerator] = callback;
+}
+
+void GlobalShortcutListener::UnregisterFastCallback(
+    const ui::Accelerator& accelerator) {
+  base::AutoLock lock(fast_callbacks_lock_);
+  fast_callbacks_.erase(accelerator);
+}
+
+bool GlobalShortcutListener::RunFastCallback(
+    const ui::Accelerator& accelerator) {
+  base::Closure callback;
+  {
+    base::AutoLock lock(fast_callbacks_lock_);
+    FastCallbackMap::const_iterator it = fast_callbacks_.find(accelerator);
+    if (it == fast_callbacks_.end())
+      return false;
+    callback = it->second;
+  }
+  // Run outside the lock, the callback may call back into this class.
+  callback.Run();
+  return true;
+}
+
 void GlobalShortcutListener::NotifyKeyPressed(
     const ui::Accelerator& accelerator) {
   AcceleratorMap::iterator iter = accelerator_map_.find(accelerator);
@@ -7,7 +7,9 @@
 
 #include <map>
 
+#include "base/callback.h"
 #include "base/macros.h"
+#include "base/synchronization/lock.h"
 #include "ui/events/keycodes/keyboard_codes.h"
 
 namespace ui {
@@ -59,6 +61,16 @@ class GlobalShortcutListener {
   // Returns whether shortcut handling is currently suspended.
   bool IsShortcutHandlingSuspended() const;
 
+  // Registers a native callback that is run as soon as |accelerator| is seen,
+  // on whatever thread the platform listener receives it, instead of
+  // notifying the registered observer on the UI thread. The callback must be
+  // safe to run from any thread; an accelerator with a fast callback does not
+  // reach the observer. The accelerator itself must still be registered
+  // through RegisterAccelerator. Both methods may be called from any thread.
+  void RegisterFastCallback(const ui::Accelerator& accelerator,
+                            const base::Closure& callback);
+  void UnregisterFastCallback(const ui::Accelerator& accelerator);
+
  protected:
   GlobalShortcutListener();
 
@@ -66,6 +78,11 @@ class GlobalShortcutListener {
   // is struck. Only called for keys that have an observer registered.
   void NotifyKeyPressed(const ui::Accelerator& accelerator);
 
+  // Runs the fast callback registered for |accelerator|, if any. Called by
+  // platform implementations at the earliest dispatch point, which may be off
+  // the UI thread. Returns true if the event was consumed.
+  bool RunFastCallback(const ui::Accelerator& accelerator);
+
  private:
   // The following methods are implemented by platform-specific implementations
   // of this class.
@@ -91,6 +108,12 @@ class GlobalShortcutListener {
   // Keeps track of whether shortcut handling is currently suspended.
   bool shortcut_handling_suspended_;
 
+  // Guards |fast_callbacks_|, which is read from the platform dispatch
+  // thread.
+  base::Lock fast_callbacks_lock_;
+  typedef std::map<ui::Accelerator, base::Closure> FastCallbackMap;
+  FastCallbackMap fast_callbacks_;
+
   DISALLOW_COPY_AND_ASSIGN(GlobalShortcutListener);
 };
 
@@ -6,15 +6,23 @@
 
 #include "base/bind.h"
 #include "base/bind_helpers.h"
+#include "base/message_loop/message_loop.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/threading/thread.h"
 #include "base/win/win_util.h"
 #include "content/public/browser/browser_thread.h"
 #include "ui/base/accelerators/accelerator.h"
 #include "ui/events/event_constants.h"
 #include "ui/events/keycodes/keyboard_code_conversion_win.h"
-#include "ui/gfx/win/singleton_hwnd.h"
 
 using content::BrowserThread;
 
+namespace {
+
+const wchar_t kHotkeyWindowClassName[] = L"Electron_GlobalShortcutWindow";
+
+}  // namespace
+
 namespace extensions {
 
 // static
@@ -26,39 +34,105 @@ GlobalShortcutListener* GlobalShortcutListener::GetInstance() {
 }
 
 GlobalShortcutListenerWin::GlobalShortcutListenerWin()
-    : is_listening_(false) {
+    : is_listening_(false),
+      hotkey_hwnd_(NULL) {
   CHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
 }
 
 GlobalShortcutListenerWin::~GlobalShortcutListenerWin() {
   if (is_listening_)
     StopListening();
+  if (dispatcher_thread_) {
+    base::WaitableEvent done(base::WaitableEvent::ResetPolicy::MANUAL,
+                             base::WaitableEvent::InitialState::NOT_SIGNALED);
+    dispatcher_thread_->task_runner()->PostTask(
+        FROM_HERE,
+        base::Bind(&GlobalShortcutListenerWin::DestroyWindowOnDispatcherThread,
+                   base::Unretained(this), &done));
+    done.Wait();
+    dispatcher_thread_->Stop();
+  }
 }
 
 void GlobalShortcutListenerWin::StartListening() {
   DCHECK(!is_listening_);  // Don't start twice.
   DCHECK(!hotkey_ids_.empty());  // Also don't start if no hotkey is registered.
-  singleton_hwnd_observer_.reset(new gfx::SingletonHwndObserver(
-      base::Bind(
-          &GlobalShortcutListenerWin::OnWndProc, base::Unretained(this))));
-
   is_listening_ = true;
 }
 
 void GlobalShortcutListenerWin::StopListening() {
   DCHECK(is_listening_);  // No point if we are not already listening.
   DCHECK(hotkey_ids_.empty());  // Make sure the map is clean before ending.
-  singleton_hwnd_observer_.reset(nullptr);
   is_listening_ = false;
 }
 
-void GlobalShortcutListenerWin::OnWndProc(HWND hwnd,
-                                          UINT message,
-                                          WPARAM wparam,
-                                          LPARAM lparam) {
-  if (message != WM_HOTKEY)
+void GlobalShortcutListenerWin::EnsureDispatcherStarted() {
+  if (dispatcher_thread_)
     return;
 
+  dispatcher_thread_.reset(new base::Thread("GlobalShortcutDispatcher"));
+  base::Thread::Options options;
+  options.message_loop_type = base::MessageLoop::TYPE_UI;
+  dispatcher_thread_->StartWithOptions(options);
+
+  // Registration needs the window to exist, so block until it does; this
+  // happens once, at the first registered shortcut.
+  base::WaitableEvent done(base::WaitableEvent::ResetPolicy::MANUAL,
+                           base::WaitableEvent::InitialState::NOT_SIGNALED);
+  dispatcher_thread_->task_runner()->PostTask(
+      FROM_HERE,
+      base::Bind(&GlobalShortcutListenerWin::CreateWindowOnDispatcherThread,
+                 base::Unretained(this), &done));
+  done.Wait();
+}
+
+void GlobalShortcutListenerWin::CreateWindowOnDispatcherThread(
+    base::WaitableEvent* done) {
+  WNDCLASSEX window_class;
+  memset(&window_class, 0, sizeof(window_class));
+  window_class.cbSize = sizeof(window_class);
+  window_class.lpfnWndProc = &GlobalShortcutListenerWin::WndProcThunk;
+  window_class.hInstance = GetModuleHandle(NULL);
+  window_class.lpszClassName = kHotkeyWindowClassName;
+  RegisterClassEx(&window_class);
+
+  // A message-only window; WM_HOTKEY is posted to the queue of the thread
+  // that created it, which is exactly why it lives here and not on the UI
+  // thread.
+  hotkey_hwnd_ = CreateWindow(kHotkeyWindowClassName, 0, 0, 0, 0, 0, 0,
+                              HWND_MESSAGE, 0, GetModuleHandle(NULL), 0);
+  SetWindowLongPtr(hotkey_hwnd_, GWLP_USERDATA,
+                   reinterpret_cast<LONG_PTR>(this));
+  done->Signal();
+}
+
+void GlobalShortcutListenerWin::DestroyWindowOnDispatcherThread(
+    base::WaitableEvent* done) {
+  if (hotkey_hwnd_) {
+    DestroyWindow(hotkey_hwnd_);
+    hotkey_hwnd_ = NULL;
+  }
+  done->Signal();
+}
+
+// static
+LRESULT CALLBACK GlobalShortcutListenerWin::WndProcThunk(HWND hwnd,
+                                                         UINT message,
+                                                         WPARAM wparam,
+                                                         LPARAM lparam) {
+  if (message == WM_HOTKEY) {
+    GlobalShortcutListenerWin* listener =
+        reinterpret_cast<GlobalShortcutListenerWin*>(
+            GetWindowLongPtr(hwnd, GWLP_USERDATA));
+    if (listener) {
+      listener->OnHotKey(wparam, lparam);
+      return 0;
+    }
+  }
+  return DefWindowProc(hwnd, message, wparam, lparam);
+}
+
+void GlobalShortcutListenerWin::OnHotKey(WPARAM wparam, LPARAM lparam) {
   int key_code = HIWORD(lparam);
   int modifiers = 0;
   modifiers |= (LOWORD(lparam) & MOD_SHIFT) ? ui::EF_SHIFT_DOWN : 0;
@@ -69,25 +143,32 @@ void GlobalShortcutListenerWin::OnWndProc(HWND hwnd,
   ui::Accelerator accelerator(
       ui::KeyboardCodeForWindowsKeyCode(key_code), modifiers);
 
-  NotifyKeyPressed(accelerator);
+  // Fast callbacks run right here on the dispatcher thread, ahead of
+  // anything queued on the UI thread.
+  if (RunFastCallback(accelerator))
+    return;
+
+  BrowserThread::PostTask(
+      BrowserThread::UI, FROM_HERE,
+      base::Bind(&GlobalShortcutListenerWin::NotifyKeyPressed,
+                 base::Unretained(this), accelerator));
 }
 
 bool GlobalShortcutListenerWin::RegisterAcceleratorImpl(
     const ui::Accelerator& accelerator) {
   DCHECK(hotkey_ids_.find(accelerator) == hotkey_ids_.end());
-
-  int modifiers = 0;
-  modifiers |= accelerator.IsShiftDown() ? MOD_SHIFT : 0;
-  modifiers |= accelerator.IsCtrlDown() ? MOD_CONTROL : 0;
-  modifiers |= accelerator.IsAltDown() ? MOD_ALT : 0;
-  modifiers |= accelerator.IsCmdDown() ? MOD_WIN : 0;
+  EnsureDispatcherStarted();
 
   static int hotkey_id = 0;
-  bool success = !!RegisterHotKey(
-      gfx::SingletonHwnd::GetInstance()->hwnd(),
-      hotkey_id,
-      modifiers,
-      accelerator.key_code());
+  bool success = false;
+  base::WaitableEvent done(base::WaitableEvent::ResetPolicy::MANUAL,
+                           base::WaitableEvent::InitialState::NOT_SIGNALED);
+  dispatcher_thread_->task_runner()->PostTask(
+      FROM_HERE,
+      base::Bind(&GlobalShortcutListenerWin::RegisterHotKeyOnDispatcherThread,
+                 base::Unretained(this), accelerator, hotkey_id, &success,
+                 &done));
+  done.Wait();
 
   if (!success) {
     // Most likely error: 1409 (Hotkey already registered).
@@ -98,18 +179,46 @@ bool GlobalShortcutListenerWin::RegisterAcceleratorImpl(
   return true;
 }
 
+void GlobalShortcutListenerWin::RegisterHotKeyOnDispatcherThread(
+    const ui::Accelerator& accelerator,
+    int id,
+    bool* success,
+    base::WaitableEvent* done) {
+  int modifiers = 0;
+  modifiers |= accelerator.IsShiftDown() ? MOD_SHIFT : 0;
+  modifiers |= accelerator.IsCtrlDown() ? MOD_CONTROL : 0;
+  modifiers |= accelerator.IsAltDown() ? MOD_ALT : 0;
+  modifiers |= accelerator.IsCmdDown() ? MOD_WIN : 0;
+
+  *success = !!RegisterHotKey(
+      hotkey_hwnd_, id, modifiers, accelerator.key_code());
+  done->Signal();
+}
+
 void GlobalShortcutListenerWin::UnregisterAcceleratorImpl(
     const ui::Accelerator& accelerator) {
   HotkeyIdMap::iterator it = hotkey_ids_.find(accelerator);
   DCHECK(it != hotkey_ids_.end());
 
-  bool success = !!UnregisterHotKey(
-      gfx::SingletonHwnd::GetInstance()->hwnd(), it->second);
+  base::WaitableEvent done(base::WaitableEvent::ResetPolicy::MANUAL,
+                           base::WaitableEvent::InitialState::NOT_SIGNALED);
+  dispatcher_thread_->task_runner()->PostTask(
+      FROM_HERE,
+      base::Bind(
+          &GlobalShortcutListenerWin::UnregisterHotKeyOnDispatcherThread,
+          base::Unretained(this), it->second, &done));
+  done.Wait();
+
+  hotkey_ids_.erase(it);
+}
+
+void GlobalShortcutListenerWin::UnregisterHotKeyOnDispatcherThread(
+    int id, base::WaitableEvent* done) {
+  bool success = !!UnregisterHotKey(hotkey_hwnd_, id);
   // This call should always succeed, as long as we pass in the right HWND and
   // an id we've used to register before.
   DCHECK(success);
-
-  hotkey_ids_.erase(it);
+  done->Signal();
 }
 
 }  // namespace extensions
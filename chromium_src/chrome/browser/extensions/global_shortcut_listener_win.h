@@ -10,23 +10,25 @@
 #include <windows.h>
 
 #include "chrome/browser/extensions/global_shortcut_listener.h"
-#include "ui/gfx/win/singleton_hwnd.h"
-#include "ui/gfx/win/singleton_hwnd_observer.h"
+
+namespace base {
+class Thread;
+class WaitableEvent;
+}
 
 namespace extensions {
 
 // Windows-specific implementation of the GlobalShortcutListener class that
-// listens for global shortcuts. Handles setting up a keyboard hook and
-// forwarding its output to the base class for processing.
+// listens for global shortcuts. Hotkeys are registered against a message-only
+// window owned by a dedicated dispatcher thread, so WM_HOTKEY delivery does
+// not have to wait for a busy UI message pump; fast callbacks run right on
+// that thread and everything else is forwarded to the UI thread.
 class GlobalShortcutListenerWin : public GlobalShortcutListener {
  public:
   GlobalShortcutListenerWin();
   virtual ~GlobalShortcutListenerWin();
 
  private:
-  // The implementation of our Window Proc, called by SingletonHwndObserver.
-  void OnWndProc(HWND hwnd, UINT message, WPARAM wparam, LPARAM lparam);
-
   // GlobalShortcutListener implementation.
   virtual void StartListening() override;
   virtual void StopListening() override;
@@ -35,6 +37,27 @@ class GlobalShortcutListenerWin : public GlobalShortcutListener {
   virtual void UnregisterAcceleratorImpl(
       const ui::Accelerator& accelerator) override;
 
+  // Lazily starts |dispatcher_thread_| and creates the message-only window
+  // on it. Blocks until the window exists.
+  void EnsureDispatcherStarted();
+
+  // The following run on |dispatcher_thread_|.
+  void CreateWindowOnDispatcherThread(base::WaitableEvent* done);
+  void DestroyWindowOnDispatcherThread(base::WaitableEvent* done);
+  void RegisterHotKeyOnDispatcherThread(const ui::Accelerator& accelerator,
+                                        int id,
+                                        bool* success,
+                                        base::WaitableEvent* done);
+  void UnregisterHotKeyOnDispatcherThread(int id, base::WaitableEvent* done);
+
+  // Handles WM_HOTKEY on the dispatcher thread.
+  void OnHotKey(WPARAM wparam, LPARAM lparam);
+
+  static LRESULT CALLBACK WndProcThunk(HWND hwnd,
+                                       UINT message,
+                                       WPARAM wparam,
+                                       LPARAM lparam);
+
   // Whether this object is listening for global shortcuts.
   bool is_listening_;
 
@@ -42,7 +65,11 @@ class GlobalShortcutListenerWin : public GlobalShortcutListener {
   typedef std::map<ui::Accelerator, int> HotkeyIdMap;
   HotkeyIdMap hotkey_ids_;
 
-  std::unique_ptr<gfx::SingletonHwndObserver> singleton_hwnd_observer_;
+  // Owns the message-only window that receives WM_HOTKEY.
+  std::unique_ptr<base::Thread> dispatcher_thread_;
+
+  // Created and used on |dispatcher_thread_| only.
+  HWND hotkey_hwnd_;
 
   DISALLOW_COPY_AND_ASSIGN(GlobalShortcutListenerWin);
 };
@@ -156,8 +156,13 @@ void GlobalShortcutListenerX11::OnXKeyPressEvent(::XEvent* x_event) {
 
   ui::Accelerator accelerator(
       ui::KeyboardCodeFromXKeyEvent(x_event), modifiers);
-  if (registered_hot_keys_.find(accelerator) != registered_hot_keys_.end())
+  if (registered_hot_keys_.find(accelerator) != registered_hot_keys_.end()) {
+    // This runs straight out of the X event source, so fast callbacks fire
+    // before anything sitting in the UI task queue.
+    if (RunFastCallback(accelerator))
+      return;
     NotifyKeyPressed(accelerator);
+  }
 }
 
 }  // namespace extensions
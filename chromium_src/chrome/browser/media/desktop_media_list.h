@@ -53,6 +53,11 @@ class DesktopMediaList {
   // model.
   virtual void StartUpdating(DesktopMediaListObserver* observer) = 0;
 
+  // Triggers one more refresh pass after updating has stopped (i.e. after
+  // the observer returned false from OnRefreshFinished()). Sources whose
+  // content has not changed keep their existing thumbnails.
+  virtual void Update() = 0;
+
   virtual int GetSourceCount() const = 0;
   virtual const Source& GetSource(int index) const = 0;
   virtual std::vector<Source> GetSources() const = 0;
@@ -270,6 +270,11 @@ void NativeDesktopMediaList::StartUpdating(DesktopMediaListObserver* observer) {
   Refresh();
 }
 
+void NativeDesktopMediaList::Update() {
+  DCHECK(observer_);
+  Refresh();
+}
+
 int NativeDesktopMediaList::GetSourceCount() const {
   return sources_.size();
 }
@@ -31,6 +31,7 @@ class NativeDesktopMediaList : public DesktopMediaList {
   void SetUpdatePeriod(base::TimeDelta period) override;
   void SetThumbnailSize(const gfx::Size& thumbnail_size) override;
   void StartUpdating(DesktopMediaListObserver* observer) override;
+  void Update() override;
   int GetSourceCount() const override;
   const Source& GetSource(int index) const override;
   std::vector<Source> GetSources() const override;
@@ -122,6 +122,10 @@ void PrintViewManagerBase::OnDidPrintPage(
   if (!document || params.document_cookie != document->cookie()) {
     // Out of sync. It may happen since we are completely asynchronous. Old
     // spurious messages can be received if one of the processes is overloaded.
+    // The data will never be consumed, so hand the spool buffer back.
+    if (params.buffer_sequence > 0)
+      Send(new PrintMsg_ReleasePageBuffer(routing_id(),
+                                          params.buffer_sequence));
     return;
   }
 
@@ -176,6 +180,11 @@ void PrintViewManagerBase::OnDidPrintPage(
         print_text_with_gdi);
   }
 #endif  // !OS_WIN
+
+  // The metafile data has been copied out of the shared buffer above, so
+  // the renderer can reuse it for the next page.
+  if (params.buffer_sequence > 0)
+    Send(new PrintMsg_ReleasePageBuffer(routing_id(), params.buffer_sequence));
 }
 
 void PrintViewManagerBase::OnPrintingFailed(int cookie) {
@@ -9,6 +9,7 @@
 #include <windows.h>
 #endif  // defined(OS_WIN)
 
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -131,6 +132,13 @@ class ProcessSingleton : public base::NonThreadSafe {
   HANDLE lock_file_;
   base::FilePath user_data_dir_;
   ShouldKillRemoteProcessCallback should_kill_remote_process_callback_;
+
+  // Serves second-instance command lines over a named pipe on a
+  // dedicated thread. Secondaries try the pipe before falling back to
+  // WM_COPYDATA; the pipe answers without waiting on the primary's UI
+  // thread to pump messages.
+  class PipeRelay;
+  std::unique_ptr<PipeRelay> pipe_relay_;
 #elif defined(OS_POSIX) && !defined(OS_ANDROID)
   // Start listening to the socket.
   void StartListening(int sock);
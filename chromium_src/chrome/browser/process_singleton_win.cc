@@ -6,16 +6,24 @@
 
 #include <shellapi.h>
 
+#include <vector>
+
 #include "base/base_paths.h"
 #include "base/bind.h"
 #include "base/command_line.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/location.h"
+#include "base/md5.h"
 #include "base/process/process.h"
 #include "base/process/process_info.h"
+#include "base/single_thread_task_runner.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/synchronization/atomic_flag.h"
+#include "base/threading/simple_thread.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "base/time/time.h"
 #include "base/win/registry.h"
 #include "base/win/scoped_handle.h"
@@ -180,8 +188,153 @@ bool TerminateAppWithError() {
   return false;
 }
 
+// Named pipe used for the fast second-instance handoff. The name is
+// derived from the user data dir so instances with different profiles
+// do not see each other, same as the message window title.
+const size_t kPipeBufferSize = 64 * 1024;
+const DWORD kPipeNotifyTimeoutMs = 2000;
+
+std::wstring GetPipeName(const base::FilePath& user_data_dir) {
+  std::string hash = base::MD5String(base::UTF16ToUTF8(user_data_dir.value()));
+  return L"\\\\.\\pipe\\AtomSingleton-" + base::UTF8ToWide(hash);
+}
+
+// Trampoline so the notification callback's return value can be dropped
+// when posting it to the UI thread.
+void RunNotificationCallback(
+    const ProcessSingleton::NotificationCallback& callback,
+    const base::CommandLine::StringVector& command_line,
+    const base::FilePath& current_directory) {
+  callback.Run(command_line, current_directory);
+}
+
+// Sends our command line to the primary's pipe relay, using the same
+// "START\0<directory>\0<command line>\0" payload as WM_COPYDATA. Returns
+// true only when the primary acknowledged the message.
+bool NotifyViaPipe(const std::wstring& pipe_name) {
+  std::wstring to_send(L"START\0", 6);  // want the NULL in the string.
+  base::FilePath cur_dir;
+  if (!base::GetCurrentDirectory(&cur_dir))
+    return false;
+  to_send.append(cur_dir.value());
+  to_send.append(L"\0", 1);  // Null separator.
+  to_send.append(::GetCommandLineW());
+  to_send.append(L"\0", 1);  // Null separator.
+
+  char ack = 0;
+  DWORD bytes_read = 0;
+  return ::CallNamedPipe(
+             pipe_name.c_str(), const_cast<wchar_t*>(to_send.c_str()),
+             static_cast<DWORD>((to_send.length() + 1) * sizeof(wchar_t)),
+             &ack, sizeof(ack), &bytes_read, kPipeNotifyTimeoutMs) != 0 &&
+         bytes_read == sizeof(ack);
+}
+
 }  // namespace
 
+// Serves relayed command lines over a named pipe on a dedicated thread.
+// Unlike the message window, the pipe answers even while the primary's
+// UI thread is busy, so a secondary process can hand off and exit in
+// milliseconds.
+class ProcessSingleton::PipeRelay
+    : public base::DelegateSimpleThread::Delegate {
+ public:
+  PipeRelay(const std::wstring& pipe_name,
+            const ProcessSingleton::NotificationCallback& callback)
+      : pipe_name_(pipe_name),
+        notification_callback_(callback),
+        ui_task_runner_(base::ThreadTaskRunnerHandle::Get()) {}
+
+  ~PipeRelay() override {
+    Stop();
+  }
+
+  void Start() {
+    thread_.reset(new base::DelegateSimpleThread(this, "AtomSingletonPipe"));
+    thread_->Start();
+  }
+
+  void Stop() {
+    if (!thread_)
+      return;
+    stopping_.Set();
+    // Wake the server thread out of ConnectNamedPipe with a dummy
+    // connection so it can observe |stopping_| and exit.
+    HANDLE pipe = ::CreateFile(pipe_name_.c_str(), GENERIC_READ, 0, NULL,
+                               OPEN_EXISTING, 0, NULL);
+    if (pipe != INVALID_HANDLE_VALUE)
+      ::CloseHandle(pipe);
+    thread_->Join();
+    thread_.reset();
+  }
+
+ private:
+  // base::DelegateSimpleThread::Delegate:
+  void Run() override {
+    while (!stopping_.IsSet()) {
+      HANDLE pipe = ::CreateNamedPipe(
+          pipe_name_.c_str(), PIPE_ACCESS_DUPLEX,
+          PIPE_TYPE_MESSAGE | PIPE_READMODE_MESSAGE | PIPE_WAIT,
+          PIPE_UNLIMITED_INSTANCES, kPipeBufferSize, kPipeBufferSize, 0, NULL);
+      if (pipe == INVALID_HANDLE_VALUE) {
+        PLOG(ERROR) << "CreateNamedPipe failed, second-instance handoff "
+                       "falls back to WM_COPYDATA";
+        return;
+      }
+
+      bool connected = ::ConnectNamedPipe(pipe, NULL) != 0 ||
+                       ::GetLastError() == ERROR_PIPE_CONNECTED;
+      if (connected && !stopping_.IsSet())
+        HandleConnection(pipe);
+
+      ::DisconnectNamedPipe(pipe);
+      ::CloseHandle(pipe);
+    }
+  }
+
+  void HandleConnection(HANDLE pipe) {
+    std::vector<char> data;
+    char chunk[4096];
+    for (;;) {
+      DWORD bytes_read = 0;
+      BOOL success = ::ReadFile(pipe, chunk, sizeof(chunk), &bytes_read, NULL);
+      data.insert(data.end(), chunk, chunk + bytes_read);
+      if (success)
+        break;
+      if (::GetLastError() != ERROR_MORE_DATA || data.size() > kPipeBufferSize)
+        return;
+    }
+
+    // Reuse the WM_COPYDATA parser; the payload format is identical.
+    COPYDATASTRUCT cds;
+    cds.dwData = 0;
+    cds.cbData = static_cast<DWORD>(data.size());
+    cds.lpData = data.data();
+
+    base::CommandLine::StringVector parsed_command_line;
+    base::FilePath current_directory;
+    if (!ParseCommandLine(&cds, &parsed_command_line, &current_directory))
+      return;
+
+    ui_task_runner_->PostTask(
+        FROM_HERE, base::Bind(&RunNotificationCallback, notification_callback_,
+                              parsed_command_line, current_directory));
+
+    char ack = 1;
+    DWORD bytes_written = 0;
+    ::WriteFile(pipe, &ack, sizeof(ack), &bytes_written, NULL);
+    ::FlushFileBuffers(pipe);
+  }
+
+  std::wstring pipe_name_;
+  ProcessSingleton::NotificationCallback notification_callback_;
+  scoped_refptr<base::SingleThreadTaskRunner> ui_task_runner_;
+  std::unique_ptr<base::DelegateSimpleThread> thread_;
+  base::AtomicFlag stopping_;
+
+  DISALLOW_COPY_AND_ASSIGN(PipeRelay);
+};
+
 ProcessSingleton::ProcessSingleton(
     const base::FilePath& user_data_dir,
     const NotificationCallback& notification_callback)
@@ -210,6 +363,16 @@ ProcessSingleton::NotifyResult ProcessSingleton::NotifyOtherProcess() {
     return PROCESS_NONE;
   }
 
+  // Fast path: primaries running the pipe relay acknowledge without
+  // their UI thread being involved. Fall through to WM_COPYDATA when
+  // the pipe is not being served (e.g. an older primary).
+  DWORD remote_process_id = 0;
+  ::GetWindowThreadProcessId(remote_window_, &remote_process_id);
+  if (remote_process_id)
+    ::AllowSetForegroundWindow(remote_process_id);
+  if (NotifyViaPipe(GetPipeName(user_data_dir_)))
+    return PROCESS_NOTIFIED;
+
   switch (chrome::AttemptToNotifyRunningChrome(remote_window_, false)) {
     case chrome::NOTIFY_SUCCESS:
       return PROCESS_NOTIFIED;
@@ -314,6 +477,11 @@ bool ProcessSingleton::Create() {
         // will still be able to send messages
         ::ChangeWindowMessageFilterEx(window_.hwnd(), WM_COPYDATA, MSGFLT_ALLOW, NULL);
         CHECK(result && window_.hwnd());
+
+        // Start serving the fast second-instance handoff path.
+        pipe_relay_.reset(
+            new PipeRelay(GetPipeName(user_data_dir_), notification_callback_));
+        pipe_relay_->Start();
       }
     }
   }
@@ -322,6 +490,7 @@ bool ProcessSingleton::Create() {
 }
 
 void ProcessSingleton::Cleanup() {
+  pipe_relay_.reset();
 }
 
 void ProcessSingleton::OverrideShouldKillRemoteProcessCallbackForTesting(
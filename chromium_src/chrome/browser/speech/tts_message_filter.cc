@@ -30,6 +30,7 @@ void TtsMessageFilter::OverrideThreadForMessage(
   switch (message.type()) {
   case TtsHostMsg_InitializeVoiceList::ID:
   case TtsHostMsg_Speak::ID:
+  case TtsHostMsg_SpeakBatch::ID:
   case TtsHostMsg_Pause::ID:
   case TtsHostMsg_Resume::ID:
   case TtsHostMsg_Cancel::ID:
@@ -43,6 +44,7 @@ bool TtsMessageFilter::OnMessageReceived(const IPC::Message& message) {
   IPC_BEGIN_MESSAGE_MAP(TtsMessageFilter, message)
     IPC_MESSAGE_HANDLER(TtsHostMsg_InitializeVoiceList, OnInitializeVoiceList)
     IPC_MESSAGE_HANDLER(TtsHostMsg_Speak, OnSpeak)
+    IPC_MESSAGE_HANDLER(TtsHostMsg_SpeakBatch, OnSpeakBatch)
     IPC_MESSAGE_HANDLER(TtsHostMsg_Pause, OnPause)
     IPC_MESSAGE_HANDLER(TtsHostMsg_Resume, OnResume)
     IPC_MESSAGE_HANDLER(TtsHostMsg_Cancel, OnCancel)
@@ -101,6 +103,15 @@ void TtsMessageFilter::OnSpeak(const TtsUtteranceRequest& request) {
   TtsController::GetInstance()->SpeakOrEnqueue(utterance.release());
 }
 
+void TtsMessageFilter::OnSpeakBatch(
+    const std::vector<TtsUtteranceRequest>& utterances) {
+  CHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  // TtsController queues utterances natively, so the whole batch can be
+  // handed over at once and speaks back to back without further IPC.
+  for (size_t i = 0; i < utterances.size(); ++i)
+    OnSpeak(utterances[i]);
+}
+
 void TtsMessageFilter::OnPause() {
   CHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
   TtsController::GetInstance()->Pause();
@@ -121,6 +132,26 @@ void TtsMessageFilter::OnTtsEvent(Utterance* utterance,
                                   int char_index,
                                   const std::string& error_message) {
   CHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+
+  // Boundary events arrive once per word at normal speech rates, so they
+  // are coalesced per message loop turn instead of sent one by one. All
+  // other events flush the batch first to keep ordering.
+  if (event_type == TTS_EVENT_WORD || event_type == TTS_EVENT_SENTENCE) {
+    if (pending_boundary_events_.empty()) {
+      BrowserThread::PostTask(
+          BrowserThread::UI, FROM_HERE,
+          base::Bind(&TtsMessageFilter::FlushBoundaryEvents,
+                     weak_ptr_factory_.GetWeakPtr()));
+    }
+    TtsBoundaryEvent event;
+    event.utterance_id = utterance->src_id();
+    event.char_index = char_index;
+    event.is_sentence = (event_type == TTS_EVENT_SENTENCE);
+    pending_boundary_events_.push_back(event);
+    return;
+  }
+  FlushBoundaryEvents();
+
   switch (event_type) {
     case TTS_EVENT_START:
       Send(new TtsMsg_DidStartSpeaking(utterance->src_id()));
@@ -129,10 +160,8 @@ void TtsMessageFilter::OnTtsEvent(Utterance* utterance,
       Send(new TtsMsg_DidFinishSpeaking(utterance->src_id()));
       break;
     case TTS_EVENT_WORD:
-      Send(new TtsMsg_WordBoundary(utterance->src_id(), char_index));
-      break;
     case TTS_EVENT_SENTENCE:
-      Send(new TtsMsg_SentenceBoundary(utterance->src_id(), char_index));
+      // Handled above.
       break;
     case TTS_EVENT_MARKER:
       Send(new TtsMsg_MarkerEvent(utterance->src_id(), char_index));
@@ -156,6 +185,14 @@ void TtsMessageFilter::OnTtsEvent(Utterance* utterance,
   }
 }
 
+void TtsMessageFilter::FlushBoundaryEvents() {
+  CHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  if (pending_boundary_events_.empty())
+    return;
+  Send(new TtsMsg_BoundaryEvents(pending_boundary_events_));
+  pending_boundary_events_.clear();
+}
+
 void TtsMessageFilter::OnVoicesChanged() {
   CHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
   OnInitializeVoiceList();
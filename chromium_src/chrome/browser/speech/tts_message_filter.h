@@ -5,6 +5,8 @@
 #ifndef CHROME_BROWSER_SPEECH_TTS_MESSAGE_FILTER_H_
 #define CHROME_BROWSER_SPEECH_TTS_MESSAGE_FILTER_H_
 
+#include <vector>
+
 #include "base/memory/weak_ptr.h"
 #include "chrome/browser/speech/tts_controller.h"
 #include "chrome/common/tts_messages.h"
@@ -47,15 +49,24 @@ class TtsMessageFilter
 
   void OnInitializeVoiceList();
   void OnSpeak(const TtsUtteranceRequest& utterance);
+  void OnSpeakBatch(const std::vector<TtsUtteranceRequest>& utterances);
   void OnPause();
   void OnResume();
   void OnCancel();
 
+  // Sends the boundary events collected since the last flush in one
+  // TtsMsg_BoundaryEvents. Called from a posted task, and before any
+  // non-boundary event so the renderer sees events in order.
+  void FlushBoundaryEvents();
+
   void OnChannelClosingInUIThread();
 
   int render_process_id_;
   content::BrowserContext* browser_context_;
 
+  // Word and sentence boundary events waiting for the next flush.
+  std::vector<TtsBoundaryEvent> pending_boundary_events_;
+
   base::WeakPtrFactory<TtsMessageFilter> weak_ptr_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(TtsMessageFilter);
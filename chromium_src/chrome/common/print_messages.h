@@ -198,6 +198,12 @@ IPC_STRUCT_BEGIN(PrintHostMsg_DidPrintPage_Params)
 
   // The printable area the page author specified.
   IPC_STRUCT_MEMBER(gfx::Rect, content_area)
+
+  // Identifies the spool buffer holding the metafile data. The browser
+  // acknowledges it with PrintMsg_ReleasePageBuffer once the data has been
+  // consumed, so the renderer can write the next page into the same mapped
+  // region instead of allocating a fresh segment per page.
+  IPC_STRUCT_MEMBER(int, buffer_sequence)
 IPC_STRUCT_END()
 
 // Parameters for the IPC message ViewHostMsg_ScriptedPrint
@@ -243,6 +249,11 @@ IPC_MESSAGE_ROUTED3(PrintMsg_PrintPages,
 IPC_MESSAGE_ROUTED1(PrintMsg_PrintingDone,
                     bool /* success */)
 
+// Tells the render view that the browser has consumed the metafile data in
+// the given spool buffer, so the buffer may be reused for a later page.
+IPC_MESSAGE_ROUTED1(PrintMsg_ReleasePageBuffer,
+                    int /* buffer_sequence */)
+
 // Tells the render view to switch the CSS to print media type, renders every
 // requested pages for print preview using the given |settings|. This gets
 // called multiple times as the user updates settings.
@@ -22,6 +22,12 @@ IPC_STRUCT_TRAITS_MEMBER(rate)
 IPC_STRUCT_TRAITS_MEMBER(pitch)
 IPC_STRUCT_TRAITS_END()
 
+IPC_STRUCT_TRAITS_BEGIN(TtsBoundaryEvent)
+IPC_STRUCT_TRAITS_MEMBER(utterance_id)
+IPC_STRUCT_TRAITS_MEMBER(char_index)
+IPC_STRUCT_TRAITS_MEMBER(is_sentence)
+IPC_STRUCT_TRAITS_END()
+
 IPC_STRUCT_TRAITS_BEGIN(TtsVoice)
 IPC_STRUCT_TRAITS_MEMBER(voice_uri)
 IPC_STRUCT_TRAITS_MEMBER(name)
@@ -35,6 +41,8 @@ IPC_STRUCT_TRAITS_END()
 IPC_MESSAGE_CONTROL0(TtsHostMsg_InitializeVoiceList)
 IPC_MESSAGE_CONTROL1(TtsHostMsg_Speak,
                      TtsUtteranceRequest)
+IPC_MESSAGE_CONTROL1(TtsHostMsg_SpeakBatch,
+                     std::vector<TtsUtteranceRequest>)
 IPC_MESSAGE_CONTROL0(TtsHostMsg_Pause)
 IPC_MESSAGE_CONTROL0(TtsHostMsg_Resume)
 IPC_MESSAGE_CONTROL0(TtsHostMsg_Cancel)
@@ -57,6 +65,8 @@ IPC_MESSAGE_CONTROL2(TtsMsg_WordBoundary,
 IPC_MESSAGE_CONTROL2(TtsMsg_SentenceBoundary,
                      int /* utterance id */,
                      int /* char index */)
+IPC_MESSAGE_CONTROL1(TtsMsg_BoundaryEvents,
+                     std::vector<TtsBoundaryEvent>)
 IPC_MESSAGE_CONTROL2(TtsMsg_MarkerEvent,
                      int /* utterance id */,
                      int /* char index */)
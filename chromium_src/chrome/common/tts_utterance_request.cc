@@ -27,4 +27,13 @@ TtsUtteranceResponse::TtsUtteranceResponse()
 }
 
 TtsUtteranceResponse::~TtsUtteranceResponse() {
+}
+
+TtsBoundaryEvent::TtsBoundaryEvent()
+    : utterance_id(0),
+      char_index(0),
+      is_sentence(false) {
+}
+
+TtsBoundaryEvent::~TtsBoundaryEvent() {
 }
\ No newline at end of file
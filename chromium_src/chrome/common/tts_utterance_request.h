@@ -41,4 +41,16 @@ struct TtsUtteranceResponse {
   int id;
 };
 
+// A word or sentence boundary reached while speaking an utterance.
+// Boundary events are coalesced and shipped in batches, since speech at
+// normal rates produces one per word.
+struct TtsBoundaryEvent {
+  TtsBoundaryEvent();
+  ~TtsBoundaryEvent();
+
+  int utterance_id;
+  int char_index;
+  bool is_sentence;
+};
+
 #endif  // CHROME_COMMON_TTS_UTTERANCE_REQUEST_H_
@@ -5,9 +5,12 @@
 #include "chrome/renderer/pepper/pepper_shared_memory_message_filter.h"
 
 #include <memory>
+#include <utility>
 
+#include "base/bind.h"
 #include "base/memory/shared_memory.h"
 #include "base/process/process_handle.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "content/public/common/content_client.h"
 #include "content/public/renderer/pepper_plugin_instance.h"
 #include "content/public/renderer/render_thread.h"
@@ -16,9 +19,36 @@
 #include "ppapi/proxy/ppapi_messages.h"
 #include "ppapi/shared_impl/var_tracker.h"
 
+namespace {
+
+// Requests at or above this size are rounded up to power-of-two buckets,
+// so a plugin that allocates at frame rate while resizing cycles through
+// few distinct segment sizes instead of a new one per resize step.
+const uint32_t kMinBucketSize = 64 * 1024;
+
+// Above this, segments are allocated at the exact requested size; the
+// waste from rounding would outweigh the churn savings.
+const uint32_t kMaxBucketSize = 8 * 1024 * 1024;
+
+// How many pre-allocated spare segments to keep per bucket.
+const size_t kMaxSparesPerBucket = 2;
+
+uint32_t BucketSize(uint32_t size) {
+  if (size > kMaxBucketSize)
+    return size;
+  uint32_t bucket = kMinBucketSize;
+  while (bucket < size)
+    bucket <<= 1;
+  return bucket;
+}
+
+}  // namespace
+
 PepperSharedMemoryMessageFilter::PepperSharedMemoryMessageFilter(
     content::RendererPpapiHost* host)
-    : InstanceMessageFilter(host->GetPpapiHost()), host_(host) {}
+    : InstanceMessageFilter(host->GetPpapiHost()),
+      host_(host),
+      weak_factory_(this) {}
 
 PepperSharedMemoryMessageFilter::~PepperSharedMemoryMessageFilter() {}
 
@@ -44,8 +74,9 @@ void PepperSharedMemoryMessageFilter::OnHostMsgCreateSharedMemory(
     ppapi::proxy::SerializedHandle* plugin_handle) {
   plugin_handle->set_null_shmem();
   *host_handle_id = -1;
-  std::unique_ptr<base::SharedMemory> shm(
-      content::RenderThread::Get()->HostAllocateSharedMemoryBuffer(size));
+  uint32_t actual_size = size;
+  std::unique_ptr<base::SharedMemory> shm =
+      TakeOrAllocateSegment(size, &actual_size);
   if (!shm.get())
     return;
 
@@ -54,11 +85,54 @@ void PepperSharedMemoryMessageFilter::OnHostMsgCreateSharedMemory(
   *host_handle_id =
       content::PepperPluginInstance::Get(instance)
           ->GetVarTracker()
-          ->TrackSharedMemoryHandle(instance, host_shm_handle, size);
+          ->TrackSharedMemoryHandle(instance, host_shm_handle, actual_size);
 
   // We set auto_close to false since we need our file descriptor to
   // actually be duplicated on linux. The shared memory destructor will
   // close the original handle for us.
   plugin_handle->set_shmem(
-      host_->ShareSharedMemoryHandleWithRemote(host_shm_handle), size);
+      host_->ShareSharedMemoryHandleWithRemote(host_shm_handle), actual_size);
+}
+
+std::unique_ptr<base::SharedMemory>
+PepperSharedMemoryMessageFilter::TakeOrAllocateSegment(uint32_t size,
+                                                       uint32_t* actual_size) {
+  uint32_t bucket = BucketSize(size);
+  *actual_size = bucket;
+
+  auto iter = spare_segments_.find(bucket);
+  if (iter != spare_segments_.end() && !iter->second.empty()) {
+    std::unique_ptr<base::SharedMemory> shm =
+        std::move(iter->second.back());
+    iter->second.pop_back();
+    // Refill the spare off the request burst, so the next allocation in a
+    // resize storm is served without a round trip to the browser.
+    if (bucket <= kMaxBucketSize) {
+      base::ThreadTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE,
+          base::Bind(&PepperSharedMemoryMessageFilter::RefillSpare,
+                     weak_factory_.GetWeakPtr(), bucket));
+    }
+    return shm;
+  }
+
+  std::unique_ptr<base::SharedMemory> shm(
+      content::RenderThread::Get()->HostAllocateSharedMemoryBuffer(bucket));
+  if (shm.get() && bucket <= kMaxBucketSize) {
+    base::ThreadTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE,
+        base::Bind(&PepperSharedMemoryMessageFilter::RefillSpare,
+                   weak_factory_.GetWeakPtr(), bucket));
+  }
+  return shm;
+}
+
+void PepperSharedMemoryMessageFilter::RefillSpare(uint32_t size) {
+  auto& spares = spare_segments_[size];
+  if (spares.size() >= kMaxSparesPerBucket)
+    return;
+  std::unique_ptr<base::SharedMemory> shm(
+      content::RenderThread::Get()->HostAllocateSharedMemoryBuffer(size));
+  if (shm.get())
+    spares.push_back(std::move(shm));
 }
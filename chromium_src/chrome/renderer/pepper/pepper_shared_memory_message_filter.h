@@ -5,9 +5,18 @@
 #ifndef CHROME_RENDERER_PEPPER_PEPPER_SHARED_MEMORY_MESSAGE_FILTER_H_
 #define CHROME_RENDERER_PEPPER_PEPPER_SHARED_MEMORY_MESSAGE_FILTER_H_
 
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "base/memory/weak_ptr.h"
 #include "ppapi/c/pp_instance.h"
 #include "ppapi/host/instance_message_filter.h"
 
+namespace base {
+class SharedMemory;
+}
+
 namespace content {
 class RendererPpapiHost;
 }
@@ -38,8 +47,26 @@ class PepperSharedMemoryMessageFilter
       int* host_shm_handle_id,
       ppapi::proxy::SerializedHandle* plugin_shm_handle);
 
+  // Takes a segment of at least |size| bytes from the spare pool, or
+  // allocates one. Returns the segment size in |actual_size|.
+  std::unique_ptr<base::SharedMemory> TakeOrAllocateSegment(
+      uint32_t size, uint32_t* actual_size);
+
+  // Allocates one spare segment of |size| bytes for later requests,
+  // posted after a request is served so the allocation round trip to the
+  // browser happens off the request burst.
+  void RefillSpare(uint32_t size);
+
   content::RendererPpapiHost* host_;
 
+  // Pre-allocated segments by bucket size. Requests are rounded up to
+  // power-of-two buckets, so a plugin resizing through many sizes reuses
+  // few distinct segment sizes.
+  std::map<uint32_t, std::vector<std::unique_ptr<base::SharedMemory>>>
+      spare_segments_;
+
+  base::WeakPtrFactory<PepperSharedMemoryMessageFilter> weak_factory_;
+
   DISALLOW_COPY_AND_ASSIGN(PepperSharedMemoryMessageFilter);
 };
 
@@ -17,6 +17,7 @@
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "chrome/common/print_messages.h"
 #include "content/public/common/web_preferences.h"
 #include "content/public/renderer/render_frame.h"
@@ -53,6 +54,13 @@ namespace {
 
 const double kMinDpi = 1.0;
 
+// Spool buffer allocations are rounded up to this, so pages of slightly
+// different sizes within a job reuse the same buffers.
+const uint32_t kSpoolBufferGranularity = 256 * 1024;
+
+// How many released spool buffers to keep mapped for reuse.
+const size_t kMaxSpareSpoolBuffers = 2;
+
 int GetDPI(const PrintMsg_Print_Params* print_params) {
 #if defined(OS_MACOSX)
   // On the Mac, the printable area is in points, don't do any scaling based
@@ -622,6 +630,7 @@ PrintWebViewHelper::PrintWebViewHelper(content::RenderFrame* render_frame)
       is_loading_(false),
       is_scripted_preview_delayed_(false),
       ipc_nesting_level_(0),
+      next_spool_sequence_(0),
       weak_ptr_factory_(this) {
 }
 
@@ -647,6 +656,7 @@ bool PrintWebViewHelper::OnMessageReceived(const IPC::Message& message) {
     IPC_MESSAGE_HANDLER(PrintMsg_PrintPages, OnPrintPages)
     IPC_MESSAGE_HANDLER(PrintMsg_PrintingDone, OnPrintingDone)
     IPC_MESSAGE_HANDLER(PrintMsg_PrintPreview, OnPrintPreview)
+    IPC_MESSAGE_HANDLER(PrintMsg_ReleasePageBuffer, OnReleasePageBuffer)
     IPC_MESSAGE_UNHANDLED(handled = false)
     IPC_END_MESSAGE_MAP()
 
@@ -719,6 +729,9 @@ void PrintWebViewHelper::OnPrintPreview(const base::DictionaryValue& settings) {
     return;
   }
   is_print_ready_metafile_sent_ = false;
+  // Cancel any page rendering still pending from an earlier request; the
+  // new preview supersedes it.
+  weak_ptr_factory_.InvalidateWeakPtrs();
   PrepareFrameForPreviewDocument();
 }
 
@@ -752,14 +765,14 @@ void PrintWebViewHelper::OnFramePreparedForPreviewDocument() {
     PrepareFrameForPreviewDocument();
     return;
   }
-  DidFinishPrinting(CreatePreviewDocument() ? OK : FAIL_PREVIEW);
+  if (!CreatePreviewDocument())
+    DidFinishPrinting(FAIL_PREVIEW);
 }
 
 bool PrintWebViewHelper::CreatePreviewDocument() {
   if (!print_pages_params_)
     return false;
 
-  const PrintMsg_Print_Params& print_params = print_pages_params_->params;
   const std::vector<int>& pages = print_pages_params_->pages;
 
   if (!print_preview_context_.CreatePreviewDocument(prep_frame_view_.release(),
@@ -767,31 +780,58 @@ bool PrintWebViewHelper::CreatePreviewDocument() {
     return false;
   }
 
-  while (!print_preview_context_.IsFinalPageRendered()) {
-    int page_number = print_preview_context_.GetNextPageNumber();
-    DCHECK_GE(page_number, 0);
-    if (!RenderPreviewPage(page_number, print_params))
-      return false;
+  // Render one page per message loop iteration rather than all pages in a
+  // single turn, so a long document does not block input and script in
+  // the renderer for the whole generation.
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::Bind(&PrintWebViewHelper::RenderNextPreviewPage,
+                            weak_ptr_factory_.GetWeakPtr()));
+  return true;
+}
 
-    // We must call PrepareFrameAndViewForPrint::FinishPrinting() (by way of
-    // print_preview_context_.AllPagesRendered()) before calling
-    // FinalizePrintReadyDocument() when printing a PDF because the plugin
-    // code does not generate output until we call FinishPrinting().  We do not
-    // generate draft pages for PDFs, so IsFinalPageRendered() and
-    // IsLastPageOfPrintReadyMetafile() will be true in the same iteration of
-    // the loop.
-    if (print_preview_context_.IsFinalPageRendered())
-      print_preview_context_.AllPagesRendered();
-
-    if (print_preview_context_.IsLastPageOfPrintReadyMetafile()) {
-      DCHECK(print_preview_context_.IsModifiable() ||
-             print_preview_context_.IsFinalPageRendered());
-      if (!FinalizePrintReadyDocument())
-        return false;
+void PrintWebViewHelper::RenderNextPreviewPage() {
+  if (!print_pages_params_) {
+    // Printing was cancelled while this task was pending.
+    DidFinishPrinting(FAIL_PREVIEW);
+    return;
+  }
+
+  const PrintMsg_Print_Params& print_params = print_pages_params_->params;
+
+  int page_number = print_preview_context_.GetNextPageNumber();
+  DCHECK_GE(page_number, 0);
+  if (!RenderPreviewPage(page_number, print_params)) {
+    DidFinishPrinting(FAIL_PREVIEW);
+    return;
+  }
+
+  // We must call PrepareFrameAndViewForPrint::FinishPrinting() (by way of
+  // print_preview_context_.AllPagesRendered()) before calling
+  // FinalizePrintReadyDocument() when printing a PDF because the plugin
+  // code does not generate output until we call FinishPrinting().  We do not
+  // generate draft pages for PDFs, so IsFinalPageRendered() and
+  // IsLastPageOfPrintReadyMetafile() will be true for the same page.
+  if (print_preview_context_.IsFinalPageRendered())
+    print_preview_context_.AllPagesRendered();
+
+  if (print_preview_context_.IsLastPageOfPrintReadyMetafile()) {
+    DCHECK(print_preview_context_.IsModifiable() ||
+           print_preview_context_.IsFinalPageRendered());
+    if (!FinalizePrintReadyDocument()) {
+      DidFinishPrinting(FAIL_PREVIEW);
+      return;
     }
   }
+
+  if (!print_preview_context_.IsFinalPageRendered()) {
+    base::ThreadTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::Bind(&PrintWebViewHelper::RenderNextPreviewPage,
+                              weak_ptr_factory_.GetWeakPtr()));
+    return;
+  }
+
   print_preview_context_.Finished();
-  return true;
+  DidFinishPrinting(OK);
 }
 
 bool PrintWebViewHelper::FinalizePrintReadyDocument() {
@@ -1177,6 +1217,60 @@ bool PrintWebViewHelper::CopyMetafileDataToSharedMem(
 }
 #endif  // defined(OS_POSIX)
 
+bool PrintWebViewHelper::SpoolMetafileToSharedMem(
+    const PdfMetafileSkia& metafile,
+    base::SharedMemoryHandle* shared_mem_handle,
+    int* buffer_sequence) {
+  uint32_t buf_size = metafile.GetDataSize();
+  if (buf_size == 0)
+    return false;
+
+  // Prefer the smallest spare buffer that fits the page.
+  std::unique_ptr<base::SharedMemory> shared_buf;
+  size_t best = spare_spool_buffers_.size();
+  for (size_t i = 0; i < spare_spool_buffers_.size(); ++i) {
+    size_t mapped = spare_spool_buffers_[i]->mapped_size();
+    if (mapped >= buf_size &&
+        (best == spare_spool_buffers_.size() ||
+         mapped < spare_spool_buffers_[best]->mapped_size())) {
+      best = i;
+    }
+  }
+  if (best != spare_spool_buffers_.size()) {
+    shared_buf = std::move(spare_spool_buffers_[best]);
+    spare_spool_buffers_.erase(spare_spool_buffers_.begin() + best);
+  } else {
+    // Round the allocation up so nearly-equal page sizes later in the job
+    // reuse this buffer instead of allocating slightly larger ones.
+    uint32_t alloc_size =
+        (buf_size + kSpoolBufferGranularity - 1) / kSpoolBufferGranularity *
+        kSpoolBufferGranularity;
+    shared_buf.reset(content::RenderThread::Get()->HostAllocateSharedMemoryBuffer(
+        alloc_size));
+    if (!shared_buf)
+      return false;
+    if (!shared_buf->Map(alloc_size))
+      return false;
+  }
+
+  if (!metafile.GetData(shared_buf->memory(), buf_size))
+    return false;
+
+  *shared_mem_handle = base::SharedMemory::DuplicateHandle(shared_buf->handle());
+  *buffer_sequence = ++next_spool_sequence_;
+  in_flight_spool_buffers_[*buffer_sequence] = std::move(shared_buf);
+  return true;
+}
+
+void PrintWebViewHelper::OnReleasePageBuffer(int buffer_sequence) {
+  auto iter = in_flight_spool_buffers_.find(buffer_sequence);
+  if (iter == in_flight_spool_buffers_.end())
+    return;
+  if (spare_spool_buffers_.size() < kMaxSpareSpoolBuffers)
+    spare_spool_buffers_.push_back(std::move(iter->second));
+  in_flight_spool_buffers_.erase(iter);
+}
+
 void PrintWebViewHelper::SetPrintPagesParams(
     const PrintMsg_PrintPages_Params& settings) {
   print_pages_params_.reset(new PrintMsg_PrintPages_Params(settings));
@@ -5,6 +5,7 @@
 #ifndef CHROME_RENDERER_PRINTING_PRINT_WEB_VIEW_HELPER_H_
 #define CHROME_RENDERER_PRINTING_PRINT_WEB_VIEW_HELPER_H_
 
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -105,6 +106,7 @@ class PrintWebViewHelper
   void OnPrintingDone(bool success);
 #endif  // !DISABLE_BASIC_PRINTING
   void OnPrintPreview(const base::DictionaryValue& settings);
+  void OnReleasePageBuffer(int buffer_sequence);
 
 
   // Get |page_size| and |content_area| information from
@@ -132,9 +134,14 @@ class PrintWebViewHelper
                          const PrintMsg_Print_Params& print_params);
 
 
-  // Initialize the print preview document.
+  // Initialize the print preview document and schedule rendering of the
+  // first page.
   bool CreatePreviewDocument();
 
+  // Renders the next preview page and re-posts itself until the document
+  // is complete, yielding to the message loop between pages.
+  void RenderNextPreviewPage();
+
   // Main printing code -------------------------------------------------------
 
   void Print(blink::WebLocalFrame* frame,
@@ -227,6 +234,15 @@ class PrintWebViewHelper
   bool CopyMetafileDataToSharedMem(const PdfMetafileSkia& metafile,
                                    base::SharedMemoryHandle* shared_mem_handle);
 
+  // Writes |metafile| into a reusable mapped spool buffer and returns its
+  // handle plus the sequence number identifying the buffer. The buffer is
+  // held in flight until the browser acknowledges the sequence number with
+  // PrintMsg_ReleasePageBuffer, then reused for later pages, so a long job
+  // does not allocate and map a fresh segment per page.
+  bool SpoolMetafileToSharedMem(const PdfMetafileSkia& metafile,
+                                base::SharedMemoryHandle* shared_mem_handle,
+                                int* buffer_sequence);
+
   // Helper method to get page layout in points and fit to page if needed.
   static void ComputePageLayoutInPointsForCss(
       blink::WebLocalFrame* frame,
@@ -379,6 +395,14 @@ class PrintWebViewHelper
   bool is_scripted_preview_delayed_;
   int ipc_nesting_level_;
 
+  // Spool buffers for printed page data, reused across pages of a job.
+  // A buffer moves from |spare_spool_buffers_| to |in_flight_spool_buffers_|
+  // when a page is sent, and back when the browser acknowledges its
+  // sequence number.
+  std::map<int, std::unique_ptr<base::SharedMemory>> in_flight_spool_buffers_;
+  std::vector<std::unique_ptr<base::SharedMemory>> spare_spool_buffers_;
+  int next_spool_sequence_;
+
   PrintPreviewContext print_preview_context_;
 
   // Used to fix a race condition where the source is a PDF and print preview
@@ -94,8 +94,9 @@ bool PrintWebViewHelper::PrintPagesNative(blink::WebLocalFrame* frame,
   metafile.FinishDocument();
 
   PrintHostMsg_DidPrintPage_Params printed_page_params;
-  if (!CopyMetafileDataToSharedMem(
-          metafile, &printed_page_params.metafile_data_handle)) {
+  if (!SpoolMetafileToSharedMem(metafile,
+                                &printed_page_params.metafile_data_handle,
+                                &printed_page_params.buffer_sequence)) {
     return false;
   }
 
@@ -107,6 +108,7 @@ bool PrintWebViewHelper::PrintPagesNative(blink::WebLocalFrame* frame,
     Send(new PrintHostMsg_DidPrintPage(routing_id(), printed_page_params));
     // Send the rest of the pages with an invalid metafile handle.
     printed_page_params.metafile_data_handle.fd = -1;
+    printed_page_params.buffer_sequence = 0;
   }
   return true;
 }
@@ -40,10 +40,11 @@ void PrintWebViewHelper::PrintPageInternal(
   page_params.content_area = content_area_in_dpi;
 
   // Ask the browser to create the shared memory for us.
-  if (!CopyMetafileDataToSharedMem(metafile,
-                                   &(page_params.metafile_data_handle))) {
+  if (!SpoolMetafileToSharedMem(metafile, &(page_params.metafile_data_handle),
+                                &(page_params.buffer_sequence))) {
     // TODO(thestig): Fail and return false instead.
     page_params.data_size = 0;
+    page_params.buffer_sequence = 0;
   }
 
   Send(new PrintHostMsg_DidPrintPage(routing_id(), page_params));
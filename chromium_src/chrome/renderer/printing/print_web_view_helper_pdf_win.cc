@@ -97,8 +97,9 @@ bool PrintWebViewHelper::PrintPagesNative(blink::WebLocalFrame* frame,
   metafile.FinishDocument();
 
   PrintHostMsg_DidPrintPage_Params printed_page_params;
-  if (!CopyMetafileDataToSharedMem(
-          metafile, &printed_page_params.metafile_data_handle)) {
+  if (!SpoolMetafileToSharedMem(metafile,
+                                &printed_page_params.metafile_data_handle,
+                                &printed_page_params.buffer_sequence)) {
     return false;
   }
 
@@ -115,6 +116,7 @@ bool PrintWebViewHelper::PrintPagesNative(blink::WebLocalFrame* frame,
     // Send the rest of the pages with an invalid metafile handle.
     printed_page_params.metafile_data_handle.Close();
     printed_page_params.metafile_data_handle = base::SharedMemoryHandle();
+    printed_page_params.buffer_sequence = 0;
   }
   return true;
 }
@@ -9,7 +9,7 @@
 #include <map>
 #include <string>
 
-#include "base/i18n/break_iterator.h"
+#include "base/lazy_instance.h"
 #include "base/logging.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
@@ -18,6 +18,49 @@
 #include "third_party/icu/source/common/unicode/uscript.h"
 #include "third_party/icu/source/i18n/unicode/ulocdata.h"
 
+namespace {
+
+// Compiled ICU break-iterator rules, keyed by the rule-set string (which
+// encodes both the language script and the contraction mode). Compiling a
+// rule set costs several milliseconds, which users switching between
+// languages in one document pay on every switch, so the compiled form is
+// kept for the process lifetime. Iterators clone from it with
+// ubrk_safeClone(), which shares the compiled rule data instead of
+// recompiling or copying it.
+class BreakIteratorCache {
+ public:
+  BreakIteratorCache() {}
+
+  UBreakIterator* CloneForRules(const base::string16& rules) {
+    UErrorCode status = U_ZERO_ERROR;
+    std::map<base::string16, UBreakIterator*>::iterator it =
+        compiled_rules_.find(rules);
+    if (it == compiled_rules_.end()) {
+      UParseError parse_error;
+      UBreakIterator* compiled = ubrk_openRules(
+          rules.c_str(), static_cast<int32_t>(rules.length()),
+          NULL, 0, &parse_error, &status);
+      if (U_FAILURE(status) || !compiled)
+        return NULL;
+      it = compiled_rules_.insert(std::make_pair(rules, compiled)).first;
+    }
+    UBreakIterator* clone = ubrk_safeClone(it->second, NULL, NULL, &status);
+    if (U_FAILURE(status))
+      return NULL;
+    return clone;
+  }
+
+ private:
+  std::map<base::string16, UBreakIterator*> compiled_rules_;
+
+  DISALLOW_COPY_AND_ASSIGN(BreakIteratorCache);
+};
+
+base::LazyInstance<BreakIteratorCache>::Leaky g_break_iterator_cache =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
 // SpellcheckCharAttribute implementation:
 
 SpellcheckCharAttribute::SpellcheckCharAttribute()
@@ -303,7 +346,7 @@ bool SpellcheckCharAttribute::OutputDefault(UChar c,
 SpellcheckWordIterator::SpellcheckWordIterator()
     : text_(NULL),
       attribute_(NULL),
-      iterator_() {
+      iterator_(NULL) {
 }
 
 SpellcheckWordIterator::~SpellcheckWordIterator() {
@@ -313,7 +356,7 @@ SpellcheckWordIterator::~SpellcheckWordIterator() {
 bool SpellcheckWordIterator::Initialize(
     const SpellcheckCharAttribute* attribute,
     bool allow_contraction) {
-  // Create a custom ICU break iterator with empty text used in this object. (We
+  // Clone a custom ICU break iterator from the cached compiled rules. (We
   // allow setting text later so we can re-use this iterator.)
   DCHECK(attribute);
   const base::string16 rule(attribute->GetRuleSet(allow_contraction));
@@ -322,16 +365,16 @@ bool SpellcheckWordIterator::Initialize(
   if (rule.empty())
     return false;
 
-  std::unique_ptr<base::i18n::BreakIterator> iterator(
-      new base::i18n::BreakIterator(base::string16(), rule));
-  if (!iterator->Init()) {
-    // Since we're not passing in any text, the only reason this could fail
-    // is if we fail to parse the rules. Since the rules are hardcoded,
-    // that would be a bug in this class.
+  UBreakIterator* iterator = g_break_iterator_cache.Get().CloneForRules(rule);
+  if (!iterator) {
+    // The only reason compilation could fail is if we fail to parse the
+    // rules. Since the rules are hardcoded, that would be a bug in this
+    // class.
     NOTREACHED() << "failed to open iterator (broken rules)";
     return false;
   }
-  iterator_ = std::move(iterator);
+  Reset();
+  iterator_ = iterator;
 
   // Set the character attributes so we can normalize the words extracted by
   // this iterator.
@@ -348,7 +391,9 @@ bool SpellcheckWordIterator::SetText(const base::char16* text, size_t length) {
   DCHECK(!!iterator_);
 
   // Set the text to be split by this iterator.
-  if (!iterator_->SetText(text, length)) {
+  UErrorCode status = U_ZERO_ERROR;
+  ubrk_setText(iterator_, text, static_cast<int32_t>(length), &status);
+  if (U_FAILURE(status)) {
     LOG(ERROR) << "failed to set text";
     return false;
   }
@@ -375,10 +420,11 @@ bool SpellcheckWordIterator::GetNextWord(base::string16* word_string,
   // spellchecker language) so this ubrk_getRuleStatus() call returns
   // UBRK_WORD_NONE when this iterator finds an invalid word. So, we skip such
   // words until we can find a valid word or reach the end of the input string.
-  while (iterator_->Advance()) {
-    const size_t start = iterator_->prev();
-    const size_t length = iterator_->pos() - start;
-    if (iterator_->IsWord()) {
+  int32_t start = ubrk_current(iterator_);
+  for (int32_t end = ubrk_next(iterator_); end != UBRK_DONE;
+       start = end, end = ubrk_next(iterator_)) {
+    if (ubrk_getRuleStatus(iterator_) != UBRK_WORD_NONE) {
+      const int32_t length = end - start;
       if (Normalize(start, length, word_string)) {
         *word_start = start;
         *word_length = length;
@@ -392,7 +438,10 @@ bool SpellcheckWordIterator::GetNextWord(base::string16* word_string,
 }
 
 void SpellcheckWordIterator::Reset() {
-  iterator_.reset();
+  if (iterator_) {
+    ubrk_close(iterator_);
+    iterator_ = NULL;
+  }
 }
 
 bool SpellcheckWordIterator::Normalize(int input_start,
@@ -9,19 +9,13 @@
 #ifndef CHROME_RENDERER_SPELLCHECKER_SPELLCHECK_WORDITERATOR_H_
 #define CHROME_RENDERER_SPELLCHECKER_SPELLCHECK_WORDITERATOR_H_
 
-#include <memory>
 #include <string>
 
 #include "base/macros.h"
 #include "base/strings/string16.h"
+#include "third_party/icu/source/common/unicode/ubrk.h"
 #include "third_party/icu/source/common/unicode/uscript.h"
 
-namespace base {
-namespace i18n {
-class BreakIterator;
-} // namespace i18n
-} // namespace base
-
 // A class which encapsulates language-specific operations used by
 // SpellcheckWordIterator. When we set the spellchecker language, this class
 // creates rule sets that filter out the characters not supported by the
@@ -117,8 +111,10 @@ class SpellcheckWordIterator {
 
   // Initializes a word-iterator object with the language-specific attribute. If
   // we need to split contractions and concatenated words, call this function
-  // with its 'allow_contraction' parameter false. (This function uses lots of
-  // temporal memory to compile a custom word-break rule into an automaton.)
+  // with its 'allow_contraction' parameter false. (Compiling a custom
+  // word-break rule into an automaton is expensive, so compiled rules are
+  // cached per language for the process lifetime and only the first
+  // initialization for a language pays the compilation cost.)
   bool Initialize(const SpellcheckCharAttribute* attribute,
                   bool allow_contraction);
 
@@ -166,8 +162,9 @@ class SpellcheckWordIterator {
   // characters.
   const SpellcheckCharAttribute* attribute_;
 
-  // The break iterator.
-  std::unique_ptr<base::i18n::BreakIterator> iterator_;
+  // The break iterator, cloned from a compiled rule set shared by all the
+  // iterators for the same language.
+  UBreakIterator* iterator_;
 
   DISALLOW_COPY_AND_ASSIGN(SpellcheckWordIterator);
 };
@@ -4,7 +4,9 @@
 
 #include "chrome/renderer/tts_dispatcher.h"
 
+#include "base/bind.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "chrome/common/tts_messages.h"
 #include "chrome/common/tts_utterance_request.h"
 #include "content/public/renderer/render_thread.h"
@@ -24,7 +26,8 @@ using blink::WebVector;
 int TtsDispatcher::next_utterance_id_ = 1;
 
 TtsDispatcher::TtsDispatcher(WebSpeechSynthesizerClient* client)
-    : synthesizer_client_(client) {
+    : synthesizer_client_(client),
+      weak_ptr_factory_(this) {
   RenderThread::Get()->AddObserver(this);
 }
 
@@ -41,6 +44,7 @@ bool TtsDispatcher::OnControlMessageReceived(const IPC::Message& message) {
     IPC_MESSAGE_HANDLER(TtsMsg_DidResumeSpeaking, OnDidResumeSpeaking)
     IPC_MESSAGE_HANDLER(TtsMsg_WordBoundary, OnWordBoundary)
     IPC_MESSAGE_HANDLER(TtsMsg_SentenceBoundary, OnSentenceBoundary)
+    IPC_MESSAGE_HANDLER(TtsMsg_BoundaryEvents, OnBoundaryEvents)
     IPC_MESSAGE_HANDLER(TtsMsg_MarkerEvent, OnMarkerEvent)
     IPC_MESSAGE_HANDLER(TtsMsg_WasInterrupted, OnWasInterrupted)
     IPC_MESSAGE_HANDLER(TtsMsg_WasCancelled, OnWasCancelled)
@@ -69,18 +73,40 @@ void TtsDispatcher::speak(const WebSpeechSynthesisUtterance& web_utterance) {
   utterance.volume = web_utterance.volume();
   utterance.rate = web_utterance.rate();
   utterance.pitch = web_utterance.pitch();
-  RenderThread::Get()->Send(new TtsHostMsg_Speak(utterance));
+
+  // Utterances queued in the same message loop turn go to the browser in
+  // one batch; rapid short utterances otherwise pay an IPC round trip
+  // each, which shows up as audible gaps between them.
+  if (pending_utterances_.empty()) {
+    base::ThreadTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE,
+        base::Bind(&TtsDispatcher::FlushPendingUtterances,
+                   weak_ptr_factory_.GetWeakPtr()));
+  }
+  pending_utterances_.push_back(utterance);
+}
+
+void TtsDispatcher::FlushPendingUtterances() {
+  if (pending_utterances_.empty())
+    return;
+  RenderThread::Get()->Send(new TtsHostMsg_SpeakBatch(pending_utterances_));
+  pending_utterances_.clear();
 }
 
 void TtsDispatcher::pause() {
+  FlushPendingUtterances();
   RenderThread::Get()->Send(new TtsHostMsg_Pause());
 }
 
 void TtsDispatcher::resume() {
+  FlushPendingUtterances();
   RenderThread::Get()->Send(new TtsHostMsg_Resume());
 }
 
 void TtsDispatcher::cancel() {
+  // Flush first so queued utterances reach the browser and get cancelled
+  // events instead of silently disappearing.
+  FlushPendingUtterances();
   RenderThread::Get()->Send(new TtsHostMsg_Cancel());
 }
 
@@ -163,6 +189,16 @@ void TtsDispatcher::OnSentenceBoundary(int utterance_id, int char_index) {
       utterance, static_cast<unsigned>(char_index));
 }
 
+void TtsDispatcher::OnBoundaryEvents(
+    const std::vector<TtsBoundaryEvent>& events) {
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (events[i].is_sentence)
+      OnSentenceBoundary(events[i].utterance_id, events[i].char_index);
+    else
+      OnWordBoundary(events[i].utterance_id, events[i].char_index);
+  }
+}
+
 void TtsDispatcher::OnMarkerEvent(int utterance_id, int char_index) {
   // Not supported yet.
 }
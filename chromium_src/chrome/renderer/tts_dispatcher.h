@@ -8,6 +8,8 @@
 #include <vector>
 
 #include "base/containers/hash_tables.h"
+#include "base/memory/weak_ptr.h"
+#include "chrome/common/tts_utterance_request.h"
 #include "content/public/renderer/render_thread_observer.h"
 #include "third_party/WebKit/public/platform/WebSpeechSynthesizer.h"
 #include "third_party/WebKit/public/platform/WebSpeechSynthesizerClient.h"
@@ -16,8 +18,6 @@ namespace IPC {
 class Message;
 }
 
-struct TtsVoice;
-
 // TtsDispatcher is a delegate for methods used by Blink for speech synthesis
 // APIs. It's the complement of TtsDispatcherHost (owned by RenderViewHost).
 // Each TtsDispatcher is owned by the WebSpeechSynthesizerClient in Blink;
@@ -47,7 +47,13 @@ class TtsDispatcher
 
   blink::WebSpeechSynthesisUtterance FindUtterance(int utterance_id);
 
+  // Sends the utterances queued by speak() since the last flush in one
+  // batched IPC. Called from a posted task, and before any control
+  // message so ordering is preserved.
+  void FlushPendingUtterances();
+
   void OnSetVoiceList(const std::vector<TtsVoice>& voices);
+  void OnBoundaryEvents(const std::vector<TtsBoundaryEvent>& events);
   void OnDidStartSpeaking(int utterance_id);
   void OnDidFinishSpeaking(int utterance_id);
   void OnDidPauseSpeaking(int utterance_id);
@@ -70,6 +76,12 @@ class TtsDispatcher
   // Map from id to utterance objects.
   base::hash_map<int, blink::WebSpeechSynthesisUtterance> utterance_id_map_;
 
+  // Utterances queued by speak() in the current message loop turn,
+  // flushed in one TtsHostMsg_SpeakBatch.
+  std::vector<TtsUtteranceRequest> pending_utterances_;
+
+  base::WeakPtrFactory<TtsDispatcher> weak_ptr_factory_;
+
   DISALLOW_COPY_AND_ASSIGN(TtsDispatcher);
 };
 
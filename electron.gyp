@@ -362,6 +362,41 @@
         }],  # OS=="linux"
       ],
     },  # target <(product_name)_lib
+    {
+      # Native microbenchmarks for converter, ipc and asar hot paths. Run
+      # with --output=results.json to archive the numbers for trend
+      # tracking.
+      'target_name': 'electron_benchmarks',
+      'type': 'executable',
+      'dependencies': [
+        '<(project_name)_lib',
+      ],
+      'sources': [
+        'atom/benchmarks/asar_benchmark.cc',
+        'atom/benchmarks/benchmark.cc',
+        'atom/benchmarks/benchmark.h',
+        'atom/benchmarks/benchmark_main.cc',
+        'atom/benchmarks/v8_value_converter_benchmark.cc',
+      ],
+      'include_dirs': [
+        '.',
+      ],
+    },  # target electron_benchmarks
+    {
+      # End-to-end latency harness. Unlike electron_benchmarks this drives
+      # the real binary: the JavaScript harness in spec/perf boots
+      # BrowserWindows and measures ipc round trips, asar reads, webRequest
+      # interception, offscreen frame delivery and window-open time. Run
+      # with:
+      #   ./out/D/electron spec/perf --output=results.json
+      # The target itself only makes sure the binary the harness drives is
+      # built.
+      'target_name': 'electron_perf_tests',
+      'type': 'none',
+      'dependencies': [
+        '<(project_name)',
+      ],
+    },  # target electron_perf_tests
     {
       'target_name': 'js2asar',
       'type': 'none',
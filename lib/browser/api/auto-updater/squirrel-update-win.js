@@ -81,9 +81,12 @@ exports.processStart = function () {
   return spawnUpdate(['--processStartAndWait', exeName], true, function () {})
 }
 
-// Download the releases specified by the URL and write new results to stdout.
-exports.download = function (updateURL, callback) {
-  return spawnUpdate(['--download', updateURL], false, function (error, stdout) {
+// Check for updates available at the URL and write new results to stdout.
+// This only fetches the RELEASES manifest; the packages themselves are
+// downloaded by the `--update` pass, which prefers delta packages when the
+// feed publishes them, so nothing gets transferred twice.
+exports.checkForUpdate = function (updateURL, callback) {
+  return spawnUpdate(['--checkForUpdate', updateURL], false, function (error, stdout) {
     var json, ref, ref1, update
     if (error != null) {
       return callback(error)
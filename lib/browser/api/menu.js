@@ -250,6 +250,23 @@ Menu.prototype.insert = function (pos, item) {
     this.setRole(pos, item.role)
   }
 
+  // Update the label of the native item in place when it changes, instead of
+  // requiring the whole menu to be rebuilt.
+  v8Util.setHiddenValue(item, 'label', item.label)
+  Object.defineProperty(item, 'label', {
+    enumerable: true,
+    get: function () {
+      return v8Util.getHiddenValue(item, 'label')
+    },
+    set: (label) => {
+      v8Util.setHiddenValue(item, 'label', label)
+      const index = this.getIndexOfCommandId(item.commandId)
+      if (index >= 0) {
+        this.setLabel(index, label)
+      }
+    }
+  })
+
   // Make menu accessable to items.
   item.overrideReadOnlyProperty('menu', this)
 
@@ -19,6 +19,7 @@ ipcMain.on('ELECTRON_SYNC_NAVIGATION_CONTROLLER', function (event, method, ...ar
 var NavigationController = (function () {
   function NavigationController (webContents) {
     this.webContents = webContents
+    this.historyLimit = 0
     this.clearHistory()
 
     // webContents may have already navigated to a page.
@@ -48,9 +49,53 @@ var NavigationController = (function () {
         this.currentIndex++
         this.history.push(url)
       }
+      this.trimHistory()
     })
   }
 
+  NavigationController.prototype.trimHistory = function () {
+    if (this.historyLimit <= 0 || this.history.length <= this.historyLimit) {
+      return
+    }
+    const overflow = this.history.length - this.historyLimit
+    this.history.splice(0, overflow)
+    this.currentIndex = Math.max(this.currentIndex - overflow, 0)
+    if (this.pendingIndex > -1) {
+      this.pendingIndex = Math.max(this.pendingIndex - overflow, 0)
+    }
+    if (this.inPageIndex > -1) {
+      this.inPageIndex = Math.max(this.inPageIndex - overflow, 0)
+    }
+  }
+
+  NavigationController.prototype.setHistoryLimit = function (limit) {
+    this.historyLimit = limit
+    this.trimHistory()
+    this.webContents._setHistoryLimit(limit)
+  }
+
+  NavigationController.prototype.serializeHistory = function () {
+    return {
+      history: this.history.slice(),
+      currentIndex: this.currentIndex,
+      state: this.webContents._serializeHistory()
+    }
+  }
+
+  NavigationController.prototype.restoreHistory = function (snapshot) {
+    if (snapshot == null || !Array.isArray(snapshot.history)) {
+      return false
+    }
+    this.history = snapshot.history.slice()
+    this.currentIndex = Math.min(Math.max(snapshot.currentIndex, 0), this.history.length - 1)
+    this.pendingIndex = -1
+    this.inPageIndex = -1
+    if (snapshot.state != null) {
+      return this.webContents._restoreHistory(snapshot.state)
+    }
+    return true
+  }
+
   NavigationController.prototype.loadURL = function (url, options) {
     if (options == null) {
       options = {}
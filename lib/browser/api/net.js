@@ -326,6 +326,30 @@ class ClientRequest extends EventEmitter {
     return this._write(data, encoding, callback, false)
   }
 
+  uploadFile (fd, offset, length) {
+    if (typeof fd !== 'number') {
+      throw new TypeError('First argument must be a file descriptor.')
+    }
+
+    if (this.chunkedEncoding) {
+      throw new Error('Can\'t upload a file with chunked transfer encoding.')
+    }
+
+    if (this.urlRequest.finished) {
+      let error = new Error('Write after end.')
+      process.nextTick(writeAfterEndNT, this, error, null)
+      return true
+    }
+
+    if (offset == null) offset = 0
+    if (length == null) length = -1
+
+    // The file region is appended to the request body and streamed by the
+    // network IO thread directly from the already-open file, it is not
+    // re-read through JS. The request is not sent until end() is called.
+    return this.urlRequest.uploadFile(fd, offset, length, false)
+  }
+
   end (data, encoding, callback) {
     if (this.urlRequest.finished) {
       return false
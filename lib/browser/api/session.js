@@ -1,4 +1,5 @@
 const {EventEmitter} = require('events')
+const {Readable} = require('stream')
 const {app} = require('electron')
 const {fromPartition, Session, Cookies} = process.atomBinding('session')
 
@@ -21,6 +22,38 @@ Session.prototype._init = function () {
   app.emit('session-created', this)
 }
 
+Session.prototype.readBlob = function (identifier, options, callback) {
+  if (typeof options === 'function') {
+    callback = options
+    options = null
+  }
+  if (options == null || !options.stream) {
+    return this.getBlobData(identifier, callback)
+  }
+
+  // Chunks are read from the blob storage context on the IO thread and
+  // pushed straight into the stream; the native reader parks after each
+  // chunk until the stream asks for more.
+  let handle = null
+  const stream = new Readable({
+    read () {
+      if (handle != null) {
+        handle.resume()
+      }
+    }
+  })
+  stream.destroy = function () {
+    if (handle != null) {
+      handle.abort()
+    }
+    stream.push(null)
+  }
+  handle = this.streamBlobData(identifier, {chunkSize: options.chunkSize}, (chunk) => {
+    stream.push(chunk)
+  })
+  return stream
+}
+
 Session.prototype.setCertificateVerifyProc = function (verifyProc) {
   if (verifyProc != null && verifyProc.length > 2) {
     // TODO(kevinsawicki): Remove in 2.0, deprecate before then with warnings
@@ -174,6 +174,16 @@ WebContents.prototype.executeJavaScript = function (code, hasUserGesture, callba
 // Translate the options of printToPDF.
 WebContents.prototype.printToPDF = function (options, callback) {
   const printingSetting = Object.assign({}, defaultPrintingSetting)
+  printingSetting.requestID = getNextId()
+  if (options.priority) {
+    printingSetting.schedulerPriority = options.priority
+  }
+  if (options.timeout) {
+    printingSetting.schedulerTimeout = options.timeout
+  }
+  if (options.concurrency) {
+    printingSetting.schedulerConcurrency = options.concurrency
+  }
   if (options.landscape) {
     printingSetting.landscape = options.landscape
   }
@@ -246,6 +256,13 @@ WebContents.prototype._init = function () {
   this.on('ipc-message', function (event, [channel, ...args]) {
     ipcMain.emit(channel, event, ...args)
   })
+  // Messages coalesced by ipcRenderer.setBatching() arrive as one array of
+  // [channel, ...args] entries and are unpacked here.
+  this.on('ipc-message-batch', function (event, [batch]) {
+    for (const [channel, ...args] of batch) {
+      ipcMain.emit(channel, event, ...args)
+    }
+  })
   this.on('ipc-message-sync', function (event, [channel, ...args]) {
     Object.defineProperty(event, 'returnValue', {
       set: function (value) {
@@ -278,6 +278,12 @@ const watchEmbedder = function (embedder) {
 
   // Forward embedder window visiblity change events to guest
   const onVisibilityChange = function (visibilityState) {
+    // Show or hide all the embedder's guests with one native call.
+    if (webViewManager == null) {
+      webViewManager = process.atomBinding('web_view_manager')
+    }
+    webViewManager.setGuestsVisibility(embedder, visibilityState === 'visible')
+
     for (const guestInstanceId of Object.keys(guestInstances)) {
       const guestInstance = guestInstances[guestInstanceId]
       if (guestInstance.embedder === embedder) {
@@ -320,6 +326,16 @@ ipcMain.on('ELECTRON_GUEST_VIEW_MANAGER_CREATE_GUEST', function (event, params,
   event.sender.send(`ELECTRON_RESPONSE_${requestId}`, createGuest(event.sender, params))
 })
 
+// Create and attach in one transaction, saving a round trip per webview when
+// the element is already in the DOM. The guest is registered with the web
+// view manager before the response is sent, so the BrowserPlugin attach that
+// follows resolves its route with a plain lookup.
+ipcMain.on('ELECTRON_GUEST_VIEW_MANAGER_CREATE_AND_ATTACH_GUEST', function (event, elementInstanceId, params, requestId) {
+  const guestInstanceId = createGuest(event.sender, params)
+  attachGuest(event, elementInstanceId, guestInstanceId, params)
+  event.sender.send(`ELECTRON_RESPONSE_${requestId}`, guestInstanceId)
+})
+
 ipcMain.on('ELECTRON_GUEST_VIEW_MANAGER_ATTACH_GUEST', function (event, elementInstanceId, guestInstanceId, params) {
   attachGuest(event, elementInstanceId, guestInstanceId, params)
 })
@@ -150,6 +150,16 @@ app.setPath('userData', path.join(app.getPath('appData'), app.getName()))
 app.setPath('userCache', path.join(app.getPath('cache'), app.getName()))
 app.setAppPath(packagePath)
 
+// Cache compiled code of the app's modules so later launches skip
+// parsing them. Opt-in since it replaces Module.prototype._compile; the
+// cache directory is resolved at first compile, so setPath calls made by
+// the app's main script still take effect.
+if (process.env.ELECTRON_ENABLE_COMPILE_CACHE) {
+  require('../common/compile-cache').install(function () {
+    return path.join(app.getPath('userData'), 'CompileCache')
+  })
+}
+
 // Load the chrome extension support.
 require('./chrome-extension')
 
@@ -159,6 +169,16 @@ require('./desktop-capturer')
 // Load protocol module to ensure it is populated on app ready
 require('./api/protocol')
 
+// Warm the default session as soon as the app is ready: creating it
+// loads prefs, and the cookie touch kicks the request context and cookie
+// store initialization on the IO thread, overlapping that work with app
+// startup instead of paying for it when the first window issues its
+// first request. Registered before the app's own listeners so it runs
+// first, after any setPath calls made while loading the main script.
+app.once('ready', function () {
+  require('electron').session.defaultSession.cookies.get({}, function () {})
+})
+
 // Set main startup script of the app.
 const mainStartupScript = packageJson.main || 'index.js'
 
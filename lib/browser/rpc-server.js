@@ -390,8 +390,12 @@ ipcMain.on('ELECTRON_BROWSER_MEMBER_GET', function (event, id, name) {
   }
 })
 
-ipcMain.on('ELECTRON_BROWSER_DEREFERENCE', function (event, id) {
-  objectsRegistry.remove(event.sender.getId(), id)
+ipcMain.on('ELECTRON_BROWSER_DEREFERENCE', function (event, ids) {
+  // Dereferences are batched per GC cycle on the renderer side.
+  if (!Array.isArray(ids)) ids = [ids]
+  for (const id of ids) {
+    objectsRegistry.remove(event.sender.getId(), id)
+  }
 })
 
 ipcMain.on('ELECTRON_BROWSER_CONTEXT_RELEASE', (e) => {
@@ -0,0 +1,137 @@
+'use strict'
+
+// Persists V8's compiled-code cache for app modules between launches.
+// Compiling a large app from source costs hundreds of milliseconds on
+// every start; V8 can serialize the compiled code and reuse it as long
+// as the source and V8 version still match. Entries are keyed by a hash
+// of (V8 version, file path, source), so a changed file or an Electron
+// upgrade simply misses the cache and the entry is rewritten. Opt-in via
+// the ELECTRON_ENABLE_COMPILE_CACHE environment variable, since
+// installing it replaces Module.prototype._compile.
+
+const crypto = require('crypto')
+const fs = require('fs')
+const path = require('path')
+const vm = require('vm')
+const Module = require('module')
+
+// Called at first compile to locate the cache, so path changes made by
+// the app's main script (e.g. app.setPath('userData', ...)) still take
+// effect.
+let resolveCacheDirectory = null
+let cacheDirectory = null
+let resolvedArgv = null
+
+const getCacheDirectory = function () {
+  if (cacheDirectory == null) {
+    cacheDirectory = resolveCacheDirectory()
+  }
+  return cacheDirectory
+}
+
+const cachePathFor = function (filename, source) {
+  const hash = crypto.createHash('sha1')
+  hash.update(process.versions.v8)
+  hash.update(filename)
+  hash.update(source)
+  return path.join(getCacheDirectory(), hash.digest('hex') + '.cache')
+}
+
+const readCachedData = function (cachePath) {
+  try {
+    return fs.readFileSync(cachePath)
+  } catch (error) {
+    return null
+  }
+}
+
+const writeCachedData = function (cachePath, cachedData) {
+  // Best effort: a failed write only means the next launch compiles
+  // from source again.
+  try {
+    fs.writeFileSync(cachePath, cachedData)
+  } catch (error) {
+    try {
+      fs.mkdirSync(getCacheDirectory())
+      fs.writeFileSync(cachePath, cachedData)
+    } catch (error) {
+      // Ignore.
+    }
+  }
+}
+
+// Equivalent of the require function node passes to module wrappers,
+// built from public Module APIs since the internal helper is not
+// exposed.
+const makeRequireFunction = function (module) {
+  const require = function (request) {
+    return module.require(request)
+  }
+  require.resolve = function (request) {
+    return Module._resolveFilename(request, module)
+  }
+  require.main = process.mainModule
+  require.extensions = Module._extensions
+  require.cache = Module._cache
+  return require
+}
+
+// Install the cache and redirect module compilation through it. Only
+// modules loaded after this call are affected, so Electron's own
+// already-loaded modules are left alone. |resolveDirectory| is called
+// lazily at first compile to get the cache directory.
+exports.install = function (resolveDirectory) {
+  resolveCacheDirectory = resolveDirectory
+
+  Module.prototype._compile = function (content, filename) {
+    // Remove shebang, like the original _compile does.
+    content = content.replace(/^#!.*/, '')
+
+    const cachePath = cachePathFor(filename, content)
+    const cachedData = readCachedData(cachePath)
+    const script = new vm.Script(Module.wrap(content), {
+      filename: filename,
+      lineOffset: 0,
+      displayErrors: true,
+      cachedData: cachedData,
+      produceCachedData: cachedData == null
+    })
+    if (script.cachedDataProduced) {
+      writeCachedData(cachePath, script.cachedData)
+    } else if (script.cachedDataRejected) {
+      // V8 refused the blob, so it can only be corrupt; the key already
+      // covers source and V8 version. Drop it and recompile next launch.
+      try {
+        fs.unlinkSync(cachePath)
+      } catch (error) {
+        // Ignore.
+      }
+    }
+
+    const compiledWrapper = script.runInThisContext({displayErrors: true})
+
+    // Replicate node's break-on-first-line handling so --debug-brk still
+    // stops in the app's main module; node versions differ on the flag
+    // name, so clear whichever is set.
+    if ((process._breakFirstLine || process._debugWaitConnect) &&
+        process._eval == null) {
+      if (!resolvedArgv) {
+        if (process.argv[1]) {
+          resolvedArgv = Module._resolveFilename(process.argv[1], null)
+        } else {
+          resolvedArgv = 'repl'
+        }
+      }
+      if (filename === resolvedArgv) {
+        delete process._breakFirstLine
+        delete process._debugWaitConnect
+        const Debug = vm.runInDebugContext('Debug')
+        Debug.setBreakPoint(compiledWrapper, 0, 0)
+      }
+    }
+
+    return compiledWrapper.call(
+        this.exports, this.exports, makeRequireFunction(this), this, filename,
+        path.dirname(filename))
+  }
+}
@@ -6,7 +6,37 @@ const v8Util = process.atomBinding('v8_util')
 // Created by init.js.
 const ipcRenderer = v8Util.getHiddenValue(global, 'ipc')
 
+// Channels opted into batching accumulate their messages and flush them in
+// one IPC per tick, which avoids a browser-process wakeup per message on
+// high-frequency channels.
+const batchedChannels = new Set()
+let pendingBatch = null
+
+const flushBatch = function () {
+  const batch = pendingBatch
+  pendingBatch = null
+  if (batch != null && batch.length > 0) {
+    binding.send('ipc-message-batch', [batch])
+  }
+}
+
+ipcRenderer.setBatching = function (channel, enabled = true) {
+  if (enabled) {
+    batchedChannels.add(channel)
+  } else {
+    batchedChannels.delete(channel)
+  }
+}
+
 ipcRenderer.send = function (...args) {
+  if (batchedChannels.has(args[0])) {
+    if (pendingBatch == null) {
+      pendingBatch = []
+      setImmediate(flushBatch)
+    }
+    pendingBatch.push(args)
+    return
+  }
   return binding.send('ipc-message', args)
 }
 
@@ -100,6 +100,12 @@ module.exports = {
     ipcRenderer.send('ELECTRON_GUEST_VIEW_MANAGER_CREATE_GUEST', params, requestId)
     ipcRenderer.once(`ELECTRON_RESPONSE_${requestId}`, callback)
   },
+  createAndAttachGuest: function (elementInstanceId, params, callback) {
+    requestId++
+    ipcRenderer.send('ELECTRON_GUEST_VIEW_MANAGER_CREATE_AND_ATTACH_GUEST', elementInstanceId, params, requestId)
+    ipcRenderer.once(`ELECTRON_RESPONSE_${requestId}`, callback)
+    webFrame.attachGuest(elementInstanceId)
+  },
   attachGuest: function (elementInstanceId, guestInstanceId, params) {
     ipcRenderer.send('ELECTRON_GUEST_VIEW_MANAGER_ATTACH_GUEST', elementInstanceId, guestInstanceId, params)
     webFrame.attachGuest(elementInstanceId)
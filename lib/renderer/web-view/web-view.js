@@ -166,7 +166,18 @@ class WebViewImpl {
   }
 
   createGuest () {
-    return guestViewInternal.createGuest(this.buildParams(), (event, guestInstanceId) => {
+    const params = this.buildParams()
+
+    // When the element is already in the DOM the guest can be created and
+    // attached in a single browser-side transaction, instead of waiting for
+    // the creation round trip before sending the attach parameters.
+    if (this.internalInstanceId) {
+      return guestViewInternal.createAndAttachGuest(this.internalInstanceId, params, (event, guestInstanceId) => {
+        this.attachGuestInstance(guestInstanceId, true)
+      })
+    }
+
+    return guestViewInternal.createGuest(params, (event, guestInstanceId) => {
       this.attachGuestInstance(guestInstanceId)
     })
   }
@@ -235,11 +246,11 @@ class WebViewImpl {
     return params
   }
 
-  attachGuestInstance (guestInstanceId) {
+  attachGuestInstance (guestInstanceId, alreadyAttached) {
     this.guestInstanceId = guestInstanceId
     this.attributes[webViewConstants.ATTRIBUTE_GUESTINSTANCE].setValueIgnoreMutation(guestInstanceId)
     this.webContents = remote.getGuestWebContents(this.guestInstanceId)
-    if (!this.internalInstanceId) {
+    if (alreadyAttached || !this.internalInstanceId) {
       return true
     }
     return guestViewInternal.attachGuest(this.internalInstanceId, this.guestInstanceId, this.buildParams())
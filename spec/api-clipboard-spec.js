@@ -85,6 +85,31 @@ describe('clipboard module', function () {
     })
   })
 
+  describe('clipboard.readMany(formats, callback)', function () {
+    it('reads multiple formats in one pass', function (done) {
+      var text = 'test'
+      var markup = process.platform === 'darwin' ? "<meta charset='utf-8'><b>Hi</b>" : process.platform === 'linux' ? '<meta http-equiv="content-type" ' + 'content="text/html; charset=utf-8"><b>Hi</b>' : '<b>Hi</b>'
+      clipboard.write({
+        text: 'test',
+        html: '<b>Hi</b>'
+      })
+      clipboard.readMany(['text', 'html'], function (data) {
+        assert.equal(data.text, text)
+        assert.equal(data.html, markup)
+        done()
+      })
+    })
+
+    it('omits formats that are not on the clipboard', function (done) {
+      clipboard.writeText('only text')
+      clipboard.readMany(['text', 'rtf'], function (data) {
+        assert.equal(data.text, 'only text')
+        assert(!('rtf' in data))
+        done()
+      })
+    })
+  })
+
   describe('clipboard.read/writeFindText(text)', function () {
     it('reads and write text to the find pasteboard', function () {
       if (process.platform !== 'darwin') return
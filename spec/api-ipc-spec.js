@@ -387,6 +387,23 @@ describe('ipc module', function () {
       ipcRenderer.send('message', obj)
     })
 
+    it('delivers batched messages in order', function (done) {
+      const received = []
+      ipcRenderer.on('message', function (event, value) {
+        received.push(value)
+        if (received.length === 3) {
+          ipcRenderer.removeAllListeners('message')
+          ipcRenderer.setBatching('message', false)
+          assert.deepEqual(received, [1, 2, 3])
+          done()
+        }
+      })
+      ipcRenderer.setBatching('message')
+      ipcRenderer.send('message', 1)
+      ipcRenderer.send('message', 2)
+      ipcRenderer.send('message', 3)
+    })
+
     it('can send instances of Date', function (done) {
       const currentDate = new Date()
       ipcRenderer.once('message', function (event, value) {
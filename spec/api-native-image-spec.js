@@ -217,6 +217,32 @@ describe('nativeImage module', () => {
       assert(good.toPNG().length <= better.toPNG().length)
       assert(better.toPNG().length < best.toPNG().length)
     })
+
+    it('supports the fast quality option', () => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'))
+      const fast = image.resize({width: 100, height: 100, quality: 'fast'})
+      assert.deepEqual(fast.getSize(), {width: 100, height: 100})
+      assert(!fast.isEmpty())
+    })
+  })
+
+  describe('resizeAsync(options, callback)', () => {
+    it('calls back with a resized image', (done) => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'))
+      image.resizeAsync({width: 269}, (resized) => {
+        assert.deepEqual(resized.getSize(), {width: 269, height: 95})
+        done()
+      })
+    })
+
+    it('supports a quality option', (done) => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'))
+      image.resizeAsync({width: 100, height: 100, quality: 'fast'}, (resized) => {
+        assert.deepEqual(resized.getSize(), {width: 100, height: 100})
+        assert(!resized.isEmpty())
+        done()
+      })
+    })
   })
 
   describe('crop(bounds)', () => {
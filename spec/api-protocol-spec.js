@@ -2,6 +2,7 @@ const assert = require('assert')
 const http = require('http')
 const path = require('path')
 const qs = require('querystring')
+const stream = require('stream')
 const {closeWindow} = require('./window-helpers')
 const remote = require('electron').remote
 const {BrowserWindow, ipcMain, protocol, session, webContents} = remote
@@ -569,6 +570,110 @@ describe('protocol module', function () {
     })
   })
 
+  describe('protocol.registerStreamProtocol', function () {
+    it('sends Stream as response', function (done) {
+      var handler = function (request, callback) {
+        var data = new stream.PassThrough()
+        data.end(text)
+        callback(data)
+      }
+      protocol.registerStreamProtocol(protocolName, handler, function (error) {
+        if (error) {
+          return done(error)
+        }
+        $.ajax({
+          url: protocolName + '://fake-host',
+          cache: false,
+          success: function (data) {
+            assert.equal(data, text)
+            done()
+          },
+          error: function (xhr, errorType, error) {
+            done(error)
+          }
+        })
+      })
+    })
+
+    it('sends object with stream as response', function (done) {
+      var handler = function (request, callback) {
+        var data = new stream.PassThrough()
+        data.end(text)
+        callback({
+          statusCode: 200,
+          mimeType: 'text/plain',
+          data: data
+        })
+      }
+      protocol.registerStreamProtocol(protocolName, handler, function (error) {
+        if (error) {
+          return done(error)
+        }
+        $.ajax({
+          url: protocolName + '://fake-host',
+          cache: false,
+          success: function (data, status, request) {
+            assert.equal(request.status, 200)
+            assert.equal(data, text)
+            done()
+          },
+          error: function (xhr, errorType, error) {
+            done(error)
+          }
+        })
+      })
+    })
+
+    it('sends error when callback is called with nothing', function (done) {
+      var handler = function (request, callback) {
+        callback()
+      }
+      protocol.registerStreamProtocol(protocolName, handler, function (error) {
+        if (error) {
+          return done(error)
+        }
+        $.ajax({
+          url: protocolName + '://fake-host',
+          cache: false,
+          success: function () {
+            done('request succeeded but it should not')
+          },
+          error: function (xhr, errorType) {
+            assert.equal(errorType, 'error')
+            done()
+          }
+        })
+      })
+    })
+
+    it('fails when stream emits error in the middle of response', function (done) {
+      var handler = function (request, callback) {
+        var data = new stream.PassThrough()
+        callback(data)
+        data.write(text)
+        setTimeout(function () {
+          data.emit('error', new Error('stream failed'))
+        }, 50)
+      }
+      protocol.registerStreamProtocol(protocolName, handler, function (error) {
+        if (error) {
+          return done(error)
+        }
+        $.ajax({
+          url: protocolName + '://fake-host',
+          cache: false,
+          success: function () {
+            done('request succeeded but it should not')
+          },
+          error: function (xhr, errorType) {
+            assert.equal(errorType, 'error')
+            done()
+          }
+        })
+      })
+    })
+  })
+
   describe('protocol.isProtocolHandled', function () {
     it('returns true for about:', function (done) {
       protocol.isProtocolHandled('about', function (result) {
@@ -899,6 +1004,58 @@ describe('protocol module', function () {
     })
   })
 
+  describe('protocol.interceptStreamProtocol', function () {
+    it('can intercept http protocol', function (done) {
+      var handler = function (request, callback) {
+        var data = new stream.PassThrough()
+        data.end(text)
+        callback(data)
+      }
+      protocol.interceptStreamProtocol('http', handler, function (error) {
+        if (error) {
+          return done(error)
+        }
+        $.ajax({
+          url: 'http://fake-host',
+          cache: false,
+          success: function (data) {
+            assert.equal(data, text)
+            done()
+          },
+          error: function (xhr, errorType, error) {
+            done(error)
+          }
+        })
+      })
+    })
+
+    it('can receive post data', function (done) {
+      var handler = function (request, callback) {
+        var data = new stream.PassThrough()
+        data.end(request.uploadData[0].bytes.toString())
+        callback(data)
+      }
+      protocol.interceptStreamProtocol('http', handler, function (error) {
+        if (error) {
+          return done(error)
+        }
+        $.ajax({
+          url: 'http://fake-host',
+          cache: false,
+          type: 'POST',
+          data: postData,
+          success: function (data) {
+            assert.deepEqual(qs.parse(data), postData)
+            done()
+          },
+          error: function (xhr, errorType, error) {
+            done(error)
+          }
+        })
+      })
+    })
+  })
+
   describe('protocol.uninterceptProtocol', function () {
     it('returns error when scheme does not exist', function (done) {
       protocol.uninterceptProtocol('not-exist', function (error) {
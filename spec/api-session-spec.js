@@ -163,6 +163,58 @@ describe('session module', function () {
       })
     })
 
+    it('should set cookies in a batch', function (done) {
+      session.defaultSession.cookies.setMany([
+        {url: url, name: 'batch1', value: 'a'},
+        {url: url, name: 'batch2', value: 'b'}
+      ], function (error) {
+        if (error) {
+          return done(error)
+        }
+        session.defaultSession.cookies.get({
+          url: url
+        }, function (error, list) {
+          if (error) {
+            return done(error)
+          }
+          var values = {}
+          for (var i = 0, len = list.length; i < len; i++) {
+            values[list[i].name] = list[i].value
+          }
+          assert.equal(values['batch1'], 'a')
+          assert.equal(values['batch2'], 'b')
+          done()
+        })
+      })
+    })
+
+    it('should get cookies for multiple filters in a batch', function (done) {
+      session.defaultSession.cookies.setMany([
+        {url: url, name: 'many1', value: '1'},
+        {url: url, name: 'many2', value: '2'}
+      ], function (error) {
+        if (error) {
+          return done(error)
+        }
+        session.defaultSession.cookies.getMany([
+          {url: url, name: 'many1'},
+          {url: url, name: 'many2'},
+          {url: url, name: 'no-such-cookie'}
+        ], function (error, lists) {
+          if (error) {
+            return done(error)
+          }
+          assert.equal(lists.length, 3)
+          assert.equal(lists[0].length, 1)
+          assert.equal(lists[0][0].value, '1')
+          assert.equal(lists[1].length, 1)
+          assert.equal(lists[1][0].value, '2')
+          assert.equal(lists[2].length, 0)
+          done()
+        })
+      })
+    })
+
     it('should set cookie for standard scheme', function (done) {
       const standardScheme = remote.getGlobal('standardScheme')
       const origin = standardScheme + '://fake-host'
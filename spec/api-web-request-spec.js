@@ -457,4 +457,112 @@ describe('webRequest module', function () {
       })
     })
   })
+
+  describe('webRequest.setRules', function () {
+    afterEach(function () {
+      ses.webRequest.setRules(null)
+    })
+
+    it('blocks matching requests and leaves others alone', function (done) {
+      ses.webRequest.setRules([
+        {urls: [defaultURL + 'filter/*'], action: 'block'}
+      ])
+      $.ajax({
+        url: defaultURL + 'nofilter/test',
+        success: function (data) {
+          assert.equal(data, '/nofilter/test')
+          $.ajax({
+            url: defaultURL + 'filter/test',
+            success: function () {
+              done('unexpected success')
+            },
+            error: function () {
+              done()
+            }
+          })
+        },
+        error: function (xhr, errorType) {
+          done(errorType)
+        }
+      })
+    })
+
+    it('can redirect matching requests', function (done) {
+      ses.webRequest.setRules([
+        {
+          urls: [defaultURL + 'redirect-me/*'],
+          action: 'redirect',
+          redirectURL: defaultURL + 'redirected'
+        }
+      ])
+      $.ajax({
+        url: defaultURL + 'redirect-me/test',
+        success: function (data) {
+          assert.equal(data, '/redirected')
+          done()
+        },
+        error: function (xhr, errorType) {
+          done(errorType)
+        }
+      })
+    })
+
+    it('can set request headers without calling a listener', function (done) {
+      ses.webRequest.setRules([
+        {
+          urls: [defaultURL + '*'],
+          action: 'setRequestHeaders',
+          requestHeaders: {Accept: '*/*;test/header'}
+        }
+      ])
+      $.ajax({
+        url: defaultURL,
+        success: function (data) {
+          assert.equal(data, '/header/received')
+          done()
+        },
+        error: function (xhr, errorType) {
+          done(errorType)
+        }
+      })
+    })
+  })
+
+  describe('webRequest.setQoS', function () {
+    afterEach(function () {
+      ses.webRequest.setQoS(null)
+    })
+
+    it('completes matching and non-matching requests normally', function (done) {
+      ses.webRequest.setQoS([
+        {urls: [defaultURL + 'important/*'], priority: 'highest'},
+        {urls: [defaultURL + 'background/*'], priority: 'idle'}
+      ])
+      $.ajax({
+        url: defaultURL + 'important/test',
+        success: function (data) {
+          assert.equal(data, '/important/test')
+          $.ajax({
+            url: defaultURL + 'unclassified/test',
+            success: function (data) {
+              assert.equal(data, '/unclassified/test')
+              done()
+            },
+            error: function (xhr, errorType) {
+              done(errorType)
+            }
+          })
+        },
+        error: function (xhr, errorType) {
+          done(errorType)
+        }
+      })
+    })
+
+    it('throws when called with neither null nor an Array', function () {
+      assert.throws(function () {
+        ses.webRequest.setQoS('not-an-array')
+      })
+    })
+  })
 })
@@ -0,0 +1,59 @@
+// Cold and warm read throughput from an asar archive. The cold pass pays
+// for opening the archive and parsing its header; warm passes hit the
+// cached archive object and measure raw extraction cost. Runs before
+// anything else touches the fixture archive so the cold number is honest.
+
+const fs = require('fs')
+const path = require('path')
+const {elapsedMs} = require('../stats')
+
+const WARM_PASSES = 20
+
+const archivePath = path.join(
+  __dirname, '..', '..', 'fixtures', 'asar', 'web.asar')
+
+function listFiles (dir) {
+  let files = []
+  for (const name of fs.readdirSync(dir)) {
+    const fullPath = path.join(dir, name)
+    if (fs.statSync(fullPath).isDirectory()) {
+      files = files.concat(listFiles(fullPath))
+    } else {
+      files.push(fullPath)
+    }
+  }
+  return files
+}
+
+function readAll (files) {
+  let bytes = 0
+  for (const file of files) {
+    bytes += fs.readFileSync(file).length
+  }
+  return bytes
+}
+
+module.exports = function () {
+  const coldStart = process.hrtime()
+  const files = listFiles(archivePath)
+  const bytes = readAll(files)
+  const coldMs = elapsedMs(coldStart)
+
+  let warmMs = 0
+  for (let i = 0; i < WARM_PASSES; ++i) {
+    const warmStart = process.hrtime()
+    readAll(files)
+    warmMs += elapsedMs(warmStart)
+  }
+  warmMs /= WARM_PASSES
+
+  return Promise.resolve({
+    archive: path.basename(archivePath),
+    files: files.length,
+    bytes: bytes,
+    coldMs: coldMs,
+    warmMs: warmMs,
+    coldBytesPerSec: bytes / (coldMs / 1e3),
+    warmBytesPerSec: bytes / (warmMs / 1e3)
+  })
+}
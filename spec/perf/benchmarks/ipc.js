@@ -0,0 +1,42 @@
+// Round-trip latency of asynchronous ipc between the main process and a
+// real renderer (ipcMain <-> ipcRenderer, backed by atom_api_renderer_ipc
+// on the renderer side). Each sample is one main -> renderer -> main round
+// trip, issued sequentially so samples do not overlap.
+
+const {BrowserWindow, ipcMain} = require('electron')
+const path = require('path')
+const url = require('url')
+const {elapsedMs, summarize} = require('../stats')
+
+const ROUND_TRIPS = 2000
+
+module.exports = function () {
+  return new Promise((resolve) => {
+    const win = new BrowserWindow({show: false})
+    win.loadURL(url.format({
+      protocol: 'file',
+      slashes: true,
+      pathname: path.join(__dirname, '..', 'fixtures', 'ipc.html')
+    }))
+
+    const samples = []
+    let start = null
+
+    ipcMain.on('perf-pong', function listener () {
+      samples.push(elapsedMs(start))
+      if (samples.length === ROUND_TRIPS) {
+        ipcMain.removeListener('perf-pong', listener)
+        win.destroy()
+        resolve({roundTrips: ROUND_TRIPS, latencyMs: summarize(samples)})
+      } else {
+        start = process.hrtime()
+        win.webContents.send('perf-ping')
+      }
+    })
+
+    win.webContents.once('did-finish-load', () => {
+      start = process.hrtime()
+      win.webContents.send('perf-ping')
+    })
+  })
+}
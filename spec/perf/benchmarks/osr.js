@@ -0,0 +1,47 @@
+// Frame delivery rate of offscreen rendering. An animating page keeps the
+// compositor busy; we count 'paint' events on the offscreen WebContents
+// over a fixed window, starting from the first delivered frame so load
+// time does not dilute the rate.
+
+const {BrowserWindow} = require('electron')
+const path = require('path')
+const url = require('url')
+
+const MEASURE_MS = 5000
+const TARGET_FRAME_RATE = 60
+
+module.exports = function () {
+  return new Promise((resolve) => {
+    const win = new BrowserWindow({
+      show: false,
+      webPreferences: {
+        offscreen: true
+      }
+    })
+    win.webContents.setFrameRate(TARGET_FRAME_RATE)
+    win.loadURL(url.format({
+      protocol: 'file',
+      slashes: true,
+      pathname: path.join(__dirname, '..', 'fixtures', 'osr.html')
+    }))
+
+    let frames = 0
+    let measuring = false
+    win.webContents.on('paint', () => {
+      if (!measuring) {
+        measuring = true
+        setTimeout(() => {
+          win.destroy()
+          resolve({
+            targetFrameRate: TARGET_FRAME_RATE,
+            durationMs: MEASURE_MS,
+            frames: frames,
+            framesPerSec: frames / (MEASURE_MS / 1e3)
+          })
+        }, MEASURE_MS)
+        return
+      }
+      ++frames
+    })
+  })
+}
@@ -0,0 +1,83 @@
+// Per-event-type overhead of webRequest interception (atom_network_delegate
+// on the browser side). A local HTTP server serves a tiny body; a renderer
+// fetches it in a sequential loop first with no listeners installed
+// (baseline) and then with a single listener for each event type in turn.
+// The difference against the baseline distribution is the cost of routing
+// that event through the JS listener.
+
+const {BrowserWindow, ipcMain, session} = require('electron')
+const http = require('http')
+const path = require('path')
+const url = require('url')
+const {summarize} = require('../stats')
+
+const REQUESTS_PER_CONFIG = 200
+
+// Blocking events answer through their callback, observing events do not.
+const eventTypes = [
+  ['onBeforeRequest', (details, callback) => callback({})],
+  ['onBeforeSendHeaders',
+    (details, callback) => callback({requestHeaders: details.requestHeaders})],
+  ['onSendHeaders', () => {}],
+  ['onHeadersReceived',
+    (details, callback) => callback({responseHeaders: details.responseHeaders})],
+  ['onResponseStarted', () => {}],
+  ['onCompleted', () => {}]
+]
+
+function clearListeners (webRequest) {
+  for (const [name] of eventTypes) {
+    webRequest[name](null)
+  }
+}
+
+module.exports = function () {
+  return new Promise((resolve) => {
+    const server = http.createServer((request, response) => {
+      response.end('perf')
+    })
+    server.listen(0, '127.0.0.1', () => {
+      const serverUrl = `http://127.0.0.1:${server.address().port}/`
+      const webRequest = session.defaultSession.webRequest
+      const win = new BrowserWindow({show: false})
+      const results = {}
+
+      const measure = (callback) => {
+        ipcMain.once('perf-fetch-done', (event, timings) => {
+          callback(summarize(timings))
+        })
+        win.webContents.send('perf-fetch', serverUrl, REQUESTS_PER_CONFIG)
+      }
+
+      const configs = [['baseline', null]].concat(eventTypes)
+      const runNext = (index) => {
+        if (index === configs.length) {
+          clearListeners(webRequest)
+          win.destroy()
+          server.close()
+          resolve({
+            requestsPerConfig: REQUESTS_PER_CONFIG,
+            requestMs: results
+          })
+          return
+        }
+        const [name, listener] = configs[index]
+        clearListeners(webRequest)
+        if (listener != null) {
+          webRequest[name](listener)
+        }
+        measure((summary) => {
+          results[name] = summary
+          runNext(index + 1)
+        })
+      }
+
+      win.loadURL(url.format({
+        protocol: 'file',
+        slashes: true,
+        pathname: path.join(__dirname, '..', 'fixtures', 'fetch.html')
+      }))
+      win.webContents.once('did-finish-load', () => runNext(0))
+    })
+  })
+}
@@ -0,0 +1,37 @@
+// Window-open time: BrowserWindow construction through 'did-finish-load'
+// of a trivial page, sampled over several windows opened one at a time.
+// Covers native window creation, renderer startup and the first load.
+
+const {BrowserWindow} = require('electron')
+const path = require('path')
+const url = require('url')
+const {elapsedMs, summarize} = require('../stats')
+
+const WINDOWS = 10
+
+const pageUrl = url.format({
+  protocol: 'file',
+  slashes: true,
+  pathname: path.join(__dirname, '..', 'fixtures', 'blank.html')
+})
+
+module.exports = function () {
+  return new Promise((resolve) => {
+    const samples = []
+    const openNext = () => {
+      const start = process.hrtime()
+      const win = new BrowserWindow({show: false})
+      win.webContents.once('did-finish-load', () => {
+        samples.push(elapsedMs(start))
+        win.destroy()
+        if (samples.length === WINDOWS) {
+          resolve({windows: WINDOWS, openMs: summarize(samples)})
+        } else {
+          openNext()
+        }
+      })
+      win.loadURL(pageUrl)
+    }
+    openNext()
+  })
+}
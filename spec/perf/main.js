@@ -0,0 +1,60 @@
+// End-to-end latency harness. Boots real BrowserWindows and measures the
+// Electron layer itself - ipc round trips, asar reads, webRequest
+// interception, offscreen frame delivery and window-open time - emitting
+// machine-readable JSON so numbers can be compared across releases.
+//
+// Run against a built binary:
+//
+//   electron spec/perf [--output=results.json]
+//
+// Without --output the JSON goes to stdout.
+
+const {app} = require('electron')
+const fs = require('fs')
+
+const benchmarks = [
+  ['ipc', require('./benchmarks/ipc')],
+  ['asar', require('./benchmarks/asar')],
+  ['webRequest', require('./benchmarks/web-request')],
+  ['osr', require('./benchmarks/osr')],
+  ['windowOpen', require('./benchmarks/window-open')]
+]
+
+let outputPath = null
+for (const arg of process.argv.slice(1)) {
+  if (arg.startsWith('--output=')) {
+    outputPath = arg.substr('--output='.length)
+  }
+}
+
+app.commandLine.appendSwitch('disable-renderer-backgrounding')
+
+app.once('ready', function () {
+  const results = {
+    timestamp: new Date().toISOString(),
+    versions: process.versions,
+    platform: process.platform,
+    arch: process.arch,
+    metrics: {}
+  }
+
+  let chain = Promise.resolve()
+  for (const [name, run] of benchmarks) {
+    chain = chain.then(() => run()).then((result) => {
+      results.metrics[name] = result
+    })
+  }
+
+  chain.then(() => {
+    const json = JSON.stringify(results, null, 2)
+    if (outputPath) {
+      fs.writeFileSync(outputPath, json + '\n')
+    } else {
+      process.stdout.write(json + '\n')
+    }
+    app.exit(0)
+  }).catch((error) => {
+    process.stderr.write(error.stack + '\n')
+    app.exit(1)
+  })
+})
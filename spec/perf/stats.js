@@ -0,0 +1,25 @@
+// Small helpers shared by the benchmarks: high-resolution elapsed time and
+// distribution summaries. Latency numbers are reported as distributions,
+// not averages, because regressions usually show up in the tail first.
+
+exports.elapsedMs = function (start) {
+  const diff = process.hrtime(start)
+  return diff[0] * 1e3 + diff[1] / 1e6
+}
+
+exports.summarize = function (samples) {
+  const sorted = samples.slice().sort((a, b) => a - b)
+  const total = sorted.reduce((sum, value) => sum + value, 0)
+  const percentile = function (p) {
+    return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))]
+  }
+  return {
+    count: sorted.length,
+    mean: total / sorted.length,
+    min: sorted[0],
+    max: sorted[sorted.length - 1],
+    p50: percentile(0.5),
+    p95: percentile(0.95),
+    p99: percentile(0.99)
+  }
+}